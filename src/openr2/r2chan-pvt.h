@@ -114,15 +114,21 @@ typedef struct openr2_chan_s {
 	/* I/O device fd */
 	openr2_io_fd_t fd;
 
-	/* I/O buffer size */
+	/* I/O buffer size, in samples */
 	int io_buf_size;
 
+	/* sample format of the I/O device media */
+	openr2_io_format_t io_format;
+
 	/* I/O device number */
 	int number;
 
 	/* to read or not to read, that is the question */
 	int read_enabled;
 
+	/* something took the media the last time the channel was processed */
+	int reading_media;
+
 	/* forward, backward or stopped.  */
 	openr2_direction_t direction;
 
@@ -164,6 +170,13 @@ typedef struct openr2_chan_s {
 	/* signal being checked for persistence */
 	int cas_persistence_check_signal;
 
+	/* raw CAS signal read along with the rest of the span, -1 if none */
+	int span_cas_read;
+
+	/* raw CAS signal to be written along with the rest of the span, -1 if
+	   the CAS is written right away */
+	int span_cas_write;
+
 	/* Meaning of last R2 signal read on this channel */
 	openr2_cas_signal_t cas_rx_signal;
 
@@ -214,6 +227,13 @@ typedef struct openr2_chan_s {
 	int detecting_dtmf;
 	int dtmf_silence_samples;
 
+	/* DTMF detector running on the answered call audio, -1 if it could not be started */
+	int detecting_call_dtmf;
+
+	/* call progress tone detector running on the outgoing call audio */
+	int detecting_cpt;
+	openr2_cpt_rx_state_t cpt_rx;
+
 	/* default DTMF tone generation handle */
 	openr2_dtmf_tx_state_t default_dtmf_write_handle;
 
@@ -258,6 +278,9 @@ typedef struct openr2_chan_s {
 
 	/* call file logging */
 	int call_files;
+
+	/* DTMF detection on the answered call audio */
+	int call_dtmf;
 	long call_count;
 	char logname[512];
 	FILE *logfile;
@@ -48,6 +48,27 @@ OR2_DECLARE(openr2_chan_t *) openr2_chan_new(openr2_context_t *r2context, int ch
 /*! \brief allocate and initialize a new channel and associates the given I/O descriptor to it */
 OR2_DECLARE(openr2_chan_t *) openr2_chan_new_from_fd(openr2_context_t *r2context, openr2_io_fd_t chanfd, int channo);
 
+/*! \brief allocate and initialize the channels of a whole span, opening them at once when the I/O
+ * interface can do it. r2chans is filled in the order of channos, that order must be kept when
+ * passing the channels to the other span routines */
+OR2_DECLARE(int) openr2_chan_new_span(openr2_context_t *r2context, int span_id, const int channos[], openr2_chan_t *r2chans[], int numchans);
+
+/*! \brief read the CAS bits of every channel of a span, in a single I/O operation when possible,
+ * and handle the changes */
+OR2_DECLARE(int) openr2_chan_process_span_cas(openr2_chan_t *r2chans[], int numchans);
+
+/*! \brief check the alarm state of a span once and handle it on every channel */
+OR2_DECLARE(int) openr2_chan_process_span_alarm(openr2_chan_t *r2chans[], int numchans);
+
+/*! \brief set every channel of a span to IDLE or BLOCKED, writing all the CAS bits at once when possible */
+OR2_DECLARE(int) openr2_chan_set_span_idle(openr2_chan_t *r2chans[], int numchans);
+OR2_DECLARE(int) openr2_chan_set_span_blocked(openr2_chan_t *r2chans[], int numchans);
+
+/*! \brief wait up to timeout ms (-1 forever) for media to read or an event on any channel of a span,
+ * starting the I/O of all of them at once when the I/O interface can do it. Returns on how many
+ * channels there is something to process, 0 on timeout or -1 on failure */
+OR2_DECLARE(int) openr2_chan_wait_span(openr2_chan_t *r2chans[], int numchans, int timeout);
+
 /*! \brief destroys the memory allocated when creating the channel
  * no need to call this function if the channel is already associated to a context, 
  * the context destruction will delete the channels associated to it 
@@ -104,7 +125,8 @@ OR2_DECLARE(openr2_log_level_t) openr2_chan_set_log_level(openr2_chan_t *r2chan,
 /*! \brief Return the logging level for the channel */
 OR2_DECLARE(openr2_log_level_t) openr2_chan_get_log_level(openr2_chan_t *r2chan);
 
-/*! \brief Enable the media reading for the channel, the stack will call the I/O read operation when needed */
+/*! \brief Enable the media reading for the channel, the stack will call the I/O read operation when needed,
+ * that is while it detects tones on the channel or the call is answered. Media received meanwhile is dropped */
 OR2_DECLARE(void) openr2_chan_enable_read(openr2_chan_t *r2chan);
 
 /*! \brief Disable the media reading for the channel, the stack will NOT call the I/O read operation when needed */
@@ -122,6 +144,16 @@ OR2_DECLARE(void) openr2_chan_disable_call_files(openr2_chan_t *r2chan);
 /*! \brief return non-zero if the call debugging files are enabled for this channel */
 OR2_DECLARE(int) openr2_chan_get_call_files_enabled(openr2_chan_t *r2chan);
 
+/*! \brief enable the DTMF detection on the audio of answered calls for this channel,
+    the digits are reported through the on_call_dtmf event */
+OR2_DECLARE(void) openr2_chan_enable_call_dtmf(openr2_chan_t *r2chan);
+
+/*! \brief disable the DTMF detection on the audio of answered calls for this channel */
+OR2_DECLARE(void) openr2_chan_disable_call_dtmf(openr2_chan_t *r2chan);
+
+/*! \brief return non-zero if the DTMF detection on answered calls is enabled for this channel */
+OR2_DECLARE(int) openr2_chan_get_call_dtmf_enabled(openr2_chan_t *r2chan);
+
 /*! \brief get the DNIS in the channel */
 OR2_DECLARE(const char *) openr2_chan_get_dnis(openr2_chan_t *r2chan);
 
@@ -182,6 +214,10 @@ OR2_DECLARE(int) openr2_chan_get_tx_mf_signal(openr2_chan_t *r2chan);
 /*! \brief return the ASCII code for the last received MF signal */
 OR2_DECLARE(int) openr2_chan_get_rx_mf_signal(openr2_chan_t *r2chan);
 
+/*! \brief get the MF signal quality measured so far in the current call,
+    returns -1 if the MF statistics are disabled or the built-in MF detector is not in use */
+OR2_DECLARE(int) openr2_chan_get_mf_stats(openr2_chan_t *r2chan, openr2_mf_rx_stats_t *stats);
+
 /*! \brief set the opaque handle that will be passed back to the DTMF callbacks */
 OR2_DECLARE(int) openr2_chan_set_dtmf_handles(openr2_chan_t *r2chan, void *dtmf_read_handle, void *dtmf_write_handle);
 
@@ -76,6 +76,9 @@ typedef enum r2context_flags_e {
 	 * otherwise the application needs to acknowledge
 	 * explicitly */
 	OR2_AUTO_SEIZE_ACK = (1 << 2),
+	/* The built-in A-law transcoder is in use, so MF and DTMF
+	 * detectors may decode A-law samples by themselves */
+	OR2_DEFAULT_TRANSCODER = (1 << 3),
 } r2context_flags_t;
 
 /* R2 library context. Holds the R2 channel list,
@@ -167,6 +170,41 @@ typedef struct openr2_context_s {
 	/* How much time the dtmf engine should be OFF between digits */
 	int dtmf_off;
 
+	/* arithmetic used by the built-in MF and DTMF detectors */
+	openr2_dsp_engine_t dsp_engine;
+
+	/* let the built-in MF detector decide several times per block */
+	int mf_sliding_detection;
+
+	/* let the built-in MF detector follow just the tone it found, and only
+	   accept the tones valid for the current MF group */
+	int mf_tracking_detection;
+
+	/* let the built-in MF detector measure the signal quality of the digits */
+	int mf_stats;
+
+	/* look for call progress tones on the audio of outgoing calls */
+	int call_progress_detection;
+
+	/* call progress tones of the variant */
+	openr2_cpt_config_t cpt;
+
+	/* ask the Zaptel or DAHDI I/O for signed linear media instead of A-law */
+	int linear_io;
+
+	/* loopback channels opened by this context do not wait 20ms between
+	   frames, just for the far end to read */
+	int loopback_free_running;
+
+	/* unix socket of the user space driver of the shared memory I/O */
+	char shm_socket[OR2_MAX_PATH];
+
+	/* I/O interface doing all but the media for OR2_IO_URING */
+	openr2_io_interface_t *uring_base;
+
+	/* io_uring of the channels of the context, while there are any */
+	struct openr2_uring_s *uring;
+
 	/* R2 logging mask */
 	openr2_log_level_t loglevel;
 
@@ -36,6 +36,11 @@ extern "C" {
 
 #define OR2_MAX_PATH 255
 
+/* The interface structures below are allocated by the application and the
+   library keeps pointers to them. New members go at the end, and the
+   library version is bumped whenever any of them grows, so applications
+   built against the smaller structures are not loaded with this library */
+
 /* MF interface */
 typedef void *(*openr2_mf_read_init_func)(void *read_handle, int forward_signals);
 typedef void *(*openr2_mf_write_init_func)(void *write_handle, int forward_signals);
@@ -45,6 +50,9 @@ typedef int (*openr2_mf_select_tone_func)(void *write_handle, char signal);
 typedef int (*openr2_mf_want_generate_func)(void *write_handle, int signal);
 typedef void (*openr2_mf_read_dispose_func)(void *read_handle);
 typedef void (*openr2_mf_write_dispose_func)(void *write_handle);
+typedef int (*openr2_mf_detect_tone_alaw_func)(void *read_handle, const uint8_t buffer[], int samples);
+typedef int (*openr2_mf_detect_tone_multi_func)(void *read_handles[], const int16_t *buffers[], int samples, int tones[], int handles);
+typedef int (*openr2_mf_generate_tone_alaw_func)(void *write_handle, uint8_t buffer[], int samples);
 typedef struct {
 	/* init routines to detect and generate tones */
 	openr2_mf_read_init_func mf_read_init;
@@ -63,8 +71,50 @@ typedef struct {
 	/* routines to dispose resources allocated by handles. (optional) */
 	openr2_mf_read_dispose_func mf_read_dispose;
 	openr2_mf_write_dispose_func mf_write_dispose;
+
+	/* detect tones on several read handles at once, one buffer and one resulting tone per handle (optional) */
+	openr2_mf_detect_tone_multi_func mf_detect_tone_multi;
+
+	/* detect tones straight from A-law samples, used instead of mf_detect_tone()
+	   when the default transcoder is in use (optional) */
+	openr2_mf_detect_tone_alaw_func mf_detect_tone_alaw;
+
+	/* generate tones straight as A-law samples, used instead of mf_generate_tone()
+	   when the default transcoder is in use (optional) */
+	openr2_mf_generate_tone_alaw_func mf_generate_tone_alaw;
 } openr2_mflib_interface_t;
 
+/* Signal quality of a digit seen by the built-in MF detector. The margins
+   are in dB over the limits of the detector, the smaller they are the closer
+   the digit came to be rejected: level_margin is the weakest tone over the
+   minimum level, twist_margin is how far the twist between both tones is
+   from the maximum twist, and relative_peak_margin is how much the weakest
+   tone stands over the strongest of the other frequencies, beyond what the
+   detector asks for. Over the blocks a digit lasts, the weakest figures are
+   kept. Durations are in samples */
+typedef struct {
+	char digit;
+	/* energies of the strongest and the weakest tone */
+	float peak_energy;
+	float second_peak_energy;
+	float level_margin;
+	float twist_margin;
+	float relative_peak_margin;
+	/* how long the digit was on, and the silence before it */
+	int on_samples;
+	int off_samples;
+} openr2_mf_digit_stats_t;
+
+typedef struct {
+	/* digits received since the statistics were started, counted once they end */
+	int digits;
+	/* the last digit received */
+	openr2_mf_digit_stats_t last;
+	/* the worst figures over all the digits, the lowest energies and margins
+	   and the shortest durations. The digit is the one with the smallest margin */
+	openr2_mf_digit_stats_t worst;
+} openr2_mf_rx_stats_t;
+
 /* Event Management interface. Users should provide
    this interface to handle library events like call starting, new call, read audio etc. */
 typedef void (*openr2_handle_new_call_func)(openr2_chan_t *r2chan);
@@ -83,6 +133,9 @@ typedef void (*openr2_handle_line_blocked_func)(openr2_chan_t *r2chan);
 typedef void (*openr2_handle_line_idle_func)(openr2_chan_t *r2chan);
 typedef void (*openr2_handle_billing_pulse_received_func)(openr2_chan_t *r2chan);
 typedef void (*openr2_handle_call_log_created_func)(openr2_chan_t *r2chan, const char *name);
+typedef void (*openr2_handle_call_mf_stats_func)(openr2_chan_t *r2chan, const openr2_mf_rx_stats_t *stats);
+typedef void (*openr2_handle_call_dtmf_func)(openr2_chan_t *r2chan, char digit);
+typedef void (*openr2_handle_call_progress_tone_func)(openr2_chan_t *r2chan, openr2_cpt_tone_t tone);
 typedef int (*openr2_handle_dnis_digit_received_func)(openr2_chan_t *r2chan, char digit);
 typedef void (*openr2_handle_ani_digit_received_func)(openr2_chan_t *r2chan, char digit);
 typedef void (*openr2_handle_context_logging_func)(openr2_context_t *r2context, const char *file, const char *function, unsigned int line, openr2_log_level_t level, const char *fmt, va_list ap);
@@ -145,8 +198,28 @@ typedef struct {
 
 	/* New call log was created */
 	openr2_handle_call_log_created_func on_call_log_created;
+
+	/* MF signal quality of the call that just ended, only when the MF
+	   statistics are enabled and the built-in MF detector is in use */
+	openr2_handle_call_mf_stats_func on_call_mf_stats;
+
+	/* DTMF digit detected on the audio of an answered call, only when
+	   the in-call DTMF detection is enabled for the channel */
+	openr2_handle_call_dtmf_func on_call_dtmf;
+
+	/* call progress tone heard on the audio of an outgoing call, once per
+	   tone and call, only when the call progress detection is enabled */
+	openr2_handle_call_progress_tone_func on_call_progress_tone;
 } openr2_event_interface_t;
 
+/* Sample format of the media of an I/O back end. With signed linear media
+   the MF and DTMF detectors and generators skip the A-law transcoding, the
+   audio handed to on_call_read and taken by openr2_chan_write is still A-law */
+typedef enum {
+	OR2_IO_FORMAT_ALAW = 0, /* one A-law byte per sample (default) */
+	OR2_IO_FORMAT_SLINEAR /* one signed 16 bit sample in host byte order */
+} openr2_io_format_t;
+
 typedef openr2_io_fd_t (*openr2_io_open_func)(openr2_context_t* r2context, int channo);
 typedef int (*openr2_io_close_func)(openr2_chan_t *r2chan);
 typedef int (*openr2_io_set_cas_func)(openr2_chan_t *r2chan, int cas);
@@ -158,6 +231,35 @@ typedef int (*openr2_io_setup_func)(openr2_chan_t *r2chan);
 typedef int (*openr2_io_wait_func)(openr2_chan_t *r2chan, int *flags, int block);
 typedef int (*openr2_io_get_oob_event_func)(openr2_chan_t *r2chan, openr2_oob_event_t *event);
 typedef int (*openr2_io_get_alarm_state_func)(openr2_chan_t *r2chan, int *alarm);
+typedef openr2_io_format_t (*openr2_io_get_format_func)(openr2_chan_t *r2chan);
+typedef int (*openr2_io_peek_func)(openr2_chan_t *r2chan, const void **buf, int size);
+typedef int (*openr2_io_consume_func)(openr2_chan_t *r2chan, int size);
+typedef int (*openr2_io_flush_read_buffers_func)(openr2_chan_t *r2chan);
+
+/* Span I/O. Optional extension of the I/O interface for back ends that can
+   handle all the timeslots of a span at once. The channels of a span are
+   given in the same order they were opened, any member may be NULL and the
+   per channel routines are used then */
+typedef int (*openr2_io_span_open_func)(openr2_context_t *r2context, int span_id, const int channos[], openr2_io_fd_t fds[], int numchans);
+typedef int (*openr2_io_span_set_cas_func)(openr2_chan_t *r2chans[], const int cas[], int numchans);
+typedef int (*openr2_io_span_get_cas_func)(openr2_chan_t *r2chans[], int cas[], int numchans);
+typedef int (*openr2_io_span_get_alarm_state_func)(openr2_chan_t *r2chans[], int numchans, int *alarm);
+typedef int (*openr2_io_span_wait_func)(openr2_chan_t *r2chans[], int numchans, int timeout);
+typedef struct {
+	/* open and setup every channel of the span, filling fds */
+	openr2_io_span_open_func open;
+	/* write the CAS bits of every channel */
+	openr2_io_span_set_cas_func set_cas;
+	/* read the CAS bits of every channel */
+	openr2_io_span_get_cas_func get_cas;
+	/* alarm state of the span */
+	openr2_io_span_get_alarm_state_func get_alarm_state;
+	/* start the I/O queued by the channels and wait up to timeout ms (-1
+	   forever) for media to read or an event on any of them, returns on how
+	   many channels there is, or -1 on failure */
+	openr2_io_span_wait_func wait;
+} openr2_io_span_interface_t;
+
 typedef struct {
 	openr2_io_open_func open;
 	openr2_io_close_func close;
@@ -170,6 +272,21 @@ typedef struct {
 	openr2_io_wait_func wait;
 	openr2_io_get_oob_event_func get_oob_event;
 	openr2_io_get_alarm_state_func get_alarm_state;
+	/* sample format of the media read and written on the channel (optional,
+	   A-law when NULL). Asked once, right after the channel is created */
+	openr2_io_get_format_func get_format;
+	/* span level routines (optional) */
+	openr2_io_span_interface_t *span;
+	/* read in place (optional, both or none). peek points buf to up to size
+	   bytes of media ready to read where they already are and returns how
+	   many, or 0 to have them copied by read instead. The channel calls
+	   consume with that count once it is done with them */
+	openr2_io_peek_func peek;
+	openr2_io_consume_func consume;
+	/* drop the media received and not read yet (optional). Called when the
+	   channel starts reading again after a while, so it does not go
+	   through media that is long gone on the line */
+	openr2_io_flush_read_buffers_func flush_read_buffers;
 } openr2_io_interface_t;
 
 typedef enum {
@@ -177,17 +294,33 @@ typedef enum {
 	/* OR2_IO_OPENZAP (libopenzap I/O) */
 	/* OR2_IO_SANGOMA (libsangoma I/O) */
 	OR2_IO_ZT, /* Zaptel or DAHDI I/O */
+	OR2_IO_LOOPBACK, /* in-process virtual E1 trunks, the two channels opened with the same number are connected */
+	OR2_IO_SHM, /* shared memory rings of a user space TDM driver, see openr2/r2ioshm.h */
+	OR2_IO_URING, /* Zaptel or DAHDI I/O with the media of the context read and written through an io_uring,
+	                 the interface given to openr2_context_set_io_type() does the rest instead when not NULL */
 	OR2_IO_CUSTOM = 9 /* any unsupported vendor I/O (pika, digivoice, kohmp etc) */
 } openr2_io_type_t;
 
+/* Arithmetic used by the built-in MF and DTMF detectors */
+typedef enum {
+	OR2_DSP_FLOAT = 0, /* single precision floating point (default) */
+	OR2_DSP_FIXED_POINT /* integer only, for boards without a fast FPU */
+} openr2_dsp_engine_t;
+
 /* Transcoding interface. Users should provide this interface
    to provide transcoding services from linear to alaw and 
    viceversa */
 typedef int16_t (*openr2_alaw_to_linear_func)(uint8_t alaw);
 typedef uint8_t (*openr2_linear_to_alaw_func)(int linear);
+/* whole blocks of samples at once. Both are optional, when they are NULL
+   the per sample routines are called for each sample of the block */
+typedef void (*openr2_alaw_to_linear_block_func)(int16_t linear[], const uint8_t alaw[], int samples);
+typedef void (*openr2_linear_to_alaw_block_func)(uint8_t alaw[], const int16_t linear[], int samples);
 typedef struct {
 	openr2_alaw_to_linear_func alaw_to_linear;
 	openr2_linear_to_alaw_func linear_to_alaw;
+	openr2_alaw_to_linear_block_func alaw_to_linear_block;
+	openr2_linear_to_alaw_block_func linear_to_alaw_block;
 } openr2_transcoder_interface_t;
 
 
@@ -196,12 +329,14 @@ typedef void *(*openr2_dtmf_tx_init_func)(void *dtmf_write_handle);
 typedef void (*openr2_dtmf_tx_set_timing_func)(void *dtmf_write_handle, int on_time, int off_time);
 typedef int (*openr2_dtmf_tx_put_func)(void *dtmf_write_handle, const char *digits, int len);
 typedef int (*openr2_dtmf_tx_func)(void *dtmf_write_handle, int16_t amp[], int max_samples);
+typedef int (*openr2_dtmf_tx_alaw_func)(void *dtmf_write_handle, uint8_t alaw[], int max_samples);
 
 /* DTMF receiver part of the openr2_dtmf_interface_t */
 typedef void (*openr2_digits_rx_callback_t)(void *user_data, const char *digits, int len);
 typedef void *(*openr2_dtmf_rx_init_func)(void *dtmf_read_handle, openr2_digits_rx_callback_t callback, void *user_data);
 typedef int (*openr2_dtmf_rx_status_func)(void *dtmf_read_handle);
 typedef int (*openr2_dtmf_rx_func)(void *dtmf_read_handle, const int16_t amp[], int samples);
+typedef int (*openr2_dtmf_rx_alaw_func)(void *dtmf_read_handle, const uint8_t alaw[], int samples);
 
 typedef struct {
 	/* DTMF Transmitter */
@@ -214,6 +349,14 @@ typedef struct {
 	openr2_dtmf_rx_init_func dtmf_rx_init;
 	openr2_dtmf_rx_status_func dtmf_rx_status;
 	openr2_dtmf_rx_func dtmf_rx;
+
+	/* detect DTMF straight from A-law samples, used instead of dtmf_rx()
+	   when the default transcoder is in use (optional) */
+	openr2_dtmf_rx_alaw_func dtmf_rx_alaw;
+
+	/* generate DTMF straight as A-law samples, used instead of dtmf_tx()
+	   when the default transcoder is in use (optional) */
+	openr2_dtmf_tx_alaw_func dtmf_tx_alaw;
 } openr2_dtmf_interface_t;
 
 /* Library errors */
@@ -272,6 +415,23 @@ OR2_DECLARE(int) openr2_context_set_transcoder_interface(openr2_context_t *r2con
 OR2_DECLARE(void) openr2_context_set_max_dnis(openr2_context_t *r2context, int max_dnis);
 OR2_DECLARE(void) openr2_context_set_max_ani(openr2_context_t *r2context, int max_ani);
 OR2_DECLARE(void) openr2_context_set_auto_seize_ack(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_set_dsp_engine(openr2_context_t *r2context, openr2_dsp_engine_t engine);
+OR2_DECLARE(openr2_dsp_engine_t) openr2_context_get_dsp_engine(openr2_context_t *r2context);
+OR2_DECLARE(void) openr2_context_set_mf_sliding_detection(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_get_mf_sliding_detection(openr2_context_t *r2context);
+OR2_DECLARE(void) openr2_context_set_mf_tracking_detection(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_get_mf_tracking_detection(openr2_context_t *r2context);
+OR2_DECLARE(void) openr2_context_set_mf_stats(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_get_mf_stats(openr2_context_t *r2context);
+OR2_DECLARE(void) openr2_context_set_call_progress_detection(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_get_call_progress_detection(openr2_context_t *r2context);
+OR2_DECLARE(void) openr2_context_set_linear_io(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_get_linear_io(openr2_context_t *r2context);
+OR2_DECLARE(void) openr2_context_set_loopback_free_running(openr2_context_t *r2context, int enable);
+OR2_DECLARE(int) openr2_context_get_loopback_free_running(openr2_context_t *r2context);
+OR2_DECLARE(int) openr2_context_set_shm_socket(openr2_context_t *r2context, const char *path);
+OR2_DECLARE(char *) openr2_context_get_shm_socket(openr2_context_t *r2context, char *path, int len);
+OR2_DECLARE(int) openr2_context_set_cpt_cadence(openr2_context_t *r2context, openr2_cpt_tone_t tone, const openr2_cpt_cadence_t *cadence);
 
 #ifdef __OR2_COMPILING_LIBRARY__
 #undef openr2_chan_t 
@@ -43,6 +43,18 @@ extern "C" {
 
 #define OR2_MAX_DTMF_DIGITS 128
 
+/* Longest DTMF tone, in samples, the transmitter keeps rendered in A-law */
+#define OR2_DTMF_TX_MAX_RENDERED 800
+
+/* Number of staggered detection windows used by the MF sliding mode */
+#define OR2_MF_RX_WINDOWS 4
+
+/* Number of the last window decisions the MF sliding mode looks at */
+#define OR2_MF_RX_VOTES 3
+
+/* Samples in an MF detection block */
+#define OR2_MF_RX_BLOCK_SIZE 133
+
 typedef void (*tone_report_func_t)(void *user_data, int code, int level, int delay);
 
 typedef struct
@@ -98,17 +110,31 @@ typedef struct
     int current_sample;
 } openr2_goertzel_state_t;
 
+/*!
+    Fixed-point Goertzel filter state descriptor. The coefficient is Q30,
+    the filter state is kept in sixteenths of the sample units.
+*/
+typedef struct
+{
+    int32_t v2;
+    int32_t v3;
+    int32_t fac;
+} openr2_goertzel_fixed_state_t;
+
 /*!
     MFC/R2 tone generator descriptor.
 */
 struct openr2_mf_tx_state
 {
-    /*! The tone generator. */
-    openr2_tone_gen_state_t tone;
     /*! TRUE if generating forward tones, otherwise generating reverse tones. */
     int fwd;
     /*! The current digit being generated. */
     int digit;
+    /*! One period of the current digit, linear and A-law encoded. */
+    const int16_t *wave;
+    const uint8_t *alaw_wave;
+    /*! The next sample of the period to be sent. */
+    int wave_position;
 };
 
 /*!
@@ -124,6 +150,113 @@ struct openr2_mf_rx_state
     int current_sample;
     /*! The currently detected digit. */
     int current_digit;
+    /*! TRUE if the fixed-point detector is used instead of the floating point one */
+    int fixed_point;
+    /*! Fixed-point tone detector working states */
+    openr2_goertzel_fixed_state_t out_fixed[6];
+    /*! TRUE if the sliding mode is on. Besides out[], OR2_MF_RX_WINDOWS - 1 more
+        detection windows run staggered by a fraction of a block, so a decision
+        is taken several times per block */
+    int sliding;
+    /*! Working states of the extra sliding windows */
+    openr2_goertzel_state_t window_out[OR2_MF_RX_WINDOWS - 1][6];
+    openr2_goertzel_fixed_state_t window_out_fixed[OR2_MF_RX_WINDOWS - 1][6];
+    /*! The current sample number within each extra window, negative while a window waits to start */
+    int window_sample[OR2_MF_RX_WINDOWS - 1];
+    /*! The decisions of the last windows to end a block, oldest at
+        window_vote. In sliding mode they vote for current_digit */
+    int window_digits[OR2_MF_RX_VOTES];
+    int window_vote;
+    /*! Energy of the current block so far, per window (window 0 is out[]) */
+    int64_t energy[OR2_MF_RX_WINDOWS];
+    /*! TRUE while the current block of a window has been too weak to bother feeding its filters */
+    int gated[OR2_MF_RX_WINDOWS];
+    /*! The last block of samples, to catch up the filters of a window once it is no longer gated */
+    float history[OR2_MF_RX_BLOCK_SIZE];
+    int history_position;
+    /*! Detection blocks evaluated, and how many of them were skipped as silence */
+    unsigned long blocks;
+    unsigned long skipped_blocks;
+    /*! TRUE if the tracking mode is on. Once a digit is found, a window only runs
+        the two filters of that digit until the pair is no longer clearly there */
+    int tracking;
+    /*! TRUE while a window is tracking, and the two filters it is running */
+    int tracked[OR2_MF_RX_WINDOWS];
+    int track_bins[OR2_MF_RX_WINDOWS][2];
+    /*! Digits that may start now, one bit per tone, in "1234567890BCDEF" order */
+    int tone_mask;
+    /*! Samples run through the detector so far */
+    unsigned long samples;
+    /*! Minimum time, in samples, a digit and the silence must last before
+        they are reported. 0 reports them as soon as they are found */
+    int debounce_on;
+    int debounce_off;
+    /*! The digit reported, and the one waiting to last long enough to
+        replace it since the sample debounce_change */
+    int debounced_digit;
+    int debounce_digit;
+    unsigned long debounce_change;
+    /*! TRUE if the signal quality of the digits is being measured */
+    int stats_enabled;
+    /*! The sample where the current digit (or silence) started */
+    unsigned long stats_change;
+    /*! The figures of the digit being received */
+    openr2_mf_digit_stats_t stats_digit;
+    /*! The smallest margin of the worst digit so far */
+    float stats_worst_margin;
+    openr2_mf_rx_stats_t stats;
+};
+
+#define OR2_CPT_CADENCES 3
+#define OR2_CPT_FILTERS (OR2_CPT_CADENCES + 3)
+
+/*!
+    Call progress tone detector descriptor. Busy, congestion and ringback
+    are told apart by their cadence, SIT by its three tones in a row.
+*/
+struct openr2_cpt_rx_state
+{
+    /*! Tone detector working states, the cadenced tones first, then the SIT ones */
+    openr2_goertzel_state_t out[OR2_CPT_FILTERS];
+    int freqs[OR2_CPT_FILTERS];
+    int filters;
+    /*! Filter of the busy, congestion and ringback tones, -1 if disabled */
+    int cadence_filter[OR2_CPT_CADENCES];
+    /*! Their on and off times, in blocks */
+    int on_blocks[OR2_CPT_CADENCES];
+    int off_blocks[OR2_CPT_CADENCES];
+    /*! Complete cycles in a row that matched each cadence */
+    int cycles[OR2_CPT_CADENCES];
+    /*! First of the three SIT filters, -1 if disabled, and SIT tones seen so far */
+    int sit_filter;
+    int sit_stage;
+    /*! Filter on in the current segment, -1 for silence, and its length in blocks */
+    int tone;
+    int run;
+    /*! Filter and length of the last tone before the current silence */
+    int last_tone;
+    int last_run;
+    /*! Tones already reported, 1 << openr2_cpt_tone_t each */
+    int reported;
+    /*! The tone found by the last call, OR2_CPT_NONE if none */
+    int detected;
+    float energy;
+    int current_sample;
+};
+
+/*!
+    MFC/R2 two way tone analyzer descriptor. Watches both directions of a
+    trunk at once, for monitoring.
+*/
+struct openr2_mf_analyzer_state
+{
+    /*! Tone detector working states, the forward tones first, then the backward ones */
+    openr2_goertzel_state_t out[12];
+    /*! The current sample number within a processing block. */
+    int current_sample;
+    /*! The currently detected forward and backward digits. */
+    int fwd_digit;
+    int back_digit;
 };
 
 /*!
@@ -142,6 +275,14 @@ struct openr2_dtmf_tx_state
         queue_state_t queue;
         uint8_t buf[QUEUE_STATE_T_SIZE(OR2_MAX_DTMF_DIGITS)];
     } queue;
+    /*! The tone of each digit, in "123A456B789C*0#D" order, rendered in A-law
+        at the current levels and on time */
+    uint8_t alaw_tones[16][OR2_DTMF_TX_MAX_RENDERED];
+    /*! One bit per digit, set while its A-law rendering is up to date */
+    int alaw_rendered;
+    /*! The digit being sent as A-law, -1 if none, and the next sample of its on and off time */
+    int alaw_digit;
+    int alaw_position;
 };
 
 /*!
@@ -188,6 +329,17 @@ struct openr2_dtmf_rx_state
     int current_digits;
     /*! The received digits buffer. This is a NULL terminated string. */
     char digits[OR2_MAX_DTMF_DIGITS + 1];
+
+    /*! TRUE if the fixed-point detector is used instead of the floating point one */
+    int fixed_point;
+    /*! Fixed-point 350Hz and 440Hz dialtone filter states */
+    int32_t z350_fixed[2];
+    int32_t z440_fixed[2];
+    /*! Fixed-point tone detector working states for the row and column tones. */
+    openr2_goertzel_fixed_state_t row_out_fixed[4];
+    openr2_goertzel_fixed_state_t col_out_fixed[4];
+    /*! Fixed-point accumulated total energy */
+    int64_t energy_fixed;
 };
 
 static __inline__ int openr2_top_bit(unsigned int bits)
@@ -44,20 +44,49 @@ extern "C" {
 
 typedef struct openr2_mf_rx_state openr2_mf_rx_state_t;
 typedef struct openr2_mf_tx_state openr2_mf_tx_state_t;
+typedef struct openr2_mf_analyzer_state openr2_mf_analyzer_state_t;
 typedef struct openr2_dtmf_tx_state openr2_dtmf_tx_state_t;
 typedef struct openr2_dtmf_rx_state openr2_dtmf_rx_state_t;
+typedef struct openr2_cpt_rx_state openr2_cpt_rx_state_t;
 
 /* MF Rx routines */
 OR2_DECLARE(openr2_mf_rx_state_t *) openr2_mf_rx_init(openr2_mf_rx_state_t *s, int fwd);
 OR2_DECLARE(int) openr2_mf_rx(openr2_mf_rx_state_t *s, const int16_t amp[], int samples);
+OR2_DECLARE(int) openr2_mf_rx_alaw(openr2_mf_rx_state_t *s, const uint8_t alaw[], int samples);
+OR2_DECLARE(void) openr2_mf_rx_set_fixed_point(openr2_mf_rx_state_t *s, int enable);
+OR2_DECLARE(void) openr2_mf_rx_set_sliding(openr2_mf_rx_state_t *s, int enable);
+OR2_DECLARE(void) openr2_mf_rx_set_tracking(openr2_mf_rx_state_t *s, int enable);
+OR2_DECLARE(void) openr2_mf_rx_set_tone_mask(openr2_mf_rx_state_t *s, const char *tones);
+OR2_DECLARE(int) openr2_mf_rx_multi(openr2_mf_rx_state_t *s[], const int16_t *amp[], int samples, int digits[], int channels);
+OR2_DECLARE(void) openr2_mf_rx_get_block_counts(openr2_mf_rx_state_t *s, unsigned long *blocks, unsigned long *skipped_blocks);
+OR2_DECLARE(void) openr2_mf_rx_set_debounce(openr2_mf_rx_state_t *s, int on_samples, int off_samples);
+OR2_DECLARE(void) openr2_mf_rx_set_stats(openr2_mf_rx_state_t *s, int enable);
+OR2_DECLARE(int) openr2_mf_rx_get_stats(openr2_mf_rx_state_t *s, openr2_mf_rx_stats_t *stats);
+OR2_DECLARE(void) openr2_mf_rx_reset_stats(openr2_mf_rx_state_t *s);
+
+/* MF two way analyzer routines */
+OR2_DECLARE(openr2_mf_analyzer_state_t *) openr2_mf_analyzer_init(openr2_mf_analyzer_state_t *s);
+OR2_DECLARE(void) openr2_mf_analyzer_rx(openr2_mf_analyzer_state_t *s, const int16_t amp[], int samples, int *fwd_digit, int *back_digit);
+OR2_DECLARE(void) openr2_mf_analyzer_rx_alaw(openr2_mf_analyzer_state_t *s, const uint8_t alaw[], int samples, int *fwd_digit, int *back_digit);
+
+/* Call progress tone Rx routines */
+OR2_DECLARE(openr2_cpt_rx_state_t *) openr2_cpt_rx_init(openr2_cpt_rx_state_t *s, const openr2_cpt_config_t *config);
+OR2_DECLARE(int) openr2_cpt_rx(openr2_cpt_rx_state_t *s, const int16_t amp[], int samples);
+OR2_DECLARE(int) openr2_cpt_rx_alaw(openr2_cpt_rx_state_t *s, const uint8_t alaw[], int samples);
+
+/* A-law transcoding of whole blocks of samples, vectorized where the CPU allows */
+OR2_DECLARE(void) openr2_alaw_to_linear_block(int16_t linear[], const uint8_t alaw[], int samples);
+OR2_DECLARE(void) openr2_linear_to_alaw_block(uint8_t alaw[], const int16_t linear[], int samples);
 
 /* MF Tx routines */
 OR2_DECLARE(openr2_mf_tx_state_t *) openr2_mf_tx_init(openr2_mf_tx_state_t *s, int fwd);
 OR2_DECLARE(int) openr2_mf_tx(openr2_mf_tx_state_t *s, int16_t amp[], int samples);
+OR2_DECLARE(int) openr2_mf_tx_alaw(openr2_mf_tx_state_t *s, uint8_t alaw[], int samples);
 OR2_DECLARE(int) openr2_mf_tx_put(openr2_mf_tx_state_t *s, char digit);
 
 /* DTMF Tx routines */
 OR2_DECLARE(int) openr2_dtmf_tx(openr2_dtmf_tx_state_t *s, int16_t amp[], int max_samples);
+OR2_DECLARE(int) openr2_dtmf_tx_alaw(openr2_dtmf_tx_state_t *s, uint8_t alaw[], int max_samples);
 OR2_DECLARE(size_t) openr2_dtmf_tx_put(openr2_dtmf_tx_state_t *s, const char *digits, int len);
 OR2_DECLARE(void) openr2_dtmf_tx_set_timing(openr2_dtmf_tx_state_t *s, int on_time, int off_time);
 OR2_DECLARE(void) openr2_dtmf_tx_set_level(openr2_dtmf_tx_state_t *s, int level, int twist);
@@ -66,7 +95,9 @@ OR2_DECLARE(openr2_dtmf_tx_state_t *) openr2_dtmf_tx_init(openr2_dtmf_tx_state_t
 /* DTMF Rx routines */
 OR2_DECLARE(openr2_dtmf_rx_state_t *) openr2_dtmf_rx_init(openr2_dtmf_rx_state_t *s, openr2_digits_rx_callback_t callback, void *user_data);
 OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[], int samples);
+OR2_DECLARE(int) openr2_dtmf_rx_alaw(openr2_dtmf_rx_state_t *s, const uint8_t alaw[], int samples);
 OR2_DECLARE(int) openr2_dtmf_rx_status(openr2_dtmf_rx_state_t *s);
+OR2_DECLARE(void) openr2_dtmf_rx_set_fixed_point(openr2_dtmf_rx_state_t *s, int enable);
 
 #if defined(__cplusplus)
 }
@@ -47,8 +47,17 @@ int openr2_io_setup(openr2_chan_t *r2chan);
 int openr2_io_wait(openr2_chan_t *r2chan, int *flags, int wait);
 int openr2_io_get_oob_event(openr2_chan_t *r2chan, openr2_oob_event_t *event);
 int openr2_io_get_alarm_state(openr2_chan_t *r2chan, int *alarm);
+openr2_io_format_t openr2_io_get_format(openr2_chan_t *r2chan);
+openr2_io_span_interface_t *openr2_io_get_span_interface(openr2_context_t *r2context);
+int openr2_io_span_wait(openr2_chan_t *r2chans[], int numchans, int timeout);
+int openr2_io_peek(openr2_chan_t *r2chan, const void **buf, int size);
+int openr2_io_consume(openr2_chan_t *r2chan, int size);
+int openr2_io_flush_read_buffers(openr2_chan_t *r2chan);
 openr2_io_interface_t *openr2_io_get_zt_interface(void);
 openr2_io_interface_t *openr2_io_get_dummy_interface(void);
+openr2_io_interface_t *openr2_io_get_loopback_interface(void);
+openr2_io_interface_t *openr2_io_get_shm_interface(void);
+openr2_io_interface_t *openr2_io_get_uring_interface(void);
 
 #if defined(__cplusplus)
 } /* endif extern "C" */
@@ -0,0 +1,133 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2ioshm.h - shared memory layout of the channels of a user space TDM
+ *             driver, as used by the OR2_IO_SHM back end
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The driver listens on a unix stream socket. To open channel N openr2
+ * connects to it and sends an openr2_shm_request_t, the driver answers with an
+ * openr2_shm_reply_t and, when the status is 0, three descriptors passed along
+ * with it (SCM_RIGHTS), in this order:
+ *
+ *   - the shared memory of the channel, an openr2_shm_chan_t
+ *   - an eventfd the driver writes to after adding media to the rx ring,
+ *     taking media from the tx ring or changing rx_cas or alarm. This is the
+ *     descriptor of the channel for the application, openr2 puts it in non
+ *     blocking mode
+ *   - an eventfd openr2 writes to after adding media to the tx ring or
+ *     changing tx_cas or tx_flush
+ *
+ * The connection stays open while the channel is open, so the driver knows
+ * the channel was closed when the connection goes down.
+ *
+ * Each ring has a single producer, the driver for rx and openr2 for tx, and a
+ * single consumer. head and tail count the bytes ever written and read, they
+ * are only written by the producer and the consumer respectively and wrap
+ * around at 2^32. The ring holds head - tail bytes from the offset
+ * tail % OR2_SHM_RING_SIZE on. The producer stores the media before it stores
+ * head with release ordering and the consumer loads head with acquire ordering
+ * before it reads the media, the same goes for tail the other way around.
+ * Writers always move whole samples.
+ *
+ * The CAS registers hold the ABCD bits in the low 4 bits and a sequence number
+ * in the rest, incremented by their writer on every change of the bits, so
+ * the reader sees every change even when the bits go back to what they were.
+ */
+
+#ifndef _OPENR2_IO_SHM_H_
+#define _OPENR2_IO_SHM_H_
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define OR2_SHM_MAGIC 0x4f523253 /* "OR2S" */
+#define OR2_SHM_VERSION 1
+
+/* where openr2 looks for the driver unless told otherwise */
+#define OR2_SHM_DEFAULT_SOCKET "/var/run/openr2-shm.sock"
+
+/* longest path of the driver socket, sun_path is 108 bytes on Linux and
+   needs room for the terminating zero */
+#define OR2_SHM_MAX_SOCKET_PATH 107
+
+/* bytes of each media ring, must be a power of two */
+#define OR2_SHM_RING_SIZE 4096
+
+/* the members written by each side are kept in cache lines of their own */
+#define OR2_SHM_CACHE_LINE 64
+
+#define OR2_SHM_CAS(seq, bits) (((uint32_t)(seq) << 4) | ((uint32_t)(bits) & 0xF))
+#define OR2_SHM_CAS_BITS(reg) ((int)((reg) & 0xF))
+#define OR2_SHM_CAS_SEQ(reg) ((reg) >> 4)
+
+typedef struct {
+	/* bytes written, written by the producer */
+	uint32_t head;
+	uint8_t head_pad[OR2_SHM_CACHE_LINE - sizeof(uint32_t)];
+	/* bytes read, written by the consumer */
+	uint32_t tail;
+	uint8_t tail_pad[OR2_SHM_CACHE_LINE - sizeof(uint32_t)];
+	uint8_t data[OR2_SHM_RING_SIZE];
+} openr2_shm_ring_t;
+
+typedef struct {
+	/* OR2_SHM_MAGIC and OR2_SHM_VERSION, set by the driver */
+	uint32_t magic;
+	uint32_t version;
+	/* sample format of both rings, an openr2_io_format_t, set by the driver */
+	uint32_t format;
+	/* non zero while the line is down, written by the driver */
+	uint32_t alarm;
+	/* CAS register of the bits received, written by the driver */
+	uint32_t rx_cas;
+	uint8_t driver_pad[OR2_SHM_CACHE_LINE - 5 * sizeof(uint32_t)];
+	/* CAS register of the bits to transmit, written by openr2 */
+	uint32_t tx_cas;
+	/* the media of the tx ring before this byte count is to be dropped
+	   instead of transmitted, written by openr2 */
+	uint32_t tx_flush;
+	uint8_t openr2_pad[OR2_SHM_CACHE_LINE - 2 * sizeof(uint32_t)];
+	/* media received, from the driver to openr2 */
+	openr2_shm_ring_t rx;
+	/* media to transmit, from openr2 to the driver */
+	openr2_shm_ring_t tx;
+} openr2_shm_chan_t;
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	/* channel number given to openr2_chan_new() */
+	int32_t channo;
+} openr2_shm_request_t;
+
+typedef struct {
+	uint32_t magic;
+	/* 0 when the channel descriptors come along, an errno value otherwise */
+	int32_t status;
+} openr2_shm_reply_t;
+
+#if defined(__cplusplus)
+} /* endif extern "C" */
+#endif
+
+#endif /* endif defined _OPENR2_IO_SHM_H_ */
@@ -154,6 +154,34 @@ typedef enum {
 	OR2_CAUSE_GLARE
 } openr2_call_disconnect_cause_t;
 
+/* Call progress tones heard in the audio of a call */
+typedef enum {
+	OR2_CPT_NONE = 0,
+	OR2_CPT_BUSY,
+	OR2_CPT_CONGESTION,
+	OR2_CPT_RINGBACK,
+	/* special information tone, 950, 1400 and 1800Hz one after the other */
+	OR2_CPT_SIT
+} openr2_cpt_tone_t;
+
+/* Frequency and cadence of a call progress tone, in Hz and milliseconds.
+   A frequency of 0 disables the tone, an off time of 0 is a continuous tone.
+   Other times must be at least 20ms, the length of a detection block */
+typedef struct {
+	int freq;
+	int on_ms;
+	int off_ms;
+} openr2_cpt_cadence_t;
+
+/* Call progress tones of a variant */
+typedef struct {
+	openr2_cpt_cadence_t busy;
+	openr2_cpt_cadence_t congestion;
+	openr2_cpt_cadence_t ringback;
+	/* non zero to detect the special information tone */
+	int sit;
+} openr2_cpt_config_t;
+
 /* possible causes of protocol error */
 typedef enum {
 	OR2_INVALID_CAS_BITS,
@@ -235,6 +263,7 @@ OR2_DECLARE(const char *) openr2_proto_get_variant_string(openr2_variant_t varia
 OR2_DECLARE(openr2_variant_t) openr2_proto_get_variant(const char *variant);
 OR2_DECLARE(const char *) openr2_proto_get_call_mode_string(openr2_call_mode_t mode);
 OR2_DECLARE(const openr2_variant_entry_t *) openr2_proto_get_variant_list(int *numvariants);
+OR2_DECLARE(const char *) openr2_proto_get_cpt_tone_string(openr2_cpt_tone_t tone);
 
 #ifdef __OR2_COMPILING_LIBRARY__
 #undef openr2_chan_t
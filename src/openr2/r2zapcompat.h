@@ -45,6 +45,7 @@ typedef struct dahdi_params ZT_PARAMS;
 	#define ZT_POLICY_IMMEDIATE DAHDI_POLICY_IMMEDIATE
 	#define ZT_LAW_ALAW DAHDI_LAW_ALAW
 	#define ZT_FLUSH_WRITE DAHDI_FLUSH_WRITE
+	#define ZT_FLUSH_READ DAHDI_FLUSH_READ
 
 	#define ZT_IOMUX_READ DAHDI_IOMUX_READ
 	#define ZT_IOMUX_WRITE DAHDI_IOMUX_WRITE
@@ -61,6 +62,7 @@ typedef struct dahdi_params ZT_PARAMS;
 	#define ZT_SET_BUFINFO DAHDI_SET_BUFINFO
 	#define ZT_SETGAINS DAHDI_SETGAINS
 	#define ZT_SETLAW DAHDI_SETLAW
+	#define ZT_SETLINEAR DAHDI_SETLINEAR
 	#define ZT_ECHOCANCEL DAHDI_ECHOCANCEL
 	#define ZT_SETTXBITS DAHDI_SETTXBITS
 	#define ZT_GETRXBITS DAHDI_GETRXBITS
@@ -176,7 +176,7 @@ int queue_read(queue_state_t *s, uint8_t *buf, int len)
             memcpy(buf, s->data + optr, real_len);
         /*endif*/
         new_optr = optr + real_len;
-        if (new_optr > s->len)
+        if (new_optr >= s->len)
             new_optr = 0;
         /*endif*/
     }
@@ -248,7 +248,7 @@ int queue_write(queue_state_t *s, const uint8_t *buf, int len)
         /* A one step process */
         memcpy(s->data + iptr, buf, real_len);
         new_iptr = iptr + real_len;
-        if (new_iptr > s->len)
+        if (new_iptr >= s->len)
             new_iptr = 0;
         /*endif*/
     }
@@ -363,7 +363,7 @@ int queue_write_msg(queue_state_t *s, const uint8_t *buf, int len)
         memcpy(s->data + iptr, &lenx, sizeof(uint16_t));
         memcpy(s->data + iptr + sizeof(uint16_t), buf, len);
         new_iptr = iptr + real_len;
-        if (new_iptr > s->len)
+        if (new_iptr >= s->len)
             new_iptr = 0;
         /*endif*/
     }
@@ -0,0 +1,272 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2batch.c - batch mode of the tone detection tools, runs many recorded
+ *             files on a pool of threads and prints the digits found
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if !defined(_XOPEN_SOURCE) && !defined(__FreeBSD__)
+#define _XOPEN_SOURCE 600
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "r2batch.h"
+
+#define MAX_THREADS 64
+
+struct r2batch_output {
+	char *buf;
+	size_t len;
+	size_t size;
+	const char *path;
+};
+
+typedef struct {
+	char *path;
+	r2batch_output_t output;
+	/* scanned, and waiting for the files before it to be printed */
+	int done;
+} r2batch_file_t;
+
+static struct {
+	r2batch_file_t *files;
+	int numfiles;
+	int format;
+	r2batch_scan_func scan;
+	/* next file to scan, and next file to print */
+	int next;
+	int printed;
+	int failed;
+	pthread_mutex_t lock;
+} batch;
+
+void r2batch_digit(r2batch_output_t *output, const char *direction, char digit, unsigned long on_sample, unsigned long off_sample)
+{
+	char *buf;
+	int len;
+
+	for (;;) {
+		len = snprintf(output->buf + output->len, output->size - output->len, "%s\t%s\t%c\t%lu\t%lu\n",
+				output->path, direction, digit, on_sample, off_sample);
+		if (len >= 0 && (size_t)len < output->size - output->len) {
+			output->len += len;
+			return;
+		}
+		buf = realloc(output->buf, output->size ? output->size * 2 : 4096);
+		if (!buf) {
+			fprintf(stderr, "out of memory while scanning %s\n", output->path);
+			/* the digit is lost, so the run must not report success */
+			pthread_mutex_lock(&batch.lock);
+			batch.failed = 1;
+			pthread_mutex_unlock(&batch.lock);
+			return;
+		}
+		output->buf = buf;
+		output->size = output->size ? output->size * 2 : 4096;
+	}
+}
+
+static int add_file(const char *path)
+{
+	r2batch_file_t *files;
+
+	files = realloc(batch.files, (batch.numfiles + 1) * sizeof(*files));
+	if (!files) {
+		return -1;
+	}
+	batch.files = files;
+	memset(&files[batch.numfiles], 0, sizeof(files[0]));
+	if (!(files[batch.numfiles].path = strdup(path))) {
+		return -1;
+	}
+	batch.numfiles++;
+	return 0;
+}
+
+static int compare_paths(const void *a, const void *b)
+{
+	return strcmp(((const r2batch_file_t *)a)->path, ((const r2batch_file_t *)b)->path);
+}
+
+/* add the regular files of a directory, sorted by name so runs are repeatable */
+static int add_directory(const char *path)
+{
+	char filepath[4096];
+	struct dirent *entry;
+	struct stat statbuf;
+	DIR *dir;
+	int first = batch.numfiles;
+
+	if (!(dir = opendir(path))) {
+		fprintf(stderr, "could not open directory %s: %s\n", path, strerror(errno));
+		return -1;
+	}
+	while ((entry = readdir(dir))) {
+		if (entry->d_name[0] == '.') {
+			continue;
+		}
+		snprintf(filepath, sizeof(filepath), "%s/%s", path, entry->d_name);
+		if (stat(filepath, &statbuf) || !S_ISREG(statbuf.st_mode)) {
+			continue;
+		}
+		if (add_file(filepath)) {
+			closedir(dir);
+			return -1;
+		}
+	}
+	closedir(dir);
+	qsort(batch.files + first, batch.numfiles - first, sizeof(batch.files[0]), compare_paths);
+	return 0;
+}
+
+static void scan_file(r2batch_file_t *file)
+{
+	struct stat statbuf;
+	size_t count;
+	void *samples;
+	int fd;
+
+	file->output.path = file->path;
+	if ((fd = open(file->path, O_RDONLY)) == -1) {
+		fprintf(stderr, "could not open audio file %s: %s\n", file->path, strerror(errno));
+		goto failed;
+	}
+	if (fstat(fd, &statbuf)) {
+		fprintf(stderr, "could not stat audio file %s: %s\n", file->path, strerror(errno));
+		close(fd);
+		goto failed;
+	}
+	count = (batch.format == R2BATCH_FORMAT_SLINEAR) ? statbuf.st_size / 2 : statbuf.st_size;
+	if (!count) {
+		close(fd);
+		return;
+	}
+	samples = mmap(NULL, statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (samples == MAP_FAILED) {
+		fprintf(stderr, "could not map audio file %s: %s\n", file->path, strerror(errno));
+		goto failed;
+	}
+	posix_madvise(samples, statbuf.st_size, POSIX_MADV_SEQUENTIAL);
+	batch.scan(batch.format, samples, count, &file->output);
+	munmap(samples, statbuf.st_size);
+	return;
+
+failed:
+	pthread_mutex_lock(&batch.lock);
+	batch.failed = 1;
+	pthread_mutex_unlock(&batch.lock);
+}
+
+static void *scan_thread(void *data)
+{
+	r2batch_file_t *file;
+	int i;
+
+	for (;;) {
+		pthread_mutex_lock(&batch.lock);
+		i = batch.next++;
+		pthread_mutex_unlock(&batch.lock);
+		if (i >= batch.numfiles) {
+			break;
+		}
+		scan_file(&batch.files[i]);
+
+		/* print every file that is done, in order */
+		pthread_mutex_lock(&batch.lock);
+		batch.files[i].done = 1;
+		while (batch.printed < batch.numfiles && batch.files[batch.printed].done) {
+			file = &batch.files[batch.printed++];
+			fwrite(file->output.buf, 1, file->output.len, stdout);
+			free(file->output.buf);
+			file->output.buf = NULL;
+		}
+		pthread_mutex_unlock(&batch.lock);
+	}
+	return NULL;
+}
+
+int r2batch_run(int format, char *paths[], int numpaths, int threads, r2batch_scan_func scan)
+{
+	pthread_t thread_ids[MAX_THREADS];
+	struct stat statbuf;
+	int i;
+
+	memset(&batch, 0, sizeof(batch));
+	batch.format = format;
+	batch.scan = scan;
+	pthread_mutex_init(&batch.lock, NULL);
+
+	for (i = 0; i < numpaths; i++) {
+		if (stat(paths[i], &statbuf)) {
+			fprintf(stderr, "could not stat %s: %s\n", paths[i], strerror(errno));
+			batch.failed = 1;
+		} else if (S_ISDIR(statbuf.st_mode)) {
+			if (add_directory(paths[i])) {
+				batch.failed = 1;
+			}
+		} else if (add_file(paths[i])) {
+			fprintf(stderr, "out of memory while adding %s\n", paths[i]);
+			batch.failed = 1;
+		}
+	}
+
+	if (threads <= 0) {
+		threads = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (threads > batch.numfiles) {
+		threads = batch.numfiles;
+	}
+	if (threads > MAX_THREADS) {
+		threads = MAX_THREADS;
+	}
+	if (threads < 1) {
+		threads = 1;
+	}
+
+	printf("# file\tdirection\tdigit\ton_sample\toff_sample\n");
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&thread_ids[i], NULL, scan_thread, NULL)) {
+			fprintf(stderr, "could not create scan thread: %s\n", strerror(errno));
+			break;
+		}
+	}
+	/* with no thread at all, do it here */
+	if (!i) {
+		scan_thread(NULL);
+	}
+	while (i--) {
+		pthread_join(thread_ids[i], NULL);
+	}
+
+	for (i = 0; i < batch.numfiles; i++) {
+		free(batch.files[i].path);
+	}
+	free(batch.files);
+	pthread_mutex_destroy(&batch.lock);
+	return batch.failed ? -1 : 0;
+}
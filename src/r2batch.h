@@ -0,0 +1,49 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2batch.h - batch mode of the tone detection tools, runs many recorded
+ *             files on a pool of threads and prints the digits found
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _OPENR2_BATCH_H_
+#define _OPENR2_BATCH_H_
+
+#include <stddef.h>
+
+#define R2BATCH_FORMAT_ALAW 1
+#define R2BATCH_FORMAT_SLINEAR 2
+
+/* the digits found on a file, kept until it is its turn to be printed */
+typedef struct r2batch_output r2batch_output_t;
+
+/* scan the samples of a whole file, one byte per sample for A-law and
+   one int16_t per sample for slinear, and report each digit found */
+typedef void (*r2batch_scan_func)(int format, const void *samples, size_t count, r2batch_output_t *output);
+
+/* report a digit heard from on_sample up to off_sample. direction is "fwd"
+   or "back", DTMF digits are forward */
+void r2batch_digit(r2batch_output_t *output, const char *direction, char digit, unsigned long on_sample, unsigned long off_sample);
+
+/* scan every file given, and every regular file of the directories given,
+   on the given number of threads (0 for one per CPU). The digits are printed
+   on stdout in the order of the files, one per line, tab separated:
+   file, direction, digit, on sample and off sample. Returns 0 if every file
+   could be read */
+int r2batch_run(int format, char *paths[], int numpaths, int threads, r2batch_scan_func scan);
+
+#endif /* _OPENR2_BATCH_H_ */
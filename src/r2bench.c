@@ -0,0 +1,622 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2bench.c - microbenchmarks of the library hot paths: MF and DTMF
+ *             generation and detection, A-law conversion, the digit
+ *             queues and the channel timers
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/* r2bench is built together with the library sources, so it can reach
+   the private queue and timer functions too */
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <time.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define R2BENCH_HAVE_TSC 1
+#include <x86intrin.h>
+#endif
+#include "openr2/r2thread.h"
+#include "openr2/r2utils-pvt.h"
+#include "openr2/r2engine-pvt.h"
+#include "openr2/r2proto-pvt.h"
+#include "openr2/r2chan-pvt.h"
+#include "openr2/r2context-pvt.h"
+#include "openr2/queue.h"
+
+#define USAGE "USAGE: %s [-j] [-c cpu] [-w warmup ms] [-t time ms] [-r rounds] [-b benchmark]\n" \
+              "  -j  print the results as JSON\n" \
+              "  -c  pin the benchmark to the given CPU\n" \
+              "  -w  time spent running each benchmark before measuring it (default %d)\n" \
+              "  -t  time spent measuring each benchmark (default %d)\n" \
+              "  -r  rounds the measuring time is split in, the median round is reported (default %d)\n" \
+              "  -b  run only the benchmarks whose name contains the given text\n"
+
+#define DEFAULT_WARMUP_MS 200
+#define DEFAULT_TIME_MS 1000
+#define DEFAULT_ROUNDS 11
+#define MAX_ROUNDS 101
+
+/* samples in a frame, 20ms as read by a channel */
+#define FRAME_SAMPLES 160
+/* frames in the audio the DSP benchmarks go round, 100ms of tone and 100ms of silence */
+#define SIGNAL_FRAMES 10
+
+typedef struct {
+	const char *name;
+	/* what a single operation does, for the report */
+	const char *op;
+	int (*setup)(void);
+	void (*run)(void);
+	void (*teardown)(void);
+} benchmark_t;
+
+typedef struct {
+	double ns_per_op;
+	double min_ns_per_op;
+	double cycles_per_op;
+	unsigned long ops;
+} result_t;
+
+static int16_t mf_signal[SIGNAL_FRAMES][FRAME_SAMPLES];
+static uint8_t mf_alaw_signal[SIGNAL_FRAMES][FRAME_SAMPLES];
+static int16_t dtmf_signal[SIGNAL_FRAMES][FRAME_SAMPLES];
+static int16_t linear_frame[FRAME_SAMPLES];
+static uint8_t alaw_frame[FRAME_SAMPLES];
+static int frame;
+static openr2_mf_rx_state_t mf_rxstate;
+static openr2_mf_tx_state_t mf_txstate;
+static openr2_dtmf_rx_state_t dtmf_rxstate;
+static openr2_dtmf_tx_state_t dtmf_txstate;
+static openr2_cpt_rx_state_t cpt_rxstate;
+static queue_state_t *queue;
+static openr2_context_t *r2context;
+static openr2_chan_t *r2chan;
+static int timer_ids[3];
+/* keeps the compiler from dropping the results */
+static volatile int sink;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void)
+{
+#ifdef R2BENCH_HAVE_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static int build_signals(void)
+{
+	openr2_mf_tx_state_t txstate;
+	openr2_dtmf_tx_state_t dtmftx;
+	int i;
+	int j;
+
+	openr2_mf_tx_init(&txstate, 1);
+	openr2_mf_tx_put(&txstate, '5');
+	for (i = 0; i < SIGNAL_FRAMES; i++) {
+		if (i == SIGNAL_FRAMES / 2) {
+			openr2_mf_tx_put(&txstate, 0);
+		}
+		openr2_mf_tx(&txstate, mf_signal[i], FRAME_SAMPLES);
+		for (j = 0; j < FRAME_SAMPLES; j++) {
+			mf_alaw_signal[i][j] = openr2_linear_to_alaw(mf_signal[i][j]);
+		}
+	}
+
+	openr2_dtmf_tx_init(&dtmftx);
+	openr2_dtmf_tx_set_timing(&dtmftx, 100, 100);
+	openr2_dtmf_tx_put(&dtmftx, "5", -1);
+	memset(dtmf_signal, 0, sizeof(dtmf_signal));
+	for (i = 0; i < SIGNAL_FRAMES; i++) {
+		openr2_dtmf_tx(&dtmftx, dtmf_signal[i], FRAME_SAMPLES);
+	}
+	for (i = 0; i < FRAME_SAMPLES; i++) {
+		linear_frame[i] = mf_signal[0][i];
+		alaw_frame[i] = mf_alaw_signal[0][i];
+	}
+	frame = 0;
+	return 0;
+}
+
+static int next_frame(void)
+{
+	int current = frame;
+
+	frame = (frame + 1) % SIGNAL_FRAMES;
+	return current;
+}
+
+static int setup_mf_rx_float(void)
+{
+	openr2_mf_rx_init(&mf_rxstate, 1);
+	return build_signals();
+}
+
+static int setup_mf_rx_fixed(void)
+{
+	openr2_mf_rx_init(&mf_rxstate, 1);
+	openr2_mf_rx_set_fixed_point(&mf_rxstate, 1);
+	return build_signals();
+}
+
+static void run_mf_rx(void)
+{
+	sink = openr2_mf_rx(&mf_rxstate, mf_signal[next_frame()], FRAME_SAMPLES);
+}
+
+static void run_mf_rx_alaw(void)
+{
+	sink = openr2_mf_rx_alaw(&mf_rxstate, mf_alaw_signal[next_frame()], FRAME_SAMPLES);
+}
+
+static int setup_mf_tx(void)
+{
+	openr2_mf_tx_init(&mf_txstate, 0);
+	openr2_mf_tx_put(&mf_txstate, '1');
+	return 0;
+}
+
+static void run_mf_tx(void)
+{
+	sink = openr2_mf_tx(&mf_txstate, linear_frame, FRAME_SAMPLES);
+}
+
+static void run_mf_tx_alaw(void)
+{
+	sink = openr2_mf_tx_alaw(&mf_txstate, alaw_frame, FRAME_SAMPLES);
+}
+
+static int setup_dtmf_rx_float(void)
+{
+	openr2_dtmf_rx_init(&dtmf_rxstate, NULL, NULL);
+	return build_signals();
+}
+
+static int setup_dtmf_rx_fixed(void)
+{
+	openr2_dtmf_rx_init(&dtmf_rxstate, NULL, NULL);
+	openr2_dtmf_rx_set_fixed_point(&dtmf_rxstate, 1);
+	return build_signals();
+}
+
+static void run_dtmf_rx(void)
+{
+	sink = openr2_dtmf_rx(&dtmf_rxstate, dtmf_signal[next_frame()], FRAME_SAMPLES);
+}
+
+static int setup_dtmf_tx(void)
+{
+	openr2_dtmf_tx_init(&dtmf_txstate);
+	return 0;
+}
+
+/* keep the transmitter busy with digits, as while dialing */
+static void run_dtmf_tx(void)
+{
+	if (openr2_dtmf_tx(&dtmf_txstate, linear_frame, FRAME_SAMPLES) < FRAME_SAMPLES) {
+		openr2_dtmf_tx_put(&dtmf_txstate, "1234567890", -1);
+	}
+}
+
+static void run_dtmf_tx_alaw(void)
+{
+	if (openr2_dtmf_tx_alaw(&dtmf_txstate, alaw_frame, FRAME_SAMPLES) < FRAME_SAMPLES) {
+		openr2_dtmf_tx_put(&dtmf_txstate, "1234567890", -1);
+	}
+}
+
+/* the ITU call progress tones, watching the MF signaling audio */
+static int setup_cpt_rx(void)
+{
+	static const openr2_cpt_config_t config = { { 425, 500, 500 }, { 425, 250, 250 }, { 425, 1000, 4000 }, 1 };
+
+	openr2_cpt_rx_init(&cpt_rxstate, &config);
+	return build_signals();
+}
+
+static void run_cpt_rx_alaw(void)
+{
+	sink = openr2_cpt_rx_alaw(&cpt_rxstate, mf_alaw_signal[next_frame()], FRAME_SAMPLES);
+}
+
+static int setup_alaw(void)
+{
+	return build_signals();
+}
+
+static void run_alaw_to_linear(void)
+{
+	int i;
+
+	for (i = 0; i < FRAME_SAMPLES; i++) {
+		linear_frame[i] = openr2_alaw_to_linear(alaw_frame[i]);
+	}
+	sink = linear_frame[FRAME_SAMPLES - 1];
+}
+
+static void run_linear_to_alaw(void)
+{
+	int i;
+
+	for (i = 0; i < FRAME_SAMPLES; i++) {
+		alaw_frame[i] = openr2_linear_to_alaw(linear_frame[i]);
+	}
+	sink = alaw_frame[FRAME_SAMPLES - 1];
+}
+
+static void run_alaw_to_linear_block(void)
+{
+	openr2_alaw_to_linear_block(linear_frame, alaw_frame, FRAME_SAMPLES);
+	sink = linear_frame[FRAME_SAMPLES - 1];
+}
+
+static void run_linear_to_alaw_block(void)
+{
+	openr2_linear_to_alaw_block(alaw_frame, linear_frame, FRAME_SAMPLES);
+	sink = alaw_frame[FRAME_SAMPLES - 1];
+}
+
+static int setup_queue(void)
+{
+	queue = queue_init(NULL, 128, QUEUE_READ_ATOMIC | QUEUE_WRITE_ATOMIC);
+	return queue ? 0 : -1;
+}
+
+/* a number worth of digits in, and out one by one, as the DTMF transmitter does */
+static void run_queue(void)
+{
+	static const uint8_t digits[] = "1234567890";
+	int digit;
+
+	queue_write(queue, digits, sizeof(digits) - 1);
+	while ((digit = queue_read_byte(queue)) >= 0) {
+		sink = digit;
+	}
+}
+
+static void teardown_queue(void)
+{
+	queue_free(queue);
+	queue = NULL;
+}
+
+/* the channel never does any I/O, it is just there to hold the timers */
+static openr2_io_fd_t bench_io_open(openr2_context_t *r2context, int channo)
+{
+	return NULL;
+}
+
+static int bench_io_close(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+static int bench_io_set_cas(openr2_chan_t *r2chan, int cas)
+{
+	return 0;
+}
+
+static int bench_io_get_cas(openr2_chan_t *r2chan, int *cas)
+{
+	*cas = 0;
+	return 0;
+}
+
+static int bench_io_flush_write_buffers(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+static int bench_io_write(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	return size;
+}
+
+static int bench_io_read(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	return 0;
+}
+
+static int bench_io_setup(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+static int bench_io_wait(openr2_chan_t *r2chan, int *flags, int block)
+{
+	*flags = 0;
+	return 0;
+}
+
+static int bench_io_get_oob_event(openr2_chan_t *r2chan, openr2_oob_event_t *event)
+{
+	*event = OR2_OOB_EVENT_NONE;
+	return 0;
+}
+
+static int bench_io_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
+{
+	*alarm = 0;
+	return 0;
+}
+
+static openr2_io_interface_t bench_io = {
+	/* .open */ bench_io_open,
+	/* .close */ bench_io_close,
+	/* .set_cas */ bench_io_set_cas,
+	/* .get_cas */ bench_io_get_cas,
+	/* .flush_write_buffers */ bench_io_flush_write_buffers,
+	/* .write */ bench_io_write,
+	/* .read */ bench_io_read,
+	/* .setup */ bench_io_setup,
+	/* .wait */ bench_io_wait,
+	/* .get_oob_event */ bench_io_get_oob_event,
+	/* .get_alarm_state */ bench_io_get_alarm_state
+};
+
+static void bench_timer_expired(openr2_chan_t *r2chan)
+{
+}
+
+static int setup_timers(void)
+{
+	static int dummy_fd;
+	int i;
+
+	r2context = openr2_context_new(OR2_VAR_ITU, NULL, 10, 10);
+	if (!r2context) {
+		return -1;
+	}
+	if (openr2_context_set_io_type(r2context, OR2_IO_CUSTOM, &bench_io)) {
+		openr2_context_delete(r2context);
+		return -1;
+	}
+	r2chan = openr2_chan_new_from_fd(r2context, &dummy_fd, 1);
+	if (!r2chan) {
+		openr2_context_delete(r2context);
+		return -1;
+	}
+	/* a call in progress has a few other timers running */
+	for (i = 0; i < 3; i++) {
+		timer_ids[i] = openr2_chan_add_timer(r2chan, 10000 * (i + 1), bench_timer_expired, "bench");
+	}
+	return 0;
+}
+
+static void run_timers(void)
+{
+	int timer_id;
+
+	timer_id = openr2_chan_add_timer(r2chan, 5000, bench_timer_expired, "bench");
+	openr2_chan_cancel_timer(r2chan, &timer_id);
+}
+
+static void teardown_timers(void)
+{
+	/* the context takes its channels along */
+	openr2_context_delete(r2context);
+	r2chan = NULL;
+	r2context = NULL;
+}
+
+static const benchmark_t benchmarks[] = {
+	{ "mf_rx_float", "20ms frame", setup_mf_rx_float, run_mf_rx, NULL },
+	{ "mf_rx_fixed", "20ms frame", setup_mf_rx_fixed, run_mf_rx, NULL },
+	{ "mf_rx_alaw", "20ms frame", setup_mf_rx_float, run_mf_rx_alaw, NULL },
+	{ "mf_tx", "20ms frame", setup_mf_tx, run_mf_tx, NULL },
+	{ "mf_tx_alaw", "20ms frame", setup_mf_tx, run_mf_tx_alaw, NULL },
+	{ "dtmf_rx_float", "20ms frame", setup_dtmf_rx_float, run_dtmf_rx, NULL },
+	{ "dtmf_rx_fixed", "20ms frame", setup_dtmf_rx_fixed, run_dtmf_rx, NULL },
+	{ "dtmf_tx", "20ms frame", setup_dtmf_tx, run_dtmf_tx, NULL },
+	{ "dtmf_tx_alaw", "20ms frame", setup_dtmf_tx, run_dtmf_tx_alaw, NULL },
+	{ "cpt_rx_alaw", "20ms frame", setup_cpt_rx, run_cpt_rx_alaw, NULL },
+	{ "alaw_to_linear", "20ms frame", setup_alaw, run_alaw_to_linear, NULL },
+	{ "linear_to_alaw", "20ms frame", setup_alaw, run_linear_to_alaw, NULL },
+	{ "alaw_to_linear_block", "20ms frame", setup_alaw, run_alaw_to_linear_block, NULL },
+	{ "linear_to_alaw_block", "20ms frame", setup_alaw, run_linear_to_alaw_block, NULL },
+	{ "queue_write_read", "10 digits in and out", setup_queue, run_queue, teardown_queue },
+	{ "chan_timer_add_cancel", "add and cancel", setup_timers, run_timers, teardown_timers },
+};
+
+static int compare_doubles(const void *a, const void *b)
+{
+	double x = *(const double *)a;
+	double y = *(const double *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* run a benchmark for about the given time, return how many ops it took */
+static unsigned long run_for(const benchmark_t *bench, double ns)
+{
+	unsigned long ops = 0;
+	double start = now_ns();
+	int i;
+
+	do {
+		for (i = 0; i < 64; i++) {
+			bench->run();
+		}
+		ops += 64;
+	} while (now_ns() - start < ns);
+	return ops;
+}
+
+static int measure(const benchmark_t *bench, int warmup_ms, int time_ms, int rounds, result_t *result)
+{
+	double ns_per_op[MAX_ROUNDS];
+	double cycles_per_op[MAX_ROUNDS];
+	double start;
+	double elapsed;
+	uint64_t start_cycles;
+	unsigned long batch;
+	unsigned long i;
+	int round;
+
+	if (bench->setup && bench->setup()) {
+		return -1;
+	}
+
+	/* the warmup also sizes the batches of the measuring rounds */
+	batch = run_for(bench, warmup_ms * 1e6);
+	batch = (unsigned long)((double)batch * time_ms / (warmup_ms ? warmup_ms : 1) / rounds);
+	if (!batch) {
+		batch = 1;
+	}
+
+	result->ops = 0;
+	for (round = 0; round < rounds; round++) {
+		start_cycles = now_cycles();
+		start = now_ns();
+		for (i = 0; i < batch; i++) {
+			bench->run();
+		}
+		elapsed = now_ns() - start;
+		cycles_per_op[round] = (double)(now_cycles() - start_cycles) / batch;
+		ns_per_op[round] = elapsed / batch;
+		result->ops += batch;
+	}
+
+	if (bench->teardown) {
+		bench->teardown();
+	}
+
+	qsort(ns_per_op, rounds, sizeof(ns_per_op[0]), compare_doubles);
+	qsort(cycles_per_op, rounds, sizeof(cycles_per_op[0]), compare_doubles);
+	result->ns_per_op = ns_per_op[rounds / 2];
+	result->min_ns_per_op = ns_per_op[0];
+	result->cycles_per_op = cycles_per_op[rounds / 2];
+	return 0;
+}
+
+static int pin_to_cpu(int cpu)
+{
+#ifdef __linux__
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return sched_setaffinity(0, sizeof(set), &set);
+#else
+	return -1;
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+	result_t result;
+	const char *filter = NULL;
+	int warmup_ms = DEFAULT_WARMUP_MS;
+	int time_ms = DEFAULT_TIME_MS;
+	int rounds = DEFAULT_ROUNDS;
+	int json = 0;
+	int cpu = -1;
+	int first = 1;
+	int failed = 0;
+	int o;
+	size_t i;
+
+	while ((o = getopt(argc, argv, "jc:w:t:r:b:")) != -1) {
+		switch (o) {
+		case 'j':
+			json = 1;
+			break;
+		case 'c':
+			cpu = atoi(optarg);
+			break;
+		case 'w':
+			warmup_ms = atoi(optarg);
+			break;
+		case 't':
+			time_ms = atoi(optarg);
+			break;
+		case 'r':
+			rounds = atoi(optarg);
+			break;
+		case 'b':
+			filter = optarg;
+			break;
+		default:
+			fprintf(stderr, USAGE, argv[0], DEFAULT_WARMUP_MS, DEFAULT_TIME_MS, DEFAULT_ROUNDS);
+			exit(1);
+		}
+	}
+	if (warmup_ms < 0 || time_ms <= 0 || rounds < 1 || rounds > MAX_ROUNDS || optind != argc) {
+		fprintf(stderr, USAGE, argv[0], DEFAULT_WARMUP_MS, DEFAULT_TIME_MS, DEFAULT_ROUNDS);
+		exit(1);
+	}
+	if (cpu >= 0 && pin_to_cpu(cpu)) {
+		fprintf(stderr, "could not pin the benchmark to CPU %d\n", cpu);
+		exit(1);
+	}
+
+	if (json) {
+		printf("{\n  \"cpu\": %d,\n  \"warmup_ms\": %d,\n  \"time_ms\": %d,\n  \"rounds\": %d,\n  \"benchmarks\": [",
+				cpu, warmup_ms, time_ms, rounds);
+	} else {
+		printf("Running OpenR2 microbenchmarks, %dms warmup, %dms in %d rounds, %s\n",
+				warmup_ms, time_ms, rounds, cpu >= 0 ? "pinned" : "not pinned");
+		printf("%-24s %-22s %12s %12s %12s %12s\n", "benchmark", "op", "ns/op", "min ns/op", "cycles/op", "ops");
+	}
+	for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+		if (filter && !strstr(benchmarks[i].name, filter)) {
+			continue;
+		}
+		if (measure(&benchmarks[i], warmup_ms, time_ms, rounds, &result)) {
+			fprintf(stderr, "could not set up benchmark %s\n", benchmarks[i].name);
+			failed = 1;
+			continue;
+		}
+		if (json) {
+			printf("%s\n    {\"name\": \"%s\", \"op\": \"%s\", \"ns_per_op\": %.2f, \"min_ns_per_op\": %.2f, ",
+					first ? "" : ",", benchmarks[i].name, benchmarks[i].op, result.ns_per_op, result.min_ns_per_op);
+#ifdef R2BENCH_HAVE_TSC
+			printf("\"cycles_per_op\": %.1f, ", result.cycles_per_op);
+#else
+			printf("\"cycles_per_op\": null, ");
+#endif
+			printf("\"ops\": %lu}", result.ops);
+		} else {
+			printf("%-24s %-22s %12.2f %12.2f %12.1f %12lu\n", benchmarks[i].name, benchmarks[i].op,
+					result.ns_per_op, result.min_ns_per_op, result.cycles_per_op, result.ops);
+		}
+		first = 0;
+	}
+	if (json) {
+		printf("\n  ]\n}\n");
+	}
+	return failed;
+}
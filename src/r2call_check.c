@@ -0,0 +1,943 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2call_check.c - place and complete calls between two contexts of the
+ *                  same process over the loopback trunks, or over the
+ *                  shared memory I/O with r2shmdrv as the driver, or
+ *                  over the io_uring I/O on socket pairs, and drive the
+ *                  CAS bits and alarms of loopback spans
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if !defined(_XOPEN_SOURCE) && !defined(__FreeBSD__)
+#define _XOPEN_SOURCE 600
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include "openr2/openr2.h"
+
+#define USAGE "USAGE: %s [loopback | shm r2shmdrv-path | uring]\n" \
+              "Places calls between two contexts over the given I/O, the loopback trunks\n" \
+              "by default, and checks they all complete. The shared memory I/O needs the\n" \
+              "r2shmdrv program, which is started on a socket of its own, and the io_uring\n" \
+              "I/O runs on socket pairs standing in for the DAHDI channels. The loopback\n" \
+              "trunks are also checked as spans\n"
+
+#define CHANNELS 4
+#define ANI "5678"
+#define DNIS "1234"
+/* a round of calls taking longer than this is stuck */
+#define ROUND_SECONDS 20
+/* time the near end gets to notice the far end is gone */
+#define ALARM_SECONDS 1
+/* exit status of a check that cannot run here, as for ctest and automake */
+#define SKIPPED 77
+/* time r2shmdrv gets to create its socket */
+#define DRIVER_SECONDS 5
+/* time a span gets to tell about a change of the far end */
+#define SPAN_WAIT_MS 100
+/* time the contexts of the io_uring I/O are waited on, each in turn */
+#define URING_WAIT_MS 5
+
+/* the line standing in for DAHDI under the io_uring I/O */
+#define LINE_FRAME_SIZE 160
+#define LINE_FRAME_MS 20
+/* frames waiting to be read beyond which the line drops them, as the DAHDI
+   buffers would */
+#define LINE_RX_FRAMES 2
+/* media an end can write ahead of the line, openr2 writes tones for as long
+   as the descriptor takes them so the line must hold it back like a real one */
+#define LINE_TX_SIZE (4 * LINE_FRAME_SIZE)
+/* A-law silence, and the CAS bits seen while the far end is not open */
+#define LINE_SILENCE 0xD5
+#define LINE_NO_PEER_CAS 0xF
+
+static openr2_chan_t *fwd_chans[CHANNELS];
+static openr2_chan_t *bwd_chans[CHANNELS];
+
+/* calls left to place on each forward channel, whether one is up, and
+   whether the line came up */
+static int calls_left[CHANNELS];
+static int call_busy[CHANNELS];
+static int line_idle[CHANNELS];
+
+static int placed = 0;
+static int offered = 0;
+static int answered = 0;
+static int fwd_ended = 0;
+static int bwd_ended = 0;
+static int errors = 0;
+static int alarms = 0;
+static int cleared = 0;
+static int blocked = 0;
+
+/* socket of the shared memory driver */
+static char shm_socket[64];
+
+/* The io_uring I/O only takes the media, the rest is left to a base interface
+   that is DAHDI on a real system. Here each channel is a socket pair instead,
+   openr2 gets one end and the line keeps the other one. A clock thread moves a
+   frame of media from one side of each channel to the other every 20ms, and
+   the CAS bits are kept in a table. An urgent byte on the socket stands in
+   for the DAHDI event, it makes the descriptor poll POLLPRI */
+typedef struct {
+	/* the end openr2 got, and the end of the line */
+	int app;
+	int line;
+	int open;
+	/* CAS bits written on this end */
+	int cas;
+	/* the far end changed its CAS bits, or came or went */
+	int cas_changed;
+	int alarm_changed;
+} line_end_t;
+
+static struct {
+	pthread_mutex_t lock;
+	/* the first and the second end opened with each channel number */
+	line_end_t ends[CHANNELS][2];
+	int stop;
+} line = { PTHREAD_MUTEX_INITIALIZER };
+
+static int fwd_index(openr2_chan_t *r2chan)
+{
+	int i;
+
+	for (i = 0; i < CHANNELS; i++) {
+		if (fwd_chans[i] == r2chan) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void on_call_init(openr2_chan_t *r2chan)
+{
+	openr2_chan_enable_read(r2chan);
+}
+
+static void on_call_offered(openr2_chan_t *r2chan, const char *ani, const char *dnis, openr2_calling_party_category_t category, int ani_restricted)
+{
+	offered++;
+	if (strcmp(ani, ANI) || strcmp(dnis, DNIS)) {
+		printf("channel %d: offered ANI %s and DNIS %s instead of " ANI " and " DNIS "\n",
+				openr2_chan_get_number(r2chan), ani, dnis);
+		errors++;
+	}
+	openr2_chan_accept_call(r2chan, OR2_CALL_WITH_CHARGE);
+}
+
+static void on_call_accepted(openr2_chan_t *r2chan, openr2_call_mode_t mode)
+{
+	if (openr2_chan_get_direction(r2chan) == OR2_DIR_BACKWARD) {
+		openr2_chan_answer_call(r2chan);
+	}
+}
+
+/* the calling end hangs up as soon as the call is answered */
+static void on_call_answered(openr2_chan_t *r2chan)
+{
+	answered++;
+	openr2_chan_disconnect_call(r2chan, OR2_CAUSE_NORMAL_CLEARING);
+}
+
+static void on_call_disconnect(openr2_chan_t *r2chan, openr2_call_disconnect_cause_t cause)
+{
+	openr2_chan_disconnect_call(r2chan, OR2_CAUSE_NORMAL_CLEARING);
+}
+
+static void on_call_end(openr2_chan_t *r2chan)
+{
+	int i;
+
+	if ((i = fwd_index(r2chan)) >= 0) {
+		fwd_ended++;
+		call_busy[i] = 0;
+	} else {
+		bwd_ended++;
+	}
+}
+
+static void on_hardware_alarm(openr2_chan_t *r2chan, int alarm)
+{
+	if (alarm) {
+		alarms++;
+	} else {
+		cleared++;
+	}
+}
+
+static void on_os_error(openr2_chan_t *r2chan, int errorcode)
+{
+	printf("channel %d: OS error %d\n", openr2_chan_get_number(r2chan), errorcode);
+	errors++;
+}
+
+static void on_protocol_error(openr2_chan_t *r2chan, openr2_protocol_error_t reason)
+{
+	printf("channel %d: protocol error %s\n", openr2_chan_get_number(r2chan), openr2_proto_get_error(reason));
+	errors++;
+}
+
+static void on_line_blocked(openr2_chan_t *r2chan)
+{
+	if (fwd_index(r2chan) >= 0) {
+		blocked++;
+	}
+}
+
+/* a forward channel takes calls once the far end is seen idle */
+static void on_line_idle(openr2_chan_t *r2chan)
+{
+	int i;
+
+	if ((i = fwd_index(r2chan)) >= 0) {
+		line_idle[i] = 1;
+	}
+}
+
+static openr2_event_interface_t event_iface = {
+	.on_call_init = on_call_init,
+	.on_call_offered = on_call_offered,
+	.on_call_accepted = on_call_accepted,
+	.on_call_answered = on_call_answered,
+	.on_call_disconnect = on_call_disconnect,
+	.on_call_end = on_call_end,
+	.on_hardware_alarm = on_hardware_alarm,
+	.on_os_error = on_os_error,
+	.on_protocol_error = on_protocol_error,
+	.on_line_blocked = on_line_blocked,
+	.on_line_idle = on_line_idle
+};
+
+static double now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+/* end of the line of a channel, with the line locked */
+static line_end_t *line_find_end(openr2_chan_t *r2chan)
+{
+	int fd = (int)(long)openr2_chan_get_fd(r2chan);
+	int i, e;
+
+	for (i = 0; i < CHANNELS; i++) {
+		for (e = 0; e < 2; e++) {
+			if (line.ends[i][e].open && line.ends[i][e].app == fd) {
+				return &line.ends[i][e];
+			}
+		}
+	}
+	return NULL;
+}
+
+static line_end_t *line_peer(line_end_t *end)
+{
+	line_end_t *ends = line.ends[(end - &line.ends[0][0]) / 2];
+
+	return (end == &ends[0]) ? &ends[1] : &ends[0];
+}
+
+/* Tell the end about the events waiting for it with an urgent byte, unless
+   one is there already. A read reaching the byte before it is taken drops
+   it, so the clock rings again for the events not taken yet. With the line
+   locked */
+static void line_ring(line_end_t *end)
+{
+	struct pollfd pfd;
+	char byte = 0;
+
+	if (!end->open || (!end->cas_changed && !end->alarm_changed)) {
+		return;
+	}
+	pfd.fd = end->app;
+	pfd.events = POLLPRI;
+	if (!poll(&pfd, 1, 0)) {
+		send(end->line, &byte, 1, MSG_OOB | MSG_DONTWAIT | MSG_NOSIGNAL);
+	}
+}
+
+static void *line_clock(void *data)
+{
+	uint8_t frame[LINE_FRAME_SIZE];
+	struct timespec next;
+	line_end_t *from, *to;
+	int i, e, len, queued;
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (;;) {
+		next.tv_nsec += LINE_FRAME_MS * 1000000L;
+		if (next.tv_nsec >= 1000000000L) {
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR);
+
+		pthread_mutex_lock(&line.lock);
+		if (line.stop) {
+			pthread_mutex_unlock(&line.lock);
+			break;
+		}
+		for (i = 0; i < CHANNELS; i++) {
+			for (e = 0; e < 2; e++) {
+				from = &line.ends[i][e];
+				to = &line.ends[i][!e];
+				line_ring(from);
+				if (!from->open) {
+					continue;
+				}
+				len = recv(from->line, frame, sizeof(frame), MSG_DONTWAIT);
+				if (len < 0) {
+					len = 0;
+				}
+				/* the far end did not write this part of the frame */
+				memset(&frame[len], LINE_SILENCE, sizeof(frame) - len);
+				if (!to->open || ioctl(to->app, FIONREAD, &queued) || queued >= LINE_RX_FRAMES * LINE_FRAME_SIZE) {
+					continue;
+				}
+				send(to->line, frame, sizeof(frame), MSG_DONTWAIT | MSG_NOSIGNAL);
+			}
+		}
+		pthread_mutex_unlock(&line.lock);
+	}
+	return NULL;
+}
+
+static openr2_io_fd_t line_open(openr2_context_t *r2context, int channo)
+{
+	line_end_t *end;
+	int sv[2], size;
+
+	if (channo < 1 || channo > CHANNELS) {
+		return NULL;
+	}
+	pthread_mutex_lock(&line.lock);
+	end = line.ends[channo - 1][0].open ? &line.ends[channo - 1][1] : &line.ends[channo - 1][0];
+	if (end->open || socketpair(AF_UNIX, SOCK_STREAM, 0, sv)) {
+		pthread_mutex_unlock(&line.lock);
+		return NULL;
+	}
+	end->app = sv[0];
+	end->line = sv[1];
+	size = LINE_TX_SIZE;
+	setsockopt(end->app, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+	end->open = 1;
+	end->cas = LINE_NO_PEER_CAS;
+	/* the bits of a far end already there are news for this end */
+	end->cas_changed = line_peer(end)->open;
+	end->alarm_changed = 0;
+	if (line_peer(end)->open) {
+		/* the line comes up on the far end */
+		line_peer(end)->alarm_changed = 1;
+		line_ring(line_peer(end));
+	}
+	line_ring(end);
+	pthread_mutex_unlock(&line.lock);
+	return (openr2_io_fd_t)(long)sv[0];
+}
+
+static int line_close(openr2_chan_t *r2chan)
+{
+	line_end_t *end;
+
+	pthread_mutex_lock(&line.lock);
+	if (!(end = line_find_end(r2chan))) {
+		pthread_mutex_unlock(&line.lock);
+		return -1;
+	}
+	end->open = 0;
+	close(end->app);
+	close(end->line);
+	if (line_peer(end)->open) {
+		/* the line goes down on the far end */
+		line_peer(end)->alarm_changed = 1;
+		line_ring(line_peer(end));
+	}
+	pthread_mutex_unlock(&line.lock);
+	return 0;
+}
+
+static int line_set_cas(openr2_chan_t *r2chan, int cas)
+{
+	line_end_t *end;
+
+	pthread_mutex_lock(&line.lock);
+	if (!(end = line_find_end(r2chan))) {
+		pthread_mutex_unlock(&line.lock);
+		return -1;
+	}
+	if (end->cas != cas) {
+		end->cas = cas;
+		if (line_peer(end)->open) {
+			line_peer(end)->cas_changed = 1;
+			line_ring(line_peer(end));
+		}
+	}
+	pthread_mutex_unlock(&line.lock);
+	return 0;
+}
+
+static int line_get_cas(openr2_chan_t *r2chan, int *cas)
+{
+	line_end_t *end;
+
+	pthread_mutex_lock(&line.lock);
+	if (!(end = line_find_end(r2chan))) {
+		pthread_mutex_unlock(&line.lock);
+		return -1;
+	}
+	*cas = line_peer(end)->open ? line_peer(end)->cas : LINE_NO_PEER_CAS;
+	pthread_mutex_unlock(&line.lock);
+	return 0;
+}
+
+static int line_flush_write_buffers(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+/* the io_uring I/O reads and writes the media of its channels itself, these
+   only serve the channels it leaves to the base */
+static int line_write(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	return send((int)(long)openr2_chan_get_fd(r2chan), buf, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+static int line_read(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	return recv((int)(long)openr2_chan_get_fd(r2chan), (void *)buf, size, MSG_DONTWAIT);
+}
+
+static int line_setup(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+static int line_wait(openr2_chan_t *r2chan, int *flags, int block)
+{
+	struct pollfd pfd;
+	int ready = 0;
+
+	pfd.fd = (int)(long)openr2_chan_get_fd(r2chan);
+	pfd.events = POLLIN | POLLOUT | POLLPRI;
+	if (poll(&pfd, 1, block ? -1 : 0) > 0) {
+		ready |= (pfd.revents & POLLIN) ? OR2_IO_READ : 0;
+		ready |= (pfd.revents & POLLOUT) ? OR2_IO_WRITE : 0;
+		ready |= (pfd.revents & POLLPRI) ? OR2_IO_OOB_EVENT : 0;
+	}
+	*flags &= ready;
+	return 0;
+}
+
+static int line_get_oob_event(openr2_chan_t *r2chan, openr2_oob_event_t *event)
+{
+	line_end_t *end;
+	char byte;
+
+	*event = OR2_OOB_EVENT_NONE;
+	pthread_mutex_lock(&line.lock);
+	if (!(end = line_find_end(r2chan))) {
+		pthread_mutex_unlock(&line.lock);
+		return -1;
+	}
+	recv(end->app, &byte, 1, MSG_OOB | MSG_DONTWAIT);
+	if (end->alarm_changed) {
+		end->alarm_changed = 0;
+		/* the CAS bits of a far end that just came up are news too */
+		end->cas_changed = line_peer(end)->open;
+		*event = line_peer(end)->open ? OR2_OOB_EVENT_ALARM_OFF : OR2_OOB_EVENT_ALARM_ON;
+	} else if (end->cas_changed) {
+		end->cas_changed = 0;
+		*event = OR2_OOB_EVENT_CAS_CHANGE;
+	}
+	line_ring(end);
+	pthread_mutex_unlock(&line.lock);
+	return 0;
+}
+
+static int line_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
+{
+	line_end_t *end;
+
+	pthread_mutex_lock(&line.lock);
+	if (!(end = line_find_end(r2chan))) {
+		pthread_mutex_unlock(&line.lock);
+		return -1;
+	}
+	/* the line is down until the far end is open */
+	*alarm = line_peer(end)->open ? 0 : 1;
+	pthread_mutex_unlock(&line.lock);
+	return 0;
+}
+
+static openr2_io_interface_t line_io_interface = {
+	.open = line_open,
+	.close = line_close,
+	.set_cas = line_set_cas,
+	.get_cas = line_get_cas,
+	.flush_write_buffers = line_flush_write_buffers,
+	.write = line_write,
+	.read = line_read,
+	.setup = line_setup,
+	.wait = line_wait,
+	.get_oob_event = line_get_oob_event,
+	.get_alarm_state = line_get_alarm_state
+};
+
+static openr2_context_t *new_context(openr2_io_type_t io_type, int free_running)
+{
+	openr2_context_t *r2context;
+
+	r2context = openr2_context_new(OR2_VAR_MEXICO, &event_iface, 4, 4);
+	if (!r2context) {
+		printf("could not create a context\n");
+		return NULL;
+	}
+	openr2_context_set_log_level(r2context, OR2_LOG_ERROR);
+	if (openr2_context_set_io_type(r2context, io_type, (io_type == OR2_IO_URING) ? &line_io_interface : NULL)) {
+		printf("could not set the I/O type of the context\n");
+		openr2_context_delete(r2context);
+		return NULL;
+	}
+	if (io_type == OR2_IO_LOOPBACK) {
+		openr2_context_set_loopback_free_running(r2context, free_running);
+	} else if (io_type == OR2_IO_SHM && openr2_context_set_shm_socket(r2context, shm_socket)) {
+		printf("could not set the driver socket of the context\n");
+		openr2_context_delete(r2context);
+		return NULL;
+	}
+	return r2context;
+}
+
+/* Wait for something to do on the forward channels, and on the backward
+   ones as well unless they are gone */
+static void wait_chans(openr2_io_type_t io_type, int backward)
+{
+	struct pollfd pollfds[2 * CHANNELS];
+	int i, n = 0;
+
+	if (io_type == OR2_IO_URING) {
+		/* the ring takes the media off the descriptors before they tell,
+		   so wait on the ring of each context instead */
+		openr2_chan_wait_span(fwd_chans, CHANNELS, URING_WAIT_MS);
+		if (backward) {
+			openr2_chan_wait_span(bwd_chans, CHANNELS, URING_WAIT_MS);
+		}
+		return;
+	}
+	for (i = 0; i < CHANNELS; i++) {
+		pollfds[n].fd = (int)(long)openr2_chan_get_fd(fwd_chans[i]);
+		pollfds[n++].events = POLLIN;
+		if (backward) {
+			pollfds[n].fd = (int)(long)openr2_chan_get_fd(bwd_chans[i]);
+			pollfds[n++].events = POLLIN;
+		}
+	}
+	poll(pollfds, n, 10);
+}
+
+/* Place calls_per_channel calls on each channel, from one context to the
+   other, and wait for all of them to end. With check_alarm, the far end goes
+   away at the end and every near channel must see it as an alarm */
+static int run_calls(const char *name, openr2_io_type_t io_type, int free_running, int calls_per_channel, int check_alarm)
+{
+	openr2_chan_t *chans[2 * CHANNELS];
+	openr2_context_t *fwd_context;
+	openr2_context_t *bwd_context;
+	double start;
+	int expected = CHANNELS * calls_per_channel;
+	int failed = 0;
+	int i;
+
+	placed = offered = answered = fwd_ended = bwd_ended = errors = alarms = 0;
+	if (!(fwd_context = new_context(io_type, free_running))) {
+		return -1;
+	}
+	if (!(bwd_context = new_context(io_type, free_running))) {
+		openr2_context_delete(fwd_context);
+		return -1;
+	}
+	for (i = 0; i < CHANNELS; i++) {
+		fwd_chans[i] = openr2_chan_new(fwd_context, i + 1);
+		bwd_chans[i] = openr2_chan_new(bwd_context, i + 1);
+		if (!fwd_chans[i] || !bwd_chans[i]) {
+			printf("%s: could not open channel %d\n", name, i + 1);
+			openr2_context_delete(fwd_context);
+			openr2_context_delete(bwd_context);
+			return -1;
+		}
+		openr2_chan_enable_read(fwd_chans[i]);
+		openr2_chan_enable_read(bwd_chans[i]);
+		openr2_chan_set_idle(fwd_chans[i]);
+		openr2_chan_set_idle(bwd_chans[i]);
+		chans[2 * i] = fwd_chans[i];
+		chans[2 * i + 1] = bwd_chans[i];
+		calls_left[i] = calls_per_channel;
+		call_busy[i] = 0;
+		line_idle[i] = 0;
+	}
+
+	start = now();
+	while (fwd_ended < expected || bwd_ended < expected) {
+		if (now() - start > ROUND_SECONDS) {
+			printf("%s: calls stuck after %d seconds\n", name, ROUND_SECONDS);
+			failed = 1;
+			break;
+		}
+		wait_chans(io_type, 1);
+		for (i = 0; i < 2 * CHANNELS; i++) {
+			openr2_chan_process_signaling(chans[i]);
+		}
+		for (i = 0; i < CHANNELS; i++) {
+			if (line_idle[i] && calls_left[i] && !call_busy[i]) {
+				if (openr2_chan_make_call(fwd_chans[i], ANI, DNIS, OR2_CALLING_PARTY_CATEGORY_NATIONAL_SUBSCRIBER, 0)) {
+					printf("%s: could not place a call on channel %d\n", name, i + 1);
+					failed = 1;
+					break;
+				}
+				openr2_chan_enable_read(fwd_chans[i]);
+				calls_left[i]--;
+				call_busy[i] = 1;
+				placed++;
+			}
+		}
+		if (failed) {
+			break;
+		}
+	}
+	printf("%s: %d calls placed, %d offered, %d answered, %d and %d ended, %d errors, %.2f s\n",
+			name, placed, offered, answered, fwd_ended, bwd_ended, errors, now() - start);
+	if (placed != expected || offered != expected || answered != expected || errors) {
+		failed = 1;
+	}
+
+	openr2_context_delete(bwd_context);
+	if (check_alarm && !failed) {
+		/* a driver may take a frame or two to tell */
+		start = now();
+		while (alarms < CHANNELS && now() - start < ALARM_SECONDS) {
+			wait_chans(io_type, 0);
+			for (i = 0; i < CHANNELS; i++) {
+				openr2_chan_process_signaling(fwd_chans[i]);
+			}
+		}
+		printf("%s: %d alarms once the far end is gone\n", name, alarms);
+		if (alarms != CHANNELS) {
+			failed = 1;
+		}
+	}
+	openr2_context_delete(fwd_context);
+	return failed ? -1 : 0;
+}
+
+/* Wait on a span, expecting a change on every channel or on none */
+static int wait_span(const char *what, openr2_chan_t *chans[], int expected)
+{
+	int res;
+
+	res = openr2_chan_wait_span(chans, CHANNELS, SPAN_WAIT_MS);
+	if (res != expected) {
+		printf("span: %d channels woke up %s instead of %d\n", res, what, expected);
+		return -1;
+	}
+	return 0;
+}
+
+/* Open both ends of the trunks as spans and drive their CAS bits and alarms
+   with the span routines alone, each change must wake up the near span and
+   be seen on all of its channels */
+static int check_span(void)
+{
+	openr2_context_t *fwd_context;
+	openr2_context_t *bwd_context;
+	int channos[CHANNELS];
+	int failed = 0;
+	int i;
+
+	alarms = cleared = blocked = errors = 0;
+	for (i = 0; i < CHANNELS; i++) {
+		channos[i] = i + 1;
+		line_idle[i] = 0;
+	}
+	if (!(fwd_context = new_context(OR2_IO_LOOPBACK, 0))) {
+		return -1;
+	}
+	if (!(bwd_context = new_context(OR2_IO_LOOPBACK, 0))) {
+		openr2_context_delete(fwd_context);
+		return -1;
+	}
+
+	/* alone, the span is in alarm */
+	if (openr2_chan_new_span(fwd_context, 1, channos, fwd_chans, CHANNELS)) {
+		printf("span: could not open the near span\n");
+		failed = 1;
+		goto done;
+	}
+	if (alarms != CHANNELS) {
+		printf("span: %d alarms with no far end\n", alarms);
+		failed = 1;
+	}
+
+	/* the far end comes up idle */
+	if (openr2_chan_new_span(bwd_context, 2, channos, bwd_chans, CHANNELS)) {
+		printf("span: could not open the far span\n");
+		failed = 1;
+		goto done;
+	}
+	openr2_chan_set_span_idle(bwd_chans, CHANNELS);
+	if (wait_span("on the far end coming up", fwd_chans, CHANNELS)) {
+		failed = 1;
+	}
+	openr2_chan_process_span_alarm(fwd_chans, CHANNELS);
+	openr2_chan_process_span_cas(fwd_chans, CHANNELS);
+	if (cleared != CHANNELS) {
+		printf("span: %d alarms cleared once the far end came up\n", cleared);
+		failed = 1;
+	}
+	if (wait_span("with nothing new", fwd_chans, 0)) {
+		failed = 1;
+	}
+
+	/* the far end blocks the line and then goes idle again */
+	openr2_chan_set_span_blocked(bwd_chans, CHANNELS);
+	if (wait_span("on the far end blocking", fwd_chans, CHANNELS)) {
+		failed = 1;
+	}
+	openr2_chan_process_span_cas(fwd_chans, CHANNELS);
+	if (blocked != CHANNELS) {
+		printf("span: %d channels blocked\n", blocked);
+		failed = 1;
+	}
+	for (i = 0; i < CHANNELS; i++) {
+		line_idle[i] = 0;
+	}
+	openr2_chan_set_span_idle(bwd_chans, CHANNELS);
+	if (wait_span("on the far end going idle", fwd_chans, CHANNELS)) {
+		failed = 1;
+	}
+	openr2_chan_process_span_cas(fwd_chans, CHANNELS);
+	for (i = 0; i < CHANNELS; i++) {
+		if (!line_idle[i]) {
+			printf("span: channel %d not idle\n", i + 1);
+			failed = 1;
+		}
+	}
+
+	/* and finally goes away */
+	openr2_context_delete(bwd_context);
+	bwd_context = NULL;
+	if (wait_span("on the far end going away", fwd_chans, CHANNELS)) {
+		failed = 1;
+	}
+	openr2_chan_process_span_alarm(fwd_chans, CHANNELS);
+	if (alarms != 2 * CHANNELS) {
+		printf("span: %d alarms once the far end is gone\n", alarms - CHANNELS);
+		failed = 1;
+	}
+	if (errors) {
+		failed = 1;
+	}
+	printf("span: %d alarms, %d cleared, %d blocked, %d errors\n", alarms, cleared, blocked, errors);
+
+done:
+	if (bwd_context) {
+		openr2_context_delete(bwd_context);
+	}
+	openr2_context_delete(fwd_context);
+	return failed ? -1 : 0;
+}
+
+static int check_uring(void)
+{
+	openr2_context_t *r2context;
+	openr2_chan_t *r2chan;
+	pthread_t clock_thread;
+	char byte = 0;
+	int sv[2];
+	int failed = 0;
+
+	/* the urgent byte of the line needs AF_UNIX sockets that have them */
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv)) {
+		printf("could not create a socket pair: %s\n", strerror(errno));
+		return 1;
+	}
+	failed = (send(sv[1], &byte, 1, MSG_OOB) != 1);
+	close(sv[0]);
+	close(sv[1]);
+	if (failed) {
+		printf("no urgent data on AF_UNIX sockets here, skipped\n");
+		return SKIPPED;
+	}
+
+	/* the io_uring I/O is only there on Linux, and the kernel may not let
+	   us have a ring */
+	r2context = openr2_context_new(OR2_VAR_MEXICO, &event_iface, 4, 4);
+	if (!r2context) {
+		printf("could not create a context\n");
+		return 1;
+	}
+	openr2_context_set_log_level(r2context, OR2_LOG_NOTHING);
+	if (openr2_context_set_io_type(r2context, OR2_IO_URING, &line_io_interface)) {
+		printf("no io_uring I/O here, skipped\n");
+		openr2_context_delete(r2context);
+		return SKIPPED;
+	}
+	r2chan = openr2_chan_new(r2context, 1);
+	openr2_context_delete(r2context);
+	if (!r2chan) {
+		printf("no io_uring for this process, skipped\n");
+		return SKIPPED;
+	}
+
+	if ((errno = pthread_create(&clock_thread, NULL, line_clock, NULL))) {
+		printf("could not start the line clock: %s\n", strerror(errno));
+		return 1;
+	}
+	/* the line runs the 20ms clock of a real one */
+	if (run_calls("uring", OR2_IO_URING, 0, 2, 1)) {
+		failed = 1;
+	}
+	pthread_mutex_lock(&line.lock);
+	line.stop = 1;
+	pthread_mutex_unlock(&line.lock);
+	pthread_join(clock_thread, NULL);
+	return failed;
+}
+
+static void stop_driver(pid_t pid);
+
+/* Start r2shmdrv on a socket of its own and wait for the socket */
+static pid_t start_driver(const char *driver)
+{
+	struct stat statbuf;
+	double start;
+	pid_t pid;
+	int status;
+
+	snprintf(shm_socket, sizeof(shm_socket), "/tmp/r2call_check-%d.sock", (int)getpid());
+	unlink(shm_socket);
+	if ((pid = fork()) == -1) {
+		printf("could not fork the driver: %s\n", strerror(errno));
+		return -1;
+	}
+	if (!pid) {
+		execl(driver, driver, "-s", shm_socket, (char *)NULL);
+		printf("could not run %s: %s\n", driver, strerror(errno));
+		_exit(127);
+	}
+	start = now();
+	while (stat(shm_socket, &statbuf) || !S_ISSOCK(statbuf.st_mode)) {
+		if (waitpid(pid, &status, WNOHANG) == pid) {
+			printf("the driver %s exited\n", driver);
+			return -1;
+		}
+		if (now() - start > DRIVER_SECONDS) {
+			printf("the driver %s did not create %s\n", driver, shm_socket);
+			stop_driver(pid);
+			return -1;
+		}
+		poll(NULL, 0, 10);
+	}
+	return pid;
+}
+
+static void stop_driver(pid_t pid)
+{
+	kill(pid, SIGTERM);
+	waitpid(pid, NULL, 0);
+	unlink(shm_socket);
+}
+
+static int check_shm(const char *driver)
+{
+	openr2_context_t *r2context;
+	pid_t pid;
+	int failed = 0;
+
+	/* the shared memory I/O is only there on Linux */
+	r2context = openr2_context_new(OR2_VAR_MEXICO, &event_iface, 4, 4);
+	if (!r2context) {
+		printf("could not create a context\n");
+		return 1;
+	}
+	openr2_context_set_log_level(r2context, OR2_LOG_NOTHING);
+	if (openr2_context_set_io_type(r2context, OR2_IO_SHM, NULL)) {
+		printf("no shared memory I/O here, skipped\n");
+		openr2_context_delete(r2context);
+		return SKIPPED;
+	}
+	openr2_context_delete(r2context);
+
+	if ((pid = start_driver(driver)) == -1) {
+		return 1;
+	}
+	/* r2shmdrv runs the 20ms clock of a real line */
+	if (run_calls("shm", OR2_IO_SHM, 0, 2, 1)) {
+		failed = 1;
+	}
+	stop_driver(pid);
+	return failed;
+}
+
+int main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	if (argc > 2 && !strcmp(argv[1], "shm")) {
+		failed = check_shm(argv[2]);
+		if (failed == SKIPPED) {
+			return SKIPPED;
+		}
+	} else if (argc > 1 && !strcmp(argv[1], "uring")) {
+		failed = check_uring();
+		if (failed == SKIPPED) {
+			return SKIPPED;
+		}
+	} else if (argc > 1 && strcmp(argv[1], "loopback")) {
+		fprintf(stderr, USAGE, argv[0]);
+		return 1;
+	} else {
+		/* as fast as the CPU allows, then on the 20ms clock of a real line */
+		if (run_calls("loopback, free running", OR2_IO_LOOPBACK, 1, 10, 1)) {
+			failed = 1;
+		}
+		if (run_calls("loopback, clocked", OR2_IO_LOOPBACK, 0, 2, 0)) {
+			failed = 1;
+		}
+		if (check_span()) {
+			failed = 1;
+		}
+	}
+	printf("%s\n", failed ? "call checks failed" : "call checks passed");
+	return failed;
+}
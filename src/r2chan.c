@@ -64,12 +64,11 @@
 				       openr2_chan_unlock(r2chan); \
 				       return retproperty;
 
-static int openr2_chan_handle_media(openr2_chan_t *r2chan, uint8_t *read_buf, int res);
+static int openr2_chan_handle_media(openr2_chan_t *r2chan, uint8_t *read_buf, int16_t *linear_buf, int res);
 
 static openr2_chan_t *__openr2_chan_new(openr2_context_t *r2context, int channo, int openchan, openr2_io_fd_t chanfd)
 {
 	openr2_chan_t *r2chan = NULL;
-	int alarm_state = 0;
 #ifdef OR2_MF_DEBUG
 	char logfile[1024];
 #endif
@@ -107,6 +106,10 @@ static openr2_chan_t *__openr2_chan_new(openr2_context_t *r2context, int channo,
 	/* no persistence check has been done */
 	r2chan->cas_persistence_check_signal = -1;
 
+	/* CAS goes straight to the I/O device unless handled span wide */
+	r2chan->span_cas_read = -1;
+	r2chan->span_cas_write = -1;
+
 	/* start with read disabled, we only read when there is a call being setup */
 	r2chan->read_enabled = 0;
 
@@ -154,18 +157,25 @@ static openr2_chan_t *__openr2_chan_new(openr2_context_t *r2context, int channo,
 
 	r2chan->number = channo;
 	r2chan->io_buf_size = OR2_CHAN_READ_SIZE;
+	r2chan->io_format = openr2_io_get_format(r2chan);
+	if (r2chan->io_format == OR2_IO_FORMAT_SLINEAR) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "I/O media is signed linear, no A-law transcoding for MF tones\n");
+	}
 
 	/* add ourselves to the list of channels in the context */
 	openr2_context_add_channel(r2context, r2chan);
 
-	/* check for alarms */
+	return r2chan;
+}
+
+static void openr2_chan_check_alarm(openr2_chan_t *r2chan)
+{
+	int alarm_state = 0;
 	openr2_io_get_alarm_state(r2chan, &alarm_state);
 	if (alarm_state) {
 		r2chan->inalarm = alarm_state;
 		openr2_proto_handle_alarm_state(r2chan);
 	}
-
-	return r2chan;
 }
 
 OR2_DECLARE(void) openr2_chan_set_span_id(openr2_chan_t *r2chan, int span_id)
@@ -202,12 +212,18 @@ OR2_DECLARE(int) openr2_chan_set_dtmf_handles(openr2_chan_t *r2chan, void *dtmf_
 
 OR2_DECLARE(openr2_chan_t *) openr2_chan_new(openr2_context_t *r2context, int channo)
 {
+	openr2_chan_t *r2chan = NULL;
 	if (channo <=0 ) {
 		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Invalid channel number %d\n", channo);
 		r2context->last_error = OR2_LIBERR_INVALID_CHAN_NUMBER;
 		return NULL;
 	}
-	return __openr2_chan_new(r2context, channo, 1, NULL);
+	r2chan = __openr2_chan_new(r2context, channo, 1, NULL);
+	if (!r2chan) {
+		return NULL;
+	}
+	openr2_chan_check_alarm(r2chan);
+	return r2chan;
 }
 
 OR2_DECLARE(openr2_chan_t *) openr2_chan_new_from_fd(openr2_context_t *r2context, openr2_io_fd_t chanfd, int channo)
@@ -222,6 +238,7 @@ OR2_DECLARE(openr2_chan_t *) openr2_chan_new_from_fd(openr2_context_t *r2context
 	if (!r2chan) {
 		return NULL;
 	}
+	openr2_chan_check_alarm(r2chan);
 	return r2chan;
 }
 
@@ -257,7 +274,7 @@ static int openr2_chan_handle_oob_event(openr2_chan_t *r2chan, openr2_oob_event_
 		break;
 	case OR2_OOB_EVENT_TONE_CHANGE:
 		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Handling tone change event\n");
-		openr2_chan_handle_media(r2chan, NULL, 0);
+		openr2_chan_handle_media(r2chan, NULL, NULL, 0);
 		break;
 	default:
 		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_NOTICE, "Unhandled OOB event %d\n", event);
@@ -313,27 +330,142 @@ OR2_DECLARE(int) openr2_chan_run_schedule(openr2_chan_t *r2chan)
 	return ret;
 }
 
+/* transcode a block with the user transcoder, a per sample only
+   transcoder is called sample by sample */
+static void transcode_to_linear(openr2_chan_t *r2chan, int16_t linear[], const uint8_t alaw[], int samples)
+{
+	int i;
+	if (TI(r2chan)->alaw_to_linear_block) {
+		TI(r2chan)->alaw_to_linear_block(linear, alaw, samples);
+		return;
+	}
+	for (i = 0; i < samples; i++) {
+		linear[i] = TI(r2chan)->alaw_to_linear(alaw[i]);
+	}
+}
+
+static void transcode_to_alaw(openr2_chan_t *r2chan, uint8_t alaw[], const int16_t linear[], int samples)
+{
+	int i;
+	if (TI(r2chan)->linear_to_alaw_block) {
+		TI(r2chan)->linear_to_alaw_block(alaw, linear, samples);
+		return;
+	}
+	for (i = 0; i < samples; i++) {
+		alaw[i] = TI(r2chan)->linear_to_alaw(linear[i]);
+	}
+}
+
+/* run the DTMF detector on the audio of the answered call, the detector hands
+   the digits to on_call_dtmf_received() in the protocol code */
+static void detect_call_dtmf(openr2_chan_t *r2chan, uint8_t *read_buf, int16_t *linear_buf, int res)
+{
+	int16_t tone_buf[OR2_CHAN_READ_SIZE];
+	if (!res || r2chan->detecting_call_dtmf < 0) {
+		return;
+	}
+	if (!r2chan->detecting_call_dtmf && openr2_proto_start_call_dtmf(r2chan)) {
+		return;
+	}
+	if (linear_buf) {
+		DTMF(r2chan)->dtmf_rx(r2chan->dtmf_read_handle, linear_buf, res);
+		return;
+	}
+	/* with the default transcoder the detector can take the A-law samples as they come */
+	if (openr2_test_flag(r2chan->r2context, OR2_DEFAULT_TRANSCODER) && DTMF(r2chan)->dtmf_rx_alaw) {
+		DTMF(r2chan)->dtmf_rx_alaw(r2chan->dtmf_read_handle, read_buf, res);
+		return;
+	}
+	transcode_to_linear(r2chan, tone_buf, read_buf, res);
+	DTMF(r2chan)->dtmf_rx(r2chan->dtmf_read_handle, tone_buf, res);
+}
+
+/* whether call progress tones are looked for on the audio of the call */
+static int openr2_chan_detecting_call_progress(openr2_chan_t *r2chan)
+{
+	return r2chan->r2context->call_progress_detection
+	    && r2chan->direction == OR2_DIR_FORWARD
+	    && (r2chan->call_state == OR2_CALL_DIALING
+	        || r2chan->call_state == OR2_CALL_ACCEPTED
+	        || r2chan->call_state == OR2_CALL_ANSWERED);
+}
+
+/* whether anything takes the media read: the MF or DTMF detectors, the call
+   progress detector or, once the call is answered, the user */
+static int openr2_chan_media_wanted(openr2_chan_t *r2chan)
+{
+	if (!r2chan->read_enabled) {
+		return 0;
+	}
+	return r2chan->mf_state != OR2_MF_OFF_STATE
+	    || r2chan->answered
+	    || openr2_chan_detecting_call_progress(r2chan);
+}
+
+/* look for call progress tones on the audio of an outgoing call, from the
+   end of the MF signaling on, so the user can release a failed call even
+   when the far end never sends the clear back */
+static void detect_call_progress(openr2_chan_t *r2chan, uint8_t *read_buf, int16_t *linear_buf, int res)
+{
+	int tone;
+	int16_t tone_buf[OR2_CHAN_READ_SIZE];
+	if (!res) {
+		return;
+	}
+	if (!r2chan->detecting_cpt) {
+		openr2_cpt_rx_init(&r2chan->cpt_rx, &r2chan->r2context->cpt);
+		r2chan->detecting_cpt = 1;
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Initialized call progress detector\n");
+	}
+	if (linear_buf) {
+		tone = openr2_cpt_rx(&r2chan->cpt_rx, linear_buf, res);
+	} else if (openr2_test_flag(r2chan->r2context, OR2_DEFAULT_TRANSCODER)) {
+		tone = openr2_cpt_rx_alaw(&r2chan->cpt_rx, read_buf, res);
+	} else {
+		transcode_to_linear(r2chan, tone_buf, read_buf, res);
+		tone = openr2_cpt_rx(&r2chan->cpt_rx, tone_buf, res);
+	}
+	if (tone != OR2_CPT_NONE) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Got call progress tone %s\n", openr2_proto_get_cpt_tone_string(tone));
+		EMI(r2chan)->on_call_progress_tone(r2chan, tone);
+	}
+}
+
 /* Note that this function can be called with an IO empty buffer (res = 0), which means
  * hardware is taking care of the IO and we must just call the tone detection callbacks, etc
- * but we don't have any media to transcode or anything */
-static int openr2_chan_handle_media(openr2_chan_t *r2chan, uint8_t *read_buf, int res)
+ * but we don't have any media to transcode or anything.
+ * When the I/O media is signed linear the samples come in linear_buf, and read_buf is
+ * only filled with them in A-law if the user has to get the audio */
+static int openr2_chan_handle_media(openr2_chan_t *r2chan, uint8_t *read_buf, int16_t *linear_buf, int res)
 {
-	unsigned i;
 	int tone_result = 0;
+	int alaw_detection = 0;
 	int16_t tone_buf[OR2_CHAN_READ_SIZE];
+	int16_t *linear = linear_buf ? linear_buf : tone_buf;
 	/* if the DTMF or MF detector is enabled, we are supposed to detect tones */
 	if (r2chan->mf_state != OR2_MF_OFF_STATE) {
-		if (res) {
-			/* assuming ALAW codec */
-			for (i = 0; i < (uint32_t) res; i++) {
-				tone_buf[i] = TI(r2chan)->alaw_to_linear(read_buf[i]);
+#ifndef OR2_MF_DEBUG
+		/* with the default transcoder the detectors can take the A-law samples as they come */
+		if (!linear_buf && openr2_test_flag(r2chan->r2context, OR2_DEFAULT_TRANSCODER)) {
+			alaw_detection = r2chan->detecting_dtmf ? (DTMF(r2chan)->dtmf_rx_alaw != NULL)
+			                                        : (MFI(r2chan)->mf_detect_tone_alaw != NULL);
+		}
+#endif
+		if (res && !alaw_detection) {
+			if (!linear_buf) {
+				/* assuming ALAW codec */
+				transcode_to_linear(r2chan, tone_buf, read_buf, res);
 			}
 #ifdef OR2_MF_DEBUG
-			write(r2chan->mf_read_fd, tone_buf, res*2);
+			write(r2chan->mf_read_fd, linear, res*2);
 #endif
 		}
 		if (r2chan->detecting_dtmf) {
-			DTMF(r2chan)->dtmf_rx(r2chan->dtmf_read_handle, tone_buf, res);
+			if (alaw_detection) {
+				DTMF(r2chan)->dtmf_rx_alaw(r2chan->dtmf_read_handle, read_buf, res);
+			} else {
+				DTMF(r2chan)->dtmf_rx(r2chan->dtmf_read_handle, linear, res);
+			}
 			res = DTMF(r2chan)->dtmf_rx_status(r2chan->dtmf_read_handle);
 			if (!res) {
 				r2chan->dtmf_silence_samples += OR2_CHAN_READ_SIZE;
@@ -344,13 +476,28 @@ static int openr2_chan_handle_media(openr2_chan_t *r2chan, uint8_t *read_buf, in
 				}
 			}
 		} else {
-			tone_result = MFI(r2chan)->mf_detect_tone(r2chan->mf_read_handle, tone_buf, res);
+			if (alaw_detection) {
+				tone_result = MFI(r2chan)->mf_detect_tone_alaw(r2chan->mf_read_handle, read_buf, res);
+			} else {
+				tone_result = MFI(r2chan)->mf_detect_tone(r2chan->mf_read_handle, linear, res);
+			}
 			if ( tone_result != -1 ) {
 				openr2_proto_handle_mf_tone(r2chan, tone_result);
 			}
 		}
-	} else if (r2chan->answered) {
-		EMI(r2chan)->on_call_read(r2chan, read_buf, res);
+	} else {
+		if (openr2_chan_detecting_call_progress(r2chan)) {
+			detect_call_progress(r2chan, read_buf, linear_buf, res);
+		}
+		if (r2chan->answered) {
+			if (r2chan->call_dtmf) {
+				detect_call_dtmf(r2chan, read_buf, linear_buf, res);
+			}
+			if (linear_buf) {
+				transcode_to_alaw(r2chan, read_buf, linear_buf, res);
+			}
+			EMI(r2chan)->on_call_read(r2chan, read_buf, res);
+		}
 	}
 
 done:
@@ -377,8 +524,10 @@ done:
 /*! \brief main processing of signaling to check for incoming events, respond to them and dispatch user events */
 static int openr2_chan_process(openr2_chan_t *r2chan, int processing_mask)
 {
-	unsigned i;
-	int interesting_events, res, wrote;
+	int interesting_events, res, wrote, in_place, reading;
+	int alaw_generation = 0;
+	int linear_io = (r2chan->io_format == OR2_IO_FORMAT_SLINEAR);
+	const void *media;
 	openr2_oob_event_t event;
 	uint8_t read_buf[OR2_CHAN_READ_SIZE];
 	int16_t tone_buf[OR2_CHAN_READ_SIZE];
@@ -392,9 +541,20 @@ tryagain:
 	/* check for CAS and ALARM events only if requested */
 	interesting_events = (processing_mask & OR2_CHAN_PROCESS_OOB) ? OR2_IO_OOB_EVENT : 0;
 
-	/* we also want to be notified about read-ready if we have read enabled and the user requested MF processing */
-	if (r2chan->read_enabled && (processing_mask & OR2_CHAN_PROCESS_MF)) {
-		/* XXX read enabled is NOT enough, we should also check if the MF engine is turned on or the channel is answered XXX*/
+	/* we also want to be notified about read-ready if the user requested MF processing and
+	   something takes the media, an idle or ringing channel does not read at all */
+	reading = 0;
+	if (processing_mask & OR2_CHAN_PROCESS_MF) {
+		reading = openr2_chan_media_wanted(r2chan);
+		if (reading && !r2chan->reading_media) {
+			/* whatever the I/O kept meanwhile is stale by now */
+			if (openr2_io_flush_read_buffers(r2chan)) {
+				openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "failed to flush rx buffers\n");
+			}
+		}
+		r2chan->reading_media = reading;
+	}
+	if (reading) {
 		interesting_events |= OR2_IO_READ;
 	}
 
@@ -434,35 +594,72 @@ tryagain:
 		}
 	}
 
-	if (r2chan->read_enabled && (OR2_IO_READ & interesting_events)) {
-		res = openr2_io_read(r2chan, read_buf, sizeof(read_buf));
+	if (reading && (OR2_IO_READ & interesting_events)) {
+		/* take the media where the I/O layer has it if it lets us, the
+		   media handling only reads from the buffer the samples come in */
+		res = in_place = openr2_io_peek(r2chan, &media, linear_io ? sizeof(tone_buf) : sizeof(read_buf));
+		if (!in_place) {
+			media = linear_io ? (void *)tone_buf : (void *)read_buf;
+			res = openr2_io_read(r2chan, media, linear_io ? sizeof(tone_buf) : sizeof(read_buf));
+		}
 		if (-1 == res) {
 			retcode = -1;
 			goto done;
 		}
+		if (linear_io) {
+			res /= sizeof(tone_buf[0]);
+		}
 		if (!res) {
 			/* if nothing was read, continue, may be there is a priority event (ie DAHDI read ELAST) */
 			goto tryagain;
 		}
-		openr2_chan_handle_media(r2chan, read_buf, res);
+		if (linear_io) {
+			openr2_chan_handle_media(r2chan, read_buf, (int16_t *)media, res);
+		} else {
+			openr2_chan_handle_media(r2chan, (uint8_t *)media, NULL, res);
+		}
+		if (in_place && openr2_io_consume(r2chan, in_place)) {
+			retcode = -1;
+			goto done;
+		}
 	}
 
 	/* we only write MF or DTMF tones here. Speech write is responsibility of the user, she should call openr2_chan_write for that */
 	if (r2chan->dialing_dtmf && (OR2_IO_WRITE & interesting_events)) {
-		res = DTMF(r2chan)->dtmf_tx(r2chan->dtmf_write_handle, tone_buf, r2chan->io_buf_size);
+		/* with the default transcoder the DTMF tones come already rendered in A-law */
+		alaw_generation = !linear_io && openr2_test_flag(r2chan->r2context, OR2_DEFAULT_TRANSCODER) && DTMF(r2chan)->dtmf_tx_alaw;
+		if (alaw_generation) {
+			res = DTMF(r2chan)->dtmf_tx_alaw(r2chan->dtmf_write_handle, read_buf, r2chan->io_buf_size);
+		} else {
+			res = DTMF(r2chan)->dtmf_tx(r2chan->dtmf_write_handle, tone_buf, r2chan->io_buf_size);
+		}
 		if (res <= 0) {
 			openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Done with DTMF generation\n");
 			openr2_proto_handle_dtmf_end(r2chan);
 			goto tryagain;
 		}
-		for (i = 0; i < (uint32_t) res; i++) {
-			read_buf[i] = TI(r2chan)->linear_to_alaw(tone_buf[i]);
+		if (linear_io) {
+			/* from here on res counts bytes */
+			res *= sizeof(tone_buf[0]);
+			wrote = openr2_io_write(r2chan, tone_buf, res);
+		} else {
+			if (!alaw_generation) {
+				transcode_to_alaw(r2chan, read_buf, tone_buf, res);
+			}
+			wrote = openr2_io_write(r2chan, read_buf, res);
 		}
-		wrote = openr2_io_write(r2chan, read_buf, res);
 		HANDLE_IO_WRITE_RESULT(wrote);
 	} else if ((OR2_MF_OFF_STATE != r2chan->mf_state) &&
 			(OR2_IO_WRITE & interesting_events)) {
-		res = MFI(r2chan)->mf_generate_tone(r2chan->mf_write_handle, tone_buf, r2chan->io_buf_size);
+#ifndef OR2_MF_DEBUG
+		/* with the default transcoder the generator can hand us the A-law samples ready to write */
+		alaw_generation = !linear_io && openr2_test_flag(r2chan->r2context, OR2_DEFAULT_TRANSCODER) && MFI(r2chan)->mf_generate_tone_alaw;
+#endif
+		if (alaw_generation) {
+			res = MFI(r2chan)->mf_generate_tone_alaw(r2chan->mf_write_handle, read_buf, r2chan->io_buf_size);
+		} else {
+			res = MFI(r2chan)->mf_generate_tone(r2chan->mf_write_handle, tone_buf, r2chan->io_buf_size);
+		}
 		/* if there are no samples to convert and write then continue,
 		   the generate routine already took care of it */
 		if (!res) {
@@ -477,10 +674,16 @@ tryagain:
 #ifdef OR2_MF_DEBUG
 		write(r2chan->mf_write_fd, tone_buf, res*2);
 #endif
-		for (i = 0; i < (uint32_t) res; i++) {
-			read_buf[i] = TI(r2chan)->linear_to_alaw(tone_buf[i]);
+		if (linear_io) {
+			/* from here on res counts bytes */
+			res *= sizeof(tone_buf[0]);
+			wrote = openr2_io_write(r2chan, tone_buf, res);
+		} else {
+			if (!alaw_generation) {
+				transcode_to_alaw(r2chan, read_buf, tone_buf, res);
+			}
+			wrote = openr2_io_write(r2chan, read_buf, res);
 		}
-		wrote = openr2_io_write(r2chan, read_buf, res);
 		HANDLE_IO_WRITE_RESULT(wrote);
 	}
 
@@ -506,6 +709,194 @@ OR2_DECLARE(int) openr2_chan_process_cas_signaling(openr2_chan_t *r2chan)
 	return openr2_proto_handle_cas(r2chan);
 }
 
+OR2_DECLARE(int) openr2_chan_new_span(openr2_context_t *r2context, int span_id, const int channos[], openr2_chan_t *r2chans[], int numchans)
+{
+	openr2_io_span_interface_t *span = openr2_io_get_span_interface(r2context);
+	openr2_io_fd_t *fds = NULL;
+	int i;
+	for (i = 0; i < numchans; i++) {
+		if (channos[i] <= 0) {
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Invalid channel number %d\n", channos[i]);
+			r2context->last_error = OR2_LIBERR_INVALID_CHAN_NUMBER;
+			return -1;
+		}
+	}
+	if (span && span->open) {
+		fds = calloc(numchans, sizeof(*fds));
+		if (!fds) {
+			r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+			return -1;
+		}
+		if (span->open(r2context, span_id, channos, fds, numchans)) {
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to open span %d\n", span_id);
+			free(fds);
+			return -1;
+		}
+	}
+	for (i = 0; i < numchans; i++) {
+		if (fds) {
+			r2chans[i] = __openr2_chan_new(r2context, channos[i], 0, fds[i]);
+			if (r2chans[i]) {
+				r2chans[i]->fd_created = 1;
+			}
+		} else {
+			r2chans[i] = __openr2_chan_new(r2context, channos[i], 1, NULL);
+		}
+		if (!r2chans[i]) {
+			break;
+		}
+		r2chans[i]->span_id = span_id;
+	}
+	free(fds);
+	if (i < numchans) {
+		while (i--) {
+			openr2_context_remove_channel(r2context, r2chans[i]);
+			openr2_chan_delete(r2chans[i]);
+		}
+		return -1;
+	}
+	if (span && span->get_alarm_state) {
+		openr2_chan_process_span_alarm(r2chans, numchans);
+	} else {
+		for (i = 0; i < numchans; i++) {
+			openr2_chan_check_alarm(r2chans[i]);
+		}
+	}
+	return 0;
+}
+
+OR2_DECLARE(int) openr2_chan_process_span_cas(openr2_chan_t *r2chans[], int numchans)
+{
+	openr2_io_span_interface_t *span;
+	int *cas;
+	int i;
+	if (numchans <= 0) {
+		return 0;
+	}
+	span = openr2_io_get_span_interface(r2chans[0]->r2context);
+	if (!span || !span->get_cas) {
+		for (i = 0; i < numchans; i++) {
+			openr2_chan_lock(r2chans[i]);
+			openr2_proto_handle_cas(r2chans[i]);
+			openr2_chan_unlock(r2chans[i]);
+		}
+		return 0;
+	}
+	cas = calloc(numchans, sizeof(*cas));
+	if (!cas) {
+		r2chans[0]->r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+		return -1;
+	}
+	if (span->get_cas(r2chans, cas, numchans)) {
+		openr2_log2(r2chans[0]->r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Getting CAS bits of span %d failed\n", r2chans[0]->span_id);
+		free(cas);
+		return -1;
+	}
+	/* only the channels whose bits changed have something to do */
+	for (i = 0; i < numchans; i++) {
+		openr2_chan_lock(r2chans[i]);
+		if (cas[i] != r2chans[i]->cas_raw_read) {
+			r2chans[i]->span_cas_read = cas[i];
+			openr2_proto_handle_cas(r2chans[i]);
+			r2chans[i]->span_cas_read = -1;
+		}
+		openr2_chan_unlock(r2chans[i]);
+	}
+	free(cas);
+	return 0;
+}
+
+OR2_DECLARE(int) openr2_chan_process_span_alarm(openr2_chan_t *r2chans[], int numchans)
+{
+	openr2_io_span_interface_t *span;
+	int alarm = 0;
+	int i;
+	if (numchans <= 0) {
+		return 0;
+	}
+	span = openr2_io_get_span_interface(r2chans[0]->r2context);
+	if (!span || !span->get_alarm_state) {
+		for (i = 0; i < numchans; i++) {
+			openr2_chan_lock(r2chans[i]);
+			alarm = 0;
+			openr2_io_get_alarm_state(r2chans[i], &alarm);
+			if ((alarm ? 1 : 0) != r2chans[i]->inalarm) {
+				openr2_chan_handle_oob_event(r2chans[i], alarm ? OR2_OOB_EVENT_ALARM_ON : OR2_OOB_EVENT_ALARM_OFF);
+			}
+			openr2_chan_unlock(r2chans[i]);
+		}
+		return 0;
+	}
+	if (span->get_alarm_state(r2chans, numchans, &alarm)) {
+		openr2_log2(r2chans[0]->r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Getting alarm state of span %d failed\n", r2chans[0]->span_id);
+		return -1;
+	}
+	for (i = 0; i < numchans; i++) {
+		openr2_chan_lock(r2chans[i]);
+		if ((alarm ? 1 : 0) != r2chans[i]->inalarm) {
+			openr2_chan_handle_oob_event(r2chans[i], alarm ? OR2_OOB_EVENT_ALARM_ON : OR2_OOB_EVENT_ALARM_OFF);
+		}
+		openr2_chan_unlock(r2chans[i]);
+	}
+	return 0;
+}
+
+/* put every channel of a span in the given state, the CAS bits of all of
+   them are written at once when the back end can do it */
+static int openr2_chan_set_span_state(openr2_chan_t *r2chans[], int numchans, int (*set_state)(openr2_chan_t *r2chan))
+{
+	openr2_io_span_interface_t *span;
+	int retcode = 0;
+	int *cas;
+	int i;
+	if (numchans <= 0) {
+		return 0;
+	}
+	span = openr2_io_get_span_interface(r2chans[0]->r2context);
+	cas = (span && span->set_cas) ? calloc(numchans, sizeof(*cas)) : NULL;
+	for (i = 0; i < numchans; i++) {
+		openr2_chan_lock(r2chans[i]);
+		if (cas) {
+			/* any value but -1 makes openr2_io_set_cas() keep the bits */
+			r2chans[i]->span_cas_write = 0;
+		}
+		if (set_state(r2chans[i])) {
+			retcode = -1;
+		}
+		if (cas) {
+			cas[i] = r2chans[i]->span_cas_write;
+			r2chans[i]->span_cas_write = -1;
+		}
+		openr2_chan_unlock(r2chans[i]);
+	}
+	if (cas) {
+		if (span->set_cas(r2chans, cas, numchans)) {
+			openr2_log2(r2chans[0]->r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Setting CAS bits of span %d failed\n", r2chans[0]->span_id);
+			retcode = -1;
+		}
+		free(cas);
+	}
+	return retcode;
+}
+
+OR2_DECLARE(int) openr2_chan_set_span_idle(openr2_chan_t *r2chans[], int numchans)
+{
+	return openr2_chan_set_span_state(r2chans, numchans, openr2_proto_set_idle);
+}
+
+OR2_DECLARE(int) openr2_chan_set_span_blocked(openr2_chan_t *r2chans[], int numchans)
+{
+	return openr2_chan_set_span_state(r2chans, numchans, openr2_proto_set_blocked);
+}
+
+OR2_DECLARE(int) openr2_chan_wait_span(openr2_chan_t *r2chans[], int numchans, int timeout)
+{
+	if (numchans <= 0) {
+		return 0;
+	}
+	return openr2_io_span_wait(r2chans, numchans, timeout);
+}
+
 OR2_DECLARE(int) openr2_chan_process_signaling(openr2_chan_t *r2chan)
 {
 	return openr2_chan_process(r2chan, OR2_CHAN_PROCESS_MF | OR2_CHAN_PROCESS_OOB);
@@ -784,6 +1175,19 @@ OR2_DECLARE(int) openr2_chan_get_rx_mf_signal(openr2_chan_t *r2chan)
 	return retcode;
 }
 
+OR2_DECLARE(int) openr2_chan_get_mf_stats(openr2_chan_t *r2chan, openr2_mf_rx_stats_t *stats)
+{
+	int retcode = -1;
+	openr2_chan_lock(r2chan);
+	if (MFI(r2chan)->mf_read_init == (openr2_mf_read_init_func)openr2_mf_rx_init
+	    && r2chan->r2context->mf_stats
+	    && r2chan->mf_read_handle) {
+		retcode = openr2_mf_rx_get_stats(r2chan->mf_read_handle, stats);
+	}
+	openr2_chan_unlock(r2chan);
+	return retcode;
+}
+
 
 OR2_DECLARE(int) openr2_chan_ack_call(openr2_chan_t *r2chan)
 {
@@ -794,12 +1198,46 @@ OR2_DECLARE(int) openr2_chan_ack_call(openr2_chan_t *r2chan)
 	return retcode;
 }
 
+/* the user audio is A-law, write it as linear to a linear I/O device */
+static int openr2_chan_write_linear(openr2_chan_t *r2chan, const unsigned char *buf, int buf_size)
+{
+	int myerrno;
+	int res = 0;
+	int len = 0;
+	int wrote = 0;
+	int16_t linear_buf[OR2_CHAN_READ_SIZE];
+	while (wrote < buf_size) {
+		len = buf_size - wrote;
+		if (len > OR2_CHAN_READ_SIZE) {
+			len = OR2_CHAN_READ_SIZE;
+		}
+		transcode_to_linear(r2chan, linear_buf, buf + wrote, len);
+		res = openr2_io_write(r2chan, linear_buf, len * sizeof(linear_buf[0]));
+		if (res == -1 && errno != EAGAIN) {
+			myerrno = errno;
+			openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Failed to write to channel\n");
+			EMI(r2chan)->on_os_error(r2chan, myerrno);
+			break;
+		} else if (res == -1) {
+			/* EAGAIN received, so let's try again */
+			continue;
+		}
+		wrote += res / sizeof(linear_buf[0]);
+	}
+	return wrote;
+}
+
 OR2_DECLARE(int) openr2_chan_write(openr2_chan_t *r2chan, const unsigned char *buf, int buf_size)
 {
 	int myerrno;
 	int res = 0;
 	int wrote = 0;
 	openr2_chan_lock(r2chan);
+	if (r2chan->io_format == OR2_IO_FORMAT_SLINEAR) {
+		wrote = openr2_chan_write_linear(r2chan, buf, buf_size);
+		openr2_chan_unlock(r2chan);
+		return wrote;
+	}
 	while (wrote < buf_size) {
 		res = openr2_io_write(r2chan, buf, buf_size);
 		if (res == -1 && errno != EAGAIN) {
@@ -948,6 +1386,21 @@ OR2_DECLARE(int) openr2_chan_get_call_files_enabled(openr2_chan_t *r2chan)
 	OR2_CHAN_RET_PROP(int,call_files);
 }
 
+OR2_DECLARE(void) openr2_chan_enable_call_dtmf(openr2_chan_t *r2chan)
+{
+	OR2_CHAN_SET_PROP(call_dtmf,1);
+}
+
+OR2_DECLARE(void) openr2_chan_disable_call_dtmf(openr2_chan_t *r2chan)
+{
+	OR2_CHAN_SET_PROP(call_dtmf,0);
+}
+
+OR2_DECLARE(int) openr2_chan_get_call_dtmf_enabled(openr2_chan_t *r2chan)
+{
+	OR2_CHAN_RET_PROP(int,call_dtmf);
+}
+
 OR2_DECLARE(const char *) openr2_chan_get_dnis(openr2_chan_t *r2chan)
 {
 	OR2_CHAN_RET_PROP(const char *,dnis);
@@ -51,6 +51,7 @@
 #include "openr2/r2chan-pvt.h"
 #include "openr2/r2context-pvt.h"
 #include "openr2/r2ioabs.h"
+#include "openr2/r2ioshm.h"
 
 static void on_call_init_default(openr2_chan_t *r2chan)
 {
@@ -143,6 +144,23 @@ static void on_call_log_created_default(openr2_chan_t *r2chan, const char *logna
 	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_NOTICE, "Log %s created on chan %d\n", logname, openr2_chan_get_number(r2chan));
 }
 
+static void on_call_mf_stats_default(openr2_chan_t *r2chan, const openr2_mf_rx_stats_t *stats)
+{
+	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "MF stats on chan %d: %d digits, worst margins level %.1fdB, twist %.1fdB, relative peak %.1fdB (digit %c)\n",
+			openr2_chan_get_number(r2chan), stats->digits, stats->worst.level_margin,
+			stats->worst.twist_margin, stats->worst.relative_peak_margin, stats->worst.digit);
+}
+
+static void on_call_dtmf_default(openr2_chan_t *r2chan, char digit)
+{
+	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "DTMF digit %c detected on chan %d\n", digit, openr2_chan_get_number(r2chan));
+}
+
+static void on_call_progress_tone_default(openr2_chan_t *r2chan, openr2_cpt_tone_t tone)
+{
+	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_NOTICE, "%s tone detected on chan %d\n", openr2_proto_get_cpt_tone_string(tone), openr2_chan_get_number(r2chan));
+}
+
 static int want_generate_default(openr2_mf_tx_state_t *state, int signal)
 {
 	return 1;
@@ -166,12 +184,17 @@ static openr2_mflib_interface_t default_mf_interface = {
 	/* .mf_select_tone */ (openr2_mf_select_tone_func)openr2_mf_tx_put,
 	/* .mf_want_generate */ (openr2_mf_want_generate_func)want_generate_default,
 	/* .mf_read_dispose */ NULL,
-	/* .mf_write_dispose */ NULL
+	/* .mf_write_dispose */ NULL,
+	/* .mf_detect_tone_multi */ (openr2_mf_detect_tone_multi_func)openr2_mf_rx_multi,
+	/* .mf_detect_tone_alaw */ (openr2_mf_detect_tone_alaw_func)openr2_mf_rx_alaw,
+	/* .mf_generate_tone_alaw */ (openr2_mf_generate_tone_alaw_func)openr2_mf_tx_alaw
 };
 
 static openr2_transcoder_interface_t default_transcoder = {
 	/* .alaw_to_linear */ openr2_alaw_to_linear,
-	/* .linear_to_alaw */ openr2_linear_to_alaw
+	/* .linear_to_alaw */ openr2_linear_to_alaw,
+	/* .alaw_to_linear_block */ openr2_alaw_to_linear_block,
+	/* .linear_to_alaw_block */ openr2_linear_to_alaw_block
 };
 
 static openr2_event_interface_t default_evmanager = {
@@ -192,7 +215,10 @@ static openr2_event_interface_t default_evmanager = {
 	/* .on_dnis_digit_received */ on_dnis_digit_received_default,
 	/* .on_ani_digit_received */ on_ani_digit_received_default,
 	/* .on_billing_pulse_received */ on_billing_pulse_received_default,
-	/* .on_call_log_created */ on_call_log_created_default
+	/* .on_call_log_created */ on_call_log_created_default,
+	/* .on_call_mf_stats */ on_call_mf_stats_default,
+	/* .on_call_dtmf */ on_call_dtmf_default,
+	/* .on_call_progress_tone */ on_call_progress_tone_default
 };
 
 static openr2_dtmf_interface_t default_dtmf_engine = {
@@ -203,7 +229,9 @@ static openr2_dtmf_interface_t default_dtmf_engine = {
 
 	/* .dtmf_rx_init */ (openr2_dtmf_rx_init_func)openr2_dtmf_rx_init,
 	/* .dtmf_rx_status */ (openr2_dtmf_rx_status_func)openr2_dtmf_rx_status,
-	/* .dtmf_rx */ (openr2_dtmf_rx_func)openr2_dtmf_rx
+	/* .dtmf_rx */ (openr2_dtmf_rx_func)openr2_dtmf_rx,
+	/* .dtmf_rx_alaw */ (openr2_dtmf_rx_alaw_func)openr2_dtmf_rx_alaw,
+	/* .dtmf_tx_alaw */ (openr2_dtmf_tx_alaw_func)openr2_dtmf_tx_alaw
 };
 
 OR2_DECLARE(openr2_context_t *) openr2_context_new(openr2_variant_t variant, openr2_event_interface_t *evmanager, int max_ani, int max_dnis)
@@ -267,6 +295,15 @@ OR2_DECLARE(openr2_context_t *) openr2_context_new(openr2_variant_t variant, ope
 		if (!evmanager->on_call_log_created) {
 			evmanager->on_call_log_created = on_call_log_created_default;
 		}
+		if (!evmanager->on_call_mf_stats) {
+			evmanager->on_call_mf_stats = on_call_mf_stats_default;
+		}
+		if (!evmanager->on_call_dtmf) {
+			evmanager->on_call_dtmf = on_call_dtmf_default;
+		}
+		if (!evmanager->on_call_progress_tone) {
+			evmanager->on_call_progress_tone = on_call_progress_tone_default;
+		}
 	}
 	r2context = calloc(1, sizeof(*r2context));
 	if (!r2context) {
@@ -276,10 +313,12 @@ OR2_DECLARE(openr2_context_t *) openr2_context_new(openr2_variant_t variant, ope
 
 	r2context->mflib = &default_mf_interface;
 	r2context->transcoder = &default_transcoder;
+	openr2_set_flag(r2context, OR2_DEFAULT_TRANSCODER);
 	r2context->variant = variant;
 	r2context->evmanager = evmanager;
 	r2context->dtmfeng = &default_dtmf_engine;
 	r2context->loglevel = OR2_LOG_ERROR | OR2_LOG_WARNING | OR2_LOG_NOTICE;
+	openr2_context_set_shm_socket(r2context, OR2_SHM_DEFAULT_SOCKET);
 	openr2_mutex_create(&r2context->timers_lock);
 	if (openr2_proto_configure_context(r2context, variant, max_ani, max_dnis)) {
 		free(r2context);
@@ -332,7 +371,8 @@ OR2_DECLARE(int) openr2_context_set_transcoder_interface(openr2_context_t *r2con
 {
 	/* fix the transcoder interface */
 	if (!transcoder) {
-		transcoder = &default_transcoder;
+		r2context->transcoder = &default_transcoder;
+		openr2_set_flag(r2context, OR2_DEFAULT_TRANSCODER);
 		return 0;
 	} 
 	if (!transcoder->alaw_to_linear) {
@@ -344,6 +384,7 @@ OR2_DECLARE(int) openr2_context_set_transcoder_interface(openr2_context_t *r2con
 		return -1;
 	}
 	r2context->transcoder = transcoder;
+	openr2_clear_flag(r2context, OR2_DEFAULT_TRANSCODER);
 	return 0;
 }
 
@@ -627,6 +668,137 @@ OR2_DECLARE(int) openr2_context_get_dtmf_dialing(openr2_context_t *r2context, in
 	return r2context->dial_with_dtmf;
 }
 
+OR2_DECLARE(int) openr2_context_set_dsp_engine(openr2_context_t *r2context, openr2_dsp_engine_t engine)
+{
+	switch (engine) {
+	case OR2_DSP_FLOAT:
+	case OR2_DSP_FIXED_POINT:
+		r2context->dsp_engine = engine;
+		return 0;
+	default:
+		break;
+	}
+	openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Invalid DSP engine %d\n", engine);
+	return -1;
+}
+
+OR2_DECLARE(openr2_dsp_engine_t) openr2_context_get_dsp_engine(openr2_context_t *r2context)
+{
+	return r2context->dsp_engine;
+}
+
+OR2_DECLARE(void) openr2_context_set_mf_sliding_detection(openr2_context_t *r2context, int enable)
+{
+	if (enable < 0) {
+		return;
+	}
+	r2context->mf_sliding_detection = enable ? 1 : 0;
+}
+
+OR2_DECLARE(int) openr2_context_get_mf_sliding_detection(openr2_context_t *r2context)
+{
+	return r2context->mf_sliding_detection;
+}
+
+OR2_DECLARE(void) openr2_context_set_mf_tracking_detection(openr2_context_t *r2context, int enable)
+{
+	if (enable < 0) {
+		return;
+	}
+	r2context->mf_tracking_detection = enable ? 1 : 0;
+}
+
+OR2_DECLARE(int) openr2_context_get_mf_tracking_detection(openr2_context_t *r2context)
+{
+	return r2context->mf_tracking_detection;
+}
+
+OR2_DECLARE(void) openr2_context_set_mf_stats(openr2_context_t *r2context, int enable)
+{
+	if (enable < 0) {
+		return;
+	}
+	r2context->mf_stats = enable ? 1 : 0;
+}
+
+OR2_DECLARE(int) openr2_context_get_mf_stats(openr2_context_t *r2context)
+{
+	return r2context->mf_stats;
+}
+
+OR2_DECLARE(void) openr2_context_set_linear_io(openr2_context_t *r2context, int enable)
+{
+	if (enable < 0) {
+		return;
+	}
+	r2context->linear_io = enable ? 1 : 0;
+}
+
+OR2_DECLARE(int) openr2_context_get_linear_io(openr2_context_t *r2context)
+{
+	return r2context->linear_io;
+}
+
+OR2_DECLARE(void) openr2_context_set_loopback_free_running(openr2_context_t *r2context, int enable)
+{
+	if (enable < 0) {
+		return;
+	}
+	r2context->loopback_free_running = enable ? 1 : 0;
+}
+
+OR2_DECLARE(int) openr2_context_get_loopback_free_running(openr2_context_t *r2context)
+{
+	return r2context->loopback_free_running;
+}
+
+OR2_DECLARE(void) openr2_context_set_call_progress_detection(openr2_context_t *r2context, int enable)
+{
+	if (enable < 0) {
+		return;
+	}
+	r2context->call_progress_detection = enable ? 1 : 0;
+}
+
+OR2_DECLARE(int) openr2_context_get_call_progress_detection(openr2_context_t *r2context)
+{
+	return r2context->call_progress_detection;
+}
+
+OR2_DECLARE(int) openr2_context_set_cpt_cadence(openr2_context_t *r2context, openr2_cpt_tone_t tone, const openr2_cpt_cadence_t *cadence)
+{
+	if (!cadence) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "No cadence given for call progress tone %d\n", tone);
+		return -1;
+	}
+	/* the detector works on 20ms blocks, a shorter time would be 0 blocks */
+	if (tone != OR2_CPT_SIT && cadence->freq
+	    && (cadence->freq < 0 || cadence->freq >= 4000 || cadence->on_ms < 20 || (cadence->off_ms && cadence->off_ms < 20))) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Invalid cadence for call progress tone %d: %dHz, %dms on, %dms off\n",
+				tone, cadence->freq, cadence->on_ms, cadence->off_ms);
+		return -1;
+	}
+	switch (tone) {
+	case OR2_CPT_BUSY:
+		r2context->cpt.busy = *cadence;
+		return 0;
+	case OR2_CPT_CONGESTION:
+		r2context->cpt.congestion = *cadence;
+		return 0;
+	case OR2_CPT_RINGBACK:
+		r2context->cpt.ringback = *cadence;
+		return 0;
+	case OR2_CPT_SIT:
+		/* SIT has no cadence, a frequency of 0 disables it */
+		r2context->cpt.sit = cadence->freq ? 1 : 0;
+		return 0;
+	default:
+		break;
+	}
+	openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Invalid call progress tone %d\n", tone);
+	return -1;
+}
+
 OR2_DECLARE(int) openr2_context_set_log_directory(openr2_context_t *r2context, char *directory)
 {
 	struct stat buff;
@@ -669,6 +841,30 @@ OR2_DECLARE(char *) openr2_context_get_log_directory(openr2_context_t *r2context
 	return directory;
 }
 
+OR2_DECLARE(int) openr2_context_set_shm_socket(openr2_context_t *r2context, const char *path)
+{
+	if (!path) {
+		return -1;
+	}
+	/* make sure it will fit in the socket address */
+	if (strlen(path) > OR2_SHM_MAX_SOCKET_PATH) {
+		return -1;
+	}
+	strncpy(r2context->shm_socket, path, sizeof(r2context->shm_socket)-1);
+	r2context->shm_socket[sizeof(r2context->shm_socket)-1] = 0;
+	return 0;
+}
+
+OR2_DECLARE(char *) openr2_context_get_shm_socket(openr2_context_t *r2context, char *path, int len)
+{
+	if (!path) {
+		return NULL;
+	}
+	strncpy(path, r2context->shm_socket, len-1);
+	path[len-1] = 0;
+	return path;
+}
+
 OR2_DECLARE(int) openr2_context_get_max_ani(openr2_context_t *r2context)
 {
 	return r2context->max_ani;
@@ -720,66 +916,112 @@ OR2_DECLARE(int) openr2_context_get_double_answer(openr2_context_t *r2context)
 	return r2context->double_answer ? 1 : 0;
 }
 
+/* sanity check for all members of an application I/O interface */
+static int openr2_context_check_io_interface(openr2_context_t *r2context, openr2_io_interface_t *io_interface)
+{
+	if (!io_interface) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "I/O interface cannot be null!\n");
+		return -1;
+	}
+	if (!io_interface->open) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: open\n");
+		return -1;
+	}
+	if (!io_interface->close) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: close\n");
+		return -1;
+	}
+	if (!io_interface->set_cas) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: set_cas\n");
+		return -1;
+	}
+	if (!io_interface->get_cas) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: get_cas\n");
+		return -1;
+	}
+	if (!io_interface->flush_write_buffers) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: flush_write_buffers\n");
+		return -1;
+	}
+	if (!io_interface->write) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: write\n");
+		return -1;
+	}
+	if (!io_interface->read) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: read\n");
+		return -1;
+	}
+	if (!io_interface->setup) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: setup\n");
+		return -1;
+	}
+	if (!io_interface->wait) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: wait\n");
+		return -1;
+	}
+	if (!io_interface->get_oob_event) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: get_oob_event\n");
+		return -1;
+	}
+	return 0;
+}
+
 OR2_DECLARE(int) openr2_context_set_io_type(openr2_context_t *r2context, openr2_io_type_t io_type, openr2_io_interface_t *io_interface)
 {
 	openr2_io_interface_t *internal_io_interface = NULL;
 	switch (io_type) {
 	case OR2_IO_CUSTOM:
-		/* sanity check for all members */
-		if (!io_interface) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "I/O interface cannot be null!\n");
+		if (openr2_context_check_io_interface(r2context, io_interface)) {
 			return -1;
 		}
-		if (!io_interface->open) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: open\n");
-			return -1;
-		}
-		if (!io_interface->close) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: close\n");
-			return -1;
-		}
-		if (!io_interface->set_cas) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: set_cas\n");
-			return -1;
-		}
-		if (!io_interface->get_cas) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: get_cas\n");
-			return -1;
-		}
-		if (!io_interface->flush_write_buffers) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: flush_write_buffers\n");
-			return -1;
-		}
-		if (!io_interface->write) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: write\n");
-			return -1;
-		}
-		if (!io_interface->read) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: read\n");
-			return -1;
-		}
-		if (!io_interface->setup) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: setup\n");
+		r2context->io = io_interface;
+		r2context->io_type = io_type;
+		return 0;
+	case OR2_IO_ZT:
+		/* check that zaptel interface is available */
+		internal_io_interface = openr2_io_get_zt_interface();
+		if (!internal_io_interface) {
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unavailable Zaptel or DAHDI I/O interface.\n");
 			return -1;
 		}
-		if (!io_interface->wait) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: wait\n");
+		r2context->io_type = io_type;
+		r2context->io = internal_io_interface;
+		return 0;
+	case OR2_IO_LOOPBACK:
+		internal_io_interface = openr2_io_get_loopback_interface();
+		if (!internal_io_interface) {
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unavailable loopback I/O interface.\n");
 			return -1;
 		}
-		if (!io_interface->get_oob_event) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unspecified I/O interface method: get_oob_event\n");
+		r2context->io_type = io_type;
+		r2context->io = internal_io_interface;
+		return 0;
+	case OR2_IO_SHM:
+		internal_io_interface = openr2_io_get_shm_interface();
+		if (!internal_io_interface) {
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unavailable shared memory I/O interface.\n");
 			return -1;
 		}
-		r2context->io = io_interface;
 		r2context->io_type = io_type;
+		r2context->io = internal_io_interface;
 		return 0;
-	case OR2_IO_ZT:
-		/* check that zaptel interface is available */
-		internal_io_interface = openr2_io_get_zt_interface();
+	case OR2_IO_URING:
+		internal_io_interface = openr2_io_get_uring_interface();
 		if (!internal_io_interface) {
-			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unavailable Zaptel or DAHDI I/O interface.\n");
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unavailable io_uring I/O interface.\n");
 			return -1;
 		}
+		/* the given interface, or the Zaptel one, does all but the media */
+		if (!io_interface) {
+			io_interface = openr2_io_get_zt_interface();
+			if (!io_interface) {
+				openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Unavailable Zaptel or DAHDI I/O interface.\n");
+				return -1;
+			}
+		} else if (openr2_context_check_io_interface(r2context, io_interface)) {
+			return -1;
+		}
+		r2context->uring_base = io_interface;
 		r2context->io_type = io_type;
 		r2context->io = internal_io_interface;
 		return 0;
@@ -836,8 +1078,29 @@ OR2_DECLARE(int) openr2_context_set_io_type(openr2_context_t *r2context, openr2_
 		} \
 	}
 
+/* the cadences are only taken through openr2_context_set_cpt_cadence() once
+   the file is read, so they go through the same checks */
+#define LOADCADENCE(mycadence) \
+	else if (1 == sscanf(line, "cpt." #mycadence "=%d", &intvalue)) { \
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_DEBUG, "Found value %d for setting cpt.%s\n", intvalue, #mycadence); \
+		cpt.mycadence = intvalue; \
+	}
+
+static void apply_cpt_cadence(openr2_context_t *r2context, openr2_cpt_tone_t tone, const char *name,
+		const openr2_cpt_cadence_t *cadence, const openr2_cpt_cadence_t *current)
+{
+	if (!memcmp(cadence, current, sizeof(*cadence))) {
+		return;
+	}
+	if (openr2_context_set_cpt_cadence(r2context, tone, cadence)) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Keeping the %s cadence of %dHz, %dms on, %dms off\n",
+				name, current->freq, current->on_ms, current->off_ms);
+	}
+}
+
 OR2_DECLARE(int) openr2_context_configure_from_advanced_file(openr2_context_t *r2context, const char *filename)
 {
+	openr2_cpt_config_t cpt;
 	FILE *variant_file;
 	int intvalue = 0;
 	char line[255];
@@ -850,6 +1113,7 @@ OR2_DECLARE(int) openr2_context_configure_from_advanced_file(openr2_context_t *r
 		return -1;
 	}
 	openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_NOTICE, "Reading R2 definitions from protocol file '%s'\n", filename);
+	cpt = r2context->cpt;
 	while (fgets(line, sizeof(line), variant_file))	{
 
 		if ('#' == line[0] || '\n' == line[0] || ' ' == line[0]) {
@@ -913,11 +1177,32 @@ OR2_DECLARE(int) openr2_context_configure_from_advanced_file(openr2_context_t *r
 
 		/* misc settings */
 		LOADSETTING(mf_threshold)
+		LOADSETTING(mf_sliding_detection)
+		LOADSETTING(mf_tracking_detection)
+		LOADSETTING(mf_stats)
+		LOADSETTING(call_progress_detection)
+		LOADSETTING(linear_io)
+		LOADSETTING(loopback_free_running)
+
+		/* call progress tones */
+		LOADCADENCE(busy.freq)
+		LOADCADENCE(busy.on_ms)
+		LOADCADENCE(busy.off_ms)
+		LOADCADENCE(congestion.freq)
+		LOADCADENCE(congestion.on_ms)
+		LOADCADENCE(congestion.off_ms)
+		LOADCADENCE(ringback.freq)
+		LOADCADENCE(ringback.on_ms)
+		LOADCADENCE(ringback.off_ms)
+		LOADSETTING(cpt.sit)
 
 		/* CAS R2 bits */
 		LOADSETTING(cas_r2_bits)
 		LOADSETTING(cas_nonr2_bits)
 	}
+	apply_cpt_cadence(r2context, OR2_CPT_BUSY, "busy", &cpt.busy, &r2context->cpt.busy);
+	apply_cpt_cadence(r2context, OR2_CPT_CONGESTION, "congestion", &cpt.congestion, &r2context->cpt.congestion);
+	apply_cpt_cadence(r2context, OR2_CPT_RINGBACK, "ringback", &cpt.ringback, &r2context->cpt.ringback);
 	r2context->configured_from_file = 1;
 	fclose(variant_file);
 	return 0;
@@ -0,0 +1,858 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2dsp_bench.c - run the MF, DTMF and call progress tone detectors over a
+ *                 synthetic corpus and report their accuracy, edge timing
+ *                 and throughput
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "openr2/openr2.h"
+#include "openr2/r2engine-pvt.h"
+
+#if !defined(M_PI)
+#define M_PI 3.14159265358979323846
+#endif
+
+#define SAMPLE_RATE 8000
+#define ms_to_samples(ms) ((ms) * (SAMPLE_RATE / 1000))
+#define samples_to_ms(samples) ((float)(samples) * 1000.0f / (float)SAMPLE_RATE)
+
+/* chunk used while checking accuracy, which is the resolution of the edge timing */
+#define ACCURACY_CHUNK_SAMPLES 40
+/* chunk used while measuring throughput, as a channel reads it */
+#define SPEED_CHUNK_SAMPLES 160
+/* minimum CPU time spent measuring the throughput of each detector */
+#define SPEED_MIN_SECONDS 0.5
+
+/* a detector report this long after the end of a tone still belongs to it */
+#define TONE_GRACE_SAMPLES ms_to_samples(40)
+
+#define MF_ON_MS 100
+#define MF_OFF_MS 100
+#define DTMF_ON_MS 50
+#define DTMF_OFF_MS 50
+#define TALKOFF_MS 30000
+/* the call progress detector is started over on each piece of speech this long */
+#define CPT_TALKOFF_SEGMENT_MS 5000
+/* random silence before each call progress clip, so it starts anywhere in a block */
+#define CPT_MAX_LEAD_MS 300
+
+/* direction of a tone in the corpus */
+#define TONE_DTMF -1
+#define TONE_BACKWARD 0
+#define TONE_FORWARD 1
+
+typedef struct {
+	int start;
+	int end;
+	int direction;
+	char digit;
+} tone_t;
+
+typedef struct {
+	int16_t *samples;
+	int length;
+	int size;
+	tone_t *tones;
+	int tone_count;
+	int tone_size;
+} corpus_t;
+
+typedef struct {
+	const char *name;
+	int fixed_point;
+	int sliding;
+	int tracking;
+} mf_engine_t;
+
+typedef struct {
+	const char *name;
+	int fixed_point;
+} dtmf_engine_t;
+
+typedef struct {
+	int tones;
+	int detected;
+	int missed;
+	int wrong;
+	int dropouts;
+	int false_hits;
+	int talkoff_hits;
+	long on_delay_total;
+	int on_delay_max;
+	int off_delays;
+	long off_delay_total;
+	int off_delay_max;
+	double samples_per_second;
+} stats_t;
+
+static const mf_engine_t mf_engines[] = {
+	{ "float", 0, 0, 0 },
+	{ "fixed", 1, 0, 0 },
+	{ "sliding", 0, 1, 0 },
+	{ "fixed+sliding", 1, 1, 0 },
+	{ "tracking", 0, 0, 1 },
+	{ "fixed+tracking", 1, 0, 1 },
+};
+
+static const dtmf_engine_t dtmf_engines[] = {
+	{ "float", 0 },
+	{ "fixed", 1 },
+};
+
+/* a call progress clip: freq Hz, on_ms on and off_ms off, for ms in total.
+   A frequency of 0 is the three SIT tones on_ms each, then off_ms of silence */
+typedef struct {
+	const char *name;
+	int expected;
+	int freq;
+	int on_ms;
+	int off_ms;
+	int ms;
+} cpt_case_t;
+
+typedef struct {
+	int clips;
+	int detected;
+	int missed;
+	int wrong;
+	long delay_total;
+	int delay_max;
+} cpt_stats_t;
+
+/* the detector runs with the ITU-T E.180 tones, the default of most variants */
+static const openr2_cpt_config_t cpt_config = {
+	{ 425, 500, 500 },
+	{ 425, 250, 250 },
+	{ 425, 1000, 4000 },
+	1
+};
+
+static const cpt_case_t cpt_cases[] = {
+	{ "busy", OR2_CPT_BUSY, 425, 500, 500, 4000 },
+	{ "congestion", OR2_CPT_CONGESTION, 425, 250, 250, 3000 },
+	{ "ringback", OR2_CPT_RINGBACK, 425, 1000, 4000, 12000 },
+	{ "sit", OR2_CPT_SIT, 0, 330, 1000, 4000 },
+	/* off nominal cadences and frequencies, still within the tolerances */
+	{ "busy +15%", OR2_CPT_BUSY, 425, 575, 575, 5000 },
+	{ "busy -15%", OR2_CPT_BUSY, 425, 425, 425, 4000 },
+	{ "ringback +10%", OR2_CPT_RINGBACK, 425, 1100, 4400, 13000 },
+	{ "busy +2% freq", OR2_CPT_BUSY, 434, 500, 500, 4000 },
+	{ "sit 280ms", OR2_CPT_SIT, 0, 280, 1000, 4000 },
+	/* a cadence half way between busy and congestion is none of them */
+	{ "350/350ms", OR2_CPT_NONE, 425, 350, 350, 5000 },
+};
+
+static const char *cpt_names[] = { "none", "busy", "congestion", "ringback", "sit" };
+static const int cpt_levels[] = { -10, -20, -30 };                             /* dBm0 */
+
+static const char mf_tones[] = "1234567890BCDEF";
+static const char dtmf_tones[] = "123A456B789C*0#D";
+
+/* R2 frequencies, in the order of the digits in mf_tones */
+static const int mf_fwd_pairs[15][2] = {
+	{ 1380, 1500 }, { 1380, 1620 }, { 1500, 1620 }, { 1380, 1740 }, { 1500, 1740 },
+	{ 1620, 1740 }, { 1380, 1860 }, { 1500, 1860 }, { 1620, 1860 }, { 1740, 1860 },
+	{ 1380, 1980 }, { 1500, 1980 }, { 1620, 1980 }, { 1740, 1980 }, { 1860, 1980 }
+};
+static const int mf_back_pairs[15][2] = {
+	{ 1140, 1020 }, { 1140, 900 }, { 1020, 900 }, { 1140, 780 }, { 1020, 780 },
+	{ 900, 780 }, { 1140, 660 }, { 1020, 660 }, { 900, 660 }, { 780, 660 },
+	{ 1140, 540 }, { 1020, 540 }, { 900, 540 }, { 780, 540 }, { 660, 540 }
+};
+static const int dtmf_row[4] = { 697, 770, 852, 941 };
+static const int dtmf_col[4] = { 1209, 1336, 1477, 1633 };
+
+/* the conditions every tone is synthesized under */
+static const float mf_offsets[] = { -10.0f, -4.0f, 0.0f, 4.0f, 10.0f };        /* Hz */
+static const float dtmf_offsets[] = { -0.015f, 0.0f, 0.015f };                 /* relative */
+static const int mf_levels[] = { -5, -15, -25, -35 };                          /* dBm0 */
+static const int dtmf_levels[] = { -5, -15, -25 };                             /* dBm0 */
+static const int mf_twists[] = { -5, 0, 5 };                                   /* dB */
+static const int dtmf_twists[] = { -4, 0, 4 };                                 /* dB */
+static const int noise_levels[] = { 0, -40, -30 };                             /* dBm0, 0 is none */
+
+#define ARRAY_LEN(x) (int)(sizeof(x) / sizeof((x)[0]))
+
+static unsigned int seed = 1;
+
+static float random_uniform(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return (float)((seed >> 8) & 0xFFFF) / 65536.0f;
+}
+
+static float random_gaussian(void)
+{
+	float u1;
+	float u2;
+
+	do {
+		u1 = random_uniform();
+	} while (u1 <= 0.0f);
+	u2 = random_uniform();
+	return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * (float)M_PI * u2);
+}
+
+/* peak amplitude of a sine at the given dBm0 level, as for A-law */
+static float dbm0_to_amplitude(float level)
+{
+	return 32767.0f * powf(10.0f, (level - 3.14f) / 20.0f);
+}
+
+static int16_t saturate(float amp)
+{
+	if (amp > 32767.0f) {
+		return 32767;
+	}
+	if (amp < -32768.0f) {
+		return -32768;
+	}
+	return (int16_t)lrintf(amp);
+}
+
+static int16_t *corpus_grow(corpus_t *corpus, int samples)
+{
+	int16_t *grown;
+
+	if (corpus->length + samples > corpus->size) {
+		corpus->size = (corpus->length + samples) * 2;
+		grown = realloc(corpus->samples, corpus->size * sizeof(*corpus->samples));
+		if (!grown) {
+			fprintf(stderr, "could not allocate the corpus\n");
+			exit(1);
+		}
+		corpus->samples = grown;
+	}
+	corpus->length += samples;
+	return corpus->samples + corpus->length - samples;
+}
+
+static void corpus_add_silence(corpus_t *corpus, int ms, int noise)
+{
+	int16_t *amp;
+	float noise_rms;
+	int samples = ms_to_samples(ms);
+	int i;
+
+	amp = corpus_grow(corpus, samples);
+	noise_rms = noise ? dbm0_to_amplitude((float)noise) / sqrtf(2.0f) : 0.0f;
+	for (i = 0; i < samples; i++) {
+		amp[i] = saturate(noise_rms * random_gaussian());
+	}
+}
+
+/* two tones, the second one twist dB above the first one */
+static void corpus_add_tone(corpus_t *corpus, int direction, char digit, float f1, float f2,
+		int level, int twist, int noise, int ms)
+{
+	tone_t *tone;
+	int16_t *amp;
+	float amp1;
+	float amp2;
+	float noise_rms;
+	float phase1;
+	float phase2;
+	int samples = ms_to_samples(ms);
+	int start = corpus->length;
+	int i;
+
+	amp = corpus_grow(corpus, samples);
+	amp1 = dbm0_to_amplitude((float)level - (float)twist / 2.0f);
+	amp2 = dbm0_to_amplitude((float)level + (float)twist / 2.0f);
+	noise_rms = noise ? dbm0_to_amplitude((float)noise) / sqrtf(2.0f) : 0.0f;
+	/* start each tone at a random phase, as a real sender would */
+	phase1 = 2.0f * (float)M_PI * random_uniform();
+	phase2 = 2.0f * (float)M_PI * random_uniform();
+	for (i = 0; i < samples; i++) {
+		amp[i] = saturate(amp1 * sinf(phase1 + 2.0f * (float)M_PI * f1 * i / SAMPLE_RATE)
+				+ amp2 * sinf(phase2 + 2.0f * (float)M_PI * f2 * i / SAMPLE_RATE)
+				+ noise_rms * random_gaussian());
+	}
+
+	if (corpus->tone_count == corpus->tone_size) {
+		corpus->tone_size = corpus->tone_size ? corpus->tone_size * 2 : 1024;
+		tone = realloc(corpus->tones, corpus->tone_size * sizeof(*corpus->tones));
+		if (!tone) {
+			fprintf(stderr, "could not allocate the corpus tone list\n");
+			exit(1);
+		}
+		corpus->tones = tone;
+	}
+	tone = &corpus->tones[corpus->tone_count++];
+	tone->start = start;
+	tone->end = start + samples;
+	tone->direction = direction;
+	tone->digit = digit;
+}
+
+/* one tone, for the call progress clips */
+static void corpus_add_single_tone(corpus_t *corpus, float freq, int level, int noise, int ms)
+{
+	int16_t *amp;
+	float amplitude;
+	float noise_rms;
+	float phase;
+	int samples = ms_to_samples(ms);
+	int i;
+
+	amp = corpus_grow(corpus, samples);
+	amplitude = dbm0_to_amplitude((float)level);
+	noise_rms = noise ? dbm0_to_amplitude((float)noise) / sqrtf(2.0f) : 0.0f;
+	phase = 2.0f * (float)M_PI * random_uniform();
+	for (i = 0; i < samples; i++) {
+		amp[i] = saturate(amplitude * sinf(phase + 2.0f * (float)M_PI * freq * i / SAMPLE_RATE)
+				+ noise_rms * random_gaussian());
+	}
+}
+
+/* voiced syllables with a random pitch and vowel, and pauses in between,
+   to see what the detectors make of someone talking */
+static void corpus_add_speech(corpus_t *corpus, int ms)
+{
+	/* first and second formants of a few vowels */
+	static const float formants[][2] = {
+		{ 730.0f, 1090.0f }, { 530.0f, 1840.0f }, { 270.0f, 2290.0f },
+		{ 570.0f, 840.0f }, { 300.0f, 870.0f }, { 660.0f, 1720.0f }
+	};
+	int16_t *amp;
+	float pitch;
+	float level;
+	float sample;
+	float harmonic;
+	float gain;
+	float envelope;
+	int vowel;
+	int length;
+	int samples;
+	int i;
+	int h;
+
+	samples = ms_to_samples(ms);
+	amp = corpus_grow(corpus, samples);
+	for (i = 0; i < samples; ) {
+		length = ms_to_samples(80 + (int)(random_uniform() * 220.0f));
+		if (length > samples - i) {
+			length = samples - i;
+		}
+		if (random_uniform() < 0.3f) {
+			for (h = 0; h < length; h++) {
+				amp[i + h] = saturate(dbm0_to_amplitude(-50.0f) * random_gaussian());
+			}
+			i += length;
+			continue;
+		}
+		pitch = 90.0f + random_uniform() * 160.0f;
+		level = dbm0_to_amplitude(-20.0f + random_uniform() * 15.0f);
+		vowel = (int)(random_uniform() * ARRAY_LEN(formants));
+		for (h = 0; h < length; h++) {
+			sample = 0.0f;
+			/* the pitch drifts a little along the syllable */
+			for (harmonic = 1.0f; harmonic * pitch < 3400.0f; harmonic += 1.0f) {
+				gain = 1.0f / (1.0f + fabsf(harmonic * pitch - formants[vowel][0]) / 150.0f)
+					+ 0.5f / (1.0f + fabsf(harmonic * pitch - formants[vowel][1]) / 200.0f);
+				sample += gain * sinf(2.0f * (float)M_PI * harmonic * pitch * (1.0f + 0.05f * h / length) * h / SAMPLE_RATE);
+			}
+			envelope = sinf((float)M_PI * h / length);
+			amp[i + h] = saturate(level * envelope * sample / 3.0f);
+		}
+		i += length;
+	}
+}
+
+static void build_mf_corpus(corpus_t *corpus)
+{
+	const int (*pairs)[2];
+	int direction;
+	int offset;
+	int level;
+	int twist;
+	int noise;
+	int i;
+
+	for (direction = TONE_BACKWARD; direction <= TONE_FORWARD; direction++) {
+		pairs = (direction == TONE_FORWARD) ? mf_fwd_pairs : mf_back_pairs;
+		for (offset = 0; offset < ARRAY_LEN(mf_offsets); offset++) {
+			for (level = 0; level < ARRAY_LEN(mf_levels); level++) {
+				for (twist = 0; twist < ARRAY_LEN(mf_twists); twist++) {
+					for (noise = 0; noise < ARRAY_LEN(noise_levels); noise++) {
+						for (i = 0; mf_tones[i]; i++) {
+							corpus_add_tone(corpus, direction, mf_tones[i],
+									pairs[i][0] + mf_offsets[offset], pairs[i][1] + mf_offsets[offset],
+									mf_levels[level], mf_twists[twist], noise_levels[noise], MF_ON_MS);
+							corpus_add_silence(corpus, MF_OFF_MS, noise_levels[noise]);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+static void build_dtmf_corpus(corpus_t *corpus)
+{
+	float scale;
+	int offset;
+	int level;
+	int twist;
+	int noise;
+	int i;
+
+	for (offset = 0; offset < ARRAY_LEN(dtmf_offsets); offset++) {
+		scale = 1.0f + dtmf_offsets[offset];
+		for (level = 0; level < ARRAY_LEN(dtmf_levels); level++) {
+			for (twist = 0; twist < ARRAY_LEN(dtmf_twists); twist++) {
+				for (noise = 0; noise < ARRAY_LEN(noise_levels); noise++) {
+					for (i = 0; dtmf_tones[i]; i++) {
+						corpus_add_tone(corpus, TONE_DTMF, dtmf_tones[i],
+								dtmf_row[i / 4] * scale, dtmf_col[i % 4] * scale,
+								dtmf_levels[level], dtmf_twists[twist], noise_levels[noise], DTMF_ON_MS);
+						corpus_add_silence(corpus, DTMF_OFF_MS, noise_levels[noise]);
+					}
+				}
+			}
+		}
+	}
+}
+
+static void build_cpt_clip(corpus_t *corpus, const cpt_case_t *cpt, int level, int noise)
+{
+	int i;
+
+	corpus->length = 0;
+	corpus_add_silence(corpus, (int)(random_uniform() * CPT_MAX_LEAD_MS), noise);
+	while (corpus->length < ms_to_samples(cpt->ms)) {
+		if (cpt->freq) {
+			corpus_add_single_tone(corpus, (float)cpt->freq, level, noise, cpt->on_ms);
+		} else {
+			for (i = 0; i < 3; i++) {
+				corpus_add_single_tone(corpus, i == 0 ? 950.0f : i == 1 ? 1400.0f : 1800.0f, level, noise, cpt->on_ms);
+			}
+		}
+		corpus_add_silence(corpus, cpt->off_ms, noise);
+	}
+}
+
+static void bench_cpt(const cpt_case_t *cpt, cpt_stats_t *stats)
+{
+	openr2_cpt_rx_state_t rxstate;
+	corpus_t clip;
+	int first;
+	int delay;
+	int level;
+	int noise;
+	int tone;
+	int position;
+
+	memset(stats, 0, sizeof(*stats));
+	memset(&clip, 0, sizeof(clip));
+	for (level = 0; level < ARRAY_LEN(cpt_levels); level++) {
+		for (noise = 0; noise < ARRAY_LEN(noise_levels); noise++) {
+			build_cpt_clip(&clip, cpt, cpt_levels[level], noise_levels[noise]);
+			openr2_cpt_rx_init(&rxstate, &cpt_config);
+			stats->clips++;
+			first = OR2_CPT_NONE;
+			delay = 0;
+			for (position = 0; position + SPEED_CHUNK_SAMPLES <= clip.length; position += SPEED_CHUNK_SAMPLES) {
+				tone = openr2_cpt_rx(&rxstate, clip.samples + position, SPEED_CHUNK_SAMPLES);
+				if (tone == OR2_CPT_NONE) {
+					continue;
+				}
+				if (tone != cpt->expected) {
+					/* any other tone, even after the right one, is a wrong report */
+					first = -1;
+					break;
+				}
+				if (first == OR2_CPT_NONE) {
+					first = tone;
+					delay = position + SPEED_CHUNK_SAMPLES;
+				}
+			}
+			if (first == -1) {
+				stats->wrong++;
+			} else if (first == OR2_CPT_NONE && cpt->expected != OR2_CPT_NONE) {
+				stats->missed++;
+			} else {
+				stats->detected++;
+				stats->delay_total += delay;
+				if (delay > stats->delay_max) {
+					stats->delay_max = delay;
+				}
+			}
+		}
+	}
+	free(clip.samples);
+}
+
+/* tones reported on speech, starting over every CPT_TALKOFF_SEGMENT_MS */
+static int bench_cpt_talkoff(const corpus_t *speech, int *segments)
+{
+	openr2_cpt_rx_state_t rxstate;
+	int segment = ms_to_samples(CPT_TALKOFF_SEGMENT_MS);
+	int hits = 0;
+	int position;
+
+	*segments = 0;
+	for (position = 0; position + SPEED_CHUNK_SAMPLES <= speech->length; position += SPEED_CHUNK_SAMPLES) {
+		if (position % segment == 0) {
+			openr2_cpt_rx_init(&rxstate, &cpt_config);
+			(*segments)++;
+		}
+		if (openr2_cpt_rx(&rxstate, speech->samples + position, SPEED_CHUNK_SAMPLES) != OR2_CPT_NONE) {
+			hits++;
+		}
+	}
+	return hits;
+}
+
+/* the accounting of the reports of one detector over a corpus */
+typedef struct {
+	const corpus_t *corpus;
+	int direction;
+	int *hits;
+	int cursor;
+	int current_digit;
+	int current_tone;
+	stats_t *stats;
+} tracker_t;
+
+static void tracker_init(tracker_t *tracker, const corpus_t *corpus, int direction, stats_t *stats)
+{
+	int i;
+
+	memset(tracker, 0, sizeof(*tracker));
+	tracker->corpus = corpus;
+	tracker->direction = direction;
+	tracker->current_tone = -1;
+	tracker->stats = stats;
+	tracker->hits = calloc(corpus->tone_count ? corpus->tone_count : 1, sizeof(*tracker->hits));
+	if (!tracker->hits) {
+		fprintf(stderr, "could not allocate the tone hits\n");
+		exit(1);
+	}
+	for (i = 0; i < corpus->tone_count; i++) {
+		if (corpus->tones[i].direction == direction) {
+			stats->tones++;
+		}
+	}
+}
+
+/* a detector reported digit (0 for none) at the given sample */
+static void tracker_report(tracker_t *tracker, int digit, int position)
+{
+	const tone_t *tones = tracker->corpus->tones;
+	const tone_t *tone;
+	stats_t *stats = tracker->stats;
+	int delay;
+
+	if (digit == tracker->current_digit) {
+		return;
+	}
+	if (tracker->current_digit && tracker->current_tone >= 0) {
+		/* the end of a good detection */
+		tone = &tones[tracker->current_tone];
+		if (position >= tone->end) {
+			delay = position - tone->end;
+			stats->off_delays++;
+			stats->off_delay_total += delay;
+			if (delay > stats->off_delay_max) {
+				stats->off_delay_max = delay;
+			}
+		}
+	}
+	tracker->current_digit = digit;
+	tracker->current_tone = -1;
+	if (!digit) {
+		return;
+	}
+
+	while (tracker->cursor < tracker->corpus->tone_count
+	       && tones[tracker->cursor].end + TONE_GRACE_SAMPLES < position) {
+		tracker->cursor++;
+	}
+	if (tracker->cursor == tracker->corpus->tone_count || tones[tracker->cursor].start > position) {
+		stats->false_hits++;
+		return;
+	}
+	tone = &tones[tracker->cursor];
+	if (tone->direction != tracker->direction) {
+		/* a tone meant for the other direction */
+		stats->false_hits++;
+		return;
+	}
+	if (tone->digit != digit) {
+		stats->wrong++;
+		return;
+	}
+	if (tracker->hits[tracker->cursor]++) {
+		stats->dropouts++;
+	} else {
+		delay = position - tone->start;
+		stats->on_delay_total += delay;
+		if (delay > stats->on_delay_max) {
+			stats->on_delay_max = delay;
+		}
+	}
+	tracker->current_tone = tracker->cursor;
+}
+
+static void tracker_finish(tracker_t *tracker)
+{
+	int i;
+
+	for (i = 0; i < tracker->corpus->tone_count; i++) {
+		if (tracker->corpus->tones[i].direction != tracker->direction) {
+			continue;
+		}
+		if (tracker->hits[i]) {
+			tracker->stats->detected++;
+		} else {
+			tracker->stats->missed++;
+		}
+	}
+	free(tracker->hits);
+}
+
+static void init_mf_detector(openr2_mf_rx_state_t *rxstate, int fwd, const mf_engine_t *engine)
+{
+	openr2_mf_rx_init(rxstate, fwd);
+	openr2_mf_rx_set_fixed_point(rxstate, engine->fixed_point);
+	openr2_mf_rx_set_sliding(rxstate, engine->sliding);
+	openr2_mf_rx_set_tracking(rxstate, engine->tracking);
+}
+
+/* openr2_mf_rx() only reports a digit on the calls that end a detection
+   block, so keep the last one reported over the calls that do not */
+static int mf_digit(openr2_mf_rx_state_t *rxstate, const int16_t amp[], int samples, int *digit)
+{
+	unsigned long before;
+	unsigned long after;
+	unsigned long skipped;
+	int result;
+
+	openr2_mf_rx_get_block_counts(rxstate, &before, &skipped);
+	result = openr2_mf_rx(rxstate, amp, samples);
+	openr2_mf_rx_get_block_counts(rxstate, &after, &skipped);
+	if (after != before) {
+		*digit = result;
+	}
+	return *digit;
+}
+
+static int dtmf_digit(openr2_dtmf_rx_state_t *rxstate)
+{
+	int digit = openr2_dtmf_rx_status(rxstate);
+
+	return digit == 'x' ? 0 : digit;
+}
+
+static int count_hits(int digit, int *current)
+{
+	int hit = digit && digit != *current;
+
+	*current = digit;
+	return hit;
+}
+
+static void bench_mf(const mf_engine_t *engine, const corpus_t *corpus, const corpus_t *speech, stats_t *stats)
+{
+	openr2_mf_rx_state_t rxstate[2];
+	tracker_t tracker[2];
+	clock_t start;
+	double elapsed;
+	double samples;
+	int current[2] = { 0, 0 };
+	int digit[2] = { 0, 0 };
+	int position;
+	int chunk;
+	int fwd;
+
+	memset(stats, 0, sizeof(*stats));
+	for (fwd = 0; fwd < 2; fwd++) {
+		init_mf_detector(&rxstate[fwd], fwd, engine);
+		tracker_init(&tracker[fwd], corpus, fwd ? TONE_FORWARD : TONE_BACKWARD, stats);
+	}
+	for (position = 0; position < corpus->length; position += chunk) {
+		chunk = corpus->length - position < ACCURACY_CHUNK_SAMPLES ? corpus->length - position : ACCURACY_CHUNK_SAMPLES;
+		for (fwd = 0; fwd < 2; fwd++) {
+			tracker_report(&tracker[fwd], mf_digit(&rxstate[fwd], corpus->samples + position, chunk, &digit[fwd]), position + chunk);
+		}
+	}
+	for (fwd = 0; fwd < 2; fwd++) {
+		tracker_finish(&tracker[fwd]);
+	}
+
+	for (fwd = 0; fwd < 2; fwd++) {
+		init_mf_detector(&rxstate[fwd], fwd, engine);
+		digit[fwd] = 0;
+	}
+	for (position = 0; position + ACCURACY_CHUNK_SAMPLES <= speech->length; position += ACCURACY_CHUNK_SAMPLES) {
+		for (fwd = 0; fwd < 2; fwd++) {
+			stats->talkoff_hits += count_hits(mf_digit(&rxstate[fwd], speech->samples + position, ACCURACY_CHUNK_SAMPLES, &digit[fwd]), &current[fwd]);
+		}
+	}
+
+	samples = 0.0;
+	start = clock();
+	do {
+		for (fwd = 0; fwd < 2; fwd++) {
+			init_mf_detector(&rxstate[fwd], fwd, engine);
+			for (position = 0; position + SPEED_CHUNK_SAMPLES <= corpus->length; position += SPEED_CHUNK_SAMPLES) {
+				openr2_mf_rx(&rxstate[fwd], corpus->samples + position, SPEED_CHUNK_SAMPLES);
+			}
+			samples += position;
+		}
+		elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+	} while (elapsed < SPEED_MIN_SECONDS);
+	stats->samples_per_second = samples / elapsed;
+}
+
+static void bench_dtmf(const dtmf_engine_t *engine, const corpus_t *corpus, const corpus_t *speech, stats_t *stats)
+{
+	openr2_dtmf_rx_state_t rxstate;
+	tracker_t tracker;
+	clock_t start;
+	double elapsed;
+	double samples;
+	int current = 0;
+	int position;
+	int chunk;
+
+	memset(stats, 0, sizeof(*stats));
+	openr2_dtmf_rx_init(&rxstate, NULL, NULL);
+	openr2_dtmf_rx_set_fixed_point(&rxstate, engine->fixed_point);
+	tracker_init(&tracker, corpus, TONE_DTMF, stats);
+	for (position = 0; position < corpus->length; position += chunk) {
+		chunk = corpus->length - position < ACCURACY_CHUNK_SAMPLES ? corpus->length - position : ACCURACY_CHUNK_SAMPLES;
+		openr2_dtmf_rx(&rxstate, corpus->samples + position, chunk);
+		tracker_report(&tracker, dtmf_digit(&rxstate), position + chunk);
+	}
+	tracker_finish(&tracker);
+
+	openr2_dtmf_rx_init(&rxstate, NULL, NULL);
+	openr2_dtmf_rx_set_fixed_point(&rxstate, engine->fixed_point);
+	for (position = 0; position + ACCURACY_CHUNK_SAMPLES <= speech->length; position += ACCURACY_CHUNK_SAMPLES) {
+		openr2_dtmf_rx(&rxstate, speech->samples + position, ACCURACY_CHUNK_SAMPLES);
+		stats->talkoff_hits += count_hits(dtmf_digit(&rxstate), &current);
+	}
+
+	samples = 0.0;
+	start = clock();
+	do {
+		openr2_dtmf_rx_init(&rxstate, NULL, NULL);
+		openr2_dtmf_rx_set_fixed_point(&rxstate, engine->fixed_point);
+		for (position = 0; position + SPEED_CHUNK_SAMPLES <= corpus->length; position += SPEED_CHUNK_SAMPLES) {
+			openr2_dtmf_rx(&rxstate, corpus->samples + position, SPEED_CHUNK_SAMPLES);
+		}
+		samples += position;
+		elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+	} while (elapsed < SPEED_MIN_SECONDS);
+	stats->samples_per_second = samples / elapsed;
+}
+
+static void print_header(const char *detector, const corpus_t *corpus)
+{
+	printf("\n%s detectors, %d tones over %.1f s of audio\n", detector, corpus->tone_count, corpus->length / (float)SAMPLE_RATE);
+	printf("%-16s %8s %7s %6s %6s %6s %8s %8s %8s %8s %8s %10s\n",
+			"engine", "detected", "missed", "wrong", "drops", "false", "talkoff",
+			"on avg", "on max", "off avg", "off max", "Msamples/s");
+}
+
+static void print_stats(const char *engine, const stats_t *stats)
+{
+	printf("%-16s %7.2f%% %7d %6d %6d %6d %8d %6.1fms %6.1fms %6.1fms %6.1fms %10.2f\n",
+			engine,
+			stats->tones ? 100.0f * stats->detected / stats->tones : 0.0f,
+			stats->missed, stats->wrong, stats->dropouts, stats->false_hits, stats->talkoff_hits,
+			stats->detected ? samples_to_ms(stats->on_delay_total / stats->detected) : 0.0f,
+			samples_to_ms(stats->on_delay_max),
+			stats->off_delays ? samples_to_ms(stats->off_delay_total / stats->off_delays) : 0.0f,
+			samples_to_ms(stats->off_delay_max),
+			stats->samples_per_second / 1.0e6);
+}
+
+int main(int argc, char *argv[])
+{
+	corpus_t mf_corpus;
+	corpus_t dtmf_corpus;
+	corpus_t speech;
+	stats_t stats;
+	cpt_stats_t cpt_stats;
+	int cpt_segments;
+	int cpt_hits;
+	int i;
+
+	if (argc > 1) {
+		fprintf(stderr, "USAGE: %s\n", argv[0]);
+		exit(1);
+	}
+
+	printf("Running MF, DTMF and call progress detector benchmark over a synthetic corpus\n");
+	printf("MF tones: %dms on, %dms off, offsets of up to %.0fHz, %d to %ddBm0, twist up to %ddB\n",
+			MF_ON_MS, MF_OFF_MS, mf_offsets[ARRAY_LEN(mf_offsets) - 1],
+			mf_levels[0], mf_levels[ARRAY_LEN(mf_levels) - 1], mf_twists[ARRAY_LEN(mf_twists) - 1]);
+	printf("DTMF tones: %dms on, %dms off, offsets of up to %.1f%%, %d to %ddBm0, twist up to %ddB\n",
+			DTMF_ON_MS, DTMF_OFF_MS, 100.0f * dtmf_offsets[ARRAY_LEN(dtmf_offsets) - 1],
+			dtmf_levels[0], dtmf_levels[ARRAY_LEN(dtmf_levels) - 1], dtmf_twists[ARRAY_LEN(dtmf_twists) - 1]);
+	printf("Noise: none, %d and %ddBm0. Talk-off: %d s of synthetic speech. Edge timing resolution: %.0fms\n",
+			noise_levels[1], noise_levels[2], TALKOFF_MS / 1000, samples_to_ms(ACCURACY_CHUNK_SAMPLES));
+
+	memset(&mf_corpus, 0, sizeof(mf_corpus));
+	memset(&dtmf_corpus, 0, sizeof(dtmf_corpus));
+	memset(&speech, 0, sizeof(speech));
+	build_mf_corpus(&mf_corpus);
+	build_dtmf_corpus(&dtmf_corpus);
+	corpus_add_speech(&speech, TALKOFF_MS);
+
+	print_header("MF", &mf_corpus);
+	for (i = 0; i < ARRAY_LEN(mf_engines); i++) {
+		bench_mf(&mf_engines[i], &mf_corpus, &speech, &stats);
+		print_stats(mf_engines[i].name, &stats);
+	}
+
+	print_header("DTMF", &dtmf_corpus);
+	for (i = 0; i < ARRAY_LEN(dtmf_engines); i++) {
+		bench_dtmf(&dtmf_engines[i], &dtmf_corpus, &speech, &stats);
+		print_stats(dtmf_engines[i].name, &stats);
+	}
+
+	printf("\nCall progress tone detector, each case at %d to %ddBm0 with each noise level\n",
+			cpt_levels[0], cpt_levels[ARRAY_LEN(cpt_levels) - 1]);
+	printf("%-16s %10s %5s %8s %7s %6s %8s %8s\n", "case", "expected", "clips", "correct", "missed", "wrong", "avg time", "max time");
+	for (i = 0; i < ARRAY_LEN(cpt_cases); i++) {
+		bench_cpt(&cpt_cases[i], &cpt_stats);
+		printf("%-16s %10s %5d %8d %7d %6d %6.0fms %6.0fms\n", cpt_cases[i].name, cpt_names[cpt_cases[i].expected],
+				cpt_stats.clips, cpt_stats.detected, cpt_stats.missed, cpt_stats.wrong,
+				cpt_stats.detected ? samples_to_ms(cpt_stats.delay_total / cpt_stats.detected) : 0.0f,
+				samples_to_ms(cpt_stats.delay_max));
+	}
+	cpt_hits = bench_cpt_talkoff(&speech, &cpt_segments);
+	printf("talk-off: %d tones reported over %d pieces of %d s of speech\n", cpt_hits, cpt_segments, CPT_TALKOFF_SEGMENT_MS / 1000);
+
+	free(mf_corpus.samples);
+	free(mf_corpus.tones);
+	free(dtmf_corpus.samples);
+	free(dtmf_corpus.tones);
+	free(speech.samples);
+	return 0;
+}
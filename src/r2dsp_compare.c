@@ -0,0 +1,498 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2dsp_compare.c - run the floating point and the fixed-point MF/DTMF
+ *                   detectors over the same audio and report any disagreement,
+ *                   and the multi-channel MF detector against the single one
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "openr2/openr2.h"
+#include "openr2/r2engine-pvt.h"
+
+#define FORMAT_INVALID 0
+#define FORMAT_ALAW 1
+#define FORMAT_SLINEAR 2
+
+#define CHUNK_SAMPLES 160
+#define SAMPLE_RATE 8000
+
+/* tone pairs of the edge cases: 100ms on, 60ms off */
+#define PAIR_CHUNKS 8
+#define PAIR_SAMPLES (PAIR_CHUNKS * CHUNK_SAMPLES)
+#define PAIR_ON_SAMPLES (5 * CHUNK_SAMPLES)
+/* channels and tone pairs of the multi-channel comparison. More channels
+   than the lanes of openr2_mf_rx_multi(), so the last group is partial */
+#define MULTI_CHANNELS 19
+#define MULTI_SLOTS 60
+/* how far a tone of an edge case is moved to see whether it sits on a limit */
+#define LIMIT_DB 0.05f
+
+#if !defined(M_PI)
+#define M_PI 3.14159265358979323846
+#endif
+
+#define USAGE "USAGE: %s [alaw|slinear] [alaw or slinear file path]\n" \
+              "Without arguments a built-in set of MF and DTMF tones is used, then tones\n" \
+              "around the level, twist and frequency limits of the detectors, and the\n" \
+              "multi-channel MF detector against the single channel one\n"
+
+#define samples_to_ms(samples) (int)((((float)samples/(float)8000)) * (float)1000)
+
+typedef struct {
+	openr2_mf_rx_state_t fwd;
+	openr2_mf_rx_state_t bwd;
+	openr2_dtmf_rx_state_t dtmf;
+} detectors_t;
+
+#define DETECTORS 3
+
+static const char *detector_names[DETECTORS] = { "Forward MF", "Backward MF", "DTMF" };
+
+/* MF frequencies, backward and forward, in "1234567890BCDEF" order */
+static const int mf_pairs[2][15][2] = {
+	{
+		{ 1140, 1020 }, { 1140, 900 }, { 1020, 900 }, { 1140, 780 }, { 1020, 780 },
+		{ 900, 780 }, { 1140, 660 }, { 1020, 660 }, { 900, 660 }, { 780, 660 },
+		{ 1140, 540 }, { 1020, 540 }, { 900, 540 }, { 780, 540 }, { 660, 540 }
+	},
+	{
+		{ 1380, 1500 }, { 1380, 1620 }, { 1500, 1620 }, { 1380, 1740 }, { 1500, 1740 },
+		{ 1620, 1740 }, { 1380, 1860 }, { 1500, 1860 }, { 1620, 1860 }, { 1740, 1860 },
+		{ 1380, 1980 }, { 1500, 1980 }, { 1620, 1980 }, { 1740, 1980 }, { 1860, 1980 }
+	}
+};
+
+static detectors_t float_detectors;
+static detectors_t fixed_detectors;
+static int processed_samples = 0;
+static int compared_blocks = 0;
+static int detected_tones = 0;
+static int mismatches = 0;
+static int limit_mismatches = 0;
+
+static void init_detectors(detectors_t *detectors, int fixed_point)
+{
+	openr2_mf_rx_init(&detectors->fwd, 1);
+	openr2_mf_rx_init(&detectors->bwd, 0);
+	openr2_dtmf_rx_init(&detectors->dtmf, NULL, NULL);
+	openr2_mf_rx_set_fixed_point(&detectors->fwd, fixed_point);
+	openr2_mf_rx_set_fixed_point(&detectors->bwd, fixed_point);
+	openr2_dtmf_rx_set_fixed_point(&detectors->dtmf, fixed_point);
+}
+
+static void compare_result(const char *detector, int float_digit, int fixed_digit)
+{
+	compared_blocks++;
+	if (float_digit) {
+		detected_tones++;
+	}
+	if (float_digit == fixed_digit) {
+		return;
+	}
+	mismatches++;
+	printf("%s mismatch: float %c, fixed %c (samples = %d, ms = %d)\n", detector,
+			float_digit ? float_digit : '-', fixed_digit ? fixed_digit : '-',
+			processed_samples, samples_to_ms(processed_samples));
+}
+
+/* run a chunk through one set of detectors, with the digit each one reports in digits[] */
+static void run_detectors(detectors_t *detectors, short *slinear_buffer, int samples, int digits[DETECTORS])
+{
+	digits[0] = openr2_mf_rx(&detectors->fwd, slinear_buffer, samples);
+	digits[1] = openr2_mf_rx(&detectors->bwd, slinear_buffer, samples);
+	openr2_dtmf_rx(&detectors->dtmf, slinear_buffer, samples);
+	digits[2] = openr2_dtmf_rx_status(&detectors->dtmf);
+	if (digits[2] == 'x') {
+		digits[2] = 0;
+	}
+}
+
+static void compare_chunk(short *slinear_buffer, int samples)
+{
+	int float_digits[DETECTORS];
+	int fixed_digits[DETECTORS];
+	int i;
+
+	processed_samples += samples;
+
+	run_detectors(&float_detectors, slinear_buffer, samples, float_digits);
+	run_detectors(&fixed_detectors, slinear_buffer, samples, fixed_digits);
+	for (i = 0; i < DETECTORS; i++) {
+		compare_result(detector_names[i], float_digits[i], fixed_digits[i]);
+	}
+}
+
+static void compare_file(FILE *audiofp, int format)
+{
+	short slinear_buffer[CHUNK_SAMPLES];
+	uint8_t alaw_buffer[CHUNK_SAMPLES];
+	int i;
+
+	if (format == FORMAT_ALAW) {
+		while (fread(alaw_buffer, sizeof(alaw_buffer), 1, audiofp) == 1) {
+			for (i = 0; i < CHUNK_SAMPLES; i++) {
+				slinear_buffer[i] = openr2_alaw_to_linear(alaw_buffer[i]);
+			}
+			compare_chunk(slinear_buffer, CHUNK_SAMPLES);
+		}
+	} else {
+		while (fread(slinear_buffer, sizeof(slinear_buffer), 1, audiofp) == 1) {
+			compare_chunk(slinear_buffer, CHUNK_SAMPLES);
+		}
+	}
+}
+
+/* attenuate by the given amount of dB and add some white noise */
+static void degrade_chunk(short *slinear_buffer, int samples, int attenuation, int noise)
+{
+	static unsigned int seed = 1;
+	int gain;
+	int i;
+
+	/* 10^(-dB/20) in Q12 for 0 to -45dB in 5dB steps */
+	static const int gains[] = { 4096, 2303, 1295, 728, 410, 230, 130, 73, 41, 23 };
+	gain = gains[attenuation / 5];
+	for (i = 0; i < samples; i++) {
+		seed = seed * 1103515245 + 12345;
+		slinear_buffer[i] = (short)(((int)slinear_buffer[i] * gain) >> 12) + (int)((seed >> 16) % (2 * noise + 1)) - noise;
+	}
+}
+
+static void compare_builtin(void)
+{
+	static const char mf_tones[] = "1234567890BCDEF";
+	static const char dtmf_tones[] = "1234567890*#ABCD";
+	short slinear_buffer[CHUNK_SAMPLES];
+	openr2_mf_tx_state_t mf_txstate;
+	openr2_dtmf_tx_state_t dtmf_txstate;
+	int attenuation;
+	int noise;
+	int fwd;
+	int i;
+	int j;
+
+	for (noise = 0; noise <= 400; noise += 200) {
+		for (attenuation = 0; attenuation <= 45; attenuation += 5) {
+			/* every forward and backward MF tone, 100ms on and 60ms off */
+			for (fwd = 0; fwd < 2; fwd++) {
+				openr2_mf_tx_init(&mf_txstate, fwd);
+				for (i = 0; mf_tones[i]; i++) {
+					openr2_mf_tx_put(&mf_txstate, mf_tones[i]);
+					for (j = 0; j < 5; j++) {
+						openr2_mf_tx(&mf_txstate, slinear_buffer, CHUNK_SAMPLES);
+						degrade_chunk(slinear_buffer, CHUNK_SAMPLES, attenuation, noise);
+						compare_chunk(slinear_buffer, CHUNK_SAMPLES);
+					}
+					openr2_mf_tx_put(&mf_txstate, 0);
+					for (j = 0; j < 3; j++) {
+						openr2_mf_tx(&mf_txstate, slinear_buffer, CHUNK_SAMPLES);
+						degrade_chunk(slinear_buffer, CHUNK_SAMPLES, attenuation, noise);
+						compare_chunk(slinear_buffer, CHUNK_SAMPLES);
+					}
+				}
+			}
+			/* every DTMF digit with the default timing */
+			openr2_dtmf_tx_init(&dtmf_txstate);
+			openr2_dtmf_tx_put(&dtmf_txstate, dtmf_tones, -1);
+			for (i = 0; i < 120; i++) {
+				memset(slinear_buffer, 0, sizeof(slinear_buffer));
+				openr2_dtmf_tx(&dtmf_txstate, slinear_buffer, CHUNK_SAMPLES);
+				degrade_chunk(slinear_buffer, CHUNK_SAMPLES, attenuation, noise);
+				compare_chunk(slinear_buffer, CHUNK_SAMPLES);
+			}
+		}
+	}
+}
+
+/* peak amplitude of a sine at the given dBm0 level, as for A-law */
+static float dbm0_to_amplitude(float level)
+{
+	return 32767.0f * powf(10.0f, (level - 3.14f) / 20.0f);
+}
+
+/* 100ms of a pair of tones, then 60ms of silence, from sample start of the tones */
+static void generate_tone_pair(short *slinear_buffer, int start, float f1, float level1, float f2, float level2)
+{
+	float amp1;
+	float amp2;
+	int n;
+	int i;
+
+	amp1 = dbm0_to_amplitude(level1);
+	amp2 = dbm0_to_amplitude(level2);
+	for (i = 0; i < PAIR_SAMPLES; i++) {
+		n = start + i;
+		slinear_buffer[i] = (i < PAIR_ON_SAMPLES) ? (short)lrintf(amp1 * sinf(2.0f * (float)M_PI * f1 * n / SAMPLE_RATE)
+				+ amp2 * sinf(2.0f * (float)M_PI * f2 * n / SAMPLE_RATE)) : 0;
+	}
+}
+
+/* what the floating point detectors, starting from the given state, make of a pair of tones */
+static void probe_tone_pair(const detectors_t *from, int start, float f1, float level1, float f2, float level2,
+		int digits[PAIR_CHUNKS][DETECTORS])
+{
+	static detectors_t probe;
+	short slinear_buffer[PAIR_SAMPLES];
+	int j;
+
+	probe = *from;
+	generate_tone_pair(slinear_buffer, start, f1, level1, f2, level2);
+	for (j = 0; j < PAIR_CHUNKS; j++) {
+		run_detectors(&probe, slinear_buffer + j * CHUNK_SAMPLES, CHUNK_SAMPLES, digits[j]);
+	}
+}
+
+static void compare_tone_pair(float f1, float level1, float f2, float level2)
+{
+	static detectors_t saved;
+	static int start = 0;
+	short slinear_buffer[PAIR_SAMPLES];
+	int digits[PAIR_CHUNKS][DETECTORS];
+	int nudged[PAIR_CHUNKS][DETECTORS];
+	int before = mismatches;
+	int j;
+
+	/* start each pair at another phase */
+	start += 37;
+	saved = float_detectors;
+	generate_tone_pair(slinear_buffer, start, f1, level1, f2, level2);
+	for (j = 0; j < PAIR_CHUNKS; j++) {
+		compare_chunk(slinear_buffer + j * CHUNK_SAMPLES, CHUNK_SAMPLES);
+	}
+	if (mismatches == before) {
+		return;
+	}
+
+	/* The two detectors round differently, so they may disagree about tones
+	   right on one of their limits. The tones were on a limit if moving
+	   either of them by LIMIT_DB changes the mind of the floating point
+	   detector too */
+	probe_tone_pair(&saved, start, f1, level1, f2, level2, digits);
+	for (j = 0; j < 4; j++) {
+		probe_tone_pair(&saved, start, f1, level1 + ((j & 1) ? LIMIT_DB : -LIMIT_DB),
+				f2, level2 + ((j & 2) ? LIMIT_DB : -LIMIT_DB), nudged);
+		if (memcmp(digits, nudged, sizeof(digits))) {
+			break;
+		}
+	}
+	printf("  tones %.1fHz at %.2fdBm0 and %.1fHz at %.2fdBm0", f1, level1, f2, level2);
+	if (j < 4) {
+		printf(", on a detector limit\n");
+		limit_mismatches += mismatches - before;
+		mismatches = before;
+	} else {
+		printf("\n");
+	}
+}
+
+/* results of an edge set, since the figures in last[] were taken */
+static void report_edges(const char *name, int last[3])
+{
+	printf("%s: %d detector results, %d mismatches, %d on a detector limit\n", name,
+			compared_blocks - last[0], mismatches - last[1], limit_mismatches - last[2]);
+	last[0] = compared_blocks;
+	last[1] = mismatches;
+	last[2] = limit_mismatches;
+}
+
+/* The levels, twists and frequencies where the detectors change their mind,
+   where the rounding of the fixed-point filters matters most */
+static void compare_edges(void)
+{
+	static const int dtmf_row[4] = { 697, 770, 852, 941 };
+	static const int dtmf_col[4] = { 1209, 1336, 1477, 1633 };
+	int last[3] = { compared_blocks, mismatches, limit_mismatches };
+	float level;
+	float twist;
+	float offset;
+	int fwd;
+	int i;
+
+	/* around the level threshold, in quarters of a dB */
+	for (level = -32.0f; level >= -42.0f; level -= 0.25f) {
+		for (fwd = 0; fwd < 2; fwd++) {
+			for (i = 0; i < 15; i++) {
+				compare_tone_pair(mf_pairs[fwd][i][0], level, mf_pairs[fwd][i][1], level);
+			}
+		}
+	}
+	for (level = -38.0f; level >= -48.0f; level -= 0.25f) {
+		for (i = 0; i < 16; i++) {
+			compare_tone_pair(dtmf_row[i / 4], level, dtmf_col[i % 4], level);
+		}
+	}
+	report_edges("Level threshold", last);
+
+	/* around the twist limits, either tone the louder one */
+	for (twist = 4.0f; twist <= 10.0f; twist += 0.25f) {
+		for (fwd = 0; fwd < 2; fwd++) {
+			for (i = 0; i < 15; i++) {
+				compare_tone_pair(mf_pairs[fwd][i][0], -15.0f, mf_pairs[fwd][i][1], -15.0f - twist);
+				compare_tone_pair(mf_pairs[fwd][i][0], -15.0f - twist, mf_pairs[fwd][i][1], -15.0f);
+			}
+		}
+	}
+	for (twist = -10.0f; twist <= 6.0f; twist += 0.25f) {
+		for (i = 0; i < 16; i++) {
+			compare_tone_pair(dtmf_row[i / 4], -15.0f, dtmf_col[i % 4], -15.0f + twist);
+		}
+	}
+	report_edges("Twist", last);
+
+	/* off the nominal frequencies, up to where the tones are lost */
+	for (offset = -60.0f; offset <= 60.0f; offset += 2.5f) {
+		for (fwd = 0; fwd < 2; fwd++) {
+			for (i = 0; i < 15; i++) {
+				compare_tone_pair(mf_pairs[fwd][i][0] + offset, -15.0f, mf_pairs[fwd][i][1] + offset, -15.0f);
+			}
+		}
+	}
+	for (offset = -0.05f; offset <= 0.05f; offset += 0.0025f) {
+		for (i = 0; i < 16; i++) {
+			compare_tone_pair(dtmf_row[i / 4] * (1.0f + offset), -15.0f, dtmf_col[i % 4] * (1.0f + offset), -15.0f);
+		}
+	}
+	report_edges("Frequency offset", last);
+}
+
+/* openr2_mf_rx_multi() must report, for every channel, the very same digits
+   openr2_mf_rx() reports for that channel on its own. The channels get
+   different tones, and some of them run the modes that have no lanes */
+static void compare_multi(void)
+{
+	static const int chunk_sizes[] = { 160, 37, 133, 240, 1, 80 };
+	static openr2_mf_rx_state_t multi[MULTI_CHANNELS];
+	static openr2_mf_rx_state_t single[MULTI_CHANNELS];
+	static short slinear[MULTI_CHANNELS][MULTI_SLOTS * PAIR_SAMPLES];
+	openr2_mf_rx_state_t *multi_s[MULTI_CHANNELS];
+	const int16_t *amp[MULTI_CHANNELS];
+	int digits[MULTI_CHANNELS];
+	int last[3] = { compared_blocks, mismatches, limit_mismatches };
+	int single_digit;
+	int position;
+	int chunk;
+	int fwd;
+	int tone;
+	int c;
+	int k;
+
+	for (c = 0; c < MULTI_CHANNELS; c++) {
+		fwd = c & 1;
+		openr2_mf_rx_init(&multi[c], fwd);
+		openr2_mf_rx_init(&single[c], fwd);
+		if (c == 3) {
+			openr2_mf_rx_set_fixed_point(&multi[c], 1);
+			openr2_mf_rx_set_fixed_point(&single[c], 1);
+		} else if (c == 6) {
+			openr2_mf_rx_set_sliding(&multi[c], 1);
+			openr2_mf_rx_set_sliding(&single[c], 1);
+		}
+		multi_s[c] = &multi[c];
+		/* another digit, level and frequency offset in each slot, down to below the threshold */
+		for (k = 0; k < MULTI_SLOTS; k++) {
+			tone = (c * 7 + k) % 15;
+			generate_tone_pair(slinear[c] + k * PAIR_SAMPLES, c * 53 + k * 11,
+					mf_pairs[fwd][tone][0] + ((c + k) % 9 - 4) * 5.0f, -5.0f - (c * 3 + k) % 40,
+					mf_pairs[fwd][tone][1] + ((c + k) % 9 - 4) * 5.0f, -5.0f - (c * 3 + k * 2) % 40);
+		}
+	}
+
+	/* the same chunks for every channel, ending blocks at all sorts of places */
+	for (position = 0, k = 0; position < MULTI_SLOTS * PAIR_SAMPLES; position += chunk, k++) {
+		chunk = chunk_sizes[k % (sizeof(chunk_sizes) / sizeof(chunk_sizes[0]))];
+		if (chunk > MULTI_SLOTS * PAIR_SAMPLES - position) {
+			chunk = MULTI_SLOTS * PAIR_SAMPLES - position;
+		}
+		for (c = 0; c < MULTI_CHANNELS; c++) {
+			amp[c] = slinear[c] + position;
+		}
+		openr2_mf_rx_multi(multi_s, amp, chunk, digits, MULTI_CHANNELS);
+		for (c = 0; c < MULTI_CHANNELS; c++) {
+			single_digit = openr2_mf_rx(&single[c], amp[c], chunk);
+			compared_blocks++;
+			if (single_digit) {
+				detected_tones++;
+			}
+			if (single_digit != digits[c]) {
+				mismatches++;
+				printf("Multi-channel MF mismatch on channel %d: single %c, multi %c (sample %d)\n", c,
+						single_digit ? single_digit : '-', digits[c] ? digits[c] : '-', position + chunk);
+			}
+		}
+	}
+	report_edges("Multi-channel", last);
+}
+
+int main(int argc, char *argv[])
+{
+	struct stat statbuf;
+	FILE *audiofp;
+	int format = FORMAT_INVALID;
+
+	printf("Running floating point vs fixed-point DSP comparison - alaw or slinear 8000hz only\n");
+
+	init_detectors(&float_detectors, 0);
+	init_detectors(&fixed_detectors, 1);
+
+	if (argc == 1) {
+		printf("Using built-in MF and DTMF tones\n");
+		compare_builtin();
+		compare_edges();
+		compare_multi();
+	} else {
+		if (argc < 3) {
+			fprintf(stderr, USAGE, argv[0]);
+			exit(1);
+		}
+
+		if (!openr2_strncasecmp(argv[1], "alaw", sizeof("alaw")-1)) {
+			format = FORMAT_ALAW;
+		} else if (!openr2_strncasecmp(argv[1], "slinear", sizeof("slinear")-1)) {
+			format = FORMAT_SLINEAR;
+		} else {
+			fprintf(stderr, USAGE, argv[0]);
+			exit(1);
+		}
+
+		printf("Using file %s\n", argv[2]);
+		if (stat(argv[2], &statbuf)) {
+			perror("could not stat audio file");
+			exit(1);
+		}
+
+		audiofp = fopen(argv[2], "r");
+		if (!audiofp) {
+			perror("could not open audio file");
+			exit(1);
+		}
+		compare_file(audiofp, format);
+		fclose(audiofp);
+	}
+
+	printf("Compared %d detector results over %d samples (%d ms), %d tones detected, %d mismatches",
+			compared_blocks, processed_samples, samples_to_ms(processed_samples), detected_tones, mismatches);
+	printf(" (and %d on a detector limit)\n", limit_mismatches);
+	return mismatches ? 1 : 0;
+}
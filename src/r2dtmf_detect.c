@@ -25,8 +25,10 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <getopt.h>
 #include "openr2/openr2.h"
 #include "openr2/r2engine-pvt.h"
+#include "r2batch.h"
 
 #define FORMAT_INVALID 0 
 #define FORMAT_ALAW 1
@@ -34,13 +36,53 @@
 
 #define CHUNK_SAMPLES 160
 
-#define USAGE "USAGE: %s [alaw|slinear] [alaw or slinear file path]\n"
+#define USAGE "USAGE: %s [-e] [-t threads] [alaw|slinear] [alaw or slinear file or directory path]...\n" \
+	"  with a single file and no options the digits are printed as they come and go,\n" \
+	"  otherwise the files are scanned in parallel and each digit is printed as an\n" \
+	"  event line (-e forces that for a single file, -t sets the number of threads)\n"
 
 static void on_dtmf_detected(void *usrdata, const char *digits, int len)
 {
 	printf("Detected %s\n", digits);
 }
 
+static void scan_dtmf(int format, const void *samples, size_t count, r2batch_output_t *output)
+{
+	openr2_dtmf_rx_state_t rxstate;
+	unsigned long on_sample = 0;
+	size_t position = 0;
+	char currdigit = 0;
+	char digit;
+	int chunk;
+
+	openr2_dtmf_rx_init(&rxstate, NULL, NULL);
+	while (position < count) {
+		chunk = (count - position < CHUNK_SAMPLES) ? count - position : CHUNK_SAMPLES;
+		if (format == R2BATCH_FORMAT_ALAW) {
+			openr2_dtmf_rx_alaw(&rxstate, (const uint8_t *)samples + position, chunk);
+		} else {
+			openr2_dtmf_rx(&rxstate, (const int16_t *)samples + position, chunk);
+		}
+		position += chunk;
+		digit = openr2_dtmf_rx_status(&rxstate);
+		/* 'x' is a tone heard but not confirmed yet, not a digit */
+		if (digit == 'x') {
+			digit = 0;
+		}
+		if (digit == currdigit) {
+			continue;
+		}
+		if (currdigit) {
+			r2batch_digit(output, "fwd", currdigit, on_sample, position);
+		}
+		currdigit = digit;
+		on_sample = position;
+	}
+	if (currdigit) {
+		r2batch_digit(output, "fwd", currdigit, on_sample, position);
+	}
+}
+
 int main(int argc, char *argv[])
 {
 	struct stat statbuf;
@@ -54,14 +96,45 @@ int main(int argc, char *argv[])
 	char digit = 0;
 	char currdigit = 0;
 	openr2_dtmf_rx_state_t  rxstate;
+	int events = 0;
+	int threads = 0;
+	int c;
 
-	printf("Running DTMF Detection Test - alaw or slinear 8000hz only\n");
+	while ((c = getopt(argc, argv, "et:")) != -1) {
+		switch (c) {
+		case 'e':
+			events = 1;
+			break;
+		case 't':
+			threads = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, USAGE, argv[0]);
+			exit(1);
+		}
+	}
 
-	if (argc < 3) {
+	if (argc - optind < 2) {
 		fprintf(stderr, USAGE, argv[0]);
 		exit(1);
 	}
 
+	if (!openr2_strncasecmp(argv[optind], "alaw", sizeof("alaw")-1)) {
+		format = FORMAT_ALAW;
+	} else if (!openr2_strncasecmp(argv[optind], "slinear", sizeof("slinear")-1)) {
+		format = FORMAT_SLINEAR;
+	} else {
+		fprintf(stderr, USAGE, argv[0]);
+		exit(1);
+	}
+
+	if (optind > 1 || events || argc - optind > 2 || (!stat(argv[optind + 1], &statbuf) && S_ISDIR(statbuf.st_mode))) {
+		return r2batch_run(format == FORMAT_ALAW ? R2BATCH_FORMAT_ALAW : R2BATCH_FORMAT_SLINEAR,
+				&argv[optind + 1], argc - optind - 1, threads, scan_dtmf) ? 1 : 0;
+	}
+
+	printf("Running DTMF Detection Test - alaw or slinear 8000hz only\n");
+
 	if (!openr2_strncasecmp(argv[1], "alaw", sizeof("alaw")-1)) {
 		format = FORMAT_ALAW;
 		chunksize = sizeof(alaw_buffer);
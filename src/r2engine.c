@@ -41,6 +41,10 @@
 #include <fcntl.h>
 #endif
 #include <math.h>
+#if defined(__GNUC__) && (__GNUC__ >= 5) && (defined(__x86_64__) || defined(__i386__))
+#define OR2_HAVE_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
 #include "openr2/r2declare.h"
 #include "openr2/fast_convert.h"
 #include "openr2/r2utils-pvt.h"
@@ -65,120 +69,2420 @@
 #define DBM0_MAX_SINE_POWER     (3.14f)
 
 /* Direct Digital Synthesis required for tone generation */
-static int32_t dds_phase_ratef(float frequency);
 static float dds_scaling_dbm0f(float level);
 static float dds_modf(uint32_t *phase_acc, int32_t phase_rate, float scale, int32_t phase);
 
 /* generic tone generation */
-static void make_tone_gen_descriptor(openr2_tone_gen_descriptor_t *s, int f1, int l1, int f2, int l2, int d1, int d2, int d3, int d4, int repeat);
-static openr2_tone_gen_state_t *tone_gen_init(openr2_tone_gen_state_t *s, openr2_tone_gen_descriptor_t *t);
+static openr2_tone_gen_state_t *tone_gen_init(openr2_tone_gen_state_t *s, const openr2_tone_gen_descriptor_t *t);
 static int tone_gen(openr2_tone_gen_state_t *s, int16_t amp[], int max_samples);
 
 /* Goertzel Algorithm for tone detection */
-static void make_goertzel_descriptor(openr2_goertzel_descriptor_t *t, float freq, int samples);
-static openr2_goertzel_state_t *goertzel_init(openr2_goertzel_state_t *s, openr2_goertzel_descriptor_t *t);
+static openr2_goertzel_state_t *goertzel_init(openr2_goertzel_state_t *s, const openr2_goertzel_descriptor_t *t);
 static void goertzel_reset(openr2_goertzel_state_t *s);
 static float goertzel_result(openr2_goertzel_state_t *s);
 
+/* Fixed-point arithmetic: Q14 coefficients for the dialtone notches, and integer filter state */
+#define Q14(x)                      ((int32_t) ((x)*16384.0f + (((x) < 0.0f)  ?  -0.5f  :  0.5f)))
+#define q14_mul(a, b)               ((int32_t) ((((int64_t) (a))*(b) + (1 << 13)) >> 14))
+/* The Goertzel coefficients are Q30. The float coefficients of the MF and
+   DTMF filters all fit in Q30 exactly, so the fixed-point filters are tuned
+   to the very same frequencies as the floating point ones */
+#define q30_mul(a, b)               ((int32_t) ((((int64_t) (a))*(b) + (1 << 29)) >> 30))
+/* The fixed-point filter state keeps 4 bits below the sample units, so the
+   rounding of the recursion does not move the energies of the blocks by more
+   than a few thousandths of a dB. A full scale input over a block of 133
+   samples still leaves more than 3 bits of headroom in the state */
+#define GOERTZEL_FIXED_SCALE        16
+static openr2_goertzel_fixed_state_t *goertzel_fixed_init(openr2_goertzel_fixed_state_t *s, const openr2_goertzel_descriptor_t *t);
+static void goertzel_fixed_reset(openr2_goertzel_fixed_state_t *s);
+static int64_t goertzel_fixed_result(openr2_goertzel_fixed_state_t *s);
+static void goertzel_fixed_update(openr2_goertzel_fixed_state_t s[], int filters, const int32_t amp[], int samples);
+
+/* A bank of up to GOERTZEL_BANK_SIZE filters fed with the same samples,
+   laid out so that every filter sits in its own vector lane. Detectors
+   load their filters into a bank, run a block of samples through the
+   selected kernel and store the filters back. Unused lanes have fac 0 */
+#define GOERTZEL_BANK_SIZE 8
 typedef struct
 {
-    float       f1;         /* First freq */
-    float       f2;         /* Second freq */
-    int8_t      level1;     /* Level of the first freq (dB) */
-    int8_t      level2;     /* Level of the second freq (dB) */
-    uint8_t     on_time;    /* Tone on time (ms) */
-    uint8_t     off_time;   /* Minimum post tone silence (ms) */
-} mf_digit_tones_t;
+    float v2[GOERTZEL_BANK_SIZE];
+    float v3[GOERTZEL_BANK_SIZE];
+    float fac[GOERTZEL_BANK_SIZE];
+} goertzel_bank_t;
+
+typedef void (*goertzel_bank_update_func_t)(goertzel_bank_t *b, const float amp[], int samples);
+
+static void goertzel_bank_load(goertzel_bank_t *b, openr2_goertzel_state_t *s, int lane, int filters);
+static void goertzel_bank_store(goertzel_bank_t *b, openr2_goertzel_state_t *s, int lane, int filters);
+static void goertzel_bank_update_generic(goertzel_bank_t *b, const float amp[], int samples);
+#if defined(OR2_HAVE_X86_DISPATCH)
+/* Runs when the library is loaded, before any channel thread can exist */
+static void goertzel_select_kernel(void) __attribute__((constructor));
+#endif
+
+/* Kernel picked by goertzel_select_kernel() according to the running CPU */
+static goertzel_bank_update_func_t goertzel_bank_update = goertzel_bank_update_generic;
+
+/* Block A-law transcoding, also picked according to the running CPU */
+typedef void (*alaw_to_linear_block_func_t)(int16_t linear[], const uint8_t alaw[], int samples);
+typedef void (*linear_to_alaw_block_func_t)(uint8_t alaw[], const int16_t linear[], int samples);
+
+static void alaw_to_linear_block_generic(int16_t linear[], const uint8_t alaw[], int samples);
+static void linear_to_alaw_block_generic(uint8_t alaw[], const int16_t linear[], int samples);
+#if defined(OR2_HAVE_X86_DISPATCH)
+static void alaw_select_kernel(void) __attribute__((constructor));
+#endif
+
+static alaw_to_linear_block_func_t alaw_to_linear_block = alaw_to_linear_block_generic;
+static linear_to_alaw_block_func_t linear_to_alaw_block = linear_to_alaw_block_generic;
 
-static int r2_mf_gen_inited = FALSE;
-static openr2_tone_gen_descriptor_t r2_mf_fwd_digit_tones[15];
-static openr2_tone_gen_descriptor_t r2_mf_back_digit_tones[15];
+/* Every R2 MF frequency is a multiple of 60Hz, so any pair of them repeats
+   exactly every 8000/20 samples. Each digit is stored for that period, both
+   linear and already A-law encoded, and then just copied out */
+#define R2_MF_TX_PERIOD 400
 
 /* R2 tone generation specs.
  *  Power: -11.5dBm +- 1dB
  *  Frequency: within +-4Hz
  *  Mismatch between the start time of a pair of tones: <=1ms.
  *  Mismatch between the end time of a pair of tones: <=1ms.
+ *
+ * The periods below are the output of the generic tone generator for each
+ * tone pair at -11dBm0 per tone, precreated so that they sit in const memory
+ * and need no setup at run time. They, and the Goertzel and DTMF descriptor
+ * tables further down, are printed by r2tables (r2tables.c). Its check,
+ * "r2tables -c r2engine.c", runs with the self checks and fails if any
+ * table here is not exactly what it renders.
  */
-static const mf_digit_tones_t r2_mf_fwd_tones[] =
-{
-    {1380.0f, 1500.0f, -11, -11, 1, 0},
-    {1380.0f, 1620.0f, -11, -11, 1, 0},
-    {1500.0f, 1620.0f, -11, -11, 1, 0},
-    {1380.0f, 1740.0f, -11, -11, 1, 0},
-    {1500.0f, 1740.0f, -11, -11, 1, 0},
-    {1620.0f, 1740.0f, -11, -11, 1, 0},
-    {1380.0f, 1860.0f, -11, -11, 1, 0},
-    {1500.0f, 1860.0f, -11, -11, 1, 0},
-    {1620.0f, 1860.0f, -11, -11, 1, 0},
-    {1740.0f, 1860.0f, -11, -11, 1, 0},
-    {1380.0f, 1980.0f, -11, -11, 1, 0},
-    {1500.0f, 1980.0f, -11, -11, 1, 0},
-    {1620.0f, 1980.0f, -11, -11, 1, 0},
-    {1740.0f, 1980.0f, -11, -11, 1, 0},
-    {1860.0f, 1980.0f, -11, -11, 1, 0},
-    {0.0f, 0.0f, 0, 0, 0, 0}
+static const int16_t r2_mf_fwd_digit_waves[15][R2_MF_TX_PERIOD] =
+{
+    {   /* 1: 1380Hz + 1500Hz */
+             0,  11626,   9876,  -3151, -12414,  -7359,   5939,  12143,   4407,  -8017,
+        -10900,  -1402,   9166,   8887,  -1258,  -9301,  -6421,   3282,   8491,   3876,
+         -4434,  -6926,  -1629,   4630,   4947,      7,  -3938,  -2909,    787,   2560,
+          1179,   -672,   -787,    -72,   -283,   -975,   -202,   1873,   2381,   -422,
+         -3784,  -3121,   1880,   5650,   2991,  -3952,  -7119,  -1923,   6321,   7848,
+            13,  -8612,  -7649,   2548,  10454,   6456,  -5424, -11541,  -4351,   8234,
+         11647,   1557, -10599, -10710,   1582,  12198,   8810,  -4721, -12815,  -6166,
+          7459,  12375,   3102,  -9468, -10955,    -18,  10529,   8763,  -2738, -10561,
+         -6120,   4824,   9620,   3403,  -6019,  -7938,   -989,   6239,   5815,   -788,
+         -5551,  -3621,   1733,   4158,   1727,  -1756,  -2352,   -450,    925,    535,
+             0,    553,    942,   -452,  -2370,  -1771,   1732,   4177,   1746,  -3627,
+         -5571,   -799,   5824,   6259,   -979,  -7949,  -6038,   3395,   9632,   4843,
+         -6114, -10575,  -2757,   8759,  10545,     18, -10953,  -9484,   3084,  12376,
+          7476,  -6150, -12818,  -4740,   8795,  12202,   1601, -10697, -10606,   1537,
+         11635,   8243,  -4331, -11531,  -5435,   6436,  10446,   2560,  -7630,  -8606,
+           -13,   7830,   6317,  -1908,  -7101,  -3950,   2974,   5632,   1881,  -3104,
+         -3768,   -425,   2363,   1858,   -197,   -956,   -270,    -79,   -807,   -683,
+          1188,   2580,    797,  -2919,  -3957,     -7,   4960,   4649,  -1624,  -6940,
+         -4452,   3873,   8507,   3300,  -6419,  -9318,  -1275,   8888,   9183,  -1386,
+        -10903,  -8036,   4392,  12149,   5958,  -7346, -12421,  -3171,   9865,  11635,
+            19, -11626,  -9876,   3151,  12414,   7359,  -5939, -12143,  -4407,   8017,
+         10900,   1402,  -9166,  -8887,   1258,   9301,   6421,  -3282,  -8491,  -3876,
+          4434,   6926,   1629,  -4630,  -4947,     -7,   3938,   2909,   -787,  -2560,
+         -1179,    672,    787,     72,    283,    975,    202,  -1873,  -2381,    422,
+          3784,   3121,  -1880,  -5650,  -2991,   3952,   7119,   1923,  -6321,  -7848,
+           -13,   8612,   7649,  -2548, -10454,  -6456,   5424,  11541,   4351,  -8234,
+        -11647,  -1557,  10599,  10710,  -1582, -12198,  -8810,   4721,  12815,   6166,
+         -7459, -12375,  -3102,   9468,  10955,     18, -10529,  -8763,   2738,  10561,
+          6120,  -4824,  -9620,  -3403,   6019,   7938,    989,  -6239,  -5815,    788,
+          5551,   3621,  -1733,  -4158,  -1727,   1756,   2352,    450,   -925,   -535,
+             0,   -553,   -942,    452,   2370,   1771,  -1732,  -4177,  -1746,   3627,
+          5571,    799,  -5824,  -6259,    979,   7949,   6038,  -3395,  -9632,  -4843,
+          6114,  10575,   2757,  -8759, -10545,    -18,  10953,   9484,  -3084, -12376,
+         -7476,   6150,  12818,   4740,  -8795, -12202,  -1601,  10697,  10606,  -1537,
+        -11635,  -8243,   4331,  11531,   5435,  -6436, -10446,  -2560,   7630,   8606,
+            13,  -7830,  -6317,   1908,   7101,   3950,  -2974,  -5632,  -1881,   3104,
+          3768,    425,  -2363,  -1858,    197,    956,    270,     79,    807,    683,
+         -1188,  -2580,   -797,   2919,   3957,      7,  -4960,  -4649,   1624,   6940,
+          4452,  -3873,  -8507,  -3300,   6419,   9318,   1275,  -8888,  -9183,   1386,
+         10903,   8036,  -4392, -12149,  -5958,   7346,  12421,   3171,  -9865, -11635
+    },
+    {   /* 2: 1380Hz + 1620Hz */
+             0,  11827,   8950,  -4709, -11968,  -4404,   7667,   9388,     14,  -7855,
+         -5349,   2502,   5483,   1672,  -2247,  -1871,     -1,   -382,  -1129,   1067,
+          3979,   1968,  -4368,  -6684,    -12,   8413,   7017,  -4057, -11281,  -4533,
+          8638,  11609,     19, -11873,  -9094,   4844,  12466,   4650,  -8217, -10230,
+           -15,   8911,   6232,  -3012,  -6900,  -2242,   3334,   3330,      3,  -1109,
+            13,   -458,  -2413,  -1383,   3334,   5396,     10,  -7294,  -6232,   3679,
+         10416,   4250,  -8217, -11193,    -19,  11731,   9094,  -4903, -12767,  -4823,
+          8638,  10910,     17,  -9826,  -7017,   3463,   8208,   2777,  -4368,  -4736,
+            -6,   2585,   1129,   -158,    808,    777,  -2247,  -4024,     -8,   6060,
+          5349,  -3243,  -9386,  -3900,   7667,  10600,     18, -11404,  -8950,   4884,
+         12866,   4920,  -8922, -11419,    -18,  10586,   7690,  -3871,  -9386,  -3268,
+          5332,   6068,      8,  -4019,  -2254,    771,    808,   -159,   1125,   2588,
+             6,  -4730,  -4381,   2756,   8208,   3499,  -6995,  -9839,    -17,  10897,
+          8665,  -4788, -12767,  -4939,   9066,  11746,     19, -11179,  -8243,   4219,
+         10416,   3707,  -6213,  -7303,    -10,   5390,   3344,  -1373,  -2413,   -461,
+           -13,  -1111,     -3,   3326,   3344,  -2225,  -6900,  -3034,   6213,   8922,
+            15, -10217,  -8243,   4616,  12466,   4880,  -9066, -11888,    -19,  11595,
+          8665,  -4499, -11281,  -4088,   6995,   8397,     12,  -6675,  -4381,   1953,
+          3979,   1075,  -1125,   -383,      1,  -1869,  -2254,   1659,   5483,   2521,
+         -5332,  -7865,    -14,   9376,   7690,  -4371, -11968,  -4744,   8922,  11842,
+            19, -11827,  -8950,   4709,  11968,   4404,  -7667,  -9388,    -14,   7855,
+          5349,  -2502,  -5483,  -1672,   2247,   1871,      1,    382,   1129,  -1067,
+         -3979,  -1968,   4368,   6684,     12,  -8413,  -7017,   4057,  11281,   4533,
+         -8638, -11609,    -19,  11873,   9094,  -4844, -12466,  -4650,   8217,  10230,
+            15,  -8911,  -6232,   3012,   6900,   2242,  -3334,  -3330,     -3,   1109,
+           -13,    458,   2413,   1383,  -3334,  -5396,    -10,   7294,   6232,  -3679,
+        -10416,  -4250,   8217,  11193,     19, -11731,  -9094,   4903,  12767,   4823,
+         -8638, -10910,    -17,   9826,   7017,  -3463,  -8208,  -2777,   4368,   4736,
+             6,  -2585,  -1129,    158,   -808,   -777,   2247,   4024,      8,  -6060,
+         -5349,   3243,   9386,   3900,  -7667, -10600,    -18,  11404,   8950,  -4884,
+        -12866,  -4920,   8922,  11419,     18, -10586,  -7690,   3871,   9386,   3268,
+         -5332,  -6068,     -8,   4019,   2254,   -771,   -808,    159,  -1125,  -2588,
+            -6,   4730,   4381,  -2756,  -8208,  -3499,   6995,   9839,     17, -10897,
+         -8665,   4788,  12767,   4939,  -9066, -11746,    -19,  11179,   8243,  -4219,
+        -10416,  -3707,   6213,   7303,     10,  -5390,  -3344,   1373,   2413,    461,
+            13,   1111,      3,  -3326,  -3344,   2225,   6900,   3034,  -6213,  -8922,
+           -15,  10217,   8243,  -4616, -12466,  -4880,   9066,  11888,     19, -11595,
+         -8665,   4499,  11281,   4088,  -6995,  -8397,    -12,   6675,   4381,  -1953,
+         -3979,  -1075,   1125,    383,     -1,   1869,   2254,  -1659,  -5483,  -2521,
+          5332,   7865,     14,  -9376,  -7690,   4371,  11968,   4744,  -8922, -11842
+    },
+    {   /* 3: 1500Hz + 1620Hz */
+             0,  12088,   8172,  -6481, -12421,  -1968,  10826,   9131,  -4392, -11725,
+         -3546,   8828,   9183,  -2291, -10087,  -4457,   6419,   8222,   -522,  -7733,
+         -4452,   3970,   6359,    572,  -4960,  -3481,   1857,   3775,    797,  -2170,
+         -1638,    394,    807,     86,    287,    896,   -197,  -2146,  -1501,   2079,
+          3768,    146,  -4746,  -3738,   2974,   6634,   1356,  -6633,  -6317,   2928,
+          9098,   3230,  -7630,  -8856,   1978,  10827,   5435,  -7640, -10978,    369,
+         11635,   7617,  -6716, -12370,  -1601,  11420,   9381,  -5105, -12818,  -3581,
+         10277,  10422,  -3084, -12245,  -5159,   8405,  10545,  -1062, -10727,  -6062,
+          6114,   9648,    606,  -8485,  -6038,   3792,   7839,   1623,  -5824,  -5038,
+          1802,   5301,   1746,  -3135,  -3158,    469,   2370,    933,   -778,   -575,
+             0,   -556,   -766,    920,   2352,    470,  -3139,  -3125,   1733,   5283,
+          1805,  -5019,  -5815,   1608,   7822,   3797,  -6019,  -8478,    591,   9631,
+          6120,  -6042, -10722,  -1079,  10529,   8405,  -5140, -12241,  -3102,  10408,
+         10286,  -3561, -12815,  -5123,   9368,  11431,  -1582, -12369,  -6734,   7605,
+         11647,    387, -10979,  -7659,   5424,  10840,   1996,  -8858,  -7649,   3221,
+          9098,   2945,  -6321,  -6652,   1348,   6649,   2991,  -3743,  -4766,    139,
+          3784,   2095,  -1508,  -2165,   -202,    912,    302,     78,    787,    391,
+         -1621,  -2156,    787,   3755,   1855,  -3481,  -4947,    561,   6340,   3970,
+         -4434,  -7721,   -534,   8203,   6421,  -4437, -10077,  -2304,   9166,   8831,
+         -3527, -11716,  -4407,   9114,  10830,  -1949, -12414,  -6497,   8155,  12094,
+             0, -12088,  -8172,   6481,  12421,   1968, -10826,  -9131,   4392,  11725,
+          3546,  -8828,  -9183,   2291,  10087,   4457,  -6419,  -8222,    522,   7733,
+          4452,  -3970,  -6359,   -572,   4960,   3481,  -1857,  -3775,   -797,   2170,
+          1638,   -394,   -807,    -86,   -287,   -896,    197,   2146,   1501,  -2079,
+         -3768,   -146,   4746,   3738,  -2974,  -6634,  -1356,   6633,   6317,  -2928,
+         -9098,  -3230,   7630,   8856,  -1978, -10827,  -5435,   7640,  10978,   -369,
+        -11635,  -7617,   6716,  12370,   1601, -11420,  -9381,   5105,  12818,   3581,
+        -10277, -10422,   3084,  12245,   5159,  -8405, -10545,   1062,  10727,   6062,
+         -6114,  -9648,   -606,   8485,   6038,  -3792,  -7839,  -1623,   5824,   5038,
+         -1802,  -5301,  -1746,   3135,   3158,   -469,  -2370,   -933,    778,    575,
+             0,    556,    766,   -920,  -2352,   -470,   3139,   3125,  -1733,  -5283,
+         -1805,   5019,   5815,  -1608,  -7822,  -3797,   6019,   8478,   -591,  -9631,
+         -6120,   6042,  10722,   1079, -10529,  -8405,   5140,  12241,   3102, -10408,
+        -10286,   3561,  12815,   5123,  -9368, -11431,   1582,  12369,   6734,  -7605,
+        -11647,   -387,  10979,   7659,  -5424, -10840,  -1996,   8858,   7649,  -3221,
+         -9098,  -2945,   6321,   6652,  -1348,  -6649,  -2991,   3743,   4766,   -139,
+         -3784,  -2095,   1508,   2165,    202,   -912,   -302,    -78,   -787,   -391,
+          1621,   2156,   -787,  -3755,  -1855,   3481,   4947,   -561,  -6340,  -3970,
+          4434,   7721,    534,  -8203,  -6421,   4437,  10077,   2304,  -9166,  -8831,
+          3527,  11716,   4407,  -9114, -10830,   1949,  12414,   6497,  -8155, -12094
+    },
+    {   /* 4: 1380Hz + 1740Hz */
+             0,  11980,   7898,  -5949, -10680,  -1539,   7447,   5295,  -2012,  -3790,
+          -623,    171,  -1363,    733,   5082,   3056,  -5614,  -8744,    651,  11092,
+          7213,  -7107, -12460,  -1214,  11265,   8413,  -4705, -10002,  -2203,   6122,
+          4726,  -1154,  -2388,   -243,   -874,  -2685,    585,   6221,   4238,  -5657,
+         -9899,   -366,  11249,   8343,  -6174, -12673,  -2373,  10355,   8691,  -3465,
+         -9084,  -2625,   4771,   3910,   -524,   -993,    391,  -1733,  -4049,    175,
+          7194,   5491,  -5439, -10911,  -1519,  11138,   9345,  -5081, -12618,  -3408,
+          9261,   8710,  -2322,  -8003,  -2799,   3463,   2899,   -130,    401,   1238,
+         -2336,  -5439,   -466,   7939,   6799,  -4964, -11711,  -2719,  10763,  10178,
+         -3912, -12288,  -4305,   8063,   8462,  -1289,  -6759,  -2705,   2281,   1704,
+             0,   1702,   2290,  -2691,  -6763,  -1315,   8448,   8085,  -4272, -12290,
+         -3949,  10154,  10784,  -2682, -11706,  -4994,   6777,   7950,   -444,  -5434,
+         -2346,   1233,    401,   -134,   2895,   3499,  -2781,  -8005,  -2350,   8692,
+          9282,  -3372, -12615,  -5117,   9318,  11156,  -1483, -10904,  -5465,   5469,
+          7201,    193,  -4044,  -1739,    388,   -993,   -533,   3903,   4783,  -2603,
+         -9112,  -3495,   8669,  10373,  -2335, -12667,  -6209,   8314,  11262,   -331,
+         -9889,  -5679,   4218,   6225,    599,  -2681,   -877,   -241,  -2389,  -1166,
+          4715,   6134,  -2177, -10000,  -4735,   8397,  11281,  -1175, -12450,  -7139,
+          7182,  11102,    684,  -8732,  -5632,   3038,   5084,    743,  -1361,    171,
+          -617,  -3789,  -2028,   5281,   7460,  -1509, -10674,  -5980,   7868,  11994,
+            19, -11980,  -7898,   5949,  10680,   1539,  -7447,  -5295,   2012,   3790,
+           623,   -171,   1363,   -733,  -5082,  -3056,   5614,   8744,   -651, -11092,
+         -7213,   7107,  12460,   1214, -11265,  -8413,   4705,  10002,   2203,  -6122,
+         -4726,   1154,   2388,    243,    874,   2685,   -585,  -6221,  -4238,   5657,
+          9899,    366, -11249,  -8343,   6174,  12673,   2373, -10355,  -8691,   3465,
+          9084,   2625,  -4771,  -3910,    524,    993,   -391,   1733,   4049,   -175,
+         -7194,  -5491,   5439,  10911,   1519, -11138,  -9345,   5081,  12618,   3408,
+         -9261,  -8710,   2322,   8003,   2799,  -3463,  -2899,    130,   -401,  -1238,
+          2336,   5439,    466,  -7939,  -6799,   4964,  11711,   2719, -10763, -10178,
+          3912,  12288,   4305,  -8063,  -8462,   1289,   6759,   2705,  -2281,  -1704,
+             0,  -1702,  -2290,   2691,   6763,   1315,  -8448,  -8085,   4272,  12290,
+          3949, -10154, -10784,   2682,  11706,   4994,  -6777,  -7950,    444,   5434,
+          2346,  -1233,   -401,    134,  -2895,  -3499,   2781,   8005,   2350,  -8692,
+         -9282,   3372,  12615,   5117,  -9318, -11156,   1483,  10904,   5465,  -5469,
+         -7201,   -193,   4044,   1739,   -388,    993,    533,  -3903,  -4783,   2603,
+          9112,   3495,  -8669, -10373,   2335,  12667,   6209,  -8314, -11262,    331,
+          9889,   5679,  -4218,  -6225,   -599,   2681,    877,    241,   2389,   1166,
+         -4715,  -6134,   2177,  10000,   4735,  -8397, -11281,   1175,  12450,   7139,
+         -7182, -11102,   -684,   8732,   5632,  -3038,  -5084,   -743,   1361,   -171,
+           617,   3789,   2028,  -5281,  -7460,   1509,  10674,   5980,  -7868, -11994
+    },
+    {   /* 5: 1500Hz + 1740Hz */
+             0,  12241,   7119,  -7721, -11133,    896,  10606,   5038,  -6419,  -7659,
+          1179,   6497,   2336,  -3230,  -2757,    470,    807,   -139,   1258,   2291,
+         -1219,  -5105,  -1732,   6042,   6317,  -3481,  -9865,  -2170,   9875,   8485,
+         -5551, -12369,  -1601,  11716,   8507,  -6634, -12078,   -575,  10955,   6652,
+         -6114,  -9131,    270,   7617,   3700,  -3797,  -4351,    391,   2370,    572,
+             0,   1062,   -445,  -3561,  -1880,   4437,   5815,  -2079,  -8795,  -3135,
+          8413,   8858,  -3938, -12088,  -3102,  10827,   9632,  -5283, -12669,  -2165,
+         10900,   8222,  -5424, -10422,   -942,   8405,   5236,  -3970,  -5958,    -86,
+          3784,   1623,   -989,   -387,    -48,  -1949,  -1624,   2928,   4947,   -920,
+         -7459,  -3743,   6827,   8828,  -2363, -11420,  -4407,   9631,  10454,  -3755,
+        -12866,  -3775,  10446,   9648,  -4392, -11431,  -2381,   8831,   6847,  -3738,
+         -7476,   -933,   4960,   2945,  -1629,  -1968,    -50,   -369,   -979,   1608,
+          3768,    -78,  -5939,  -3970,   5216,   8405,   -925, -10408,  -5435,   8203,
+         10903,  -2146, -12664,  -5301,   9620,  10840,  -3084, -12094,  -3957,   8856,
+          8432,  -3125,  -8810,  -2095,   5824,   4457,  -1881,  -3581,   -452,   1079,
+             0,    561,   2352,    394,  -4331,  -3792,   3682,   7605,    283,  -9114,
+         -6120,   6633,  10953,   -556, -12069,  -6649,   8491,  11725,  -1582, -12370,
+         -5571,   8478,   9891,  -2156,  -9876,  -3481,   6321,   6062,  -1727,  -5123,
+         -1230,   2304,   1275,   -146,    787,    469,  -2738,  -3221,   2321,   6481,
+          1188,  -7640,  -6421,   5019,  10599,    912, -11119,  -7733,   7101,  12245,
+             0, -12241,  -7119,   7721,  11133,   -896, -10606,  -5038,   6419,   7659,
+         -1179,  -6497,  -2336,   3230,   2757,   -470,   -807,    139,  -1258,  -2291,
+          1219,   5105,   1732,  -6042,  -6317,   3481,   9865,   2170,  -9875,  -8485,
+          5551,  12369,   1601, -11716,  -8507,   6634,  12078,    575, -10955,  -6652,
+          6114,   9131,   -270,  -7617,  -3700,   3797,   4351,   -391,  -2370,   -572,
+             0,  -1062,    445,   3561,   1880,  -4437,  -5815,   2079,   8795,   3135,
+         -8413,  -8858,   3938,  12088,   3102, -10827,  -9632,   5283,  12669,   2165,
+        -10900,  -8222,   5424,  10422,    942,  -8405,  -5236,   3970,   5958,     86,
+         -3784,  -1623,    989,    387,     48,   1949,   1624,  -2928,  -4947,    920,
+          7459,   3743,  -6827,  -8828,   2363,  11420,   4407,  -9631, -10454,   3755,
+         12866,   3775, -10446,  -9648,   4392,  11431,   2381,  -8831,  -6847,   3738,
+          7476,    933,  -4960,  -2945,   1629,   1968,     50,    369,    979,  -1608,
+         -3768,     78,   5939,   3970,  -5216,  -8405,    925,  10408,   5435,  -8203,
+        -10903,   2146,  12664,   5301,  -9620, -10840,   3084,  12094,   3957,  -8856,
+         -8432,   3125,   8810,   2095,  -5824,  -4457,   1881,   3581,    452,  -1079,
+             0,   -561,  -2352,   -394,   4331,   3792,  -3682,  -7605,   -283,   9114,
+          6120,  -6633, -10953,    556,  12069,   6649,  -8491, -11725,   1582,  12370,
+          5571,  -8478,  -9891,   2156,   9876,   3481,  -6321,  -6062,   1727,   5123,
+          1230,  -2304,  -1275,    146,   -787,   -469,   2738,   3221,  -2321,  -6481,
+         -1188,   7640,   6421,  -5019, -10599,   -912,  11119,   7733,  -7101, -12245
+    },
+    {   /* 6: 1620Hz + 1740Hz */
+             0,  12442,   6194,  -9279, -10687,   3850,  12334,   2283, -10812,  -7497,
+          6731,  10401,  -1345, -10445,  -3746,   7900,   7227,  -3804,  -8362,   -517,
+          7194,   3789,  -4470,  -5272,   1356,   4923,   1090,  -3318,  -2194,   1391,
+          1907,    -86,   -794,    -84,   -303,   -814,    590,   2202,    355,  -3154,
+         -2346,   2901,   4622,  -1044,  -6191,  -2087,   6102,   5645,  -3946,  -8386,
+             0,   9216,   4790,  -7494,  -9000,   3378,  11250,   2167, -10676,  -7690,
+          7182,  11551,  -1556, -12571,  -4703,  10361,   9916,  -5464, -12620,   -823,
+         12080,   6757,  -8509, -10780,   2995,  11887,   2914,  -9957,  -7588,   5738,
+          9899,   -615,  -9480,  -3949,   6779,   6767,  -2882,  -7335,   -876,   5927,
+          3441,  -3366,  -4291,    769,   3576,    935,  -2036,  -1322,    578,    592,
+             0,    592,    581,  -1318,  -2040,    927,   3576,    781,  -4285,  -3378,
+          3427,   5934,   -855,  -7332,  -2905,   6752,   6796,  -3923,  -9486,   -646,
+          9889,   5766,  -7563,  -9973,   2880,  11887,   3031, -10762,  -8537,   6724,
+         12092,   -784, -12613,  -5500,   9891,  10384,  -4667, -12576,  -1594,  11537,
+          7213,  -7661, -10691,   2132,  11248,   3410,  -8983,  -7515,   4764,   9224,
+             0,  -8379,  -3968,   5629,   6114,  -2067,  -6192,  -1061,   4615,   2912,
+         -2336,  -3158,    346,   2201,    594,   -812,   -304,    -83,   -794,    -91,
+          1905,   1398,  -2187,  -3324,   1077,   4923,   1373,  -5263,  -4485,   3771,
+          7201,   -493,  -8357,  -3829,   7208,   7918,  -3717, -10449,  -1378,  10389,
+          6759,  -7469, -10828,   2246,  12331,   3887, -10667,  -9306,   6159,  12452,
+             0, -12442,  -6194,   9279,  10687,  -3850, -12334,  -2283,  10812,   7497,
+         -6731, -10401,   1345,  10445,   3746,  -7900,  -7227,   3804,   8362,    517,
+         -7194,  -3789,   4470,   5272,  -1356,  -4923,  -1090,   3318,   2194,  -1391,
+         -1907,     86,    794,     84,    303,    814,   -590,  -2202,   -355,   3154,
+          2346,  -2901,  -4622,   1044,   6191,   2087,  -6102,  -5645,   3946,   8386,
+             0,  -9216,  -4790,   7494,   9000,  -3378, -11250,  -2167,  10676,   7690,
+         -7182, -11551,   1556,  12571,   4703, -10361,  -9916,   5464,  12620,    823,
+        -12080,  -6757,   8509,  10780,  -2995, -11887,  -2914,   9957,   7588,  -5738,
+         -9899,    615,   9480,   3949,  -6779,  -6767,   2882,   7335,    876,  -5927,
+         -3441,   3366,   4291,   -769,  -3576,   -935,   2036,   1322,   -578,   -592,
+             0,   -592,   -581,   1318,   2040,   -927,  -3576,   -781,   4285,   3378,
+         -3427,  -5934,    855,   7332,   2905,  -6752,  -6796,   3923,   9486,    646,
+         -9889,  -5766,   7563,   9973,  -2880, -11887,  -3031,  10762,   8537,  -6724,
+        -12092,    784,  12613,   5500,  -9891, -10384,   4667,  12576,   1594, -11537,
+         -7213,   7661,  10691,  -2132, -11248,  -3410,   8983,   7515,  -4764,  -9224,
+             0,   8379,   3968,  -5629,  -6114,   2067,   6192,   1061,  -4615,  -2912,
+          2336,   3158,   -346,  -2201,   -594,    812,    304,     83,    794,     91,
+         -1905,  -1398,   2187,   3324,  -1077,  -4923,  -1373,   5263,   4485,  -3771,
+         -7201,    493,   8357,   3829,  -7208,  -7918,   3717,  10449,   1378, -10389,
+         -6759,   7469,  10828,  -2246, -12331,  -3887,  10667,   9306,  -6159, -12452
+    },
+    {   /* 7: 1380Hz + 1860Hz */
+             0,  12077,   6736,  -6772,  -8731,    579,   5348,   1581,   -553,   1450,
+          -614,  -6123,  -3502,   7330,   9720,  -2845, -12738,  -4566,   9839,   9526,
+         -3203,  -8799,  -1932,   3958,   1863,      7,   2402,    967,  -6040,  -6326,
+          4706,  11471,   1582, -11699,  -8455,   6370,  10930,    486,  -7705,  -3723,
+          2336,   1527,     23,   3069,   2940,  -4908,  -8621,   1180,  11745,   5940,
+         -9084, -11173,   2225,  10791,   3737,  -5746,  -4637,    835,    808,   -525,
+          3214,   4952,  -2760,  -9910,  -2825,  10426,   9588,  -5257, -12370,  -2007,
+          9264,   6136,  -3317,  -4644,   -232,    -18,  -1539,   2597,   6630,    148,
+         -9889,  -6716,   7624,  12015,   -782, -11891,  -5755,   6662,   7417,   -860,
+         -3930,   -712,   -588,  -2767,   1193,   7545,   3471,  -8468,  -9904,   3687,
+         12866,   3724,  -9883,  -8489,   3445,   7546,   1209,  -2762,   -589,   -708,
+         -3932,   -879,   7406,   6685,  -5725, -11900,   -821,  12001,   7654,  -6687,
+         -9899,    121,   6624,   2609,  -1533,     18,   -225,  -4641,  -3336,   6116,
+          9279,  -1972, -12365,  -5293,   9562,  10446,  -2791,  -9909,  -2783,   4940,
+          3221,   -520,    808,    844,  -4628,  -5761,   3711,  10795,   2261, -11155,
+         -9112,   5906,  11752,   1213,  -8610,  -4926,   2926,   3072,     26,   1526,
+          2346,  -3708,  -7714,    456,  10922,   6402,  -8426, -11715,   1545,  11465,
+          4735,  -6308,  -6050,    953,   2402,     -7,   1858,   3966,  -1911,  -8799,
+         -3233,   9506,   9863,  -4529, -12741,  -2881,   9703,   7350,  -3480,  -6126,
+          -626,   1448,   -554,   1573,   5351,    603,  -8720,  -6798,   6706,  12088,
+            19, -12077,  -6736,   6772,   8731,   -579,  -5348,  -1581,    553,  -1450,
+           614,   6123,   3502,  -7330,  -9720,   2845,  12738,   4566,  -9839,  -9526,
+          3203,   8799,   1932,  -3958,  -1863,     -7,  -2402,   -967,   6040,   6326,
+         -4706, -11471,  -1582,  11699,   8455,  -6370, -10930,   -486,   7705,   3723,
+         -2336,  -1527,    -23,  -3069,  -2940,   4908,   8621,  -1180, -11745,  -5940,
+          9084,  11173,  -2225, -10791,  -3737,   5746,   4637,   -835,   -808,    525,
+         -3214,  -4952,   2760,   9910,   2825, -10426,  -9588,   5257,  12370,   2007,
+         -9264,  -6136,   3317,   4644,    232,     18,   1539,  -2597,  -6630,   -148,
+          9889,   6716,  -7624, -12015,    782,  11891,   5755,  -6662,  -7417,    860,
+          3930,    712,    588,   2767,  -1193,  -7545,  -3471,   8468,   9904,  -3687,
+        -12866,  -3724,   9883,   8489,  -3445,  -7546,  -1209,   2762,    589,    708,
+          3932,    879,  -7406,  -6685,   5725,  11900,    821, -12001,  -7654,   6687,
+          9899,   -121,  -6624,  -2609,   1533,    -18,    225,   4641,   3336,  -6116,
+         -9279,   1972,  12365,   5293,  -9562, -10446,   2791,   9909,   2783,  -4940,
+         -3221,    520,   -808,   -844,   4628,   5761,  -3711, -10795,  -2261,  11155,
+          9112,  -5906, -11752,  -1213,   8610,   4926,  -2926,  -3072,    -26,  -1526,
+         -2346,   3708,   7714,   -456, -10922,  -6402,   8426,  11715,  -1545, -11465,
+         -4735,   6308,   6050,   -953,  -2402,      7,  -1858,  -3966,   1911,   8799,
+          3233,  -9506,  -9863,   4529,  12741,   2881,  -9703,  -7350,   3480,   6126,
+           626,  -1448,    554,  -1573,  -5351,   -603,   8720,   6798,  -6706, -12088
+    },
+    {   /* 8: 1500Hz + 1860Hz */
+             0,  12337,   5958,  -8545,  -9183,   3015,   8507,   1325,  -4960,  -2418,
+          1188,    201,    197,   3366,   1881,  -5431,  -6317,   4038,  10446,    726,
+        -11635,  -6796,   8795,  11214,  -3084, -11887,  -2757,   8800,   6038,  -3963,
+         -5571,    256,   2370,    260,    925,   2422,  -1733,  -6310,   -989,   8586,
+          6120,  -7237, -10955,   2343,  12815,   3967, -10599,  -8783,   5424,   9978,
+             0,  -7484,  -2991,   3319,   2381,   -315,    787,    488,  -3938,  -3835,
+          4434,   8319,  -1258, -11087,  -4407,  10115,   9876,  -5459, -12421,   -765,
+         10903,   5647,  -6419,  -7062,   1624,   4923,    797,  -1242,    270,  -1176,
+         -3768,    346,   7101,   3688,  -7630,  -8876,   4331,  12310,   1601, -11959,
+         -7476,   7832,  10545,  -2002,  -9632,  -2585,   5824,   3869,  -1732,  -1772,
+             0,  -1752,  -1727,   3850,   5815,  -2568,  -9620,  -2016,  10529,   7843,
+         -7459, -11966,   1582,  12313,   4351,  -8874,  -7649,   3682,   7119,    355,
+         -3784,  -1190,    283,  -1226,    787,   4923,   1629,  -7043,  -6421,   5627,
+         10900,   -746, -12414,  -5477,   9865,  10130,  -4392, -11099,  -1275,   8327,
+          4452,  -3839,  -3957,    488,    807,   -311,   2363,   3310,  -2974,  -7472,
+             0,   9963,   5435,  -8765, -10606,   3948,  12818,   2363, -10953,  -7256,
+          6114,   8604,   -979,  -6325,  -1746,   2435,    942,    251,   2352,    261,
+         -5551,  -3964,   6019,   8797,  -2738, -11887,  -3102,  11203,   8810,  -6782,
+        -11647,    709,  10454,   4057,  -6321,  -5450,   1880,   3386,    202,    183,
+          1179,  -2402,  -4947,   1311,   8491,   3025,  -9166,  -8551,   5939,  12339,
+             0, -12337,  -5958,   8545,   9183,  -3015,  -8507,  -1325,   4960,   2418,
+         -1188,   -201,   -197,  -3366,  -1881,   5431,   6317,  -4038, -10446,   -726,
+         11635,   6796,  -8795, -11214,   3084,  11887,   2757,  -8800,  -6038,   3963,
+          5571,   -256,  -2370,   -260,   -925,  -2422,   1733,   6310,    989,  -8586,
+         -6120,   7237,  10955,  -2343, -12815,  -3967,  10599,   8783,  -5424,  -9978,
+             0,   7484,   2991,  -3319,  -2381,    315,   -787,   -488,   3938,   3835,
+         -4434,  -8319,   1258,  11087,   4407, -10115,  -9876,   5459,  12421,    765,
+        -10903,  -5647,   6419,   7062,  -1624,  -4923,   -797,   1242,   -270,   1176,
+          3768,   -346,  -7101,  -3688,   7630,   8876,  -4331, -12310,  -1601,  11959,
+          7476,  -7832, -10545,   2002,   9632,   2585,  -5824,  -3869,   1732,   1772,
+             0,   1752,   1727,  -3850,  -5815,   2568,   9620,   2016, -10529,  -7843,
+          7459,  11966,  -1582, -12313,  -4351,   8874,   7649,  -3682,  -7119,   -355,
+          3784,   1190,   -283,   1226,   -787,  -4923,  -1629,   7043,   6421,  -5627,
+        -10900,    746,  12414,   5477,  -9865, -10130,   4392,  11099,   1275,  -8327,
+         -4452,   3839,   3957,   -488,   -807,    311,  -2363,  -3310,   2974,   7472,
+             0,  -9963,  -5435,   8765,  10606,  -3948, -12818,  -2363,  10953,   7256,
+         -6114,  -8604,    979,   6325,   1746,  -2435,   -942,   -251,  -2352,   -261,
+          5551,   3964,  -6019,  -8797,   2738,  11887,   3102, -11203,  -8810,   6782,
+         11647,   -709, -10454,  -4057,   6321,   5450,  -1880,  -3386,   -202,   -183,
+         -1179,   2402,   4947,  -1311,  -8491,  -3025,   9166,   8551,  -5939, -12339
+    },
+    {   /* 9: 1620Hz + 1860Hz */
+             0,  12538,   5032, -10103,  -8738,   5970,  10235,  -1430,  -9353,  -2256,
+          6740,   4106,  -3485,  -3848,    892,   1999,    102,    373,    825,  -2083,
+         -3221,   2097,   6057,    -99,  -8045,  -3481,   8197,   7651,  -6030, -11057,
+          1888,  12538,   3177, -11540,  -7884,   8242,  10935,  -3532, -11588,  -1220,
+          9889,   4796,  -6603,  -6318,   2924,   5677,   -145,  -3528,   -892,   1020,
+             0,    669,   2244,   -612,  -4738,  -1375,   6222,   4735,  -5818,  -8390,
+          3203,  11012,   1123, -11570,  -6008,   9649,  10159,  -5640, -12372,    577,
+         12083,   4182,  -9504,  -7421,   5562,   8405,  -1524,  -7229,  -1359,   4648,
+          2346,  -1893,  -1389,    127,   -802,   -159,   3073,   2046,  -4222,  -5111,
+          3423,   8210,   -574, -10062,  -3693,   9770,   8194,  -7084, -11608,   2575,
+         12866,   2614, -11593,  -7115,   8167,   9789,  -3662, -10066,   -603,   8203,
+          3444,  -5098,  -4233,   2034,   3076,   -153,   -802,    128,  -1387,  -1899,
+          2336,   4654,  -1340,  -7229,  -1549,   8405,   5587,  -7397,  -9523,   4148,
+         12089,    615, -12363,  -5676,  10135,   9674,  -5975, -11581,   1087,  11009,
+          3233,  -8376,  -5839,   4716,   6231,  -1357,  -4738,   -623,   2242,    672,
+             0,   1022,   -885,  -3530,   -159,   5673,   2943,  -6304,  -6621,   4770,
+          9899,  -1187, -11585,  -3568,  10917,   8271,  -7853, -11557,   3139,  12540,
+          1925, -11044,  -6059,   7628,   8215,  -3481,  -8049,   -121,   6053,   2111,
+         -3214,  -2088,    821,    373,    100,   1998,    901,  -3842,  -3498,   4090,
+          6750,  -2231,  -9355,  -1461,  10223,   6000,  -8713, -10125,   4997,  12546,
+             0, -12538,  -5032,  10103,   8738,  -5970, -10235,   1430,   9353,   2256,
+         -6740,  -4106,   3485,   3848,   -892,  -1999,   -102,   -373,   -825,   2083,
+          3221,  -2097,  -6057,     99,   8045,   3481,  -8197,  -7651,   6030,  11057,
+         -1888, -12538,  -3177,  11540,   7884,  -8242, -10935,   3532,  11588,   1220,
+         -9889,  -4796,   6603,   6318,  -2924,  -5677,    145,   3528,    892,  -1020,
+             0,   -669,  -2244,    612,   4738,   1375,  -6222,  -4735,   5818,   8390,
+         -3203, -11012,  -1123,  11570,   6008,  -9649, -10159,   5640,  12372,   -577,
+        -12083,  -4182,   9504,   7421,  -5562,  -8405,   1524,   7229,   1359,  -4648,
+         -2346,   1893,   1389,   -127,    802,    159,  -3073,  -2046,   4222,   5111,
+         -3423,  -8210,    574,  10062,   3693,  -9770,  -8194,   7084,  11608,  -2575,
+        -12866,  -2614,  11593,   7115,  -8167,  -9789,   3662,  10066,    603,  -8203,
+         -3444,   5098,   4233,  -2034,  -3076,    153,    802,   -128,   1387,   1899,
+         -2336,  -4654,   1340,   7229,   1549,  -8405,  -5587,   7397,   9523,  -4148,
+        -12089,   -615,  12363,   5676, -10135,  -9674,   5975,  11581,  -1087, -11009,
+         -3233,   8376,   5839,  -4716,  -6231,   1357,   4738,    623,  -2242,   -672,
+             0,  -1022,    885,   3530,    159,  -5673,  -2943,   6304,   6621,  -4770,
+         -9899,   1187,  11585,   3568, -10917,  -8271,   7853,  11557,  -3139, -12540,
+         -1925,  11044,   6059,  -7628,  -8215,   3481,   8049,    121,  -6053,  -2111,
+          3214,   2088,   -821,   -373,   -100,  -1998,   -901,   3842,   3498,  -4090,
+         -6750,   2231,   9355,   1461, -10223,  -6000,   8713,  10125,  -4997, -12546
+    },
+    {   /* 0: 1740Hz + 1860Hz */
+             0,  12692,   3980, -11343,  -7450,   8835,  10015,  -5523, -11380,   1808,
+         11466,   1775, -10332,  -4787,   8222,   6927,  -5510,  -7988,   2606,   7941,
+            11,  -6978,  -2034,   5369,   3232,  -3481,  -3524,   1706,   3047,   -402,
+         -2024,   -225,    769,     89,    334,    712,   -945,  -1961,    867,   3352,
+             6,  -4481,  -1586,   5037,   3649,  -4753,  -5853,   3495,   7795,  -1335,
+         -9098,  -1497,   9429,   4681,  -8597,  -7764,   6603,  10296,  -3635, -11895,
+           -18,  12253,   3901, -11288,  -7509,   9056,  10410,  -5819, -12223,   1992,
+         12706,   1982, -11844,  -5598,   9780,   8405,  -6833, -10136,   3409,  10623,
+            15,  -9917,  -2985,   8224,   5188,  -5901,  -6390,   3351,   6549,   -993,
+         -5837,   -834,   4506,   1902,  -2897,  -2119,   1416,   1614,   -376,   -604,
+             0,   -604,   -379,   1611,   1422,  -2112,  -2904,   1890,   4510,   -818,
+         -5837,  -1012,   6542,   3371,  -6376,  -5919,   5166,   8237,  -2957,  -9922,
+           -15,  10618,   3442, -10120,  -6861,   8405,   9802,  -5564, -11856,   1944,
+         12706,   2031, -12211,  -5854,  10387,   9084,  -7477, -11306,   3864,  12259,
+            18, -11889,  -3670,  10280,   6631,  -7741,  -8616,   4653,   9439,  -1469,
+         -9098,  -1361,   7787,   3516,  -5840,  -4768,   3634,   5045,  -1571,  -4484,
+            -6,   3350,    876,  -1958,   -949,    709,    335,     89,    769,   -220,
+         -2024,   -410,   3044,   1716,  -3516,  -3481,   3218,   5378,  -2015,  -6981,
+           -11,   7937,   2631,  -7976,  -5533,   6905,   8240,  -4758, -10342,   1741,
+         11466,   1844, -11369,  -5556,   9993,   8862,  -7419, -11360,   3943,  12698,
+             0, -12692,  -3980,  11343,   7450,  -8835, -10015,   5523,  11380,  -1808,
+        -11466,  -1775,  10332,   4787,  -8222,  -6927,   5510,   7988,  -2606,  -7941,
+           -11,   6978,   2034,  -5369,  -3232,   3481,   3524,  -1706,  -3047,    402,
+          2024,    225,   -769,    -89,   -334,   -712,    945,   1961,   -867,  -3352,
+            -6,   4481,   1586,  -5037,  -3649,   4753,   5853,  -3495,  -7795,   1335,
+          9098,   1497,  -9429,  -4681,   8597,   7764,  -6603, -10296,   3635,  11895,
+            18, -12253,  -3901,  11288,   7509,  -9056, -10410,   5819,  12223,  -1992,
+        -12706,  -1982,  11844,   5598,  -9780,  -8405,   6833,  10136,  -3409, -10623,
+           -15,   9917,   2985,  -8224,  -5188,   5901,   6390,  -3351,  -6549,    993,
+          5837,    834,  -4506,  -1902,   2897,   2119,  -1416,  -1614,    376,    604,
+             0,    604,    379,  -1611,  -1422,   2112,   2904,  -1890,  -4510,    818,
+          5837,   1012,  -6542,  -3371,   6376,   5919,  -5166,  -8237,   2957,   9922,
+            15, -10618,  -3442,  10120,   6861,  -8405,  -9802,   5564,  11856,  -1944,
+        -12706,  -2031,  12211,   5854, -10387,  -9084,   7477,  11306,  -3864, -12259,
+           -18,  11889,   3670, -10280,  -6631,   7741,   8616,  -4653,  -9439,   1469,
+          9098,   1361,  -7787,  -3516,   5840,   4768,  -3634,  -5045,   1571,   4484,
+             6,  -3350,   -876,   1958,    949,   -709,   -335,    -89,   -769,    220,
+          2024,    410,  -3044,  -1716,   3516,   3481,  -3218,  -5378,   2015,   6981,
+            11,  -7937,  -2631,   7976,   5533,  -6905,  -8240,   4758,  10342,  -1741,
+        -11466,  -1844,  11369,   5556,  -9993,  -8862,   7419,  11360,  -3943, -12698
+    },
+    {   /* B: 1380Hz + 1980Hz */
+             0,  12115,   5544,  -7115,  -6394,   1515,   2001,   -193,   3600,   4292,
+         -5329, -10199,   1516,  12723,   4700,  -9612,  -8022,   3539,   5753,    193,
+             0,   1618,  -3992,  -7329,   2577,  11894,   3181, -11228,  -8396,   5871,
+          8656,   -411,  -3889,   -428,  -1542,  -3990,   2772,   9705,   1455, -11626,
+         -7569,   7965,  10387,  -1822,  -7553,  -1530,   1690,   -733,   1913,   6523,
+            13, -10615,  -5916,   9330,  10737,  -3659, -10385,  -1577,   5281,   1924,
+             0,   2783,   -723,  -8291,  -3852,   9612,   9799,  -5430, -12028,   -706,
+          8647,   3610,  -2722,   -881,   -500,  -4942,  -1891,   8561,   7868,  -6692,
+        -12241,    767,  11250,   4168,  -5821,  -3990,    743,   -997,   -505,   6255,
+          5352,  -6988, -11084,   2386,  12683,   3694,  -8773,  -6098,   2807,   2899,
+             0,   2896,   2822,  -6080,  -8790,   3659,  12685,   2424, -11068,  -7014,
+          5329,   6262,   -493,   -997,    748,  -3981,  -5836,   4141,  11257,    805,
+        -12229,  -6724,   7842,   8576,  -1868,  -4905,   -506,   -880,  -2730,   3593,
+          8656,   -672, -12021,  -5466,   9774,   9634,  -3823,  -8294,   -741,   2779,
+             0,   1917,   5288,  -1552, -10383,  -3694,  10716,   9357,  -5883, -10623,
+           -13,   6518,   1924,   -731,   1693,  -1515,  -7554,  -1851,  10372,   7995,
+         -7537, -11640,   1421,   9702,   2793,  -3981,  -1545,   -425,  -3891,   -432,
+          8647,   5899,  -8368, -11247,   3144,  11879,   2608,  -7317,  -4005,   1611,
+             0,    184,   5749,   3562,  -8002,  -9634,   4663,  12728,   1553, -10186,
+         -5352,   4276,   3605,   -190,   2000,   1530,  -6382,  -7135,   5513,  12124,
+            19, -12115,  -5544,   7115,   6394,  -1515,  -2001,    193,  -3600,  -4292,
+          5329,  10199,  -1516, -12723,  -4700,   9612,   8022,  -3539,  -5753,   -193,
+             0,  -1618,   3992,   7329,  -2577, -11894,  -3181,  11228,   8396,  -5871,
+         -8656,    411,   3889,    428,   1542,   3990,  -2772,  -9705,  -1455,  11626,
+          7569,  -7965, -10387,   1822,   7553,   1530,  -1690,    733,  -1913,  -6523,
+           -13,  10615,   5916,  -9330, -10737,   3659,  10385,   1577,  -5281,  -1924,
+             0,  -2783,    723,   8291,   3852,  -9612,  -9799,   5430,  12028,    706,
+         -8647,  -3610,   2722,    881,    500,   4942,   1891,  -8561,  -7868,   6692,
+         12241,   -767, -11250,  -4168,   5821,   3990,   -743,    997,    505,  -6255,
+         -5352,   6988,  11084,  -2386, -12683,  -3694,   8773,   6098,  -2807,  -2899,
+             0,  -2896,  -2822,   6080,   8790,  -3659, -12685,  -2424,  11068,   7014,
+         -5329,  -6262,    493,    997,   -748,   3981,   5836,  -4141, -11257,   -805,
+         12229,   6724,  -7842,  -8576,   1868,   4905,    506,    880,   2730,  -3593,
+         -8656,    672,  12021,   5466,  -9774,  -9634,   3823,   8294,    741,  -2779,
+             0,  -1917,  -5288,   1552,  10383,   3694, -10716,  -9357,   5883,  10623,
+            13,  -6518,  -1924,    731,  -1693,   1515,   7554,   1851, -10372,  -7995,
+          7537,  11640,  -1421,  -9702,  -2793,   3981,   1545,    425,   3891,    432,
+         -8647,  -5899,   8368,  11247,  -3144, -11879,  -2608,   7317,   4005,  -1611,
+             0,   -184,  -5749,  -3562,   8002,   9634,  -4663, -12728,  -1553,  10186,
+          5352,  -4276,  -3605,    190,  -2000,  -1530,   6382,   7135,  -5513, -12124
+    },
+    {   /* C: 1500Hz + 1980Hz */
+             0,  12375,   4766,  -8887,  -6847,   3950,   5159,   -450,   -807,    422,
+         -3527,  -3873,   5216,   8759,  -3139, -12198,  -1601,  12143,   6359,  -8606,
+         -8432,   3621,   6734,    -72,  -2370,      0,  -1978,  -3395,   3682,   8234,
+         -1621, -11626,  -3102,  11531,   7839,  -7938,  -9891,   2909,   8172,    683,
+         -3784,   -799,   -591,  -2548,   2321,   7346,   -287, -10697,  -4407,  10561,
+          9098,  -6926, -11133,   1858,   9381,   1771,  -4960,  -1923,    534,  -1386,
+          1219,   6150,    778,  -9468,  -5435,   9301,  10087,  -5632, -12078,    535,
+         10286,   3121,  -5824,  -3300,   1356,      0,    445,   4721,   1508,  -8017,
+         -6120,   7830,  10727,  -4158, -12669,   -975,  10830,   4649,  -6321,  -4843,
+          1805,   1557,     48,   3151,   1857,  -6436,  -6421,   6239,  10979,  -2560,
+        -12866,  -2580,  10978,   6259,  -6419,  -6456,   1855,   3171,     50,   1537,
+          1802,  -4824,  -6317,   4630,  10826,   -956, -12664,  -4177,  10722,   7848,
+         -6114,  -8036,   1501,   4740,    452,      0,   1348,  -3282,  -5815,   3104,
+         10277,    553, -12069,  -5650,  10077,   9318,  -5424,  -9484,    766,   6166,
+          1230,  -1402,    522,  -1908,  -4947,   1756,   9368,   1873, -11119,  -6940,
+          9098,  10575,  -4392, -10710,   -302,   7359,   2336,  -2560,   -606,   -788,
+         -3768,    672,   8155,   2919,  -9875,  -7949,   7822,  11541,  -3084, -11635,
+         -1638,   8243,   3700,  -3403,  -1996,      0,  -2352,    -79,   6716,   3627,
+         -8413,  -8612,   6340,  12149,  -1582, -12202,  -3158,   8763,   5236,  -3876,
+         -3546,    425,   -787,   -452,   5140,   3952,  -6827,  -8888,   4746,  12376,
+             0, -12375,  -4766,   8887,   6847,  -3950,  -5159,    450,    807,   -422,
+          3527,   3873,  -5216,  -8759,   3139,  12198,   1601, -12143,  -6359,   8606,
+          8432,  -3621,  -6734,     72,   2370,      0,   1978,   3395,  -3682,  -8234,
+          1621,  11626,   3102, -11531,  -7839,   7938,   9891,  -2909,  -8172,   -683,
+          3784,    799,    591,   2548,  -2321,  -7346,    287,  10697,   4407, -10561,
+         -9098,   6926,  11133,  -1858,  -9381,  -1771,   4960,   1923,   -534,   1386,
+         -1219,  -6150,   -778,   9468,   5435,  -9301, -10087,   5632,  12078,   -535,
+        -10286,  -3121,   5824,   3300,  -1356,      0,   -445,  -4721,  -1508,   8017,
+          6120,  -7830, -10727,   4158,  12669,    975, -10830,  -4649,   6321,   4843,
+         -1805,  -1557,    -48,  -3151,  -1857,   6436,   6421,  -6239, -10979,   2560,
+         12866,   2580, -10978,  -6259,   6419,   6456,  -1855,  -3171,    -50,  -1537,
+         -1802,   4824,   6317,  -4630, -10826,    956,  12664,   4177, -10722,  -7848,
+          6114,   8036,  -1501,  -4740,   -452,      0,  -1348,   3282,   5815,  -3104,
+        -10277,   -553,  12069,   5650, -10077,  -9318,   5424,   9484,   -766,  -6166,
+         -1230,   1402,   -522,   1908,   4947,  -1756,  -9368,  -1873,  11119,   6940,
+         -9098, -10575,   4392,  10710,    302,  -7359,  -2336,   2560,    606,    788,
+          3768,   -672,  -8155,  -2919,   9875,   7949,  -7822, -11541,   3084,  11635,
+          1638,  -8243,  -3700,   3403,   1996,      0,   2352,     79,  -6716,  -3627,
+          8413,   8612,  -6340, -12149,   1582,  12202,   3158,  -8763,  -5236,   3876,
+          3546,   -425,    787,    452,  -5140,  -3952,   6827,   8888,  -4746, -12376
+    },
+    {   /* D: 1620Hz + 1980Hz */
+             0,  12577,   3840, -10445,  -6402,   6905,   6887,  -3206,  -5200,    585,
+          2024,     31,   1534,   1544,  -4128,  -4768,   4818,   8478,  -3260, -11415,
+           -18,  12516,   3996, -11387,  -7330,   8405,   8977,  -4544,  -8386,   1140,
+          5837,    655,  -2294,   -269,   -971,  -2119,   2777,   5686,  -2427,  -9123,
+           -15,  11233,   3760, -11210,  -7570,   9056,  10166,  -5442, -10724,   1603,
+          9098,   1227,  -5896,  -2073,   2261,    712,    474,   2323,  -1345,  -5941,
+           -11,   8843,   3159,  -9951,  -7036,   8835,  10370,  -5814, -12030,   1878,
+         11466,   1656,  -8908,  -3658,   5294,   3481,  -1876,  -1264,   -121,  -2192,
+            -6,   5590,   2236,  -7720,  -5841,   7741,   9571,  -5614, -12145,   2004,
+         12706,   1934, -11071,  -4908,   7796,   5919,  -4050,  -4714,   1103,   1787,
+             0,   1786,   1113,  -4707,  -4067,   5901,   7813,  -4878, -11082,   1897,
+         12706,   2043, -12132,  -5648,   9550,   7764,  -5816,  -7732,   2215,   5593,
+             6,  -2191,   -122,  -1262,  -1884,   3481,   5306,  -3636,  -8917,   1625,
+         11466,   1915, -12018,  -5849,  10347,   8862,  -7006,  -9966,   3130,   8848,
+            11,  -5938,  -1358,   2319,    476,    709,   2266,  -2061,  -5902,   1204,
+          9098,   1634, -10713,  -5475,  10144,   9084,  -7538, -11228,   3725,  11238,
+            15,  -9119,  -2450,   5677,   2789,  -2112,   -973,   -267,  -2297,    643,
+          5837,   1163,  -8378,  -4571,   8957,   8405,  -7300, -11405,   3959,  12522,
+            18, -11410,  -3292,   8465,   4838,  -4753,  -4137,   1535,   1535,     30,
+          2024,    596,  -5194,  -3225,   6872,   6927,  -6375, -10461,   3804,  12583,
+             0, -12577,  -3840,  10445,   6402,  -6905,  -6887,   3206,   5200,   -585,
+         -2024,    -31,  -1534,  -1544,   4128,   4768,  -4818,  -8478,   3260,  11415,
+            18, -12516,  -3996,  11387,   7330,  -8405,  -8977,   4544,   8386,  -1140,
+         -5837,   -655,   2294,    269,    971,   2119,  -2777,  -5686,   2427,   9123,
+            15, -11233,  -3760,  11210,   7570,  -9056, -10166,   5442,  10724,  -1603,
+         -9098,  -1227,   5896,   2073,  -2261,   -712,   -474,  -2323,   1345,   5941,
+            11,  -8843,  -3159,   9951,   7036,  -8835, -10370,   5814,  12030,  -1878,
+        -11466,  -1656,   8908,   3658,  -5294,  -3481,   1876,   1264,    121,   2192,
+             6,  -5590,  -2236,   7720,   5841,  -7741,  -9571,   5614,  12145,  -2004,
+        -12706,  -1934,  11071,   4908,  -7796,  -5919,   4050,   4714,  -1103,  -1787,
+             0,  -1786,  -1113,   4707,   4067,  -5901,  -7813,   4878,  11082,  -1897,
+        -12706,  -2043,  12132,   5648,  -9550,  -7764,   5816,   7732,  -2215,  -5593,
+            -6,   2191,    122,   1262,   1884,  -3481,  -5306,   3636,   8917,  -1625,
+        -11466,  -1915,  12018,   5849, -10347,  -8862,   7006,   9966,  -3130,  -8848,
+           -11,   5938,   1358,  -2319,   -476,   -709,  -2266,   2061,   5902,  -1204,
+         -9098,  -1634,  10713,   5475, -10144,  -9084,   7538,  11228,  -3725, -11238,
+           -15,   9119,   2450,  -5677,  -2789,   2112,    973,    267,   2297,   -643,
+         -5837,  -1163,   8378,   4571,  -8957,  -8405,   7300,  11405,  -3959, -12522,
+           -18,  11410,   3292,  -8465,  -4838,   4753,   4137,  -1535,  -1535,    -30,
+         -2024,   -596,   5194,   3225,  -6872,  -6927,   6375,  10461,  -3804, -12583
+    },
+    {   /* E: 1740Hz + 1980Hz */
+             0,  12730,   2787, -11685,  -5114,   9770,   6668,  -7299,  -7227,   4650,
+          6750,  -2299,  -5312,    605,   3201,    159,   -794,    116,  -1479,  -1391,
+          3214,   3440,  -4095,  -5917,   3946,   8405,  -2745, -10489,    691,  11796,
+          1925, -12108,  -4703,  11360,   7248,  -9649,  -9104,   7257,  10029,  -4550,
+         -9899,   1955,   8777,    145,  -6844,  -1375,   4458,   1581,  -2036,   -752,
+             0,   -939,   1287,   3220,  -1597,  -5677,    855,   7883,    837,  -9445,
+         -3233,  10084,   5938,  -9669,  -8537,   8242,  10622,  -5992, -11881,   3293,
+         12089,   -543, -11248,  -1835,   9512,   3481,  -7184,  -4172,   4647,   3783,
+         -2336,  -2433,    640,    377,    149,   1999,    108,  -4309,  -1373,   6122,
+          3444,  -7110,  -5990,   7056,   8592,  -5970, -10828,   3984,  12335,  -1392,
+        -12866,  -1431,  12326,   4020, -10812,  -6000,   8571,   7078,  -5968,  -7124,
+          3423,   6129,  -1356,  -4310,     98,   1998,    151,    376,    645,  -2429,
+         -2346,   3772,   4660,  -4154,  -7197,   3481,   9520,  -1803, -11250,   -579,
+         12083,   3330, -11866,  -6027,  10599,   8271,  -8509,  -9691,   5907,  10098,
+         -3203,  -9451,    810,   7883,    876,  -5673,  -1610,   3215,   1294,   -937,
+             0,   -749,  -2040,   1571,   4463,  -1357,  -6847,    120,   8774,   1984,
+         -9889,  -4581,  10011,   7287,  -9077,  -9674,   7215,  11379,  -4667, -12118,
+          1888,  11797,    725, -10483,  -2774,   8405,   3968,  -5904,  -4109,   3428,
+          3221,  -1383,  -1481,    115,   -794,    153,   3201,    618,  -5308,  -2318,
+          6740,   4672,  -7208,  -7320,   6641,   9789,  -5080, -11697,   2750,  12734,
+             0, -12730,  -2787,  11685,   5114,  -9770,  -6668,   7299,   7227,  -4650,
+         -6750,   2299,   5312,   -605,  -3201,   -159,    794,   -116,   1479,   1391,
+         -3214,  -3440,   4095,   5917,  -3946,  -8405,   2745,  10489,   -691, -11796,
+         -1925,  12108,   4703, -11360,  -7248,   9649,   9104,  -7257, -10029,   4550,
+          9899,  -1955,  -8777,   -145,   6844,   1375,  -4458,  -1581,   2036,    752,
+             0,    939,  -1287,  -3220,   1597,   5677,   -855,  -7883,   -837,   9445,
+          3233, -10084,  -5938,   9669,   8537,  -8242, -10622,   5992,  11881,  -3293,
+        -12089,    543,  11248,   1835,  -9512,  -3481,   7184,   4172,  -4647,  -3783,
+          2336,   2433,   -640,   -377,   -149,  -1999,   -108,   4309,   1373,  -6122,
+         -3444,   7110,   5990,  -7056,  -8592,   5970,  10828,  -3984, -12335,   1392,
+         12866,   1431, -12326,  -4020,  10812,   6000,  -8571,  -7078,   5968,   7124,
+         -3423,  -6129,   1356,   4310,    -98,  -1998,   -151,   -376,   -645,   2429,
+          2346,  -3772,  -4660,   4154,   7197,  -3481,  -9520,   1803,  11250,    579,
+        -12083,  -3330,  11866,   6027, -10599,  -8271,   8509,   9691,  -5907, -10098,
+          3203,   9451,   -810,  -7883,   -876,   5673,   1610,  -3215,  -1294,    937,
+             0,    749,   2040,  -1571,  -4463,   1357,   6847,   -120,  -8774,  -1984,
+          9889,   4581, -10011,  -7287,   9077,   9674,  -7215, -11379,   4667,  12118,
+         -1888, -11797,   -725,  10483,   2774,  -8405,  -3968,   5904,   4109,  -3428,
+         -3221,   1383,   1481,   -115,    794,   -153,  -3201,   -618,   5308,   2318,
+         -6740,  -4672,   7208,   7320,  -6641,  -9789,   5080,  11697,  -2750, -12734
+    },
+    {   /* F: 1860Hz + 1980Hz */
+             0,  12826,   1626, -12509,  -3164,  11889,   4568, -11012,  -5767,   9891,
+          6759,  -8595,  -7452,   7202,   7839,  -5742,  -7918,   4295,   7708,  -2956,
+         -7201,   1748,   6432,   -745,  -5455,      0,   4362,    481,  -3145,   -652,
+          1905,    517,   -731,    -95,   -332,   -592,   1241,   1522,  -1914,  -2616,
+          2336,   3849,  -2448,  -5128,   2270,   6389,  -1789,  -7593,   1017,   8653,
+             0,  -9487,  -1258,  10101,   2665, -10431,  -4172,  10452,   5694, -10146,
+         -7213,   9545,   8617,  -8668,  -9842,   7530,  10865,  -6168, -11633,   4694,
+         12092,  -3117, -12244,   1523,  12078,      0, -11624,  -1444,  10876,   2692,
+         -9889,  -3711,   8731,   4453,  -7432,  -4927,   6064,   5072,  -4719,  -4916,
+          3427,   4466,  -2273,  -3775,   1322,   2865,   -597,  -1778,    148,    590,
+             0,    590,    152,  -1777,   -604,   2862,   1332,  -3769,  -2286,   4457,
+          3441,  -4904,  -4734,   5056,   6079,  -4907,  -7447,   4428,   8744,  -3682,
+         -9899,   2660,  10883,  -1409, -11626,      0,  12076,   1561, -12236,  -3155,
+         12080,   4731, -11616,  -6203,  10844,   7561,  -9817,  -8696,   8589,   9569,
+         -7182, -10165,   5662,  10467,  -4140, -10441,   2633,  10107,  -1227,  -9489,
+             0,   8651,   1042,  -7588,  -1810,   6383,   2288,  -5121,  -2461,   3842,
+          2346,  -2610,  -1921,   1517,   1244,   -590,   -333,    -94,   -732,    513,
+          1907,   -645,  -3146,    469,   4363,      0,  -5454,   -763,   6428,   1769,
+         -7194,  -2979,   7696,   4319,  -7903,  -5766,   7819,   7226,  -7427,  -8617,
+          6731,   9910,  -5735, -11028,   4533,  11901,  -3127, -12516,   1587,  12828,
+             0, -12826,  -1626,  12509,   3164, -11889,  -4568,  11012,   5767,  -9891,
+         -6759,   8595,   7452,  -7202,  -7839,   5742,   7918,  -4295,  -7708,   2956,
+          7201,  -1748,  -6432,    745,   5455,      0,  -4362,   -481,   3145,    652,
+         -1905,   -517,    731,     95,    332,    592,  -1241,  -1522,   1914,   2616,
+         -2336,  -3849,   2448,   5128,  -2270,  -6389,   1789,   7593,  -1017,  -8653,
+             0,   9487,   1258, -10101,  -2665,  10431,   4172, -10452,  -5694,  10146,
+          7213,  -9545,  -8617,   8668,   9842,  -7530, -10865,   6168,  11633,  -4694,
+        -12092,   3117,  12244,  -1523, -12078,      0,  11624,   1444, -10876,  -2692,
+          9889,   3711,  -8731,  -4453,   7432,   4927,  -6064,  -5072,   4719,   4916,
+         -3427,  -4466,   2273,   3775,  -1322,  -2865,    597,   1778,   -148,   -590,
+             0,   -590,   -152,   1777,    604,  -2862,  -1332,   3769,   2286,  -4457,
+         -3441,   4904,   4734,  -5056,  -6079,   4907,   7447,  -4428,  -8744,   3682,
+          9899,  -2660, -10883,   1409,  11626,      0, -12076,  -1561,  12236,   3155,
+        -12080,  -4731,  11616,   6203, -10844,  -7561,   9817,   8696,  -8589,  -9569,
+          7182,  10165,  -5662, -10467,   4140,  10441,  -2633, -10107,   1227,   9489,
+             0,  -8651,  -1042,   7588,   1810,  -6383,  -2288,   5121,   2461,  -3842,
+         -2346,   2610,   1921,  -1517,  -1244,    590,    333,     94,    732,   -513,
+         -1907,    645,   3146,   -469,  -4363,      0,   5454,    763,  -6428,  -1769,
+          7194,   2979,  -7696,  -4319,   7903,   5766,  -7819,  -7226,   7427,   8617,
+         -6731,  -9910,   5735,  11028,  -4533, -11901,   3127,  12516,  -1587, -12828
+    }
+};
+
+static const int16_t r2_mf_back_digit_waves[15][R2_MF_TX_PERIOD] =
+{
+    {   /* 1: 1140Hz + 1020Hz */
+             0,   9628,  12711,   7174,  -3127, -11138, -11489,  -4153,   5735,  11445,
+          9282,   1061,  -7427, -10526,  -6498,   1509,   7903,   8603,   3625,  -3185,
+         -7194,  -6088,  -1237,   3677,   5454,   3492,   -268,  -2992,  -3146,  -1329,
+           617,   1282,    732,     55,    211,    993,   1244,     71,  -2036,  -3379,
+         -2346,    984,   4472,   5327,   2288,  -3038,  -6999,  -6399,  -1042,   5723,
+          9098,   6297,  -1227,  -8500, -10312,  -4994,   4140,  10860,  10364,   2636,
+         -7182, -12354,  -9161,    369,   9817,  12673,   6913,  -3583, -11616, -11748,
+         -3949,   6394,  12236,   9727,    779,  -8379, -11626,  -6984,   2060,   9248,
+          9899,   3995,  -4086,  -8863,  -7447,  -1315,   5020,   7388,   4734,   -586,
+         -4715,  -5161,  -2286,   1409,   3347,   2685,    604,  -1014,  -1192,   -444,
+             0,   -443,  -1192,  -1019,    597,   2681,   3351,   1421,  -2273,  -5157,
+         -4726,   -605,   4719,   7389,   5039,  -1289,  -7432,  -8871,  -4113,   3967,
+          9889,   9265,   2094,  -6957, -11624,  -8431,    742,   9704,  12244,   6427,
+         -3912, -11732, -11633,  -3621,   6880,  12667,   9842,    408,  -9135, -12358,
+         -7213,   2600,  10346,  10872,   4172,  -4964, -10304,  -8518,  -1258,   6275,
+          9098,   5743,  -1017,  -6385,  -7005,  -3056,   2270,   5321,   4480,    998,
+         -2336,  -3378,  -2042,     64,   1241,    993,    212,     54,    731,   1284,
+           623,  -1323,  -3145,  -2999,   -281,   3471,   5455,   3692,  -1218,  -6077,
+         -7201,  -3207,   3602,   8595,   7918,   1539,  -6474, -10525,  -7452,   1027,
+          9261,  11453,   5767,  -4118, -11475, -11156,  -3164,   7142,  12706,   9654,
+            39,  -9628, -12711,  -7174,   3127,  11138,  11489,   4153,  -5735, -11445,
+         -9282,  -1061,   7427,  10526,   6498,  -1509,  -7903,  -8603,  -3625,   3185,
+          7194,   6088,   1237,  -3677,  -5454,  -3492,    268,   2992,   3146,   1329,
+          -617,  -1282,   -732,    -55,   -211,   -993,  -1244,    -71,   2036,   3379,
+          2346,   -984,  -4472,  -5327,  -2288,   3038,   6999,   6399,   1042,  -5723,
+         -9098,  -6297,   1227,   8500,  10312,   4994,  -4140, -10860, -10364,  -2636,
+          7182,  12354,   9161,   -369,  -9817, -12673,  -6913,   3583,  11616,  11748,
+          3949,  -6394, -12236,  -9727,   -779,   8379,  11626,   6984,  -2060,  -9248,
+         -9899,  -3995,   4086,   8863,   7447,   1315,  -5020,  -7388,  -4734,    586,
+          4715,   5161,   2286,  -1409,  -3347,  -2685,   -604,   1014,   1192,    444,
+             0,    443,   1192,   1019,   -597,  -2681,  -3351,  -1421,   2273,   5157,
+          4726,    605,  -4719,  -7389,  -5039,   1289,   7432,   8871,   4113,  -3967,
+         -9889,  -9265,  -2094,   6957,  11624,   8431,   -742,  -9704, -12244,  -6427,
+          3912,  11732,  11633,   3621,  -6880, -12667,  -9842,   -408,   9135,  12358,
+          7213,  -2600, -10346, -10872,  -4172,   4964,  10304,   8518,   1258,  -6275,
+         -9098,  -5743,   1017,   6385,   7005,   3056,  -2270,  -5321,  -4480,   -998,
+          2336,   3378,   2042,    -64,  -1241,   -993,   -212,    -54,   -731,  -1284,
+          -623,   1323,   3145,   2999,    281,  -3471,  -5455,  -3692,   1218,   6077,
+          7201,   3207,  -3602,  -8595,  -7918,  -1539,   6474,  10525,   7452,  -1027,
+         -9261, -11453,  -5767,   4118,  11475,  11156,   3164,  -7142, -12706,  -9654
+    },
+    {   /* 2: 1140Hz + 900Hz */
+             0,   9182,  12632,   8326,   -733,  -8698, -10812,  -6377,   1163,   6794,
+          7462,   3769,  -1016,  -3649,  -3127,  -1051,    200,   -359,  -1550,  -1316,
+          1219,   4581,   5841,   2980,  -3012,  -8394,  -9100,  -3784,   4788,  11167,
+         10917,   3700,  -6120, -12399, -11064,  -2992,   6666,  11846,   9645,   1927,
+         -6095,  -9553,  -6962,   -869,   4385,   5818,   3561,    175,  -1650,  -1202,
+             0,    -16,  -1755,  -3579,  -3140,    448,   5313,   7839,   5403,  -1342,
+         -8413, -10913,  -6560,   2433,  10507,  12365,   6550,  -3372, -11183, -12011,
+         -5584,   3807,  10189,   9959,   3945,  -3455,  -7626,  -6596,  -2108,   2239,
+          3764,   2475,    454,   -204,    782,   1728,    701,  -2395,  -5366,  -5364,
+         -1202,   5099,   9310,   7938,   1047,  -7422, -11936,  -9156,   -407,   8904,
+         12866,   8932,   -368,  -9130, -11938,  -7456,   1014,   7918,   9314,   5120,
+         -1165,  -5352,  -5370,  -2406,    692,   1706,    783,   -205,    449,   2471,
+          3788,   2253,  -2090,  -6587,  -7635,  -3507,   3917,   9947,  10204,   3842,
+         -5537, -12000, -11201,  -3410,   6517,  12348,  10528,   2469,  -6530, -10907,
+         -8432,  -1372,   5382,   7836,   5327,    474,  -3129,  -3579,  -1760,    -20,
+             0,  -1202,  -1656,    164,   3551,   5838,   4402,   -845,  -6946,  -9558,
+         -6140,   1893,   9625,  11853,   6699,  -2936, -11044, -12409,  -6155,   3663,
+         10886,  11179,   4819,  -3754,  -9088,  -8416,  -3036,   2960,   5835,   4588,
+          1230,  -1308,  -1548,   -360,    202,  -1054,  -3125,  -3657,  -1033,   3753,
+          7473,   6810,   1191,  -6353, -10809,  -8739,   -770,   8298,  12631,   9209,
+            39,  -9182, -12632,  -8326,    733,   8698,  10812,   6377,  -1163,  -6794,
+         -7462,  -3769,   1016,   3649,   3127,   1051,   -200,    359,   1550,   1316,
+         -1219,  -4581,  -5841,  -2980,   3012,   8394,   9100,   3784,  -4788, -11167,
+        -10917,  -3700,   6120,  12399,  11064,   2992,  -6666, -11846,  -9645,  -1927,
+          6095,   9553,   6962,    869,  -4385,  -5818,  -3561,   -175,   1650,   1202,
+             0,     16,   1755,   3579,   3140,   -448,  -5313,  -7839,  -5403,   1342,
+          8413,  10913,   6560,  -2433, -10507, -12365,  -6550,   3372,  11183,  12011,
+          5584,  -3807, -10189,  -9959,  -3945,   3455,   7626,   6596,   2108,  -2239,
+         -3764,  -2475,   -454,    204,   -782,  -1728,   -701,   2395,   5366,   5364,
+          1202,  -5099,  -9310,  -7938,  -1047,   7422,  11936,   9156,    407,  -8904,
+        -12866,  -8932,    368,   9130,  11938,   7456,  -1014,  -7918,  -9314,  -5120,
+          1165,   5352,   5370,   2406,   -692,  -1706,   -783,    205,   -449,  -2471,
+         -3788,  -2253,   2090,   6587,   7635,   3507,  -3917,  -9947, -10204,  -3842,
+          5537,  12000,  11201,   3410,  -6517, -12348, -10528,  -2469,   6530,  10907,
+          8432,   1372,  -5382,  -7836,  -5327,   -474,   3129,   3579,   1760,     20,
+             0,   1202,   1656,   -164,  -3551,  -5838,  -4402,    845,   6946,   9558,
+          6140,  -1893,  -9625, -11853,  -6699,   2936,  11044,  12409,   6155,  -3663,
+        -10886, -11179,  -4819,   3754,   9088,   8416,   3036,  -2960,  -5835,  -4588,
+         -1230,   1308,   1548,    360,   -202,   1054,   3125,   3657,   1033,  -3753,
+         -7473,  -6810,  -1191,   6353,  10809,   8739,    770,  -8298, -12631,  -9209
+    },
+    {   /* 3: 1020Hz + 900Hz */
+             0,   8790,  12781,   9822,   1604,  -7327, -12134, -10294,  -2997,   5636,
+         10889,  10117,   4016,  -3865,  -9191,  -9310,  -4538,   2212,   7181,   7899,
+          4452,   -875,  -5035,  -6019,  -3762,    -15,   2977,   3764,   2469,    331,
+         -1174,  -1392,   -683,    -54,   -199,   -974,  -1461,   -820,   1027,   3067,
+          3788,   2194,  -1267,  -4778,  -6095,  -3969,    896,   5943,   8177,   5939,
+            27,  -6511,  -9900,  -7932,  -1351,   6429,  11068,   9771,   2955,  -5789,
+        -11635, -11235,  -4645,   4651,  11539,  12210,   6218,  -3183, -10838, -12564,
+         -7490,   1561,   9584,  12277,   8308,     36,  -7961, -11342,  -8540,  -1365,
+          6095,   9864,   8162,   2316,  -4231,  -7931,  -7138,  -2734,   2532,   5764,
+          5557,   2564,  -1168,  -3517,  -3521,  -1763,    299,   1391,   1219,    419,
+             0,    418,   1219,   1395,    306,  -1764,  -3518,  -3523,  -1182,   2550,
+          5565,   5772,   2552,  -2713,  -7127,  -7957,  -4255,   2288,   8146,   9870,
+          6140,  -1332,  -8518, -11344,  -7987,    -36,   8281,  12275,   9608,   1599,
+         -7445, -12557, -10859,  -3221,   6183,  12190,  11556,   4687,  -4609, -11219,
+        -11647,  -5821,   2920,   9752,  11075,   6463,  -1319,  -7912,  -9902,  -6532,
+           -27,   5919,   8176,   5958,    918,  -3934,  -6092,  -4787,  -1283,   2182,
+          3764,   3072,   1035,   -814,  -1459,   -957,   -200,    -53,   -682,  -1393,
+         -1193,    323,   2463,   3765,   2987,     15,  -3750,  -6017,  -5048,   -897,
+          4434,   7894,   7195,   2239,  -4513,  -9309,  -9204,  -3895,   3986,  10102,
+         10914,   5668,  -2961, -10274, -12141,  -7377,   1566,   9797,  12784,   8819,
+            39,  -8790, -12781,  -9822,  -1604,   7327,  12134,  10294,   2997,  -5636,
+        -10889, -10117,  -4016,   3865,   9191,   9310,   4538,  -2212,  -7181,  -7899,
+         -4452,    875,   5035,   6019,   3762,     15,  -2977,  -3764,  -2469,   -331,
+          1174,   1392,    683,     54,    199,    974,   1461,    820,  -1027,  -3067,
+         -3788,  -2194,   1267,   4778,   6095,   3969,   -896,  -5943,  -8177,  -5939,
+           -27,   6511,   9900,   7932,   1351,  -6429, -11068,  -9771,  -2955,   5789,
+         11635,  11235,   4645,  -4651, -11539, -12210,  -6218,   3183,  10838,  12564,
+          7490,  -1561,  -9584, -12277,  -8308,    -36,   7961,  11342,   8540,   1365,
+         -6095,  -9864,  -8162,  -2316,   4231,   7931,   7138,   2734,  -2532,  -5764,
+         -5557,  -2564,   1168,   3517,   3521,   1763,   -299,  -1391,  -1219,   -419,
+             0,   -418,  -1219,  -1395,   -306,   1764,   3518,   3523,   1182,  -2550,
+         -5565,  -5772,  -2552,   2713,   7127,   7957,   4255,  -2288,  -8146,  -9870,
+         -6140,   1332,   8518,  11344,   7987,     36,  -8281, -12275,  -9608,  -1599,
+          7445,  12557,  10859,   3221,  -6183, -12190, -11556,  -4687,   4609,  11219,
+         11647,   5821,  -2920,  -9752, -11075,  -6463,   1319,   7912,   9902,   6532,
+            27,  -5919,  -8176,  -5958,   -918,   3934,   6092,   4787,   1283,  -2182,
+         -3764,  -3072,  -1035,    814,   1459,    957,    200,     53,    682,   1393,
+          1193,   -323,  -2463,  -3765,  -2987,    -15,   3750,   6017,   5048,    897,
+         -4434,  -7894,  -7195,  -2239,   4513,   9309,   9204,   3895,  -3986, -10102,
+        -10914,  -5668,   2961,  10274,  12141,   7377,  -1566,  -9797, -12784,  -8819
+    },
+    {   /* 4: 1140Hz + 780Hz */
+             0,   8698,  12331,   9045,   1378,  -5742,  -8357,  -5975,  -1373,   1823,
+          1905,    178,   -594,   1240,   4615,   6389,   3968,  -2355,  -8983, -11355,
+         -7213,   1570,   9891,  12764,   8537,     36,  -7563, -10024,  -6796,   -938,
+          3427,   4093,   2040,    153,    578,   2862,   4291,   2349,  -2882,  -8349,
+         -9899,  -5500,   2995,  10634,  12620,   7561,  -1556,  -9254, -11250,  -7047,
+           -27,   5276,   6191,   3513,    355,   -590,    794,   2204,   1090,  -2891,
+         -7194,  -8109,  -3746,   4085,  10812,  11901,   6194,  -3180, -10667, -11964,
+         -6759,   1305,   7208,   8024,   4485,     15,  -2187,  -1415,    304,    281,
+         -2336,  -5560,  -6114,  -2167,   4764,  10431,  10691,   4573,  -4667, -11629,
+        -12092,  -5945,   2880,   9075,   9486,   4927,   -855,  -4065,  -3576,  -1239,
+             0,  -1235,  -3576,  -4075,   -876,   4907,   9480,   9093,   2914,  -5912,
+        -12080, -11646,  -4703,   4537,  10676,  10441,   4790,  -2141,  -6102,  -5564,
+         -2346,    275,    303,  -1415,  -2194,    -15,   4470,   8023,   7227,   1337,
+         -6731, -11957, -10687,  -3218,   6159,  11889,  10828,   4117,  -3717,  -8097,
+         -7201,  -2907,   1077,   2200,    794,   -592,    346,   3504,   6192,   5294,
+            27,  -7024, -11248,  -9277,  -1594,   7530,  12613,  10655,   3031,  -5469,
+         -9889,  -8361,  -2905,   2331,   4285,   2865,    581,    151,   2036,   4095,
+          3441,   -916,  -6779, -10026,  -7588,    -36,   8509,  12761,   9916,   1609,
+         -7182, -11349,  -9000,  -2384,   3946,   6383,   4622,   1250,   -590,    178,
+          1907,   1833,  -1356,  -5963,  -8362,  -5766,   1345,   9022,  12334,   8727,
+            39,  -8698, -12331,  -9045,  -1378,   5742,   8357,   5975,   1373,  -1823,
+         -1905,   -178,    594,  -1240,  -4615,  -6389,  -3968,   2355,   8983,  11355,
+          7213,  -1570,  -9891, -12764,  -8537,    -36,   7563,  10024,   6796,    938,
+         -3427,  -4093,  -2040,   -153,   -578,  -2862,  -4291,  -2349,   2882,   8349,
+          9899,   5500,  -2995, -10634, -12620,  -7561,   1556,   9254,  11250,   7047,
+            27,  -5276,  -6191,  -3513,   -355,    590,   -794,  -2204,  -1090,   2891,
+          7194,   8109,   3746,  -4085, -10812, -11901,  -6194,   3180,  10667,  11964,
+          6759,  -1305,  -7208,  -8024,  -4485,    -15,   2187,   1415,   -304,   -281,
+          2336,   5560,   6114,   2167,  -4764, -10431, -10691,  -4573,   4667,  11629,
+         12092,   5945,  -2880,  -9075,  -9486,  -4927,    855,   4065,   3576,   1239,
+             0,   1235,   3576,   4075,    876,  -4907,  -9480,  -9093,  -2914,   5912,
+         12080,  11646,   4703,  -4537, -10676, -10441,  -4790,   2141,   6102,   5564,
+          2346,   -275,   -303,   1415,   2194,     15,  -4470,  -8023,  -7227,  -1337,
+          6731,  11957,  10687,   3218,  -6159, -11889, -10828,  -4117,   3717,   8097,
+          7201,   2907,  -1077,  -2200,   -794,    592,   -346,  -3504,  -6192,  -5294,
+           -27,   7024,  11248,   9277,   1594,  -7530, -12613, -10655,  -3031,   5469,
+          9889,   8361,   2905,  -2331,  -4285,  -2865,   -581,   -151,  -2036,  -4095,
+         -3441,    916,   6779,  10026,   7588,     36,  -8509, -12761,  -9916,  -1609,
+          7182,  11349,   9000,   2384,  -3946,  -6383,  -4622,  -1250,    590,   -178,
+         -1907,  -1833,   1356,   5963,   8362,   5766,  -1345,  -9022, -12334,  -8727
+    },
+    {   /* 5: 1020Hz + 780Hz */
+             0,   8306,  12480,  10540,   3717,  -4371,  -9679,  -9892,  -5533,    664,
+          5332,   6526,   4439,   1025,  -1448,  -1869,   -769,    216,   -251,  -2140,
+         -3979,  -3886,   -985,   3764,   7787,   8416,   4514,  -2475,  -9115, -11775,
+         -8665,  -1000,   7477,  12498,  11443,   4880,  -3836, -10317, -11500,  -7209,
+           -15,   6248,   8690,   6725,   2139,  -2225,  -4221,  -3486,  -1422,     93,
+             0,  -1217,  -1953,   -838,   2144,   5390,   6549,   4136,  -1358,  -7337,
+        -10416,  -8431,  -1831,   6304,  11844,  11746,   5861,  -2990, -10322, -12517,
+         -8665,   -941,   6603,  10343,   8847,   3507,  -2522,  -6161,  -6128,  -3322,
+            -6,   1828,   1593,    353,   -250,    771,   2851,   4233,   3232,   -501,
+         -5332,  -8480,  -7598,  -2379,   4917,  10586,  11380,   6482,  -1950,  -9724,
+        -12866,  -9749,  -1988,   6450,  11369,  10600,   4946,  -2349,  -7581,  -8482,
+         -5349,   -521,   3218,   4230,   2856,    777,   -247,    353,   1594,   1834,
+             6,  -3311,  -6125,  -6172,  -2546,   3455,   8834,  10351,   6631,   -904,
+         -8638, -12514, -10345,  -3028,   5826,  11731,  11856,   6335,  -1796,  -8409,
+        -10416,  -7356,  -1384,   4115,   6542,   5396,   2157,   -828,  -1949,  -1218,
+             0,     97,  -1416,  -3484,  -4228,  -2242,   2119,   6712,   8694,   6270,
+            15,  -7183, -11494, -10337,  -3872,   4844,  11425,  12507,   7509,   -961,
+         -8638, -11772,  -9135,  -2506,   4487,   8394,   7795,   3783,   -966,  -3876,
+         -3979,  -2145,   -256,    215,   -769,  -1871,  -1457,   1012,   4429,   6527,
+          5349,    690,  -5510,  -9885,  -9694,  -4404,   3682,  10520,  12486,   8336,
+            39,  -8306, -12480, -10540,  -3717,   4371,   9679,   9892,   5533,   -664,
+         -5332,  -6526,  -4439,  -1025,   1448,   1869,    769,   -216,    251,   2140,
+          3979,   3886,    985,  -3764,  -7787,  -8416,  -4514,   2475,   9115,  11775,
+          8665,   1000,  -7477, -12498, -11443,  -4880,   3836,  10317,  11500,   7209,
+            15,  -6248,  -8690,  -6725,  -2139,   2225,   4221,   3486,   1422,    -93,
+             0,   1217,   1953,    838,  -2144,  -5390,  -6549,  -4136,   1358,   7337,
+         10416,   8431,   1831,  -6304, -11844, -11746,  -5861,   2990,  10322,  12517,
+          8665,    941,  -6603, -10343,  -8847,  -3507,   2522,   6161,   6128,   3322,
+             6,  -1828,  -1593,   -353,    250,   -771,  -2851,  -4233,  -3232,    501,
+          5332,   8480,   7598,   2379,  -4917, -10586, -11380,  -6482,   1950,   9724,
+         12866,   9749,   1988,  -6450, -11369, -10600,  -4946,   2349,   7581,   8482,
+          5349,    521,  -3218,  -4230,  -2856,   -777,    247,   -353,  -1594,  -1834,
+            -6,   3311,   6125,   6172,   2546,  -3455,  -8834, -10351,  -6631,    904,
+          8638,  12514,  10345,   3028,  -5826, -11731, -11856,  -6335,   1796,   8409,
+         10416,   7356,   1384,  -4115,  -6542,  -5396,  -2157,    828,   1949,   1218,
+             0,    -97,   1416,   3484,   4228,   2242,  -2119,  -6712,  -8694,  -6270,
+           -15,   7183,  11494,  10337,   3872,  -4844, -11425, -12507,  -7509,    961,
+          8638,  11772,   9135,   2506,  -4487,  -8394,  -7795,  -3783,    966,   3876,
+          3979,   2145,    256,   -215,    769,   1871,   1457,  -1012,  -4429,  -6527,
+         -5349,   -690,   5510,   9885,   9694,   4404,  -3682, -10520, -12486,  -8336
+    },
+    {   /* 6: 900Hz + 780Hz */
+             0,   7860,  12402,  11692,   6110,  -1931,  -9002, -12116, -10105,  -3985,
+          3513,   9234,  10850,   7901,   1922,  -4430,  -8473,  -8745,  -5427,   -271,
+          4434,   6783,   6093,   3067,   -679,  -3471,  -4317,  -3267,  -1180,    722,
+          1635,   1417,    624,     43,    167,    894,   1586,   1457,    181,  -1902,
+         -3764,  -4290,  -2744,    528,   4236,   6630,   6339,   3088,  -2031,  -6831,
+         -9098,  -7532,  -2481,   4082,   9316,  10833,   7722,   1114,  -6318, -11316,
+        -11647,  -6989,    769,   8368,  12534,  11438,   5498,  -2780,  -9888, -12781,
+        -10300,  -3527,   4556,  10575,  12014,   8431,   1477,  -5773, -10297, -10331,
+         -6140,    308,   6134,   9012,   7979,   3815,  -1467,  -5550,  -6869,  -5279,
+         -1819,   1780,   3997,   4148,   2618,    478,  -1160,  -1659,  -1164,   -375,
+             0,   -374,  -1163,  -1661,  -1166,    461,   2610,   4147,   4005,   1796,
+         -1788,  -5268,  -6870,  -5565,  -1490,   3774,   7968,   9018,   6157,    338,
+         -6095, -10322, -10309,  -5803,   1442,   8379,  12009,  10594,   4591,  -3490,
+        -10263, -12782,  -9913,  -2818,   5462,  11413,  12542,   8397,    808,  -6958,
+        -11635, -11329,  -6349,   1079,   7697,  10835,   9331,   4111,  -2451,  -7514,
+         -9098,  -6847,  -2055,   3066,   6328,   6652,   4250,    546,  -2731,  -4285,
+         -3788,  -1911,    172,   1452,   1585,    914,    168,     42,    622,   1417,
+          1624,    729,  -1171,  -3261,  -4319,  -3492,   -696,   3051,   6086,   6789,
+          4452,   -246,  -5407,  -8739,  -8485,  -4464,   1891,   7880,  10847,   9253,
+          3560,  -3951, -10085, -12119,  -9027,  -1987,   6077,  11677,  12412,   7891,
+            39,  -7860, -12402, -11692,  -6110,   1931,   9002,  12116,  10105,   3985,
+         -3513,  -9234, -10850,  -7901,  -1922,   4430,   8473,   8745,   5427,    271,
+         -4434,  -6783,  -6093,  -3067,    679,   3471,   4317,   3267,   1180,   -722,
+         -1635,  -1417,   -624,    -43,   -167,   -894,  -1586,  -1457,   -181,   1902,
+          3764,   4290,   2744,   -528,  -4236,  -6630,  -6339,  -3088,   2031,   6831,
+          9098,   7532,   2481,  -4082,  -9316, -10833,  -7722,  -1114,   6318,  11316,
+         11647,   6989,   -769,  -8368, -12534, -11438,  -5498,   2780,   9888,  12781,
+         10300,   3527,  -4556, -10575, -12014,  -8431,  -1477,   5773,  10297,  10331,
+          6140,   -308,  -6134,  -9012,  -7979,  -3815,   1467,   5550,   6869,   5279,
+          1819,  -1780,  -3997,  -4148,  -2618,   -478,   1160,   1659,   1164,    375,
+             0,    374,   1163,   1661,   1166,   -461,  -2610,  -4147,  -4005,  -1796,
+          1788,   5268,   6870,   5565,   1490,  -3774,  -7968,  -9018,  -6157,   -338,
+          6095,  10322,  10309,   5803,  -1442,  -8379, -12009, -10594,  -4591,   3490,
+         10263,  12782,   9913,   2818,  -5462, -11413, -12542,  -8397,   -808,   6958,
+         11635,  11329,   6349,  -1079,  -7697, -10835,  -9331,  -4111,   2451,   7514,
+          9098,   6847,   2055,  -3066,  -6328,  -6652,  -4250,   -546,   2731,   4285,
+          3788,   1911,   -172,  -1452,  -1585,   -914,   -168,    -42,   -622,  -1417,
+         -1624,   -729,   1171,   3261,   4319,   3492,    696,  -3051,  -6086,  -6789,
+         -4452,    246,   5407,   8739,   8485,   4464,  -1891,  -7880, -10847,  -9253,
+         -3560,   3951,  10085,  12119,   9027,   1987,  -6077, -11677, -12412,  -7891
+    },
+    {   /* 7: 1140Hz + 660Hz */
+             0,   8181,  11809,   9271,   2912,  -2879,  -4866,  -3116,   -476,   -123,
+         -2809,  -6184,  -6645,  -2333,   5098,  11297,  12145,   6719,  -1941,  -8843,
+        -10416,  -6709,  -1085,   2474,   2294,     18,  -1101,   1095,   5573,   8788,
+          7376,    928,  -7300, -12479, -11384,  -4699,   3470,   8443,   8109,   4037,
+             6,  -1046,    798,   2731,   1698,  -2879,  -8346, -10562,  -7036,    987,
+          9084,  12596,   9694,   2557,  -4239,  -6973,  -5200,  -1680,    124,  -1225,
+         -3979,  -4722,  -1291,   5158,  10713,  11311,   5809,  -2986, -10077, -11613,
+         -7376,   -702,   4050,   4609,   2150,      7,    739,   4036,   6817,   5737,
+            15,  -7554, -12303, -10963,  -3966,   4665,  10037,   9636,   4838,   -475,
+         -2809,  -1609,    654,    749,  -2472,  -6973,  -8917,  -5682,   1863,   9607,
+         12866,   9632,   1900,  -5654,  -8908,  -6982,  -2487,    740,    653,  -1609,
+         -2818,   -494,   4818,   9629,  10052,   4699,  -3929, -10942, -12309,  -7581,
+           -15,   5716,   6814,   4043,    746,     -7,   2147,   4612,   4067,   -675,
+         -7354, -11611, -10099,  -3024,   5774,  11297,  10724,   5184,  -1266,  -4710,
+         -3979,  -1228,    127,  -1671,  -5194,  -6982,  -4265,   2525,   9672,  12599,
+          9112,   1026,  -7006, -10554,  -8359,  -2901,   1682,   2726,    799,  -1050,
+            -6,   4023,   8105,   8459,   3503,  -4665, -11366, -12489,  -7330,    892,
+          7354,   8786,   5586,   1109,  -1094,    -18,   2297,   2487,  -1064,  -6692,
+        -10416,  -8866,  -1979,   6686,  12132,  11311,   5129,  -2304,  -6630,  -6185,
+         -2818,   -128,   -474,  -3113,  -4874,  -2901,   2885,   9254,  11815,   8210,
+            19,  -8181, -11809,  -9271,  -2912,   2879,   4866,   3116,    476,    123,
+          2809,   6184,   6645,   2333,  -5098, -11297, -12145,  -6719,   1941,   8843,
+         10416,   6709,   1085,  -2474,  -2294,    -18,   1101,  -1095,  -5573,  -8788,
+         -7376,   -928,   7300,  12479,  11384,   4699,  -3470,  -8443,  -8109,  -4037,
+            -6,   1046,   -798,  -2731,  -1698,   2879,   8346,  10562,   7036,   -987,
+         -9084, -12596,  -9694,  -2557,   4239,   6973,   5200,   1680,   -124,   1225,
+          3979,   4722,   1291,  -5158, -10713, -11311,  -5809,   2986,  10077,  11613,
+          7376,    702,  -4050,  -4609,  -2150,     -7,   -739,  -4036,  -6817,  -5737,
+           -15,   7554,  12303,  10963,   3966,  -4665, -10037,  -9636,  -4838,    475,
+          2809,   1609,   -654,   -749,   2472,   6973,   8917,   5682,  -1863,  -9607,
+        -12866,  -9632,  -1900,   5654,   8908,   6982,   2487,   -740,   -653,   1609,
+          2818,    494,  -4818,  -9629, -10052,  -4699,   3929,  10942,  12309,   7581,
+            15,  -5716,  -6814,  -4043,   -746,      7,  -2147,  -4612,  -4067,    675,
+          7354,  11611,  10099,   3024,  -5774, -11297, -10724,  -5184,   1266,   4710,
+          3979,   1228,   -127,   1671,   5194,   6982,   4265,  -2525,  -9672, -12599,
+         -9112,  -1026,   7006,  10554,   8359,   2901,  -1682,  -2726,   -799,   1050,
+             6,  -4023,  -8105,  -8459,  -3503,   4665,  11366,  12489,   7330,   -892,
+         -7354,  -8786,  -5586,  -1109,   1094,     18,  -2297,  -2487,   1064,   6692,
+         10416,   8866,   1979,  -6686, -12132, -11311,  -5129,   2304,   6630,   6185,
+          2818,    128,    474,   3113,   4874,   2901,  -2885,  -9254, -11815,  -8210
+    },
+    {   /* 8: 1020Hz + 660Hz */
+             0,   7789,  11958,  10767,   5251,  -1509,  -6189,  -7033,  -4637,  -1281,
+           617,    163,  -1611,  -2549,   -965,   3038,   7406,   9292,   6789,    372,
+         -7182, -12166, -11962,  -6525,   1545,   8397,  10976,   8645,   3255,  -2048,
+         -4715,  -4165,  -1863,   -134,   -519,  -2681,  -4658,  -4223,   -507,   5178,
+          9889,  10701,   6493,  -1177,  -8782, -12667, -11011,  -4794,   2791,   8129,
+          9112,   6101,   1549,  -1794,  -2450,   -993,    554,    251,  -2323,  -5671,
+         -7201,  -5044,    623,   7377,  11745,  11156,   5476,  -2796,  -9732, -12166,
+         -9282,  -2948,   3445,   6928,   6513,   3499,    404,   -709,    385,   2132,
+          2346,   -164,  -4595,  -8442,  -8981,  -4994,   2197,   9297,  12738,  10652,
+          3949,  -4144,  -9824, -10705,  -7041,  -1315,   3317,   4865,   3490,   1123,
+             0,   1118,   3487,   4871,   3336,  -1289,  -7020, -10702,  -9843,  -4179,
+          3912,  10630,  12741,   9322,   2232,  -4964,  -8968,  -8447,  -4612,   -182,
+          2336,   2130,    385,   -713,    394,   3463,   6510,   6940,   3471,  -2917,
+         -9261, -12168,  -9757,  -2835,   5440,  11138,  11752,   7402,    654,  -5022,
+         -7194,  -5677,  -2334,    243,    553,   -993,  -2454,  -1807,   1530,   6087,
+          9084,   8148,   2825,  -4760, -10992, -12673,  -8811,  -1215,   6461,  10689,
+          9899,   5202,   -483,  -4209,  -4655,  -2685,   -522,   -133,  -1858,  -4164,
+         -4726,  -2069,   3230,   8629,  10981,   8413,   1582,  -6491, -11947, -12177,
+         -7213,    336,   6764,   9285,   7417,   3056,   -949,  -2542,  -1610,    163,
+           623,  -1271,  -4628,  -7035,  -6206,  -1539,   5221,  10752,  11967,   7820,
+            19,  -7789, -11958, -10767,  -5251,   1509,   6189,   7033,   4637,   1281,
+          -617,   -163,   1611,   2549,    965,  -3038,  -7406,  -9292,  -6789,   -372,
+          7182,  12166,  11962,   6525,  -1545,  -8397, -10976,  -8645,  -3255,   2048,
+          4715,   4165,   1863,    134,    519,   2681,   4658,   4223,    507,  -5178,
+         -9889, -10701,  -6493,   1177,   8782,  12667,  11011,   4794,  -2791,  -8129,
+         -9112,  -6101,  -1549,   1794,   2450,    993,   -554,   -251,   2323,   5671,
+          7201,   5044,   -623,  -7377, -11745, -11156,  -5476,   2796,   9732,  12166,
+          9282,   2948,  -3445,  -6928,  -6513,  -3499,   -404,    709,   -385,  -2132,
+         -2346,    164,   4595,   8442,   8981,   4994,  -2197,  -9297, -12738, -10652,
+         -3949,   4144,   9824,  10705,   7041,   1315,  -3317,  -4865,  -3490,  -1123,
+             0,  -1118,  -3487,  -4871,  -3336,   1289,   7020,  10702,   9843,   4179,
+         -3912, -10630, -12741,  -9322,  -2232,   4964,   8968,   8447,   4612,    182,
+         -2336,  -2130,   -385,    713,   -394,  -3463,  -6510,  -6940,  -3471,   2917,
+          9261,  12168,   9757,   2835,  -5440, -11138, -11752,  -7402,   -654,   5022,
+          7194,   5677,   2334,   -243,   -553,    993,   2454,   1807,  -1530,  -6087,
+         -9084,  -8148,  -2825,   4760,  10992,  12673,   8811,   1215,  -6461, -10689,
+         -9899,  -5202,    483,   4209,   4655,   2685,    522,    133,   1858,   4164,
+          4726,   2069,  -3230,  -8629, -10981,  -8413,  -1582,   6491,  11947,  12177,
+          7213,   -336,  -6764,  -9285,  -7417,  -3056,    949,   2542,   1610,   -163,
+          -623,   1271,   4628,   7035,   6206,   1539,  -5221, -10752, -11967,  -7820
+    },
+    {   /* 9: 900Hz + 660Hz */
+             0,   7343,  11879,  11919,   7644,    931,  -5511,  -9257,  -9209,  -5932,
+         -1202,   2871,   4799,   4327,   2405,    476,   -296,    329,   1613,   2241,
+          1230,  -1497,  -4883,  -7222,  -6921,  -3489,   2143,   7853,  11190,  10449,
+          5584,  -1747,  -8716, -12589, -11794,  -6667,    764,   7551,  11174,  10485,
+          6140,    162,  -4942,  -7373,  -6685,  -3810,   -450,   1780,   2183,   1203,
+            13,   -212,   1021,   3126,   4720,   4449,   1727,  -2769,  -7283,  -9651,
+         -8432,  -3603,   3224,   9441,  12435,  10848,   5113,  -2586,  -9298, -12430,
+        -10917,  -5535,   1398,   7159,   9679,   8423,   4404,   -321,  -3783,  -4876,
+         -3788,  -1685,    -54,    216,   -751,  -1950,  -2121,   -486,   2636,   5874,
+          7462,   6116,   1772,  -4177,  -9340, -11423,  -9222,  -3276,   4275,  10472,
+         12866,  10494,   4312,  -3239,  -9199, -11428,  -9357,  -4205,   1743,   6098,
+          7473,   5883,   2651,   -473,  -2114,  -1967,   -752,    217,    -49,  -1678,
+         -3764,  -4881,  -3798,   -343,   4383,   8387,   9686,   7183,   1432,  -5503,
+        -10886, -12436,  -9325,  -2624,   5077,  10820,  12438,   9464,   3259,  -3571,
+         -8413,  -9650,  -7299,  -2792,   1707,   4445,   4719,   3131,   1028,   -208,
+           -13,   1203,   2186,   1790,   -435,  -3779,  -6680,  -7382,  -4964,    133,
+          6095,  10474,  11184,   7580,    802,  -6615, -11779, -12597,  -8745,  -1785,
+          5537,  10432,  11194,   7875,   2173,  -3474,  -6908,  -7223,  -4894,  -1512,
+          1219,   2235,   1613,    330,   -299,    463,   2399,   4325,   4807,   2889,
+         -1165,  -5913,  -9203,  -9269,  -5540,    877,   7616,  11909,  11893,   7375,
+            19,  -7343, -11879, -11919,  -7644,   -931,   5511,   9257,   9209,   5932,
+          1202,  -2871,  -4799,  -4327,  -2405,   -476,    296,   -329,  -1613,  -2241,
+         -1230,   1497,   4883,   7222,   6921,   3489,  -2143,  -7853, -11190, -10449,
+         -5584,   1747,   8716,  12589,  11794,   6667,   -764,  -7551, -11174, -10485,
+         -6140,   -162,   4942,   7373,   6685,   3810,    450,  -1780,  -2183,  -1203,
+           -13,    212,  -1021,  -3126,  -4720,  -4449,  -1727,   2769,   7283,   9651,
+          8432,   3603,  -3224,  -9441, -12435, -10848,  -5113,   2586,   9298,  12430,
+         10917,   5535,  -1398,  -7159,  -9679,  -8423,  -4404,    321,   3783,   4876,
+          3788,   1685,     54,   -216,    751,   1950,   2121,    486,  -2636,  -5874,
+         -7462,  -6116,  -1772,   4177,   9340,  11423,   9222,   3276,  -4275, -10472,
+        -12866, -10494,  -4312,   3239,   9199,  11428,   9357,   4205,  -1743,  -6098,
+         -7473,  -5883,  -2651,    473,   2114,   1967,    752,   -217,     49,   1678,
+          3764,   4881,   3798,    343,  -4383,  -8387,  -9686,  -7183,  -1432,   5503,
+         10886,  12436,   9325,   2624,  -5077, -10820, -12438,  -9464,  -3259,   3571,
+          8413,   9650,   7299,   2792,  -1707,  -4445,  -4719,  -3131,  -1028,    208,
+            13,  -1203,  -2186,  -1790,    435,   3779,   6680,   7382,   4964,   -133,
+         -6095, -10474, -11184,  -7580,   -802,   6615,  11779,  12597,   8745,   1785,
+         -5537, -10432, -11194,  -7875,  -2173,   3474,   6908,   7223,   4894,   1512,
+         -1219,  -2235,  -1613,   -330,    299,   -463,  -2399,  -4325,  -4807,  -2889,
+          1165,   5913,   9203,   9269,   5540,   -877,  -7616, -11909, -11893,  -7375
+    },
+    {   /* 0: 780Hz + 660Hz */
+             0,   6859,  11578,  12637,   9757,   3887,  -3056,  -8854, -11745, -10904,
+         -6759,   -719,   5221,   9218,  10148,   7918,   3471,  -1666,  -5819,  -7798,
+         -7201,  -4507,   -833,   2561,   4628,   4942,   3681,   1613,   -394,  -1656,
+         -1905,  -1355,   -554,    -37,   -152,   -812,  -1610,  -1945,  -1353,    208,
+          2336,   4216,   5016,   4129,   1549,  -2067,  -5567,  -7649,  -7417,  -4641,
+           -13,   5081,   8968,  10219,   8216,   3410,  -2791,  -8404, -11597, -11199,
+         -7213,   -799,   6038,  11093,  12741,  10384,   4756,  -2393,  -8782, -12382,
+        -12092,  -8037,  -1582,   5225,  10219,  11894,   9843,   4859,  -1371,  -6834,
+         -9889,  -9721,  -6623,  -1746,   3230,   6752,   7868,   6481,   3336,   -390,
+         -3427,  -4927,  -4658,  -3039,   -902,    927,   1858,   1814,   1106,    328,
+             0,    326,   1104,   1815,   1863,    935,   -891,  -3031,  -4655,  -4933,
+         -3441,   -410,   3317,   6470,   7869,   6767,   3255,  -1718,  -6601,  -9713,
+         -9899,  -6859,  -1405,   4828,   9824,  11879,  10239,   5259,  -1545,  -8008,
+        -12080, -12392,  -8811,  -2432,   4720,  10361,  12738,  11112,   6072,   -761,
+         -7182, -11185, -11604,  -8429,  -2825,   3378,   8196,  10215,   8981,   5105,
+            13,  -4619,  -7406,  -7652,  -5581,  -2087,   1530,   4118,   5013,   4221,
+          2346,    218,  -1346,  -1942,  -1611,   -814,   -153,    -36,   -553,  -1354,
+         -1907,  -1663,   -404,   1602,   3674,   4905,   4637,   2578,   -813,  -4491,
+         -7194,  -7804,  -5838,  -1693,   3445,   7900,  10146,   9233,   5251,   -685,
+         -6731, -10891, -11752,  -8880,  -3093,   3850,   9732,  12632,  11595,   6892,
+            19,  -6859, -11578, -12637,  -9757,  -3887,   3056,   8854,  11745,  10904,
+          6759,    719,  -5221,  -9218, -10148,  -7918,  -3471,   1666,   5819,   7798,
+          7201,   4507,    833,  -2561,  -4628,  -4942,  -3681,  -1613,    394,   1656,
+          1905,   1355,    554,     37,    152,    812,   1610,   1945,   1353,   -208,
+         -2336,  -4216,  -5016,  -4129,  -1549,   2067,   5567,   7649,   7417,   4641,
+            13,  -5081,  -8968, -10219,  -8216,  -3410,   2791,   8404,  11597,  11199,
+          7213,    799,  -6038, -11093, -12741, -10384,  -4756,   2393,   8782,  12382,
+         12092,   8037,   1582,  -5225, -10219, -11894,  -9843,  -4859,   1371,   6834,
+          9889,   9721,   6623,   1746,  -3230,  -6752,  -7868,  -6481,  -3336,    390,
+          3427,   4927,   4658,   3039,    902,   -927,  -1858,  -1814,  -1106,   -328,
+             0,   -326,  -1104,  -1815,  -1863,   -935,    891,   3031,   4655,   4933,
+          3441,    410,  -3317,  -6470,  -7869,  -6767,  -3255,   1718,   6601,   9713,
+          9899,   6859,   1405,  -4828,  -9824, -11879, -10239,  -5259,   1545,   8008,
+         12080,  12392,   8811,   2432,  -4720, -10361, -12738, -11112,  -6072,    761,
+          7182,  11185,  11604,   8429,   2825,  -3378,  -8196, -10215,  -8981,  -5105,
+           -13,   4619,   7406,   7652,   5581,   2087,  -1530,  -4118,  -5013,  -4221,
+         -2346,   -218,   1346,   1942,   1611,    814,    153,     36,    553,   1354,
+          1907,   1663,    404,  -1602,  -3674,  -4905,  -4637,  -2578,    813,   4491,
+          7194,   7804,   5838,   1693,  -3445,  -7900, -10146,  -9233,  -5251,    685,
+          6731,  10891,  11752,   8880,   3093,  -3850,  -9732, -12632, -11595,  -6892
+    },
+    {   /* B: 1140Hz + 540Hz */
+             0,   7653,  11100,   8984,   3652,   -767,  -1460,   1000,   3365,   2281,
+         -2800,  -9068, -12218,  -9634,  -2402,   5377,   9405,   8158,   3724,    101,
+             0,   2872,   5430,   4264,  -1290,  -8387, -12603, -11052,  -4525,   3037,
+          7357,   6712,   3072,    221,    851,   4384,   7437,   6487,    737,  -7013,
+        -12229, -11778,  -6149,    913,   5168,   4861,   1775,   -400,    984,   5314,
+          9084,   8674,   3063,  -5071, -11122, -11742,  -7128,   -806,   3115,   2832,
+             0,  -1695,    359,   5508,  10217,  10601,   5434,  -2791,  -9422, -10968,
+         -7373,  -1885,   1460,    864,  -2008,  -3474,   -959,   4964,  10652,  12024,
+          7569,   -383,  -7287,  -9540,  -6852,  -2240,    373,   -768,  -3952,  -5561,
+         -2827,   3697,  10327,  12771,   9285,   1888,  -5008,  -7667,  -5656,  -1837,
+             0,  -1829,  -5651,  -7678,  -5036,   1852,   9258,  12767,  10347,   3728,
+         -2800,  -5549,  -3953,   -770,    379,  -2227,  -6842,  -9546,  -7314,   -422,
+          7537,  12013,  10665,   4989,   -936,  -3489,  -2008,    866,   1472,  -1865,
+         -7357, -10969,  -9446,  -2829,   5398,  10585,  10223,   5527,    376,  -1688,
+             0,   2835,   3130,   -781,  -7104, -11736, -11141,  -5108,   3027,   8654,
+          9112,   5326,    996,   -397,   1772,   4863,   5185,    943,  -6119, -11765,
+        -12241,  -7045,    702,   6465,   7432,   4391,    857,    218,   3064,   6712,
+          7373,   3069,  -4491, -11032, -12608,  -8423,  -1322,   4242,   5423,   2875,
+             0,     92,   3710,   8153,   9419,   5409,  -2364,  -9608, -12216,  -9087,
+         -2827,   2262,   3359,   1001,  -1464,   -782,   3631,   8972,  11109,   7683,
+            19,  -7653, -11100,  -8984,  -3652,    767,   1460,  -1000,  -3365,  -2281,
+          2800,   9068,  12218,   9634,   2402,  -5377,  -9405,  -8158,  -3724,   -101,
+             0,  -2872,  -5430,  -4264,   1290,   8387,  12603,  11052,   4525,  -3037,
+         -7357,  -6712,  -3072,   -221,   -851,  -4384,  -7437,  -6487,   -737,   7013,
+         12229,  11778,   6149,   -913,  -5168,  -4861,  -1775,    400,   -984,  -5314,
+         -9084,  -8674,  -3063,   5071,  11122,  11742,   7128,    806,  -3115,  -2832,
+             0,   1695,   -359,  -5508, -10217, -10601,  -5434,   2791,   9422,  10968,
+          7373,   1885,  -1460,   -864,   2008,   3474,    959,  -4964, -10652, -12024,
+         -7569,    383,   7287,   9540,   6852,   2240,   -373,    768,   3952,   5561,
+          2827,  -3697, -10327, -12771,  -9285,  -1888,   5008,   7667,   5656,   1837,
+             0,   1829,   5651,   7678,   5036,  -1852,  -9258, -12767, -10347,  -3728,
+          2800,   5549,   3953,    770,   -379,   2227,   6842,   9546,   7314,    422,
+         -7537, -12013, -10665,  -4989,    936,   3489,   2008,   -866,  -1472,   1865,
+          7357,  10969,   9446,   2829,  -5398, -10585, -10223,  -5527,   -376,   1688,
+             0,  -2835,  -3130,    781,   7104,  11736,  11141,   5108,  -3027,  -8654,
+         -9112,  -5326,   -996,    397,  -1772,  -4863,  -5185,   -943,   6119,  11765,
+         12241,   7045,   -702,  -6465,  -7432,  -4391,   -857,   -218,  -3064,  -6712,
+         -7373,  -3069,   4491,  11032,  12608,   8423,   1322,  -4242,  -5423,  -2875,
+             0,    -92,  -3710,  -8153,  -9419,  -5409,   2364,   9608,  12216,   9087,
+          2827,  -2262,  -3359,  -1001,   1464,    782,  -3631,  -8972, -11109,  -7683
+    },
+    {   /* C: 1020Hz + 540Hz */
+             0,   7261,  11249,  10479,   5990,    603,  -2782,  -2916,   -794,   1123,
+           626,  -2721,  -7184,  -9849,  -8467,  -2881,   4667,  10731,  12455,   9317,
+          3233,  -2584,  -5446,  -4735,  -2040,     -7,   -525,  -3503,  -6844,  -7799,
+         -4735,   1619,   8509,  12566,  11717,   6402,   -691,  -6179,  -7879,  -5872,
+         -2346,    -29,   -454,  -2995,  -5312,  -4926,   -890,   5367,  10812,  12455,
+          9112,   2179,  -5080,  -9424,  -9333,  -5761,  -1373,   1125,    667,  -1613,
+         -3221,  -2018,   2274,   7726,  11248,  10446,   5101,  -2601,  -9077, -11521,
+         -9279,  -4131,    855,   3183,   2353,     18,  -1294,    218,   4220,   8419,
+          9899,   7005,    420,  -7019, -11866, -11900,  -7466,  -1107,   3946,   5567,
+          3932,   1162,   -151,   1315,   4716,   7546,   7227,   2880,  -4029, -10321,
+        -12866, -10344,  -4064,   2848,   7208,   7545,   4724,   1324,   -149,   1158,
+          3930,   5575,   3968,  -1077,  -7440, -11891, -11881,  -7052,    382,   6976,
+          9889,   8427,   4236,    232,  -1287,    -18,   2355,   3194,    876,  -4107,
+         -9264, -11526,  -9104,  -2640,   5065,  10426,  11250,   7745,   2298,  -2000,
+         -3214,  -1613,    668,   1134,  -1356,  -5746,  -9330,  -9440,  -5114,   2141,
+          9084,  12448,  10828,   5396,   -861,  -4908,  -5308,  -2998,   -456,    -24,
+         -2336,  -5866,  -7886,  -6203,   -725,   6370,  11701,  12574,   8537,   1654,
+         -4706,  -7786,  -6847,  -3512,   -532,      7,  -2036,  -4735,  -5459,  -2610,
+          3203,   9295,  12454,  10753,   4703,  -2845,  -8444,  -9846,  -7197,  -2738,
+           614,   1120,   -794,  -2920,  -2797,    579,   5968,  10470,  11262,   7293,
+            19,  -7261, -11249, -10479,  -5990,   -603,   2782,   2916,    794,  -1123,
+          -626,   2721,   7184,   9849,   8467,   2881,  -4667, -10731, -12455,  -9317,
+         -3233,   2584,   5446,   4735,   2040,      7,    525,   3503,   6844,   7799,
+          4735,  -1619,  -8509, -12566, -11717,  -6402,    691,   6179,   7879,   5872,
+          2346,     29,    454,   2995,   5312,   4926,    890,  -5367, -10812, -12455,
+         -9112,  -2179,   5080,   9424,   9333,   5761,   1373,  -1125,   -667,   1613,
+          3221,   2018,  -2274,  -7726, -11248, -10446,  -5101,   2601,   9077,  11521,
+          9279,   4131,   -855,  -3183,  -2353,    -18,   1294,   -218,  -4220,  -8419,
+         -9899,  -7005,   -420,   7019,  11866,  11900,   7466,   1107,  -3946,  -5567,
+         -3932,  -1162,    151,  -1315,  -4716,  -7546,  -7227,  -2880,   4029,  10321,
+         12866,  10344,   4064,  -2848,  -7208,  -7545,  -4724,  -1324,    149,  -1158,
+         -3930,  -5575,  -3968,   1077,   7440,  11891,  11881,   7052,   -382,  -6976,
+         -9889,  -8427,  -4236,   -232,   1287,     18,  -2355,  -3194,   -876,   4107,
+          9264,  11526,   9104,   2640,  -5065, -10426, -11250,  -7745,  -2298,   2000,
+          3214,   1613,   -668,  -1134,   1356,   5746,   9330,   9440,   5114,  -2141,
+         -9084, -12448, -10828,  -5396,    861,   4908,   5308,   2998,    456,     24,
+          2336,   5866,   7886,   6203,    725,  -6370, -11701, -12574,  -8537,  -1654,
+          4706,   7786,   6847,   3512,    532,     -7,   2036,   4735,   5459,   2610,
+         -3203,  -9295, -12454, -10753,  -4703,   2845,   8444,   9846,   7197,   2738,
+          -614,  -1120,    794,   2920,   2797,   -579,  -5968, -10470, -11262,  -7293
+    },
+    {   /* D: 900Hz + 540Hz */
+             0,   6815,  11171,  11632,   8384,   3043,  -2105,  -5139,  -5366,  -3526,
+         -1193,    -12,   -773,  -2973,  -5096,  -5443,  -3036,   1768,   7279,  11186,
+         11647,   8085,   1632,  -5432, -10507, -11894,  -9358,  -4295,   1090,   4698,
+          5565,   4037,   1656,    111,    441,   2416,   4731,   5595,   3801,   -566,
+         -6095, -10568, -11889,  -9191,  -3215,   3930,   9670,  11942,  10204,   5530,
+            13,  -4134,  -5608,  -4503,  -2161,   -318,   -200,  -1896,  -4292,  -5593,
+         -4452,   -576,   4875,   9790,  11938,  10138,   4738,  -2391,  -8644, -11785,
+        -10914,  -6718,  -1191,   3415,   5520,   4942,   2705,    606,     51,   1410,
+          3764,   5485,   4961,   1639,  -3636,  -8856, -11785, -10891,  -6155,    788,
+          7445,  11423,  11444,   7844,   2416,  -2561,  -5313,  -5261,  -3244,   -972,
+             0,   -968,  -3239,  -5263,  -5327,  -2593,   2388,   7821,  11438,  11437,
+          7490,    828,  -6120, -10872, -11788,  -8894,  -3665,   1613,   4945,   5480,
+          3788,   1415,     52,    602,   2700,   4905,   5531,   3437,  -1163,  -6693,
+        -10889, -11794,  -8672,  -2430,   4701,  10108,  11936,   9807,   4902,   -549,
+         -4434,  -5586,  -4295,  -1901,   -202,   -308,  -2156,  -4501,  -5616,  -4154,
+           -13,   5503,  10189,  11946,   9695,   3985,  -3177,  -9165, -11882, -10581,
+         -6140,   -594,   3780,   5586,   4732,   2440,    444,    110,   1650,   4034,
+          5557,   4716,   1117,  -4267,  -9339, -11879, -10528,  -5467,   1593,   8055,
+         11635,  11194,   7303,   1797,  -3012,  -5438,  -5095,  -2978,   -778,    -12,
+         -1174,  -3522,  -5370,  -5154,  -2130,   2996,   8363,  11627,  11187,   6848,
+            19,  -6815, -11171, -11632,  -8384,  -3043,   2105,   5139,   5366,   3526,
+          1193,     12,    773,   2973,   5096,   5443,   3036,  -1768,  -7279, -11186,
+        -11647,  -8085,  -1632,   5432,  10507,  11894,   9358,   4295,  -1090,  -4698,
+         -5565,  -4037,  -1656,   -111,   -441,  -2416,  -4731,  -5595,  -3801,    566,
+          6095,  10568,  11889,   9191,   3215,  -3930,  -9670, -11942, -10204,  -5530,
+           -13,   4134,   5608,   4503,   2161,    318,    200,   1896,   4292,   5593,
+          4452,    576,  -4875,  -9790, -11938, -10138,  -4738,   2391,   8644,  11785,
+         10914,   6718,   1191,  -3415,  -5520,  -4942,  -2705,   -606,    -51,  -1410,
+         -3764,  -5485,  -4961,  -1639,   3636,   8856,  11785,  10891,   6155,   -788,
+         -7445, -11423, -11444,  -7844,  -2416,   2561,   5313,   5261,   3244,    972,
+             0,    968,   3239,   5263,   5327,   2593,  -2388,  -7821, -11438, -11437,
+         -7490,   -828,   6120,  10872,  11788,   8894,   3665,  -1613,  -4945,  -5480,
+         -3788,  -1415,    -52,   -602,  -2700,  -4905,  -5531,  -3437,   1163,   6693,
+         10889,  11794,   8672,   2430,  -4701, -10108, -11936,  -9807,  -4902,    549,
+          4434,   5586,   4295,   1901,    202,    308,   2156,   4501,   5616,   4154,
+            13,  -5503, -10189, -11946,  -9695,  -3985,   3177,   9165,  11882,  10581,
+          6140,    594,  -3780,  -5586,  -4732,  -2440,   -444,   -110,  -1650,  -4034,
+         -5557,  -4716,  -1117,   4267,   9339,  11879,  10528,   5467,  -1593,  -8055,
+        -11635, -11194,  -7303,  -1797,   3012,   5438,   5095,   2978,    778,     12,
+          1174,   3522,   5370,   5154,   2130,  -2996,  -8363, -11627, -11187,  -6848
+    },
+    {   /* E: 780Hz + 540Hz */
+             0,   6331,  10870,  12350,  10496,   6000,    349,  -4737,  -7903,  -8498,
+         -6750,  -3603,   -351,   1917,   2646,   1998,    732,   -227,   -153,   1146,
+          3214,   5074,   5682,   4351,   1042,  -3463,  -7820, -10534, -10494,  -7408,
+         -1925,   4429,   9817,  12664,  12083,   8271,   2356,  -3901,  -8726, -10843,
+         -9899,  -6514,  -1931,   2311,   5019,   5673,   4553,   2511,    604,   -315,
+           -13,   1159,   2338,   2590,   1334,  -1357,  -4719,  -7531,  -8606,  -7141,
+         -3233,   2227,   7689,  11442,  12244,   9674,   4381,  -2198,  -8128, -11737,
+        -12089,  -9220,  -4172,   1480,   6059,   8413,   8144,   5787,   2463,   -547,
+         -2336,  -2550,  -1607,   -323,    344,   -153,  -1795,  -3922,  -5455,  -5476,
+         -3444,    378,   5014,   8981,  10855,   9789,   5767,   -170,  -6414, -11116,
+        -12866, -11136,  -6447,   -208,   5735,   9770,  10854,   8996,   5038,    404,
+         -3423,  -5465,  -5454,  -3928,  -1803,   -159,    342,   -322,  -1606,  -2554,
+         -2346,   -562,   2446,   5774,   8141,   8397,   6083,   1513,  -4140,  -9198,
+        -12083, -11751,  -8158,  -2237,   4344,   9649,  12236,  11455,   7715,   2260,
+         -3203,  -7121,  -8600,  -7538,  -4734,  -1375,   1320,   2582,   2336,   1160,
+            13,   -318,    597,   2504,   4549,   5677,   5033,   2335,  -1904,  -6492,
+         -9889, -10850,  -8749,  -3936,   2318,   8242,  12070,  12671,   9842,   4465,
+         -1888,  -7379, -10481, -10539,  -7839,  -3499,   1017,   4333,   5675,   5076,
+          3221,   1154,   -148,   -226,    731,   1999,   2652,   1929,   -335,  -3587,
+         -6740,  -8499,  -7918,  -4765,    316,   5970,  10479,  12350,  10889,   6365,
+            19,  -6331, -10870, -12350, -10496,  -6000,   -349,   4737,   7903,   8498,
+          6750,   3603,    351,  -1917,  -2646,  -1998,   -732,    227,    153,  -1146,
+         -3214,  -5074,  -5682,  -4351,  -1042,   3463,   7820,  10534,  10494,   7408,
+          1925,  -4429,  -9817, -12664, -12083,  -8271,  -2356,   3901,   8726,  10843,
+          9899,   6514,   1931,  -2311,  -5019,  -5673,  -4553,  -2511,   -604,    315,
+            13,  -1159,  -2338,  -2590,  -1334,   1357,   4719,   7531,   8606,   7141,
+          3233,  -2227,  -7689, -11442, -12244,  -9674,  -4381,   2198,   8128,  11737,
+         12089,   9220,   4172,  -1480,  -6059,  -8413,  -8144,  -5787,  -2463,    547,
+          2336,   2550,   1607,    323,   -344,    153,   1795,   3922,   5455,   5476,
+          3444,   -378,  -5014,  -8981, -10855,  -9789,  -5767,    170,   6414,  11116,
+         12866,  11136,   6447,    208,  -5735,  -9770, -10854,  -8996,  -5038,   -404,
+          3423,   5465,   5454,   3928,   1803,    159,   -342,    322,   1606,   2554,
+          2346,    562,  -2446,  -5774,  -8141,  -8397,  -6083,  -1513,   4140,   9198,
+         12083,  11751,   8158,   2237,  -4344,  -9649, -12236, -11455,  -7715,  -2260,
+          3203,   7121,   8600,   7538,   4734,   1375,  -1320,  -2582,  -2336,  -1160,
+           -13,    318,   -597,  -2504,  -4549,  -5677,  -5033,  -2335,   1904,   6492,
+          9889,  10850,   8749,   3936,  -2318,  -8242, -12070, -12671,  -9842,  -4465,
+          1888,   7379,  10481,  10539,   7839,   3499,  -1017,  -4333,  -5675,  -5076,
+         -3221,  -1154,    148,    226,   -731,  -1999,  -2652,  -1929,    335,   3587,
+          6740,   8499,   7918,   4765,   -316,  -5970, -10479, -12350, -10889,  -6365
+    },
+    {   /* F: 660Hz + 540Hz */
+             0,   5814,  10347,  12577,  12030,   8862,   3840,  -1878,  -7006, -10445,
+        -11466,  -9966,  -6402,  -1656,   3130,   6905,   8908,   8848,   6887,   3658,
+            11,  -3206,  -5294,  -5938,  -5200,  -3481,  -1358,    585,   1876,   2319,
+          2024,   1264,    476,     31,    121,    709,   1534,   2192,   2266,   1544,
+             6,  -2061,  -4128,  -5590,  -5902,  -4768,  -2236,   1204,   4818,   7720,
+          9098,   8478,   5841,   1634,  -3260,  -7741, -10713, -11415,  -9571,  -5475,
+           -18,   5614,  10144,  12516,  12145,   9084,   3996,  -2004,  -7538, -11387,
+        -12706, -11228,  -7330,  -1934,   3725,   8405,  11071,  11238,   8977,   4908,
+            15,  -4544,  -7796,  -9119,  -8386,  -5919,  -2450,   1140,   4050,   5677,
+          5837,   4714,   2789,    655,  -1103,  -2112,  -2294,  -1787,   -973,   -269,
+             0,   -267,   -971,  -1786,  -2297,  -2119,  -1113,    643,   2777,   4707,
+          5837,   5686,   4067,   1163,  -2427,  -5901,  -8378,  -9123,  -7813,  -4571,
+           -15,   4878,   8957,  11233,  11082,   8405,   3760,  -1897,  -7300, -11210,
+        -12706, -11405,  -7570,  -2043,   3959,   9056,  12132,  12522,  10166,   5648,
+            18,  -5442,  -9550, -11410, -10724,  -7764,  -3292,   1603,   5816,   8465,
+          9098,   7732,   4838,   1227,  -2215,  -4753,  -5896,  -5593,  -4137,  -2073,
+            -6,   1535,   2261,   2191,   1535,    712,    122,     30,    474,   1262,
+          2024,   2323,   1884,    596,  -1345,  -3481,  -5194,  -5941,  -5306,  -3225,
+           -11,   3636,   6872,   8843,   8917,   6927,   3159,  -1625,  -6375,  -9951,
+        -11466, -10461,  -7036,  -1915,   3804,   8835,  12018,  12583,  10370,   5849,
+             0,  -5814, -10347, -12577, -12030,  -8862,  -3840,   1878,   7006,  10445,
+         11466,   9966,   6402,   1656,  -3130,  -6905,  -8908,  -8848,  -6887,  -3658,
+           -11,   3206,   5294,   5938,   5200,   3481,   1358,   -585,  -1876,  -2319,
+         -2024,  -1264,   -476,    -31,   -121,   -709,  -1534,  -2192,  -2266,  -1544,
+            -6,   2061,   4128,   5590,   5902,   4768,   2236,  -1204,  -4818,  -7720,
+         -9098,  -8478,  -5841,  -1634,   3260,   7741,  10713,  11415,   9571,   5475,
+            18,  -5614, -10144, -12516, -12145,  -9084,  -3996,   2004,   7538,  11387,
+         12706,  11228,   7330,   1934,  -3725,  -8405, -11071, -11238,  -8977,  -4908,
+           -15,   4544,   7796,   9119,   8386,   5919,   2450,  -1140,  -4050,  -5677,
+         -5837,  -4714,  -2789,   -655,   1103,   2112,   2294,   1787,    973,    269,
+             0,    267,    971,   1786,   2297,   2119,   1113,   -643,  -2777,  -4707,
+         -5837,  -5686,  -4067,  -1163,   2427,   5901,   8378,   9123,   7813,   4571,
+            15,  -4878,  -8957, -11233, -11082,  -8405,  -3760,   1897,   7300,  11210,
+         12706,  11405,   7570,   2043,  -3959,  -9056, -12132, -12522, -10166,  -5648,
+           -18,   5442,   9550,  11410,  10724,   7764,   3292,  -1603,  -5816,  -8465,
+         -9098,  -7732,  -4838,  -1227,   2215,   4753,   5896,   5593,   4137,   2073,
+             6,  -1535,  -2261,  -2191,  -1535,   -712,   -122,    -30,   -474,  -1262,
+         -2024,  -2323,  -1884,   -596,   1345,   3481,   5194,   5941,   5306,   3225,
+            11,  -3636,  -6872,  -8843,  -8917,  -6927,  -3159,   1625,   6375,   9951,
+         11466,  10461,   7036,   1915,  -3804,  -8835, -12018, -12583, -10370,  -5849
+    }
+};
+
+static const uint8_t r2_mf_fwd_digit_alaw_waves[15][R2_MF_TX_PERIOD] =
+{
+    {   /* 1 */
+        0xD5, 0xB3, 0xB6, 0x1D, 0x3D, 0x09, 0x82, 0xB2, 0x84, 0x0A, 0x30, 0x60, 0xB4, 0xB4, 0x66, 0x37,
+        0x0C, 0x9C, 0xB5, 0x9B, 0x04, 0x0E, 0x6C, 0x87, 0x86, 0xD5, 0x1B, 0x13, 0xFD, 0x91, 0xE7, 0x71,
+        0x7D, 0x51, 0x44, 0x7B, 0x59, 0xE8, 0x97, 0x4F, 0x18, 0x1D, 0xE8, 0x83, 0x92, 0x1B, 0x0E, 0x6B,
+        0x8D, 0x8B, 0xD5, 0x35, 0x08, 0x96, 0xB1, 0x8C, 0x00, 0x33, 0x05, 0xB5, 0xB3, 0xED, 0x31, 0x31,
+        0xED, 0xB2, 0xB4, 0x07, 0x3C, 0x0D, 0x88, 0xBD, 0x9D, 0x37, 0x30, 0x54, 0xB1, 0xB4, 0x10, 0x31,
+        0x02, 0x87, 0xB7, 0x9F, 0x02, 0x0A, 0x7B, 0x8D, 0x83, 0x7D, 0x00, 0x19, 0xEE, 0x85, 0xEF, 0x6E,
+        0x17, 0x49, 0xF9, 0xF5, 0xD5, 0xF4, 0xF8, 0x49, 0x17, 0x6E, 0xEE, 0x85, 0xEE, 0x19, 0x00, 0x7D,
+        0x83, 0x8D, 0x7B, 0x0A, 0x02, 0x9F, 0xB7, 0x87, 0x02, 0x31, 0x10, 0xB4, 0xB1, 0xD4, 0x30, 0x37,
+        0x9D, 0xBD, 0x88, 0x0D, 0x3C, 0x07, 0xB4, 0xB2, 0xEC, 0x31, 0x31, 0xED, 0xB3, 0xB5, 0x05, 0x33,
+        0x00, 0x8C, 0xB1, 0x91, 0x08, 0x35, 0x55, 0x8B, 0x8D, 0x68, 0x0E, 0x1B, 0x92, 0x83, 0xE8, 0x1D,
+        0x18, 0x4F, 0x97, 0xE8, 0x59, 0x78, 0x45, 0x51, 0x7C, 0x70, 0xE7, 0x91, 0xFD, 0x13, 0x1B, 0x55,
+        0x86, 0x87, 0x6C, 0x0E, 0x04, 0x9B, 0xB5, 0x9C, 0x0C, 0x37, 0x66, 0xB4, 0xB4, 0x60, 0x30, 0x0A,
+        0x84, 0xB2, 0x82, 0x09, 0x3D, 0x1D, 0xB6, 0xB3, 0xD4, 0x33, 0x36, 0x9D, 0xBD, 0x89, 0x02, 0x32,
+        0x04, 0x8A, 0xB0, 0xE0, 0x34, 0x34, 0xE6, 0xB7, 0x8C, 0x1C, 0x35, 0x1B, 0x84, 0x8E, 0xEC, 0x07,
+        0x06, 0x55, 0x9B, 0x93, 0x7D, 0x16, 0x67, 0xF0, 0xFD, 0xD1, 0xC4, 0xFB, 0xD9, 0x68, 0x17, 0xCF,
+        0x98, 0x9D, 0x68, 0x03, 0x12, 0x9B, 0x8E, 0xEB, 0x0D, 0x0B, 0x55, 0xB5, 0x88, 0x16, 0x31, 0x0C,
+        0x80, 0xB3, 0x85, 0x35, 0x33, 0x6D, 0xB1, 0xB1, 0x6D, 0x32, 0x34, 0x87, 0xBC, 0x8D, 0x08, 0x3D,
+        0x1D, 0xB7, 0xB0, 0xD4, 0x31, 0x34, 0x90, 0xB1, 0x82, 0x07, 0x37, 0x1F, 0x82, 0x8A, 0xFB, 0x0D,
+        0x03, 0xFD, 0x80, 0x99, 0x6E, 0x05, 0x6F, 0xEE, 0x97, 0xC9, 0x79, 0x75, 0xD5, 0x74, 0x78, 0xC9,
+        0x97, 0xEE, 0x6E, 0x05, 0x6E, 0x99, 0x80, 0xFD, 0x03, 0x0D, 0xFB, 0x8A, 0x82, 0x1F, 0x37, 0x07,
+        0x82, 0xB1, 0x90, 0x34, 0x31, 0x54, 0xB0, 0xB7, 0x1D, 0x3D, 0x08, 0x8D, 0xBC, 0x87, 0x34, 0x32,
+        0x6C, 0xB1, 0xB1, 0x6D, 0x33, 0x35, 0x85, 0xB3, 0x80, 0x0C, 0x31, 0x16, 0x88, 0xB5, 0xD5, 0x0B,
+        0x0D, 0xE8, 0x8E, 0x9B, 0x12, 0x00, 0x68, 0x9D, 0x98, 0xCF, 0x17, 0x68, 0xD9, 0xF8, 0xC5, 0xD1,
+        0xFC, 0xF0, 0x67, 0x11, 0x7D, 0x93, 0x9B, 0xD5, 0x06, 0x07, 0xEC, 0x8E, 0x84, 0x1B, 0x35, 0x1C,
+        0x8C, 0xB7, 0xE6, 0x34, 0x34, 0xE0, 0xB0, 0x8A, 0x04, 0x32, 0x02, 0x89, 0xBD, 0x9D, 0x36, 0x33
+    },
+    {   /* 2 */
+        0xD5, 0xB2, 0xB4, 0x07, 0x32, 0x04, 0x88, 0xB7, 0xD5, 0x0B, 0x01, 0x96, 0x80, 0xEF, 0x14, 0x68,
+        0x55, 0x42, 0x64, 0xE5, 0x9A, 0xEB, 0x04, 0x0F, 0x55, 0xB5, 0x8E, 0x1A, 0x33, 0x04, 0xB5, 0xB3,
+        0xD4, 0x32, 0x34, 0x87, 0xBD, 0x87, 0x35, 0x36, 0x55, 0xB4, 0x8D, 0x12, 0x0F, 0x14, 0x9F, 0x9F,
+        0xD5, 0x64, 0xD5, 0x49, 0x17, 0x60, 0x9F, 0x80, 0xD5, 0x09, 0x0D, 0x99, 0xB1, 0x85, 0x35, 0x30,
+        0x54, 0xB3, 0xB4, 0x06, 0x3D, 0x07, 0xB5, 0xB0, 0xD4, 0x36, 0x0E, 0x9E, 0xB5, 0x90, 0x04, 0x07,
+        0x55, 0x91, 0xE4, 0x5C, 0xFC, 0xFD, 0x14, 0x1A, 0x55, 0x82, 0x81, 0x1C, 0x37, 0x1B, 0x88, 0xB1,
+        0xD4, 0x33, 0x34, 0x86, 0xBC, 0x86, 0x34, 0x33, 0x54, 0xB1, 0x8B, 0x1B, 0x37, 0x1C, 0x81, 0x82,
+        0xD5, 0x1A, 0x14, 0xFD, 0xFC, 0x5C, 0xE4, 0x91, 0xD5, 0x07, 0x04, 0x90, 0xB5, 0x9E, 0x0E, 0x36,
+        0x54, 0xB0, 0xB5, 0x07, 0x3D, 0x06, 0xB4, 0xB3, 0xD4, 0x30, 0x35, 0x85, 0xB1, 0x99, 0x0D, 0x09,
+        0x55, 0x80, 0x9F, 0x60, 0x17, 0x49, 0x55, 0x64, 0x55, 0x9C, 0x9F, 0x14, 0x0F, 0x12, 0x8D, 0xB4,
+        0xD5, 0x36, 0x35, 0x87, 0xBD, 0x86, 0x34, 0x32, 0x54, 0xB3, 0xB5, 0x04, 0x33, 0x1A, 0x8E, 0xB5,
+        0xD5, 0x0F, 0x04, 0xEB, 0x9A, 0xE5, 0x64, 0x42, 0xD5, 0x68, 0x14, 0xEC, 0x80, 0x96, 0x01, 0x0B,
+        0x55, 0xB7, 0x8B, 0x04, 0x32, 0x07, 0xB4, 0xB2, 0xD4, 0x32, 0x34, 0x87, 0xB2, 0x84, 0x08, 0x37,
+        0x55, 0x8B, 0x81, 0x16, 0x00, 0x6F, 0x94, 0xE8, 0xD5, 0xC2, 0xE4, 0x65, 0x1A, 0x6B, 0x84, 0x8F,
+        0xD5, 0x35, 0x0E, 0x9A, 0xB3, 0x84, 0x35, 0x33, 0x54, 0xB2, 0xB4, 0x07, 0x3D, 0x07, 0xB5, 0xB6,
+        0xD5, 0x34, 0x0D, 0x92, 0x8F, 0x94, 0x1F, 0x1F, 0x55, 0xE4, 0x55, 0xC9, 0x97, 0xE0, 0x1F, 0x00,
+        0x55, 0x89, 0x8D, 0x19, 0x31, 0x05, 0xB5, 0xB0, 0xD4, 0x33, 0x34, 0x86, 0xBD, 0x87, 0x35, 0x30,
+        0x54, 0xB6, 0x8E, 0x1E, 0x35, 0x10, 0x84, 0x87, 0xD5, 0x11, 0x64, 0xDC, 0x7C, 0x7D, 0x94, 0x9A,
+        0xD5, 0x02, 0x01, 0x9C, 0xB7, 0x9B, 0x08, 0x31, 0x54, 0xB3, 0xB4, 0x06, 0x3C, 0x06, 0xB4, 0xB3,
+        0xD4, 0x31, 0x0B, 0x9B, 0xB7, 0x9C, 0x01, 0x02, 0x55, 0x9A, 0x94, 0x7D, 0x7C, 0xDC, 0x64, 0x11,
+        0x55, 0x87, 0x84, 0x10, 0x35, 0x1E, 0x8E, 0xB6, 0xD4, 0x30, 0x35, 0x87, 0xBD, 0x86, 0x34, 0x33,
+        0x54, 0xB0, 0xB5, 0x05, 0x31, 0x19, 0x8D, 0x89, 0xD5, 0x00, 0x1F, 0xE0, 0x97, 0xC9, 0xD5, 0xE4,
+        0xD5, 0x1C, 0x1F, 0x94, 0x8F, 0x92, 0x0D, 0x34, 0x55, 0xB6, 0xB5, 0x07, 0x3D, 0x06, 0xB4, 0xB2,
+        0xD4, 0x33, 0x35, 0x84, 0xB3, 0x9A, 0x0E, 0x35, 0x55, 0x8F, 0x84, 0x6B, 0x1A, 0x65, 0xE4, 0xC2,
+        0x55, 0xE8, 0x94, 0x6C, 0x00, 0x16, 0x81, 0x8B, 0xD5, 0x37, 0x0B, 0x84, 0xB2, 0x87, 0x34, 0x32
+    },
+    {   /* 3 */
+        0xD5, 0xB2, 0x8A, 0x0C, 0x3D, 0x6B, 0xB0, 0xB4, 0x04, 0x33, 0x1E, 0xB4, 0xB4, 0x14, 0x36, 0x04,
+        0x8C, 0xB5, 0x75, 0x0B, 0x04, 0x9A, 0x8D, 0xF4, 0x06, 0x1E, 0xE8, 0x98, 0xFD, 0x15, 0x6C, 0xCD,
+        0xFC, 0xD0, 0xC4, 0xF9, 0x59, 0x15, 0x62, 0x95, 0x98, 0xDC, 0x07, 0x18, 0x92, 0x8C, 0xE0, 0x0C,
+        0x0D, 0x93, 0xB4, 0x9C, 0x08, 0x34, 0xEB, 0xB0, 0x80, 0x08, 0x30, 0xC2, 0xB3, 0x88, 0x0F, 0x3D,
+        0x6C, 0xB3, 0xB7, 0x06, 0x3C, 0x1E, 0xB1, 0xB1, 0x1D, 0x32, 0x01, 0xB5, 0xB1, 0x65, 0x31, 0x02,
+        0x82, 0xB7, 0xF7, 0x35, 0x02, 0x98, 0x8B, 0xEC, 0x03, 0x06, 0xE9, 0x81, 0xEE, 0x1D, 0x1D, 0xC8,
+        0x97, 0xF8, 0x7D, 0x74, 0xD5, 0x74, 0x72, 0xF9, 0x97, 0xC8, 0x1D, 0x1D, 0xEE, 0x81, 0xE9, 0x06,
+        0x03, 0xEC, 0x8B, 0x98, 0x02, 0x35, 0xF7, 0xB7, 0x82, 0x02, 0x31, 0x65, 0xB1, 0xB5, 0x01, 0x32,
+        0x1D, 0xB1, 0xB1, 0x1E, 0x3C, 0x01, 0xB7, 0xB3, 0x6D, 0x3D, 0x0F, 0x88, 0xB3, 0xCD, 0x30, 0x08,
+        0x80, 0xB0, 0xEA, 0x34, 0x08, 0x9C, 0xB4, 0x92, 0x0D, 0x0C, 0xE0, 0x8C, 0x92, 0x18, 0x07, 0xDD,
+        0x98, 0x95, 0x62, 0x15, 0x59, 0xF9, 0xC7, 0xD1, 0xFD, 0xCD, 0x6C, 0x15, 0xFD, 0x98, 0xE9, 0x1E,
+        0x06, 0xF4, 0x8D, 0x9A, 0x04, 0x0B, 0x75, 0xB5, 0x8C, 0x04, 0x36, 0x14, 0xB4, 0xB4, 0x1E, 0x33,
+        0x04, 0xB4, 0xB0, 0x6B, 0x3D, 0x0C, 0x8A, 0xB2, 0xD5, 0x32, 0x0A, 0x8C, 0xBD, 0xEB, 0x30, 0x34,
+        0x84, 0xB3, 0x9E, 0x34, 0x34, 0x94, 0xB6, 0x84, 0x0C, 0x35, 0xF5, 0x8B, 0x84, 0x1A, 0x0D, 0x74,
+        0x86, 0x9E, 0x68, 0x18, 0x7D, 0x95, 0xEC, 0x4D, 0x7C, 0x50, 0x44, 0x7E, 0xD9, 0x95, 0xE2, 0x15,
+        0x18, 0x5C, 0x87, 0x98, 0x12, 0x0C, 0x60, 0x8C, 0x8D, 0x13, 0x34, 0x1C, 0x88, 0xB4, 0x6B, 0x30,
+        0x00, 0x88, 0xB0, 0x42, 0x33, 0x08, 0x8F, 0xBD, 0xEC, 0x33, 0x37, 0x86, 0xBC, 0x9E, 0x31, 0x31,
+        0x9D, 0xB2, 0x81, 0x35, 0x31, 0xE5, 0xB1, 0x82, 0x02, 0x37, 0x77, 0xB5, 0x82, 0x18, 0x0B, 0x6C,
+        0x83, 0x86, 0x69, 0x01, 0x6E, 0x9D, 0x9D, 0x48, 0x17, 0x78, 0xFD, 0xF4, 0xD5, 0xF4, 0xF2, 0x79,
+        0x17, 0x48, 0x9D, 0x9D, 0x6E, 0x01, 0x69, 0x86, 0x83, 0x6C, 0x0B, 0x18, 0x82, 0xB5, 0x77, 0x37,
+        0x02, 0x82, 0xB1, 0xE5, 0x31, 0x35, 0x81, 0xB2, 0x9D, 0x31, 0x31, 0x9E, 0xBC, 0x81, 0x37, 0x33,
+        0xED, 0xBD, 0x8F, 0x08, 0x33, 0x4D, 0xB0, 0x88, 0x00, 0x30, 0x6A, 0xB4, 0x88, 0x1C, 0x34, 0x12,
+        0x8D, 0x8C, 0x60, 0x0C, 0x12, 0x98, 0x87, 0x5D, 0x18, 0x15, 0xE2, 0x95, 0xD9, 0x79, 0x47, 0x51,
+        0x7D, 0x4D, 0xEC, 0x95, 0x7D, 0x18, 0x69, 0x9E, 0x86, 0x74, 0x0D, 0x1A, 0x84, 0x8B, 0xF5, 0x35,
+        0x0C, 0x84, 0xB6, 0x97, 0x34, 0x34, 0x9E, 0xB3, 0x84, 0x34, 0x30, 0xEB, 0xBD, 0x8C, 0x0A, 0x32
+    },
+    {   /* 4 */
+        0xD5, 0xB2, 0x8B, 0x02, 0x31, 0x6D, 0x88, 0x81, 0x6A, 0x18, 0x76, 0xDF, 0x60, 0xF3, 0x86, 0x92,
+        0x00, 0x34, 0xF1, 0xB0, 0x89, 0x0E, 0x3D, 0x67, 0xB3, 0xB5, 0x07, 0x36, 0x14, 0x82, 0x87, 0x67,
+        0x17, 0x5A, 0x7E, 0x11, 0xF7, 0x8D, 0x85, 0x03, 0x36, 0x43, 0xB0, 0xB5, 0x0D, 0x3D, 0x17, 0xB1,
+        0xB5, 0x1E, 0x34, 0x11, 0x87, 0x9B, 0x75, 0x7A, 0xCD, 0x6E, 0x1A, 0xDF, 0x89, 0x80, 0x00, 0x30,
+        0x62, 0xB0, 0xB7, 0x06, 0x3D, 0x1F, 0xB7, 0xB4, 0x17, 0x0A, 0x10, 0x9E, 0x93, 0x5D, 0xCC, 0xE6,
+        0x17, 0x00, 0x48, 0x8A, 0x8F, 0x06, 0x33, 0x10, 0xB0, 0xB6, 0x1B, 0x32, 0x05, 0x8A, 0xB5, 0x61,
+        0x0F, 0x10, 0x94, 0xEF, 0xD5, 0xEF, 0x94, 0x10, 0x0F, 0x61, 0xB5, 0x8A, 0x05, 0x3D, 0x1B, 0xB6,
+        0xB0, 0x11, 0x33, 0x06, 0x8F, 0x8A, 0x4E, 0x00, 0x17, 0xE6, 0xCC, 0x5D, 0x93, 0x9E, 0x10, 0x0A,
+        0x17, 0xB5, 0xB7, 0x1F, 0x3D, 0x06, 0xB7, 0xB0, 0x62, 0x30, 0x00, 0x80, 0x89, 0xD9, 0x1A, 0x6E,
+        0xCD, 0x7A, 0x75, 0x9B, 0x87, 0x11, 0x34, 0x1E, 0xB5, 0xB1, 0x17, 0x3D, 0x0D, 0xB5, 0xB0, 0x41,
+        0x36, 0x03, 0x85, 0x8D, 0xF7, 0x11, 0x7E, 0x5A, 0x17, 0x67, 0x87, 0x82, 0x14, 0x36, 0x07, 0xB5,
+        0xB3, 0x67, 0x3D, 0x0E, 0x89, 0xB0, 0xF0, 0x34, 0x00, 0x92, 0x86, 0xF2, 0x60, 0xDF, 0x76, 0x18,
+        0x6A, 0x81, 0x88, 0x62, 0x31, 0x02, 0x8B, 0xB2, 0xD4, 0x32, 0x0B, 0x82, 0xB1, 0xED, 0x08, 0x01,
+        0xEA, 0x98, 0xF6, 0x5F, 0xE0, 0x73, 0x06, 0x12, 0x80, 0xB4, 0x71, 0x30, 0x09, 0x8E, 0xBD, 0xE7,
+        0x33, 0x35, 0x87, 0xB6, 0x94, 0x02, 0x07, 0xE7, 0x97, 0xDA, 0xFE, 0x91, 0x77, 0x0D, 0x05, 0x83,
+        0xB6, 0xC3, 0x30, 0x35, 0x8D, 0xBD, 0x97, 0x31, 0x35, 0x9E, 0xB4, 0x91, 0x07, 0x1B, 0xF5, 0xFA,
+        0x4D, 0xEE, 0x9A, 0x5F, 0x09, 0x00, 0x80, 0xB0, 0xE2, 0x30, 0x37, 0x86, 0xBD, 0x9F, 0x37, 0x34,
+        0x97, 0x8A, 0x90, 0x1E, 0x13, 0xDD, 0x4C, 0x66, 0x97, 0x80, 0xC8, 0x0A, 0x0F, 0x86, 0xB3, 0x90,
+        0x30, 0x36, 0x9B, 0xBD, 0x85, 0x0A, 0x35, 0xE1, 0x8F, 0x90, 0x14, 0x6F, 0xD5, 0x6F, 0x14, 0x90,
+        0x8F, 0xE1, 0x35, 0x0A, 0x85, 0xBD, 0x9B, 0x36, 0x30, 0x91, 0xB3, 0x86, 0x0F, 0x0A, 0xCE, 0x80,
+        0x97, 0x66, 0x4C, 0xDD, 0x13, 0x1E, 0x90, 0x8A, 0x97, 0x35, 0x37, 0x9F, 0xBD, 0x86, 0x37, 0x30,
+        0xE2, 0xB0, 0x80, 0x00, 0x09, 0x59, 0x9A, 0xEE, 0x4D, 0xFA, 0xF5, 0x1B, 0x07, 0x91, 0xB4, 0x9E,
+        0x35, 0x31, 0x97, 0xBD, 0x8D, 0x35, 0x30, 0xC1, 0xB6, 0x83, 0x05, 0x0D, 0x77, 0x91, 0xFE, 0xDA,
+        0x97, 0xE7, 0x07, 0x02, 0x94, 0xB6, 0x87, 0x35, 0x33, 0xE7, 0xBD, 0x8E, 0x09, 0x30, 0x70, 0xB4,
+        0x83, 0x12, 0x06, 0x72, 0xE0, 0x5F, 0xF6, 0x98, 0xEA, 0x01, 0x08, 0xE2, 0xB1, 0x82, 0x0B, 0x32
+    },
+    {   /* 5 */
+        0xD5, 0xB2, 0x8E, 0x0B, 0x30, 0xF9, 0xB1, 0x86, 0x0C, 0x08, 0xE7, 0x8C, 0x97, 0x1C, 0x10, 0xC8,
+        0xFC, 0x5D, 0xE6, 0x94, 0x66, 0x06, 0x6E, 0x82, 0x8D, 0x1E, 0x36, 0x15, 0xB6, 0xB5, 0x00, 0x3D,
+        0x6C, 0xB3, 0xB5, 0x0C, 0x32, 0x74, 0xB0, 0x8C, 0x02, 0x34, 0xC5, 0x88, 0x99, 0x18, 0x05, 0xCD,
+        0x97, 0xF4, 0xD5, 0xE5, 0x4E, 0x1E, 0x68, 0x84, 0x83, 0x15, 0x34, 0x1D, 0xB5, 0xB4, 0x1B, 0x32,
+        0x1D, 0xB0, 0xB7, 0x01, 0x3D, 0x15, 0xB0, 0xB5, 0x00, 0x31, 0x78, 0xB5, 0x81, 0x1A, 0x02, 0x50,
+        0x98, 0xEC, 0x7B, 0x4D, 0x57, 0x6B, 0x6C, 0x93, 0x86, 0x79, 0x08, 0x18, 0x8F, 0xB4, 0x17, 0x33,
+        0x04, 0xB7, 0xB1, 0x18, 0x3C, 0x18, 0xB1, 0xB7, 0x04, 0x33, 0x17, 0xB4, 0x8F, 0x18, 0x08, 0x78,
+        0x86, 0x92, 0x6C, 0x6B, 0x56, 0x42, 0x7B, 0xEC, 0x98, 0x51, 0x02, 0x1A, 0x81, 0xB5, 0x79, 0x31,
+        0x00, 0xB5, 0xB0, 0x15, 0x3D, 0x01, 0xB7, 0xB0, 0x1D, 0x32, 0x1B, 0xB4, 0xB5, 0x1D, 0x34, 0x15,
+        0x83, 0x84, 0x68, 0x1E, 0x49, 0xE5, 0xD5, 0xF4, 0x97, 0xCD, 0x05, 0x18, 0x99, 0x88, 0xC4, 0x34,
+        0x02, 0x8C, 0xB0, 0x74, 0x32, 0x0C, 0xB5, 0xB3, 0x6D, 0x3D, 0x00, 0xB5, 0xB6, 0x15, 0x36, 0x1E,
+        0x8D, 0x82, 0x6F, 0x01, 0x66, 0x97, 0xE6, 0x5C, 0xFD, 0xC8, 0x10, 0x1C, 0x97, 0x8C, 0xE7, 0x08,
+        0x0C, 0x86, 0xB1, 0xF9, 0x30, 0x0B, 0x8E, 0xB2, 0xD5, 0x32, 0x0E, 0x8B, 0xB0, 0x7E, 0x31, 0x06,
+        0x8C, 0x88, 0x67, 0x0C, 0x17, 0x9C, 0x90, 0x48, 0x7C, 0xDD, 0x66, 0x14, 0xE6, 0x86, 0xEE, 0x02,
+        0x0D, 0x9E, 0xB6, 0x95, 0x36, 0x35, 0x80, 0xBD, 0xEC, 0x33, 0x35, 0x8C, 0xB2, 0xF4, 0x30, 0x0C,
+        0x82, 0xB4, 0x45, 0x08, 0x19, 0x98, 0x85, 0x4D, 0x17, 0x74, 0xD5, 0x65, 0xCE, 0x9E, 0xE8, 0x04,
+        0x03, 0x95, 0xB4, 0x9D, 0x35, 0x34, 0x9B, 0xB2, 0x9D, 0x30, 0x37, 0x81, 0xBD, 0x95, 0x30, 0x35,
+        0x80, 0xB1, 0xF8, 0x35, 0x01, 0x9A, 0x82, 0xD0, 0x18, 0x6C, 0xFB, 0xCD, 0xD6, 0xEB, 0xEC, 0x13,
+        0x06, 0xF9, 0x88, 0x98, 0x0F, 0x34, 0x97, 0xB3, 0x84, 0x37, 0x31, 0x98, 0xBC, 0x98, 0x31, 0x37,
+        0x84, 0xB3, 0x97, 0x34, 0x0F, 0x98, 0x88, 0xF8, 0x06, 0x12, 0xEC, 0xEB, 0xD6, 0xC2, 0xFB, 0x6C,
+        0x18, 0xD1, 0x82, 0x9A, 0x01, 0x35, 0xF9, 0xB1, 0x80, 0x35, 0x30, 0x95, 0xBD, 0x81, 0x37, 0x30,
+        0x9D, 0xB2, 0x9B, 0x34, 0x35, 0x9D, 0xB4, 0x95, 0x03, 0x04, 0xE8, 0x9E, 0xC9, 0x65, 0xD5, 0x74,
+        0x17, 0x4D, 0x85, 0x98, 0x19, 0x08, 0x44, 0xB4, 0x82, 0x0C, 0x30, 0xF4, 0xB2, 0x8C, 0x35, 0x33,
+        0xED, 0xBD, 0x80, 0x35, 0x36, 0x95, 0xB6, 0x9E, 0x0D, 0x02, 0xEF, 0x81, 0xE6, 0x14, 0x66, 0xDC,
+        0x7D, 0x48, 0x90, 0x9C, 0x17, 0x0C, 0x67, 0x88, 0x8C, 0x06, 0x31, 0x79, 0xB0, 0x8B, 0x0E, 0x32
+    },
+    {   /* 6 */
+        0xD5, 0xBD, 0x8D, 0x37, 0x31, 0x9B, 0xBD, 0x94, 0x30, 0x08, 0x8F, 0xB1, 0x60, 0x31, 0x18, 0x8B,
+        0x89, 0x18, 0x35, 0x75, 0x89, 0x98, 0x04, 0x01, 0xE0, 0x86, 0xE4, 0x1C, 0x14, 0xE0, 0xE8, 0x50,
+        0x7D, 0x50, 0x47, 0x7C, 0xF7, 0x94, 0xC3, 0x1D, 0x17, 0x93, 0x87, 0x65, 0x0D, 0x15, 0x82, 0x83,
+        0x1B, 0x35, 0xD5, 0xB7, 0x87, 0x08, 0x34, 0x9F, 0xB0, 0x95, 0x31, 0x0B, 0x89, 0xB3, 0x6D, 0x3D,
+        0x07, 0xB1, 0xB6, 0x00, 0x3D, 0x7C, 0xB2, 0x8F, 0x35, 0x30, 0x92, 0xB2, 0x93, 0x36, 0x08, 0x83,
+        0xB6, 0x76, 0x37, 0x1B, 0x8F, 0x8F, 0x13, 0x09, 0x7E, 0x82, 0x9F, 0x1F, 0x05, 0xFD, 0x9E, 0xF8,
+        0x6A, 0x61, 0xF7, 0xF7, 0xD5, 0xF7, 0xF7, 0x61, 0x6A, 0xF9, 0x9E, 0xFD, 0x05, 0x1F, 0x9F, 0x82,
+        0x7F, 0x09, 0x13, 0x8F, 0x8F, 0x1B, 0x37, 0x71, 0xB6, 0x83, 0x08, 0x36, 0x93, 0xB2, 0x92, 0x30,
+        0x35, 0x8F, 0xB2, 0x7D, 0x3D, 0x00, 0xB6, 0xB1, 0x07, 0x3D, 0x6D, 0xB3, 0x89, 0x08, 0x31, 0x95,
+        0xB0, 0x9F, 0x34, 0x08, 0x87, 0xB7, 0xD5, 0x35, 0x1B, 0x80, 0x82, 0x15, 0x0D, 0x65, 0x87, 0x93,
+        0x17, 0x1D, 0xC0, 0x94, 0xF7, 0x7C, 0x47, 0x50, 0x7D, 0x50, 0xE8, 0xE0, 0x14, 0x1C, 0xE5, 0x86,
+        0xE0, 0x01, 0x04, 0x98, 0x89, 0x4B, 0x35, 0x18, 0x89, 0x8B, 0x18, 0x31, 0x60, 0xB1, 0x8F, 0x08,
+        0x30, 0x94, 0xBD, 0x9B, 0x31, 0x37, 0x8D, 0xBD, 0xD5, 0x3D, 0x0D, 0xB7, 0xB1, 0x1B, 0x3D, 0x14,
+        0xB0, 0x88, 0x0F, 0x31, 0xE0, 0xB1, 0x98, 0x0B, 0x09, 0x98, 0xB5, 0xF5, 0x09, 0x18, 0x84, 0x81,
+        0x60, 0x06, 0x64, 0x9C, 0x94, 0x60, 0x68, 0xD0, 0xFD, 0xD0, 0xC7, 0xFC, 0x77, 0x14, 0x43, 0x9D,
+        0x97, 0x13, 0x07, 0xE5, 0x8D, 0x95, 0x02, 0x03, 0x9B, 0xB5, 0xD5, 0x34, 0x07, 0x88, 0xB4, 0x1F,
+        0x30, 0x15, 0xB1, 0x8B, 0x09, 0x33, 0xED, 0xBD, 0x87, 0x31, 0x36, 0x80, 0xBD, 0xFC, 0x32, 0x0F,
+        0xB5, 0xB0, 0x12, 0x32, 0x13, 0xB6, 0x88, 0x03, 0x36, 0xF6, 0xB7, 0x9B, 0x0F, 0x0F, 0x93, 0x89,
+        0xFE, 0x02, 0x1F, 0x9F, 0x85, 0x7D, 0x1E, 0x78, 0xEA, 0xE1, 0x77, 0x77, 0xD5, 0x77, 0x77, 0xE1,
+        0xEA, 0x79, 0x1E, 0x7D, 0x85, 0x9F, 0x1F, 0x02, 0xFF, 0x89, 0x93, 0x0F, 0x0F, 0x9B, 0xB7, 0xF1,
+        0x36, 0x03, 0x88, 0xB6, 0x13, 0x32, 0x12, 0xB0, 0xB5, 0x0F, 0x32, 0xFD, 0xBD, 0x80, 0x36, 0x31,
+        0x87, 0xBD, 0xED, 0x33, 0x09, 0x88, 0xB1, 0x15, 0x30, 0x1F, 0xB4, 0x88, 0x07, 0x37, 0xD5, 0xB5,
+        0x9A, 0x00, 0x02, 0x95, 0x8D, 0xE5, 0x07, 0x13, 0x97, 0x9D, 0x40, 0x14, 0x77, 0xFC, 0xC6, 0xD0,
+        0xFD, 0xD0, 0x68, 0x60, 0x94, 0x9C, 0x65, 0x06, 0x60, 0x81, 0x84, 0x18, 0x09, 0xCB, 0xB5, 0x98,
+        0x09, 0x0B, 0x98, 0xB1, 0xE0, 0x31, 0x0F, 0x88, 0xB0, 0x14, 0x3D, 0x1B, 0xB1, 0xB7, 0x0D, 0x3D
+    },
+    {   /* 7 */
+        0xD5, 0xB2, 0x8F, 0x0F, 0x34, 0xF7, 0x81, 0xED, 0x74, 0xE3, 0x76, 0x02, 0x1E, 0x89, 0xB7, 0x13,
+        0x3D, 0x04, 0xB6, 0xB7, 0x1C, 0x34, 0x6B, 0x9B, 0xE8, 0xD5, 0x97, 0xFB, 0x02, 0x0D, 0x87, 0xB3,
+        0xED, 0x33, 0x35, 0x8D, 0xB0, 0xCB, 0x0B, 0x18, 0x97, 0xE2, 0xD4, 0x92, 0x93, 0x06, 0x35, 0xE7,
+        0xB3, 0x82, 0x34, 0x30, 0x94, 0xB0, 0x98, 0x03, 0x07, 0xFF, 0xFC, 0x75, 0x9C, 0x86, 0x10, 0x36,
+        0x13, 0xB1, 0xB7, 0x01, 0x3D, 0x6A, 0xB7, 0x82, 0x1C, 0x07, 0x5B, 0x54, 0x6D, 0x91, 0x8C, 0xDC,
+        0x36, 0x0F, 0x88, 0xB2, 0x7D, 0x32, 0x03, 0x8F, 0x89, 0x7F, 0x1B, 0x73, 0x77, 0x10, 0xE7, 0x88,
+        0x9E, 0x35, 0x36, 0x99, 0xBC, 0x98, 0x36, 0x35, 0x9F, 0x88, 0xE7, 0x10, 0x77, 0x73, 0x1B, 0x7E,
+        0x89, 0x8F, 0x03, 0x32, 0x7C, 0xB2, 0x88, 0x0F, 0x36, 0xD2, 0x8C, 0x91, 0x62, 0xD4, 0x5B, 0x07,
+        0x1F, 0x82, 0xB7, 0x6B, 0x3D, 0x01, 0xB7, 0xB1, 0x10, 0x36, 0x10, 0x86, 0x9C, 0x75, 0xFC, 0xFF,
+        0x07, 0x03, 0x99, 0xB0, 0x94, 0x30, 0x34, 0x82, 0xB3, 0xE7, 0x35, 0x06, 0x93, 0x9D, 0xD4, 0xE2,
+        0x97, 0x19, 0x0B, 0xC9, 0xB0, 0x8C, 0x35, 0x33, 0xED, 0xB3, 0x87, 0x0D, 0x02, 0xF8, 0x97, 0x55,
+        0xE8, 0x9B, 0x68, 0x34, 0x1C, 0xB7, 0xB6, 0x04, 0x3D, 0x13, 0xB7, 0x89, 0x1E, 0x02, 0x76, 0xE3,
+        0x74, 0xED, 0x81, 0xF7, 0x34, 0x0F, 0x8F, 0xB2, 0xD4, 0x32, 0x0F, 0x8F, 0xB4, 0x77, 0x01, 0x6D,
+        0xF4, 0x63, 0xF6, 0x82, 0x9E, 0x09, 0x37, 0x93, 0xBD, 0x84, 0x36, 0x37, 0x9C, 0xB4, 0xEB, 0x1B,
+        0x68, 0x55, 0x17, 0x7B, 0x82, 0x8D, 0x07, 0x33, 0x6D, 0xB3, 0xB5, 0x0D, 0x30, 0x4B, 0x8B, 0x98,
+        0x17, 0x62, 0x54, 0x12, 0x13, 0x86, 0xB5, 0x67, 0x33, 0x02, 0xB4, 0xB0, 0x14, 0x30, 0x18, 0x83,
+        0x87, 0x7F, 0x7C, 0xF5, 0x1C, 0x06, 0x90, 0xB6, 0x93, 0x31, 0x37, 0x81, 0xBD, 0xEA, 0x37, 0x02,
+        0x9C, 0x87, 0xDB, 0xD4, 0xED, 0x11, 0x0C, 0x5C, 0xB6, 0x8F, 0x08, 0x32, 0xFD, 0xB2, 0x83, 0x0F,
+        0x09, 0xFF, 0x9B, 0xF3, 0xF7, 0x90, 0x67, 0x08, 0x1E, 0xB5, 0xB6, 0x19, 0x3C, 0x18, 0xB6, 0xB5,
+        0x1F, 0x08, 0x67, 0x90, 0xF7, 0xF3, 0x9B, 0xFE, 0x09, 0x0F, 0x83, 0xB2, 0xFC, 0x32, 0x08, 0x8F,
+        0xB6, 0x52, 0x0C, 0x11, 0xE2, 0x54, 0xDB, 0x87, 0x9F, 0x02, 0x37, 0xEB, 0xBD, 0x81, 0x37, 0x31,
+        0x90, 0xB6, 0x90, 0x06, 0x1C, 0xF5, 0x7C, 0x7F, 0x87, 0x83, 0x19, 0x30, 0x14, 0xB0, 0xB4, 0x02,
+        0x33, 0x67, 0xB5, 0x86, 0x13, 0x12, 0x54, 0x62, 0x17, 0x99, 0x8B, 0x49, 0x30, 0x0C, 0xB5, 0xB3,
+        0x6D, 0x33, 0x07, 0x8D, 0x82, 0x78, 0x17, 0xD5, 0x68, 0x1B, 0xE8, 0xB4, 0x9C, 0x37, 0x36, 0x84,
+        0xBD, 0x93, 0x37, 0x09, 0x9E, 0x82, 0xF6, 0x63, 0xF4, 0x6D, 0x01, 0x77, 0xB4, 0x8F, 0x0F, 0x32
+    },
+    {   /* 8 */
+        0xD5, 0xBD, 0x82, 0x35, 0x34, 0x92, 0xB5, 0xE1, 0x06, 0x17, 0xE7, 0xD9, 0xD9, 0x9F, 0xE8, 0x00,
+        0x0D, 0x9A, 0xB1, 0xF3, 0x33, 0x0F, 0xB4, 0xB0, 0x1D, 0x32, 0x10, 0xB4, 0x82, 0x1B, 0x00, 0xC5,
+        0x97, 0xC5, 0xF9, 0x97, 0x6E, 0x0D, 0x7B, 0xB5, 0x82, 0x09, 0x30, 0x97, 0xBC, 0x9B, 0x31, 0x34,
+        0x80, 0xB6, 0xD5, 0x08, 0x12, 0x9C, 0x97, 0x46, 0xFD, 0xCB, 0x1B, 0x18, 0x84, 0xB5, 0x66, 0x30,
+        0x04, 0xB6, 0xB6, 0x00, 0x3D, 0x72, 0xB0, 0x83, 0x0C, 0x0E, 0xEC, 0x86, 0xFD, 0x66, 0xC5, 0x67,
+        0x18, 0xC0, 0x8E, 0x99, 0x08, 0x34, 0x85, 0xBD, 0xEC, 0x32, 0x08, 0x8B, 0xB1, 0x6A, 0x37, 0x11,
+        0x83, 0x9B, 0x6E, 0x6E, 0xD5, 0x6E, 0x6F, 0x9B, 0x83, 0x11, 0x37, 0x6A, 0xB1, 0x8B, 0x08, 0x32,
+        0xED, 0xBD, 0x85, 0x34, 0x08, 0x99, 0x8E, 0xC3, 0x18, 0x67, 0xC4, 0x66, 0xFD, 0x86, 0xEC, 0x0E,
+        0x0C, 0x80, 0xB0, 0x72, 0x3D, 0x00, 0xB6, 0xB6, 0x04, 0x30, 0x66, 0xB5, 0x84, 0x18, 0x1B, 0xCB,
+        0xFC, 0x46, 0x97, 0x9C, 0x12, 0x08, 0xD5, 0xB6, 0x80, 0x34, 0x31, 0x9B, 0xBC, 0x97, 0x30, 0x09,
+        0x82, 0xB5, 0x7B, 0x0D, 0x6E, 0x96, 0xF8, 0xDA, 0x97, 0xC5, 0x00, 0x1B, 0x82, 0xB4, 0x10, 0x32,
+        0x1D, 0xB0, 0xB4, 0x0F, 0x33, 0xF3, 0xB1, 0x9A, 0x0D, 0x00, 0xE8, 0x9F, 0xD9, 0xDE, 0xE7, 0x17,
+        0x06, 0xE1, 0xB5, 0x92, 0x34, 0x35, 0x82, 0xBD, 0xD5, 0x3D, 0x02, 0xB5, 0xB4, 0x12, 0x35, 0x61,
+        0x86, 0x97, 0x67, 0x59, 0x59, 0x1F, 0x68, 0x80, 0x8D, 0x1A, 0x31, 0x73, 0xB3, 0x8F, 0x34, 0x30,
+        0x9D, 0xB2, 0x90, 0x34, 0x02, 0x9B, 0x80, 0x5A, 0x17, 0x45, 0x79, 0x17, 0xEE, 0x8D, 0xFB, 0x35,
+        0x02, 0x89, 0xB0, 0x17, 0x3C, 0x1B, 0xB1, 0xB4, 0x00, 0x36, 0xD5, 0x88, 0x92, 0x1C, 0x17, 0xC6,
+        0x7D, 0x4B, 0x9B, 0x98, 0x04, 0x35, 0xE6, 0xB0, 0x84, 0x36, 0x36, 0x80, 0xBD, 0xF2, 0x30, 0x03,
+        0x8C, 0x8E, 0x6C, 0x06, 0x7D, 0xE6, 0x45, 0xE7, 0x98, 0x40, 0x0E, 0x19, 0x88, 0xB4, 0x05, 0x3D,
+        0x6C, 0xB2, 0x88, 0x0B, 0x31, 0xEA, 0xB7, 0x91, 0x03, 0x1B, 0xEE, 0xEE, 0xD5, 0xEE, 0xEF, 0x1B,
+        0x03, 0x91, 0xB7, 0xEA, 0x31, 0x0B, 0x88, 0xB2, 0x6D, 0x3D, 0x05, 0xB4, 0x88, 0x19, 0x0E, 0x43,
+        0x98, 0xE7, 0x44, 0xE6, 0x7D, 0x06, 0x6C, 0x8E, 0x8C, 0x00, 0x30, 0xF2, 0xBD, 0x80, 0x36, 0x36,
+        0x84, 0xB0, 0xE6, 0x35, 0x04, 0x98, 0x9B, 0x4B, 0x7C, 0xC6, 0x17, 0x1C, 0x92, 0x88, 0xD5, 0x36,
+        0x00, 0xB4, 0xB1, 0x1B, 0x3C, 0x17, 0xB0, 0x89, 0x02, 0x35, 0xFB, 0x8D, 0xEE, 0x16, 0x78, 0x5A,
+        0x17, 0x45, 0x80, 0x9B, 0x02, 0x34, 0x90, 0xB2, 0x9D, 0x30, 0x34, 0x8F, 0xB3, 0x73, 0x31, 0x1A,
+        0x8D, 0x80, 0x68, 0x1F, 0x59, 0x5E, 0x67, 0x97, 0x86, 0x61, 0x35, 0x12, 0xB4, 0xB5, 0x02, 0x3D
+    },
+    {   /* 9 */
+        0xD5, 0xBD, 0x86, 0x36, 0x34, 0x82, 0xB6, 0x63, 0x37, 0x14, 0x8F, 0x85, 0x1E, 0x1B, 0xFE, 0xEA,
+        0xD3, 0xC2, 0xFC, 0x15, 0x1C, 0x95, 0x82, 0x53, 0x0A, 0x1E, 0xB5, 0x88, 0x02, 0x30, 0xE8, 0xBD,
+        0x9D, 0x33, 0x0B, 0xB5, 0xB0, 0x1E, 0x33, 0x66, 0xB6, 0x87, 0x0C, 0x0D, 0x93, 0x83, 0x5C, 0x1E,
+        0x7E, 0xFA, 0xD5, 0xF1, 0x94, 0x76, 0x07, 0x60, 0x8D, 0x87, 0x03, 0x35, 0x9C, 0xB0, 0xE4, 0x33,
+        0x02, 0xB7, 0xB6, 0x03, 0x3D, 0xF7, 0xB2, 0x85, 0x37, 0x09, 0x80, 0xB5, 0x62, 0x09, 0x60, 0x87,
+        0x97, 0x68, 0x60, 0xD2, 0x7C, 0x5C, 0x9D, 0xEA, 0x05, 0x06, 0x9F, 0xB5, 0x74, 0x36, 0x19, 0xB6,
+        0xB5, 0x0E, 0x33, 0x91, 0xBC, 0x91, 0x33, 0x0E, 0x8A, 0xB6, 0x19, 0x36, 0x77, 0xB5, 0x9F, 0x06,
+        0x05, 0xEA, 0x9D, 0x5C, 0x7C, 0xDD, 0x60, 0x68, 0x97, 0x87, 0x61, 0x09, 0x6D, 0xB5, 0x80, 0x09,
+        0x37, 0x85, 0xB2, 0xF6, 0x3D, 0x03, 0xB6, 0xB7, 0x02, 0x33, 0xE5, 0xB0, 0x9C, 0x35, 0x03, 0x87,
+        0x8D, 0x60, 0x07, 0x76, 0x94, 0xF0, 0xD5, 0xFA, 0x7E, 0x1E, 0x5C, 0x83, 0x93, 0x0D, 0x0C, 0x87,
+        0xB6, 0x67, 0x33, 0x1E, 0xB0, 0xB5, 0x0B, 0x33, 0x9D, 0xBD, 0xEB, 0x30, 0x02, 0x88, 0xB5, 0x1E,
+        0x0A, 0x52, 0x82, 0x95, 0x1C, 0x15, 0xFC, 0xC2, 0xD3, 0xEA, 0xF9, 0x1B, 0x1E, 0x9A, 0x8F, 0x14,
+        0x37, 0x63, 0xB6, 0x82, 0x34, 0x36, 0x86, 0xBD, 0xD5, 0x3D, 0x06, 0xB6, 0xB4, 0x02, 0x36, 0xE3,
+        0xB7, 0x94, 0x0F, 0x05, 0x9E, 0x9B, 0x7E, 0x6A, 0x53, 0x42, 0x7C, 0x95, 0x9C, 0x15, 0x02, 0xD3,
+        0x8A, 0x9E, 0x35, 0x08, 0x82, 0xB0, 0x68, 0x3D, 0x1D, 0xB3, 0x8B, 0x35, 0x30, 0x9E, 0xB3, 0xE6,
+        0x36, 0x07, 0x8C, 0x8D, 0x13, 0x03, 0xDC, 0x9E, 0xFE, 0x7A, 0xD5, 0x71, 0x14, 0xF6, 0x87, 0xE0,
+        0x0D, 0x07, 0x83, 0xB5, 0x1C, 0x30, 0x64, 0xB3, 0x82, 0x37, 0x36, 0x83, 0xBD, 0x77, 0x32, 0x05,
+        0xB7, 0x89, 0x00, 0x35, 0xE2, 0x89, 0xE0, 0x07, 0x17, 0xE8, 0xE0, 0x52, 0xFC, 0xDC, 0x1D, 0x6A,
+        0x85, 0x86, 0x1F, 0x35, 0xF4, 0xB6, 0x99, 0x36, 0x35, 0x8E, 0xB3, 0x11, 0x3C, 0x11, 0xB3, 0x8E,
+        0x0A, 0x36, 0x99, 0xB6, 0xF7, 0x35, 0x1F, 0x86, 0x85, 0x6A, 0x1D, 0xDC, 0xFC, 0x52, 0xE0, 0xE8,
+        0x17, 0x07, 0xE1, 0x89, 0xED, 0x35, 0x00, 0x89, 0xB7, 0x05, 0x32, 0x76, 0xBD, 0x83, 0x36, 0x37,
+        0x82, 0xB3, 0x65, 0x30, 0x1C, 0xB5, 0x83, 0x07, 0x0D, 0xE0, 0x87, 0xF6, 0x14, 0x71, 0xD5, 0x7A,
+        0xFE, 0x9E, 0xDC, 0x03, 0x13, 0x8D, 0x8C, 0x07, 0x36, 0xE7, 0xB3, 0x9E, 0x30, 0x35, 0x8B, 0xB3,
+        0x1D, 0x3D, 0x6B, 0xB0, 0x82, 0x08, 0x35, 0x9E, 0x8A, 0xD2, 0x02, 0x15, 0x9C, 0x95, 0x7C, 0x42,
+        0x53, 0x6A, 0x79, 0x9B, 0x9E, 0x1A, 0x0F, 0x94, 0xB7, 0xE3, 0x36, 0x02, 0xB4, 0xB6, 0x06, 0x3D
+    },
+    {   /* 0 */
+        0xD5, 0xBD, 0x9A, 0x33, 0x08, 0xB4, 0xB6, 0x00, 0x33, 0xE9, 0xB3, 0xEE, 0x31, 0x07, 0xB5, 0x8E,
+        0x00, 0x0A, 0x91, 0x8A, 0xD5, 0x0E, 0x6A, 0x81, 0x9C, 0x1E, 0x1E, 0xEF, 0x92, 0x4C, 0x6A, 0x5B,
+        0xFD, 0xD0, 0xC1, 0xF3, 0x78, 0x6B, 0xFE, 0x9F, 0xD5, 0x04, 0x6D, 0x86, 0x99, 0x07, 0x03, 0x9E,
+        0x8B, 0x61, 0x34, 0x62, 0xB7, 0x87, 0x35, 0x0B, 0x8C, 0xB1, 0x19, 0x32, 0x54, 0xB2, 0x9B, 0x33,
+        0x08, 0xB4, 0xB1, 0x03, 0x32, 0xEA, 0xBD, 0xEB, 0x32, 0x00, 0xB6, 0xB5, 0x0F, 0x36, 0x9F, 0xB1,
+        0xD5, 0x36, 0x12, 0xB5, 0x81, 0x02, 0x0D, 0x9F, 0x8C, 0x7A, 0x03, 0x7F, 0x84, 0xE8, 0x13, 0x15,
+        0xE3, 0xEC, 0x42, 0x77, 0xD5, 0x77, 0x42, 0xEC, 0xE3, 0x15, 0x13, 0xE8, 0x84, 0x7C, 0x03, 0x7A,
+        0x8C, 0x9F, 0x0D, 0x02, 0x81, 0xB5, 0x12, 0x36, 0x55, 0xB1, 0x9F, 0x36, 0x0F, 0xB5, 0xB6, 0x00,
+        0x32, 0xEB, 0xBD, 0xEA, 0x32, 0x03, 0xB1, 0xB4, 0x08, 0x33, 0x9B, 0xB2, 0xD4, 0x32, 0x19, 0xB1,
+        0x8C, 0x0B, 0x35, 0x87, 0xB7, 0x63, 0x34, 0x60, 0x8B, 0x9E, 0x03, 0x07, 0x99, 0x86, 0x6D, 0x04,
+        0x55, 0x9F, 0xFE, 0x6B, 0x78, 0xF3, 0xC1, 0xD0, 0xFD, 0x58, 0x6A, 0x4C, 0x92, 0xEF, 0x1E, 0x1E,
+        0x9C, 0x80, 0x6A, 0x0E, 0x55, 0x8A, 0x91, 0x0A, 0x00, 0x8F, 0xB5, 0x07, 0x31, 0xEE, 0xB3, 0xE9,
+        0x33, 0x00, 0xB6, 0xB4, 0x09, 0x33, 0x9B, 0xBD, 0xD5, 0x3D, 0x1A, 0xB3, 0x88, 0x34, 0x36, 0x80,
+        0xB3, 0x69, 0x33, 0x6E, 0xB1, 0x87, 0x35, 0x0E, 0x80, 0x8A, 0x11, 0x0A, 0x55, 0x8E, 0xEA, 0x01,
+        0x1C, 0x9E, 0x9E, 0x6F, 0x12, 0xCC, 0xEA, 0xDB, 0x7D, 0x50, 0x41, 0x73, 0xF8, 0xEB, 0x7E, 0x1F,
+        0x55, 0x84, 0xED, 0x06, 0x19, 0x87, 0x83, 0x1E, 0x0B, 0xE1, 0xB4, 0xE2, 0x37, 0x07, 0xB5, 0x8B,
+        0x0C, 0x31, 0x99, 0xB2, 0xD4, 0x32, 0x1B, 0xB3, 0x88, 0x34, 0x31, 0x83, 0xB2, 0x6A, 0x3D, 0x6B,
+        0xB2, 0x80, 0x36, 0x35, 0x8F, 0xB6, 0x1F, 0x31, 0x55, 0xB6, 0x92, 0x35, 0x01, 0x82, 0x8D, 0x1F,
+        0x0C, 0xFA, 0x83, 0xFF, 0x04, 0x68, 0x93, 0x95, 0x63, 0x6C, 0xC2, 0xF7, 0xD5, 0xF7, 0xC2, 0x6C,
+        0x63, 0x95, 0x93, 0x68, 0x04, 0xFC, 0x83, 0xFA, 0x0C, 0x1F, 0x8D, 0x82, 0x01, 0x35, 0x92, 0xB6,
+        0xD5, 0x31, 0x1F, 0xB6, 0x8F, 0x35, 0x36, 0x80, 0xB2, 0x6B, 0x3D, 0x6A, 0xB2, 0x83, 0x31, 0x34,
+        0x88, 0xB3, 0x1B, 0x32, 0x54, 0xB2, 0x99, 0x31, 0x0C, 0x8B, 0xB5, 0x07, 0x37, 0xE3, 0xB4, 0xE0,
+        0x0B, 0x1E, 0x83, 0x87, 0x19, 0x06, 0xED, 0x84, 0xD5, 0x1F, 0x7E, 0xEB, 0xF8, 0x73, 0x41, 0x50,
+        0x7D, 0xD8, 0xEA, 0xCC, 0x12, 0x6F, 0x9E, 0x9E, 0x1C, 0x00, 0xEA, 0x8E, 0xD5, 0x0A, 0x11, 0x8A,
+        0x80, 0x0F, 0x35, 0x87, 0xB1, 0x6E, 0x33, 0x69, 0xB3, 0x80, 0x36, 0x34, 0x89, 0xB3, 0x1B, 0x3D
+    },
+    {   /* B */
+        0xD5, 0xB2, 0x80, 0x0E, 0x0D, 0xE2, 0xEA, 0x59, 0x99, 0x85, 0x01, 0x36, 0xE2, 0xBD, 0x87, 0x37,
+        0x0A, 0x9E, 0x83, 0xD9, 0xD5, 0xEC, 0x1A, 0x09, 0x91, 0xB2, 0x9D, 0x30, 0x35, 0x83, 0xB5, 0x4C,
+        0x1B, 0x4F, 0x6D, 0x1A, 0x90, 0xB7, 0xE3, 0x33, 0x08, 0x8A, 0xB1, 0x69, 0x08, 0x62, 0xEF, 0x73,
+        0xE8, 0x8C, 0xD5, 0x31, 0x02, 0xB7, 0xB1, 0x19, 0x31, 0x6D, 0x81, 0xEB, 0xD5, 0x90, 0x73, 0x35,
+        0x1B, 0xB7, 0xB6, 0x00, 0x32, 0x73, 0xB5, 0x99, 0x10, 0x7E, 0x4A, 0x06, 0x68, 0xB5, 0x8B, 0x0F,
+        0x32, 0xF2, 0xB0, 0x85, 0x03, 0x1A, 0xF2, 0x7A, 0x4A, 0x8D, 0x81, 0x0E, 0x30, 0x97, 0xBD, 0x99,
+        0x34, 0x02, 0x90, 0x93, 0xD5, 0x93, 0x93, 0x02, 0x34, 0x99, 0xBD, 0x97, 0x30, 0x0E, 0x81, 0x8D,
+        0x4B, 0x7A, 0xF2, 0x1A, 0x03, 0x85, 0xB0, 0xFC, 0x32, 0x0F, 0x8B, 0xB5, 0x68, 0x06, 0x4A, 0x7E,
+        0x10, 0x99, 0xB5, 0x71, 0x32, 0x00, 0xB6, 0xB7, 0x18, 0x35, 0x72, 0x90, 0xD5, 0xE8, 0x81, 0x6D,
+        0x31, 0x19, 0xB1, 0xB7, 0x03, 0x31, 0x55, 0x8C, 0xEB, 0x73, 0xEF, 0x62, 0x08, 0x69, 0xB1, 0x8A,
+        0x08, 0x33, 0xE3, 0xB7, 0x90, 0x1A, 0x6D, 0x4F, 0x1B, 0x4F, 0xB5, 0x82, 0x35, 0x30, 0x9D, 0xB2,
+        0x91, 0x09, 0x1A, 0xEC, 0xD5, 0xDE, 0x83, 0x9E, 0x0A, 0x37, 0x87, 0xBD, 0xED, 0x36, 0x01, 0x85,
+        0x99, 0x5E, 0xEA, 0xE2, 0x0D, 0x0E, 0x80, 0xB2, 0xD4, 0x32, 0x00, 0x8E, 0x8D, 0x62, 0x6A, 0xD9,
+        0x19, 0x05, 0x81, 0xB6, 0x62, 0x3D, 0x07, 0xB7, 0x8A, 0x1E, 0x03, 0x59, 0xD5, 0x6C, 0x9A, 0x89,
+        0x11, 0x32, 0x1D, 0xB0, 0xB5, 0x03, 0x35, 0xCC, 0x9B, 0xCF, 0xED, 0x9A, 0x10, 0x37, 0x63, 0xB3,
+        0x88, 0x0A, 0x31, 0xE9, 0x88, 0xE2, 0x6F, 0xF3, 0x68, 0x0C, 0x55, 0xB1, 0x82, 0x37, 0x31, 0x99,
+        0xB1, 0xED, 0x01, 0x6B, 0xD5, 0x10, 0xF3, 0xB5, 0x9B, 0x37, 0x36, 0x80, 0xB2, 0xF3, 0x35, 0x19,
+        0x90, 0xFE, 0xCA, 0x86, 0xE8, 0x35, 0x0B, 0x8F, 0xB2, 0x72, 0x30, 0x05, 0x83, 0x9A, 0x72, 0xFA,
+        0xCA, 0x0D, 0x01, 0x8E, 0xB0, 0x17, 0x3D, 0x19, 0xB4, 0x82, 0x10, 0x13, 0xD5, 0x13, 0x13, 0x82,
+        0xB4, 0x19, 0x3D, 0x17, 0xB0, 0x8E, 0x01, 0x0D, 0xCB, 0xFA, 0x72, 0x9A, 0x83, 0x05, 0x30, 0x7C,
+        0xB2, 0x8F, 0x0B, 0x35, 0xE8, 0x86, 0xCA, 0xFE, 0x90, 0x19, 0x35, 0xF0, 0xB2, 0x80, 0x36, 0x37,
+        0x98, 0xB5, 0xF2, 0x10, 0xD5, 0x68, 0x01, 0xED, 0xB1, 0x99, 0x31, 0x37, 0x83, 0xB1, 0xD5, 0x0C,
+        0x6B, 0xF3, 0x6F, 0xE2, 0x88, 0xE9, 0x31, 0x0A, 0x88, 0xB3, 0x63, 0x37, 0x10, 0x9A, 0xED, 0xCF,
+        0x9B, 0xCE, 0x35, 0x02, 0xB5, 0xB0, 0x1D, 0x32, 0x11, 0x89, 0x9A, 0x6C, 0xD5, 0x5E, 0x03, 0x1E,
+        0x8A, 0xB7, 0x07, 0x3D, 0x6D, 0xB6, 0x81, 0x05, 0x19, 0xDE, 0x6A, 0x62, 0x8D, 0x8E, 0x00, 0x32
+    },
+    {   /* C */
+        0xD5, 0xBD, 0x87, 0x34, 0x0F, 0x9B, 0x81, 0x49, 0x7C, 0xCF, 0x1E, 0x1B, 0x81, 0xB4, 0x1D, 0x32,
+        0x6C, 0xB2, 0x8D, 0x35, 0x35, 0x99, 0x8F, 0x51, 0x17, 0xD5, 0x6B, 0x1F, 0x99, 0xB5, 0x6C, 0x33,
+        0x1D, 0xB3, 0x8B, 0x0A, 0x36, 0x93, 0x8A, 0xF0, 0x18, 0x7D, 0x77, 0x16, 0x97, 0x89, 0x44, 0x31,
+        0x04, 0xB1, 0xB4, 0x0E, 0x30, 0xE8, 0xB7, 0xEE, 0x06, 0x6B, 0xF5, 0x60, 0xE6, 0x8D, 0xFD, 0x37,
+        0x00, 0xB7, 0xB6, 0x00, 0x32, 0xF5, 0xB1, 0x9D, 0x03, 0x1C, 0xE0, 0xD5, 0xCE, 0x87, 0xE2, 0x0A,
+        0x02, 0x8B, 0xB1, 0x05, 0x3D, 0x7B, 0xB0, 0x87, 0x0D, 0x07, 0xE9, 0xED, 0xD6, 0x9D, 0xE8, 0x0C,
+        0x0C, 0x8D, 0xB0, 0x16, 0x3C, 0x11, 0xB0, 0x8D, 0x0C, 0x0C, 0xE9, 0x9D, 0xD6, 0xED, 0xE9, 0x07,
+        0x0D, 0x87, 0xB0, 0x78, 0x3D, 0x05, 0xB1, 0x8B, 0x02, 0x0A, 0xE2, 0x87, 0xC9, 0xD5, 0xE0, 0x1C,
+        0x03, 0x9D, 0xB1, 0xF4, 0x32, 0x03, 0xB6, 0xB7, 0x00, 0x37, 0xF2, 0x8D, 0xE6, 0x60, 0xF5, 0x68,
+        0x06, 0xEE, 0xB7, 0xE8, 0x30, 0x0E, 0xB4, 0xB1, 0x04, 0x31, 0x47, 0x89, 0x97, 0x16, 0x77, 0x7D,
+        0x18, 0xF0, 0x8A, 0x93, 0x36, 0x0A, 0x8B, 0xB3, 0x1D, 0x33, 0x6C, 0xB5, 0x99, 0x1F, 0x6A, 0xD5,
+        0x17, 0x51, 0x8F, 0x99, 0x35, 0x35, 0x8D, 0xB2, 0x6D, 0x32, 0x1D, 0xB4, 0x81, 0x1B, 0x1E, 0xCF,
+        0x7D, 0x49, 0x81, 0x9B, 0x0F, 0x34, 0x87, 0xBD, 0xD5, 0x3D, 0x07, 0xB4, 0x8F, 0x1B, 0x01, 0xC9,
+        0xFC, 0x4F, 0x9E, 0x9B, 0x01, 0x34, 0x9D, 0xB2, 0xEC, 0x32, 0x0D, 0xB5, 0xB5, 0x19, 0x0F, 0xD1,
+        0x97, 0xD5, 0xEB, 0x9F, 0x19, 0x35, 0xEC, 0xB3, 0x9D, 0x33, 0x0B, 0x8A, 0xB6, 0x13, 0x0A, 0x70,
+        0x98, 0xFD, 0xF7, 0x96, 0x17, 0x09, 0xC4, 0xB1, 0x84, 0x31, 0x34, 0x8E, 0xB0, 0x68, 0x37, 0x6E,
+        0x86, 0xEB, 0x75, 0xE0, 0x66, 0x0D, 0x7D, 0xB7, 0x80, 0x37, 0x36, 0x83, 0xB2, 0x75, 0x31, 0x1D,
+        0x83, 0x9C, 0x60, 0xD5, 0x4E, 0x07, 0x62, 0x8A, 0x82, 0x0B, 0x31, 0x85, 0xBD, 0xFB, 0x30, 0x07,
+        0x8D, 0x87, 0x69, 0x6D, 0x57, 0x1D, 0x68, 0x8C, 0x8C, 0x0D, 0x30, 0x91, 0xBC, 0x91, 0x30, 0x0D,
+        0x8C, 0x8C, 0x69, 0x1D, 0x56, 0x6D, 0x69, 0x87, 0x8D, 0x07, 0x30, 0xF8, 0xBD, 0x85, 0x31, 0x0B,
+        0x82, 0x8A, 0x62, 0x07, 0x49, 0xD5, 0x60, 0x9C, 0x83, 0x1D, 0x31, 0x74, 0xB2, 0x83, 0x36, 0x37,
+        0x80, 0xB7, 0x72, 0x0D, 0x66, 0xE0, 0x75, 0xE8, 0x86, 0x6E, 0x37, 0x68, 0xB0, 0x8E, 0x34, 0x31,
+        0x84, 0xB1, 0xC7, 0x09, 0x17, 0x91, 0xF7, 0xFD, 0x98, 0x71, 0x0A, 0x13, 0xB6, 0x8A, 0x0B, 0x33,
+        0x9D, 0xB3, 0xEC, 0x35, 0x19, 0x9F, 0xEA, 0xD5, 0x97, 0xD1, 0x0F, 0x19, 0xB5, 0xB5, 0x0D, 0x32,
+        0xED, 0xB2, 0x9D, 0x34, 0x01, 0x9B, 0x9E, 0x4F, 0xFD, 0xC9, 0x01, 0x1B, 0x8F, 0xB4, 0x07, 0x3D
+    },
+    {   /* D */
+        0xD5, 0xBD, 0x9B, 0x31, 0x0C, 0x8F, 0x8F, 0x1C, 0x01, 0xF7, 0xEA, 0xD4, 0xE2, 0xED, 0x05, 0x07,
+        0x87, 0xB5, 0x1C, 0x33, 0x54, 0xBD, 0x9A, 0x33, 0x09, 0xB5, 0xB4, 0x04, 0x35, 0xE4, 0x83, 0xF1,
+        0x14, 0x45, 0x7B, 0x15, 0x90, 0x83, 0x17, 0x34, 0x55, 0xB0, 0x98, 0x30, 0x08, 0xB4, 0xB6, 0x00,
+        0x31, 0xEC, 0xB4, 0xE6, 0x02, 0x15, 0x94, 0xF3, 0xC8, 0x97, 0x60, 0x02, 0x55, 0xB4, 0x9D, 0x36,
+        0x0E, 0xB4, 0xB1, 0x03, 0x32, 0xE8, 0xB3, 0xEC, 0x34, 0x19, 0x81, 0x9E, 0x68, 0x66, 0x52, 0x14,
+        0x55, 0x80, 0x94, 0x0B, 0x03, 0x8B, 0xB7, 0x00, 0x32, 0xEA, 0xBD, 0xEB, 0x30, 0x06, 0x8B, 0x82,
+        0x1A, 0x07, 0xE4, 0xEE, 0xD5, 0xEE, 0xE4, 0x07, 0x1A, 0x82, 0x8B, 0x06, 0x30, 0xE8, 0xBD, 0xEA,
+        0x32, 0x03, 0xB7, 0x8B, 0x03, 0x0B, 0x94, 0x80, 0xD5, 0x14, 0x52, 0x66, 0x68, 0x9E, 0x81, 0x19,
+        0x34, 0xEC, 0xB3, 0xE8, 0x32, 0x03, 0xB1, 0xB4, 0x0E, 0x36, 0x9D, 0xB4, 0xD5, 0x02, 0x60, 0x97,
+        0xC8, 0xF3, 0x94, 0x15, 0x02, 0xE7, 0xB4, 0xEC, 0x31, 0x00, 0xB6, 0xB4, 0x08, 0x30, 0x98, 0xB0,
+        0xD5, 0x34, 0x16, 0x83, 0x90, 0x15, 0x7B, 0x45, 0x14, 0xF1, 0x83, 0xE7, 0x35, 0x04, 0xB4, 0xB5,
+        0x09, 0x33, 0x9B, 0xBD, 0xD4, 0x33, 0x1C, 0xB5, 0x87, 0x07, 0x05, 0xE2, 0xE2, 0xD4, 0xEA, 0xF7,
+        0x01, 0x1C, 0x8F, 0x8E, 0x0D, 0x31, 0x98, 0xBD, 0xD5, 0x3D, 0x18, 0xB1, 0x8C, 0x0F, 0x0F, 0x9C,
+        0x81, 0x77, 0x6A, 0x54, 0x62, 0x6D, 0x85, 0x87, 0x07, 0x35, 0x9C, 0xB3, 0xD4, 0x3D, 0x1A, 0xB3,
+        0x89, 0x35, 0x34, 0x84, 0xB5, 0x64, 0x03, 0x71, 0x94, 0xC5, 0xFB, 0x95, 0x10, 0x03, 0x97, 0xB4,
+        0xD5, 0x30, 0x18, 0xB0, 0x88, 0x34, 0x36, 0x80, 0xB1, 0x6C, 0x34, 0x66, 0x82, 0x95, 0x14, 0x73,
+        0x48, 0x17, 0xE0, 0x82, 0xD5, 0x34, 0x1D, 0xB6, 0x8E, 0x34, 0x31, 0x83, 0xB2, 0x68, 0x33, 0x6C,
+        0xB4, 0x99, 0x01, 0x1E, 0xE8, 0xE6, 0xD2, 0x94, 0xD5, 0x00, 0x14, 0x8B, 0x83, 0x0B, 0x37, 0x80,
+        0xB2, 0x6A, 0x3D, 0x6B, 0xB0, 0x86, 0x0B, 0x02, 0x9A, 0x87, 0x64, 0x6E, 0xD5, 0x6E, 0x64, 0x87,
+        0x9A, 0x02, 0x0B, 0x86, 0xB0, 0x68, 0x3D, 0x6A, 0xB2, 0x83, 0x37, 0x0B, 0x83, 0x8B, 0x14, 0x00,
+        0x55, 0x94, 0xD2, 0xE6, 0xE8, 0x1E, 0x01, 0x99, 0xB4, 0x6C, 0x33, 0x68, 0xB2, 0x83, 0x31, 0x34,
+        0x8E, 0xB6, 0x1D, 0x34, 0x55, 0x82, 0xE0, 0x17, 0x48, 0x73, 0x14, 0x95, 0x82, 0x67, 0x34, 0x6C,
+        0xB1, 0x80, 0x36, 0x34, 0x88, 0xB0, 0x18, 0x30, 0x55, 0xB4, 0x96, 0x03, 0x10, 0x95, 0xFB, 0xC5,
+        0x94, 0x71, 0x03, 0x67, 0xB5, 0x84, 0x34, 0x35, 0x89, 0xB3, 0x1B, 0x3D, 0x54, 0xB3, 0x9C, 0x35,
+        0x07, 0x87, 0x85, 0x62, 0x62, 0x54, 0x6A, 0x77, 0x81, 0x9C, 0x0F, 0x0E, 0x8D, 0xB1, 0x18, 0x3D
+    },
+    {   /* E */
+        0xD5, 0xBD, 0x90, 0x33, 0x06, 0xB6, 0x8F, 0x09, 0x09, 0x87, 0x8F, 0x14, 0x01, 0xF7, 0x9C, 0xDC,
+        0x7D, 0xD2, 0x62, 0x60, 0x9C, 0x9F, 0x1A, 0x02, 0x9B, 0xB5, 0x10, 0x31, 0xF0, 0xB2, 0xEB, 0x32,
+        0x07, 0xB3, 0x89, 0x37, 0x34, 0x89, 0xB6, 0x04, 0x36, 0xEB, 0xB4, 0xDC, 0x0F, 0x60, 0x84, 0xED,
+        0x6A, 0x72, 0xD5, 0x78, 0xE1, 0x9C, 0x6D, 0x03, 0xFF, 0x8B, 0xFF, 0x37, 0x1C, 0xB6, 0x82, 0x37,
+        0x35, 0xB5, 0xB1, 0x02, 0x32, 0x9C, 0xB2, 0x75, 0x30, 0x69, 0xB7, 0x9E, 0x09, 0x05, 0x87, 0x98,
+        0x17, 0x16, 0xF1, 0xC2, 0xDC, 0xEA, 0xD3, 0x05, 0x60, 0x82, 0x9F, 0x0E, 0x02, 0x8E, 0xB5, 0x02,
+        0x30, 0x9A, 0xBD, 0x60, 0x3C, 0x63, 0xBD, 0x9A, 0x30, 0x02, 0xB5, 0x8E, 0x02, 0x0E, 0x9F, 0x82,
+        0x60, 0x05, 0xD3, 0xEA, 0xDC, 0xC2, 0xF1, 0x17, 0x17, 0x98, 0x87, 0x05, 0x09, 0x9E, 0xB7, 0x69,
+        0x30, 0x77, 0xB2, 0x9F, 0x32, 0x02, 0xB1, 0xB5, 0x35, 0x37, 0x82, 0xB6, 0x1C, 0x37, 0xFC, 0x8B,
+        0xFE, 0x03, 0x6C, 0x9C, 0xE1, 0x78, 0xD5, 0x72, 0x6A, 0xED, 0x84, 0x60, 0x0F, 0xD2, 0xB4, 0xEA,
+        0x36, 0x04, 0xB6, 0x89, 0x34, 0x37, 0x89, 0xB3, 0x07, 0x32, 0xE8, 0xB2, 0xF3, 0x31, 0x10, 0xB5,
+        0x9A, 0x02, 0x05, 0x9F, 0x9C, 0x60, 0x62, 0xD2, 0x7D, 0xDC, 0x9C, 0xF6, 0x01, 0x17, 0x8F, 0x87,
+        0x09, 0x09, 0x8C, 0xB6, 0x06, 0x33, 0x90, 0xBD, 0xD5, 0x3D, 0x10, 0xB3, 0x86, 0x36, 0x0F, 0x89,
+        0x89, 0x07, 0x0F, 0x94, 0x81, 0x77, 0x1C, 0x5C, 0xFD, 0x52, 0xE2, 0xE0, 0x1C, 0x1F, 0x9A, 0x82,
+        0x1B, 0x35, 0x90, 0xB1, 0x70, 0x32, 0x6B, 0xB2, 0x87, 0x33, 0x09, 0xB7, 0xB4, 0x09, 0x36, 0x84,
+        0xB6, 0x6B, 0x34, 0x5C, 0x8F, 0xE0, 0x04, 0x6D, 0xEA, 0xF2, 0xD5, 0xF8, 0x61, 0x1C, 0xED, 0x83,
+        0x7F, 0x0B, 0x7F, 0xB7, 0x9C, 0x36, 0x02, 0xB7, 0xB5, 0x35, 0x31, 0x82, 0xB2, 0x1C, 0x32, 0xF5,
+        0xB0, 0xE9, 0x37, 0x1E, 0x89, 0x85, 0x07, 0x18, 0x97, 0x96, 0x76, 0x42, 0x5C, 0x6A, 0x53, 0x85,
+        0xE0, 0x02, 0x1F, 0x8E, 0x82, 0x0E, 0x35, 0x82, 0xB0, 0x1A, 0x3D, 0xE0, 0xBC, 0xE3, 0x3D, 0x1A,
+        0xB0, 0x82, 0x35, 0x0E, 0x82, 0x8E, 0x1F, 0x02, 0xE0, 0x85, 0x53, 0x6A, 0x5C, 0x42, 0x71, 0x97,
+        0x97, 0x18, 0x07, 0x85, 0x89, 0x1E, 0x37, 0xE9, 0xB0, 0xF7, 0x32, 0x1F, 0xB2, 0x82, 0x31, 0x35,
+        0xB5, 0xB7, 0x02, 0x36, 0x9C, 0xB7, 0x7C, 0x0B, 0x7E, 0x83, 0xEC, 0x1C, 0x61, 0xF8, 0xD5, 0xF2,
+        0xEA, 0x6D, 0x04, 0xE0, 0x8F, 0x52, 0x34, 0x6B, 0xB6, 0x84, 0x36, 0x09, 0xB4, 0xB7, 0x09, 0x33,
+        0x87, 0xB2, 0x68, 0x32, 0x73, 0xB1, 0x90, 0x35, 0x1B, 0x82, 0x85, 0x1F, 0x1C, 0xE0, 0xE2, 0x52,
+        0xFD, 0x5C, 0x1C, 0x76, 0x81, 0x97, 0x0F, 0x07, 0x89, 0x89, 0x0C, 0x36, 0x86, 0xB3, 0x10, 0x3D
+    },
+    {   /* F */
+        0xD5, 0xBC, 0xEC, 0x3D, 0x1D, 0xB2, 0x84, 0x30, 0x03, 0xB6, 0x8F, 0x35, 0x08, 0x89, 0x8B, 0x03,
+        0x0B, 0x85, 0x8B, 0x12, 0x09, 0xEE, 0x8C, 0x72, 0x00, 0xD5, 0x84, 0xCB, 0x1D, 0x71, 0xE8, 0xF5,
+        0x73, 0x50, 0x41, 0x77, 0xE6, 0xE2, 0x68, 0x11, 0x97, 0x9B, 0x16, 0x01, 0x94, 0x8D, 0x6E, 0x08,
+        0xFA, 0xB5, 0xD5, 0x37, 0x66, 0xB6, 0x91, 0x31, 0x05, 0xB1, 0x83, 0x36, 0x09, 0xB7, 0xB5, 0x35,
+        0x36, 0x88, 0xB0, 0x0D, 0x33, 0x87, 0xB2, 0x1D, 0x32, 0xE2, 0xB2, 0xD5, 0x33, 0x63, 0xB0, 0x90,
+        0x36, 0x19, 0xB4, 0x84, 0x08, 0x06, 0x82, 0x86, 0x07, 0x06, 0x9F, 0x84, 0x14, 0x18, 0xE1, 0x93,
+        0x77, 0x6E, 0xDC, 0xF7, 0xD5, 0xF7, 0xDC, 0x6E, 0x77, 0x93, 0xE1, 0x18, 0x14, 0x84, 0x9F, 0x06,
+        0x07, 0x86, 0x82, 0x06, 0x08, 0x84, 0xB4, 0x19, 0x36, 0x91, 0xB0, 0x63, 0x33, 0xD5, 0xB2, 0xED,
+        0x32, 0x1D, 0xB2, 0x87, 0x33, 0x0D, 0xB0, 0x88, 0x36, 0x35, 0xB5, 0xB7, 0x09, 0x36, 0x83, 0xB1,
+        0x05, 0x31, 0x91, 0xB6, 0x66, 0x37, 0xD5, 0xB5, 0xE5, 0x08, 0x69, 0x8D, 0x94, 0x01, 0x16, 0x9B,
+        0x97, 0x11, 0x6B, 0xE2, 0xE6, 0x77, 0x41, 0x50, 0x73, 0xF5, 0xE8, 0x71, 0x1D, 0xC8, 0x84, 0xD5,
+        0x00, 0x72, 0x8C, 0xEE, 0x09, 0x12, 0x8B, 0x85, 0x0B, 0x03, 0x8B, 0x89, 0x08, 0x35, 0x8F, 0xB6,
+        0x03, 0x30, 0x84, 0xB2, 0x1D, 0x3D, 0xED, 0xBC, 0xD5, 0x3C, 0x6C, 0xBD, 0x9D, 0x32, 0x04, 0xB0,
+        0x83, 0x36, 0x0F, 0xB5, 0x88, 0x09, 0x0B, 0x83, 0x8B, 0x05, 0x0B, 0x92, 0x89, 0x6E, 0x0C, 0xF2,
+        0x80, 0xD5, 0x04, 0x4B, 0x9D, 0xF1, 0x68, 0x75, 0xF3, 0xD0, 0xC1, 0xF7, 0x66, 0x62, 0xE8, 0x91,
+        0x17, 0x1B, 0x96, 0x81, 0x14, 0x0D, 0xEE, 0x88, 0x7A, 0x35, 0xD5, 0xB7, 0xE6, 0x36, 0x11, 0xB1,
+        0x85, 0x31, 0x03, 0xB6, 0x89, 0x37, 0x35, 0xB5, 0xB6, 0x08, 0x30, 0x8D, 0xB3, 0x07, 0x32, 0x9D,
+        0xB2, 0x62, 0x32, 0xD5, 0xB3, 0xE3, 0x30, 0x10, 0xB6, 0x99, 0x34, 0x04, 0x88, 0x86, 0x02, 0x06,
+        0x87, 0x86, 0x1F, 0x04, 0x94, 0x98, 0x61, 0x13, 0xF7, 0xEE, 0x5C, 0x77, 0xD5, 0x77, 0x5C, 0xEE,
+        0xF7, 0x13, 0x61, 0x98, 0x94, 0x04, 0x1F, 0x86, 0x87, 0x06, 0x02, 0x86, 0x88, 0x04, 0x34, 0x99,
+        0xB6, 0x11, 0x30, 0xE3, 0xB3, 0xD5, 0x32, 0x6D, 0xB2, 0x9D, 0x32, 0x07, 0xB3, 0x8D, 0x30, 0x08,
+        0xB6, 0xB5, 0x35, 0x37, 0x89, 0xB6, 0x03, 0x31, 0x85, 0xB1, 0x11, 0x36, 0xE6, 0xB7, 0xD5, 0x35,
+        0x65, 0x88, 0xE9, 0x0D, 0x14, 0x81, 0x96, 0x1B, 0x17, 0x91, 0xEB, 0x62, 0x66, 0xF7, 0xC1, 0xD0,
+        0xF3, 0x75, 0x68, 0xF1, 0x9D, 0x48, 0x04, 0xD5, 0x80, 0xF2, 0x0C, 0x6E, 0x89, 0x92, 0x0B, 0x05,
+        0x8B, 0x83, 0x0B, 0x09, 0x88, 0xB5, 0x0F, 0x36, 0x83, 0xB0, 0x04, 0x32, 0x9D, 0xBD, 0x6D, 0x3C
+    }
 };
 
-static const mf_digit_tones_t r2_mf_back_tones[] =
-{
-    {1140.0f, 1020.0f, -11, -11, 1, 0},
-    {1140.0f,  900.0f, -11, -11, 1, 0},
-    {1020.0f,  900.0f, -11, -11, 1, 0},
-    {1140.0f,  780.0f, -11, -11, 1, 0},
-    {1020.0f,  780.0f, -11, -11, 1, 0},
-    { 900.0f,  780.0f, -11, -11, 1, 0},
-    {1140.0f,  660.0f, -11, -11, 1, 0},
-    {1020.0f,  660.0f, -11, -11, 1, 0},
-    { 900.0f,  660.0f, -11, -11, 1, 0},
-    { 780.0f,  660.0f, -11, -11, 1, 0},
-    {1140.0f,  540.0f, -11, -11, 1, 0},
-    {1020.0f,  540.0f, -11, -11, 1, 0},
-    { 900.0f,  540.0f, -11, -11, 1, 0},
-    { 780.0f,  540.0f, -11, -11, 1, 0},
-    { 660.0f,  540.0f, -11, -11, 1, 0},
-    {0.0f, 0.0f, 0, 0, 0, 0}
+static const uint8_t r2_mf_back_digit_alaw_waves[15][R2_MF_TX_PERIOD] =
+{
+    {   /* 1 */
+        0xD5, 0xB7, 0xBD, 0x89, 0x1D, 0x30, 0x33, 0x05, 0x83, 0xB3, 0xB7, 0xE5, 0x08, 0x31, 0x0C, 0xE2,
+        0x8B, 0xB5, 0x99, 0x1D, 0x09, 0x02, 0x66, 0x99, 0x80, 0x9E, 0x45, 0x12, 0x1D, 0x61, 0xF6, 0xE1,
+        0xF3, 0xD6, 0xD8, 0xFA, 0xE6, 0xD1, 0x6A, 0x1F, 0x17, 0xFB, 0x84, 0x81, 0x94, 0x12, 0x0E, 0x0D,
+        0x65, 0x83, 0xB4, 0x8D, 0x66, 0x35, 0x31, 0x06, 0x85, 0xB0, 0xB1, 0x91, 0x09, 0x3D, 0x34, 0xC2,
+        0xB6, 0xBD, 0x8E, 0x1E, 0x33, 0x33, 0x1B, 0x8D, 0xB2, 0xB7, 0xFD, 0x35, 0x33, 0x0E, 0x95, 0xB7,
+        0xB6, 0x9A, 0x1A, 0x34, 0x08, 0x61, 0x86, 0x89, 0x87, 0x77, 0x07, 0x01, 0x14, 0xE3, 0x9F, 0x91,
+        0xF7, 0x7A, 0x67, 0x4E, 0xD5, 0x4E, 0x67, 0x7A, 0xF7, 0x91, 0x9F, 0xE3, 0x14, 0x01, 0x07, 0x77,
+        0x87, 0x89, 0x86, 0x61, 0x08, 0x34, 0x05, 0x9B, 0xB6, 0xB7, 0x95, 0x0E, 0x33, 0x35, 0xF2, 0xB7,
+        0xB2, 0x8C, 0x1B, 0x33, 0x33, 0x19, 0x8F, 0xBD, 0xB6, 0xCC, 0x34, 0x3D, 0x09, 0x91, 0xB1, 0xB0,
+        0x85, 0x06, 0x31, 0x35, 0x66, 0x8D, 0xB4, 0x83, 0x7A, 0x0D, 0x0E, 0x12, 0x94, 0x81, 0x84, 0xFA,
+        0x17, 0x1F, 0x6A, 0xD1, 0xE6, 0xFA, 0xD8, 0xD6, 0xF3, 0xE1, 0xF6, 0x61, 0x1D, 0x12, 0x44, 0x9E,
+        0x80, 0x99, 0x66, 0x02, 0x09, 0x1C, 0x99, 0xB5, 0x8B, 0xED, 0x0C, 0x31, 0x08, 0xE5, 0xB7, 0xB3,
+        0x83, 0x05, 0x33, 0x30, 0x1D, 0x8E, 0xBD, 0xB7, 0xD7, 0x37, 0x3D, 0x09, 0x9D, 0xB0, 0xB3, 0x85,
+        0x03, 0x33, 0x37, 0x65, 0x88, 0xB1, 0x8C, 0x62, 0x0B, 0x35, 0x19, 0x9D, 0x89, 0x82, 0xE6, 0x19,
+        0x00, 0x1E, 0xC5, 0x92, 0x9D, 0xE1, 0x76, 0x61, 0x73, 0x56, 0x58, 0x7A, 0x66, 0x51, 0xEA, 0x9F,
+        0x97, 0x7B, 0x04, 0x01, 0x14, 0x92, 0x8E, 0x8D, 0xE5, 0x03, 0x34, 0x0D, 0xE6, 0xB5, 0xB1, 0x86,
+        0x05, 0x30, 0x31, 0x11, 0x89, 0xBD, 0xB4, 0x42, 0x36, 0x3D, 0x0E, 0x9E, 0xB3, 0xB3, 0x9B, 0x0D,
+        0x32, 0x37, 0x7D, 0xB5, 0xB3, 0x8E, 0x15, 0x37, 0x36, 0x1A, 0x9A, 0xB4, 0x88, 0xE1, 0x06, 0x09,
+        0x07, 0xF7, 0x87, 0x81, 0x94, 0x63, 0x1F, 0x11, 0x77, 0xFA, 0xE7, 0xCE, 0xD5, 0xCE, 0xE7, 0xFA,
+        0x77, 0x11, 0x1F, 0x63, 0x94, 0x81, 0x87, 0xF7, 0x07, 0x09, 0x06, 0xE1, 0x88, 0xB4, 0x85, 0x1B,
+        0x36, 0x37, 0x15, 0x8E, 0xB3, 0xB5, 0x72, 0x37, 0x32, 0x0C, 0x9B, 0xB3, 0xB3, 0x99, 0x0F, 0x3D,
+        0x36, 0x4C, 0xB4, 0xBD, 0x89, 0x11, 0x31, 0x30, 0x05, 0x86, 0xB1, 0xB5, 0xE6, 0x0D, 0x34, 0x03,
+        0xFA, 0x8D, 0x8E, 0x92, 0x14, 0x01, 0x04, 0x7A, 0x97, 0x9F, 0xEA, 0x56, 0x66, 0x7A, 0x58, 0x56,
+        0x73, 0x61, 0x76, 0xE1, 0x9D, 0x92, 0xC4, 0x1E, 0x00, 0x19, 0xE6, 0x82, 0x89, 0x9C, 0x19, 0x35,
+        0x0B, 0x6D, 0x8C, 0xB1, 0x88, 0x65, 0x37, 0x33, 0x03, 0x85, 0xB3, 0xB0, 0x9D, 0x0E, 0x3D, 0x37
+    },
+    {   /* 2 */
+        0xD5, 0xB4, 0xBD, 0xB5, 0x73, 0x35, 0x30, 0x0D, 0xE7, 0x8F, 0x88, 0x98, 0x7A, 0x19, 0x1D, 0x65,
+        0xD9, 0x43, 0x6D, 0x61, 0xE6, 0x84, 0x83, 0x92, 0x12, 0x35, 0x34, 0x18, 0x87, 0xB0, 0xB0, 0x99,
+        0x02, 0x3D, 0x30, 0x12, 0x8F, 0xB2, 0xB7, 0xEB, 0x02, 0x37, 0x0E, 0x7E, 0x84, 0x83, 0x9E, 0xDF,
+        0x6C, 0x67, 0xD5, 0x55, 0x6E, 0x1E, 0x1D, 0xC9, 0x81, 0x8B, 0x80, 0x61, 0x35, 0x30, 0x0C, 0x96,
+        0xB1, 0xBD, 0x8C, 0x1F, 0x30, 0x32, 0x00, 0x98, 0xB6, 0xB6, 0x9B, 0x1F, 0x08, 0x0C, 0x15, 0x94,
+        0x98, 0x96, 0xC9, 0x59, 0xFD, 0xEE, 0xF0, 0x17, 0x01, 0x01, 0x67, 0x86, 0xB7, 0x8A, 0xE5, 0x09,
+        0x32, 0x34, 0x4C, 0xB4, 0xBC, 0xB4, 0x43, 0x34, 0x32, 0x08, 0xFA, 0x8B, 0xB7, 0x81, 0x67, 0x01,
+        0x01, 0x17, 0xF0, 0xEF, 0xFD, 0x59, 0xC9, 0x96, 0x98, 0x94, 0x15, 0x0C, 0x08, 0x1E, 0x9B, 0xB6,
+        0xB6, 0x9B, 0x00, 0x32, 0x30, 0x1F, 0x8C, 0xBD, 0xB1, 0x96, 0x0C, 0x30, 0x35, 0x60, 0x80, 0x8B,
+        0x81, 0xC8, 0x1D, 0x1E, 0x6E, 0x54, 0xD5, 0x67, 0x6C, 0xDF, 0x9E, 0x83, 0x84, 0x7F, 0x0E, 0x37,
+        0x02, 0xE8, 0xB7, 0xB2, 0x8F, 0x13, 0x30, 0x3D, 0x0D, 0x99, 0xB0, 0xB0, 0x87, 0x18, 0x34, 0x35,
+        0x12, 0x92, 0x83, 0x84, 0xE6, 0x61, 0x6D, 0x43, 0xD9, 0x65, 0x1D, 0x19, 0x65, 0x98, 0x88, 0x8F,
+        0xE7, 0x0D, 0x30, 0x34, 0x7D, 0xB5, 0xBD, 0xB4, 0xD7, 0x34, 0x3D, 0x35, 0xF3, 0xB5, 0xB0, 0x8D,
+        0x67, 0x0F, 0x08, 0x18, 0xFA, 0x99, 0x9D, 0xE5, 0x59, 0xC3, 0xED, 0xE1, 0x66, 0x04, 0x03, 0x12,
+        0x92, 0xB5, 0xB4, 0x98, 0x07, 0x30, 0x30, 0x19, 0x82, 0xBD, 0xB0, 0x92, 0x0F, 0x32, 0x37, 0x6B,
+        0x82, 0xB7, 0x8E, 0xFE, 0x04, 0x03, 0x1E, 0x5F, 0xEC, 0xE7, 0xD5, 0xD4, 0xEE, 0x9E, 0x9D, 0x4E,
+        0x01, 0x0B, 0x00, 0xE1, 0xB5, 0xB0, 0x8C, 0x16, 0x31, 0x3D, 0x0C, 0x9F, 0xB0, 0xB2, 0x80, 0x18,
+        0x36, 0x36, 0x1B, 0x9F, 0x88, 0x8C, 0x95, 0x14, 0x18, 0x16, 0x49, 0xD9, 0x7D, 0x6F, 0x70, 0x97,
+        0x81, 0x81, 0xE7, 0x06, 0x37, 0x0A, 0x65, 0x89, 0xB2, 0xB4, 0xCC, 0x34, 0x3C, 0x34, 0xC2, 0xB4,
+        0xB2, 0x88, 0x7A, 0x0B, 0x37, 0x06, 0xE7, 0x81, 0x81, 0x97, 0x70, 0x6F, 0x7D, 0xD9, 0x49, 0x16,
+        0x18, 0x14, 0x95, 0x8C, 0x88, 0x9E, 0x1B, 0x36, 0x36, 0x1B, 0x80, 0xB2, 0xB0, 0x9F, 0x0C, 0x3D,
+        0x31, 0x16, 0x8C, 0xB0, 0xB5, 0xE0, 0x00, 0x0B, 0x01, 0x48, 0x9D, 0x9E, 0xEE, 0xD4, 0xD5, 0xE7,
+        0xEC, 0x5F, 0x1E, 0x03, 0x04, 0xFF, 0x8E, 0xB7, 0x82, 0x68, 0x37, 0x32, 0x0F, 0x93, 0xB0, 0xBD,
+        0x8D, 0x19, 0x30, 0x30, 0x07, 0x98, 0xB4, 0xB5, 0x92, 0x12, 0x03, 0x04, 0x66, 0xE1, 0xED, 0xC3,
+        0x59, 0xE5, 0x9D, 0x99, 0xE5, 0x18, 0x08, 0x0F, 0x67, 0x8D, 0xB0, 0xB4, 0xFD, 0x35, 0x3D, 0x34
+    },
+    {   /* 3 */
+        0xD5, 0xB4, 0xBD, 0xB6, 0xEC, 0x09, 0x32, 0x31, 0x12, 0x83, 0xB0, 0xB6, 0x9A, 0x1B, 0x34, 0x37,
+        0x04, 0x94, 0x89, 0x8B, 0x84, 0x7E, 0x06, 0x02, 0x18, 0x55, 0x92, 0x98, 0x96, 0xC1, 0x67, 0x60,
+        0x70, 0x56, 0x59, 0x7B, 0x63, 0x7C, 0xE5, 0x92, 0x98, 0x94, 0x66, 0x07, 0x02, 0x1A, 0xF9, 0x82,
+        0x8A, 0x82, 0xD4, 0x0C, 0x36, 0x0B, 0x60, 0x8C, 0xB0, 0xB6, 0x92, 0x03, 0x33, 0x30, 0x07, 0x87,
+        0xB3, 0xB2, 0x8D, 0x1D, 0x30, 0x3D, 0x08, 0xED, 0xB7, 0xB2, 0xB5, 0xD7, 0x0A, 0x33, 0x35, 0x60,
+        0x82, 0xB6, 0x8A, 0x97, 0x05, 0x0B, 0x0E, 0x10, 0x96, 0x83, 0x80, 0x91, 0x67, 0x1E, 0x1E, 0x6E,
+        0xC7, 0xE0, 0xE6, 0xCF, 0xD5, 0xCF, 0xE6, 0xE0, 0xC6, 0x6E, 0x1E, 0x1E, 0x67, 0x96, 0x80, 0x83,
+        0x96, 0x10, 0x0E, 0x0A, 0x05, 0x94, 0x8A, 0xB6, 0x82, 0x61, 0x35, 0x33, 0x0A, 0x57, 0xB5, 0xB2,
+        0xB7, 0xED, 0x08, 0x3D, 0x30, 0x1C, 0x8D, 0xB2, 0xB3, 0x87, 0x07, 0x30, 0x33, 0x03, 0x93, 0xB6,
+        0xB0, 0x8C, 0x61, 0x0B, 0x36, 0x0C, 0x54, 0x82, 0x8A, 0x82, 0xF9, 0x1B, 0x02, 0x07, 0x61, 0x94,
+        0x98, 0x9D, 0xE5, 0x7C, 0x63, 0x78, 0x59, 0x56, 0x70, 0x60, 0x67, 0xC1, 0x96, 0x98, 0x92, 0xD5,
+        0x18, 0x02, 0x06, 0x79, 0x84, 0x8B, 0x89, 0x94, 0x04, 0x37, 0x34, 0x1B, 0x9A, 0xB6, 0xB0, 0x83,
+        0x12, 0x31, 0x32, 0x09, 0xED, 0xB6, 0xBD, 0xB4, 0xD7, 0x34, 0x3D, 0x36, 0x6C, 0x89, 0xB2, 0xB1,
+        0x92, 0x03, 0x30, 0x36, 0x1A, 0x9B, 0xB4, 0xB7, 0x84, 0x14, 0x09, 0x0B, 0x04, 0xFE, 0x86, 0x82,
+        0x98, 0xD5, 0x12, 0x18, 0x16, 0x41, 0xE7, 0xE0, 0xF0, 0xD6, 0xD9, 0xFB, 0xE3, 0xFC, 0x65, 0x12,
+        0x18, 0x14, 0xE6, 0x87, 0x82, 0x9A, 0x7E, 0x02, 0x0A, 0x02, 0x54, 0x8C, 0xB6, 0x8B, 0xE0, 0x0C,
+        0x30, 0x36, 0x12, 0x83, 0xB3, 0xB0, 0x87, 0x07, 0x33, 0x32, 0x0D, 0x9D, 0xB0, 0xBD, 0x88, 0x6D,
+        0x37, 0x32, 0x35, 0x57, 0x8A, 0xB3, 0xB5, 0xE0, 0x02, 0x36, 0x0A, 0x17, 0x85, 0x8B, 0x8E, 0x90,
+        0x16, 0x03, 0x00, 0x11, 0xE7, 0x9E, 0x9E, 0xEE, 0x47, 0x60, 0x66, 0x4F, 0xD5, 0x4F, 0x66, 0x60,
+        0x46, 0xEE, 0x9E, 0x9E, 0xE7, 0x16, 0x00, 0x03, 0x16, 0x90, 0x8E, 0x8A, 0x85, 0x14, 0x0A, 0x36,
+        0x02, 0xE1, 0xB5, 0xB3, 0x8A, 0xD7, 0x35, 0x32, 0x37, 0x6D, 0x88, 0xBD, 0xB0, 0x9C, 0x0D, 0x32,
+        0x33, 0x07, 0x87, 0xB0, 0xB3, 0x83, 0x13, 0x36, 0x30, 0x0C, 0xE1, 0x8B, 0xB6, 0x8C, 0xD4, 0x02,
+        0x0A, 0x02, 0x79, 0x9B, 0x82, 0x87, 0xE1, 0x14, 0x18, 0x12, 0x65, 0xFC, 0xE3, 0xF8, 0xD9, 0xD6,
+        0xF0, 0xE0, 0xE7, 0x41, 0x16, 0x18, 0x12, 0x55, 0x98, 0x82, 0x86, 0xF9, 0x04, 0x0B, 0x09, 0x14,
+        0x84, 0xB7, 0xB4, 0x9B, 0x1A, 0x36, 0x30, 0x03, 0x92, 0xB1, 0xB2, 0x89, 0x6D, 0x36, 0x3D, 0x34
+    },
+    {   /* 4 */
+        0xD5, 0xB5, 0xBD, 0xB4, 0xE0, 0x03, 0x35, 0x02, 0x60, 0xE9, 0xE8, 0xDE, 0x77, 0xE6, 0x87, 0x8D,
+        0x9A, 0x17, 0x34, 0x33, 0x09, 0xED, 0xB6, 0xBD, 0xB5, 0xD7, 0x08, 0x36, 0x0F, 0x78, 0x9F, 0x9A,
+        0xEA, 0xDC, 0xF7, 0x93, 0x85, 0x97, 0x13, 0x35, 0x36, 0x00, 0x92, 0xB1, 0xBD, 0x88, 0x6D, 0x37,
+        0x30, 0x0E, 0x54, 0x81, 0x8D, 0x9E, 0xC3, 0x77, 0xFD, 0x94, 0xE4, 0x13, 0x09, 0x0A, 0x18, 0x9A,
+        0xB0, 0xB2, 0x8D, 0x1D, 0x31, 0x32, 0x0F, 0xE1, 0x89, 0x8A, 0x84, 0xD5, 0x14, 0x63, 0xC6, 0xC4,
+        0x17, 0x00, 0x02, 0x15, 0x87, 0xB1, 0xB1, 0x84, 0x07, 0x33, 0x32, 0x02, 0x93, 0xB4, 0xB7, 0x86,
+        0x7F, 0x1A, 0x1E, 0x66, 0xD5, 0x66, 0x1E, 0x1A, 0x7E, 0x86, 0xB7, 0xB4, 0x93, 0x02, 0x32, 0x33,
+        0x07, 0x84, 0xB1, 0xB1, 0x87, 0x15, 0x02, 0x00, 0x17, 0xC4, 0xC7, 0x63, 0x14, 0x55, 0x84, 0x8A,
+        0x89, 0xE1, 0x0F, 0x32, 0x31, 0x1C, 0x8D, 0xB2, 0xB0, 0x85, 0x18, 0x0A, 0x09, 0x13, 0xE5, 0x94,
+        0xFD, 0x77, 0xC0, 0x9E, 0x8D, 0x81, 0xD4, 0x0E, 0x30, 0x37, 0x6D, 0x88, 0xBD, 0xB1, 0x92, 0x00,
+        0x36, 0x35, 0x13, 0x97, 0x85, 0x93, 0xF7, 0xDC, 0xEA, 0x9A, 0x9F, 0x79, 0x0F, 0x36, 0x08, 0x57,
+        0xB5, 0xBD, 0xB6, 0xEC, 0x09, 0x33, 0x34, 0x17, 0x9B, 0x8D, 0x87, 0xE6, 0x77, 0xDE, 0xE8, 0xE9,
+        0x60, 0x02, 0x35, 0x03, 0xE0, 0xB4, 0xBD, 0xB4, 0xD7, 0x35, 0x3D, 0x34, 0x60, 0x83, 0xB5, 0x82,
+        0xE0, 0x69, 0x68, 0x5E, 0xF7, 0x66, 0x07, 0x0D, 0x1B, 0x97, 0xB4, 0xB3, 0x89, 0x6D, 0x36, 0x3D,
+        0x35, 0x57, 0x88, 0xB6, 0x8F, 0xF8, 0x1F, 0x1A, 0x6A, 0x5C, 0x77, 0x13, 0x05, 0x17, 0x93, 0xB5,
+        0xB6, 0x80, 0x12, 0x31, 0x3D, 0x08, 0xED, 0xB7, 0xB0, 0x8E, 0xD4, 0x01, 0x0D, 0x1E, 0x43, 0xF7,
+        0x7D, 0x14, 0x64, 0x93, 0x89, 0x8A, 0x98, 0x1A, 0x30, 0x32, 0x0D, 0x9D, 0xB1, 0xB2, 0x8F, 0x61,
+        0x09, 0x0A, 0x04, 0x55, 0x94, 0xE3, 0x47, 0x44, 0x97, 0x80, 0x82, 0x95, 0x07, 0x31, 0x31, 0x04,
+        0x87, 0xB3, 0xB2, 0x82, 0x13, 0x34, 0x37, 0x06, 0xFF, 0x9A, 0x9E, 0xE6, 0xD5, 0xE6, 0x9E, 0x9A,
+        0xFE, 0x06, 0x37, 0x34, 0x13, 0x82, 0xB2, 0xB3, 0x87, 0x04, 0x31, 0x31, 0x07, 0x95, 0x82, 0x80,
+        0x97, 0x44, 0x47, 0xE3, 0x94, 0xD5, 0x04, 0x0A, 0x09, 0x61, 0x8F, 0xB2, 0xB1, 0x9C, 0x0D, 0x32,
+        0x30, 0x05, 0x98, 0x8A, 0x89, 0x93, 0x65, 0x14, 0x7D, 0xF7, 0x40, 0x1E, 0x0D, 0x01, 0x54, 0x8E,
+        0xB0, 0xB7, 0xED, 0x08, 0x3D, 0x31, 0x12, 0x80, 0xB6, 0xB5, 0x93, 0x17, 0x05, 0x13, 0x77, 0x5C,
+        0x6A, 0x1A, 0x1F, 0xF9, 0x8F, 0xB6, 0x88, 0xD7, 0x35, 0x3D, 0x36, 0x6C, 0x89, 0xB3, 0xB4, 0x97,
+        0x1B, 0x0D, 0x07, 0x66, 0xF7, 0x5E, 0x68, 0x69, 0xE0, 0x82, 0xB5, 0x83, 0x60, 0x34, 0x3D, 0x34
+    },
+    {   /* 5 */
+        0xD5, 0xB5, 0xBD, 0xB1, 0x98, 0x04, 0x37, 0x36, 0x00, 0xF1, 0x81, 0x8C, 0x84, 0xE5, 0x63, 0x68,
+        0x7D, 0xD8, 0x5A, 0x15, 0x1A, 0x1B, 0x7B, 0x98, 0x8B, 0xB5, 0x84, 0x16, 0x34, 0x33, 0x35, 0x7A,
+        0x88, 0xBD, 0xB3, 0x86, 0x18, 0x31, 0x33, 0x09, 0x55, 0x8D, 0xB5, 0x8F, 0x95, 0x14, 0x05, 0x1E,
+        0x63, 0xD0, 0xD5, 0x66, 0x6B, 0x7F, 0x95, 0x80, 0x8C, 0x85, 0x60, 0x09, 0x31, 0x35, 0x69, 0x8D,
+        0xB2, 0xB3, 0x83, 0x12, 0x31, 0x3D, 0x35, 0x78, 0x8C, 0xB1, 0xB4, 0x9E, 0x16, 0x0D, 0x02, 0x1C,
+        0x55, 0xE9, 0xED, 0xC3, 0x5A, 0xFD, 0x93, 0x85, 0x9C, 0x4A, 0x01, 0x35, 0x08, 0x17, 0x86, 0xB1,
+        0xB3, 0x8C, 0x6B, 0x37, 0x3C, 0x36, 0x6A, 0x8C, 0xB3, 0xB1, 0x86, 0x17, 0x08, 0x35, 0x01, 0x75,
+        0x9C, 0x85, 0x93, 0xFD, 0x5A, 0xC3, 0xED, 0xE9, 0xD5, 0x1C, 0x02, 0x0D, 0x16, 0x9F, 0xB4, 0xB1,
+        0x8C, 0x79, 0x35, 0x3D, 0x31, 0x12, 0x83, 0xB3, 0xB2, 0x8D, 0x69, 0x35, 0x31, 0x09, 0x60, 0x85,
+        0x8C, 0x80, 0x95, 0x7C, 0x6B, 0x66, 0xD5, 0xD3, 0x63, 0x1E, 0x05, 0x14, 0x95, 0x8F, 0xB5, 0x8D,
+        0xD5, 0x09, 0x33, 0x31, 0x1B, 0x87, 0xB3, 0xBD, 0x88, 0x7B, 0x35, 0x33, 0x34, 0x16, 0x84, 0xB5,
+        0x8B, 0x98, 0x7B, 0x1B, 0x1A, 0x15, 0x5A, 0xD8, 0x7D, 0x68, 0x63, 0xFA, 0x84, 0x8C, 0x81, 0xF0,
+        0x00, 0x36, 0x37, 0x04, 0x99, 0xB1, 0xBD, 0xB5, 0xD7, 0x35, 0x3D, 0x31, 0x18, 0x84, 0xB7, 0xB6,
+        0x80, 0x71, 0x01, 0x0C, 0x04, 0x65, 0xE3, 0xE8, 0xFD, 0x58, 0xDA, 0x95, 0x9A, 0x9B, 0xFB, 0x18,
+        0x0B, 0x35, 0x04, 0x96, 0xB4, 0xB3, 0xB5, 0xFA, 0x08, 0x3D, 0x33, 0x06, 0x98, 0xB1, 0xB3, 0x89,
+        0xD5, 0x0D, 0x35, 0x0F, 0x15, 0x94, 0x85, 0x9E, 0xE3, 0x50, 0xD5, 0xE6, 0xEB, 0xFF, 0x15, 0x00,
+        0x0C, 0x05, 0xE0, 0x89, 0xB1, 0xB5, 0xE9, 0x0D, 0x32, 0x33, 0x03, 0x92, 0xB1, 0xBD, 0xB5, 0xF8,
+        0x0C, 0x31, 0x34, 0x1E, 0x96, 0x8D, 0x82, 0x9C, 0xD5, 0x69, 0x6D, 0x43, 0xDA, 0x7D, 0x13, 0x05,
+        0x1C, 0xCA, 0x81, 0xB5, 0x88, 0x97, 0x06, 0x31, 0x33, 0x0C, 0xEB, 0xB7, 0xBC, 0xB6, 0xEA, 0x0C,
+        0x33, 0x31, 0x06, 0x97, 0x88, 0xB5, 0x81, 0xF5, 0x1C, 0x05, 0x13, 0x7D, 0xDA, 0x43, 0x6D, 0x69,
+        0x55, 0x9C, 0x82, 0x8D, 0x96, 0x1F, 0x34, 0x31, 0x0C, 0xF9, 0xB5, 0xBD, 0xB1, 0x92, 0x03, 0x33,
+        0x32, 0x0D, 0xE9, 0xB5, 0xB1, 0x89, 0xE0, 0x05, 0x0C, 0x00, 0x15, 0xFC, 0xEB, 0xE6, 0xD5, 0x53,
+        0xE3, 0x9E, 0x85, 0x94, 0x15, 0x0F, 0x35, 0x0D, 0x55, 0x89, 0xB3, 0xB1, 0x9B, 0x07, 0x33, 0x3D,
+        0x08, 0xFB, 0xB5, 0xB3, 0xB4, 0x96, 0x04, 0x35, 0x0B, 0x18, 0xFB, 0x9B, 0x9A, 0x95, 0xC5, 0x58,
+        0xFD, 0xE8, 0xE3, 0x7A, 0x04, 0x0C, 0x01, 0x70, 0x80, 0xB6, 0xB7, 0x84, 0x19, 0x31, 0x3D, 0x35
+    },
+    {   /* 6 */
+        0xD5, 0x8B, 0xBD, 0xB3, 0x82, 0x6B, 0x34, 0x32, 0x36, 0x1A, 0x9E, 0xB7, 0xB0, 0x8B, 0xEB, 0x04,
+        0x35, 0x34, 0x00, 0x45, 0x84, 0x8F, 0x82, 0x92, 0x70, 0x1E, 0x05, 0x1C, 0x67, 0xF3, 0xEC, 0xE3,
+        0xF6, 0xD7, 0xDF, 0xFE, 0xED, 0xE3, 0xDE, 0x68, 0x18, 0x05, 0x10, 0xF5, 0x85, 0x8C, 0x8D, 0x9D,
+        0x6A, 0x0F, 0x34, 0x08, 0x16, 0x9A, 0xB7, 0xB0, 0x8B, 0xE4, 0x0D, 0x33, 0x33, 0x0E, 0xFD, 0xB5,
+        0xBD, 0xB3, 0x80, 0x10, 0x36, 0x3D, 0x31, 0x1E, 0x84, 0xB1, 0xB2, 0xB5, 0xE2, 0x03, 0x31, 0x31,
+        0x02, 0xC6, 0x82, 0xB4, 0x8A, 0x98, 0x63, 0x00, 0x0F, 0x01, 0x69, 0xEE, 0x9A, 0x85, 0x91, 0xC8,
+        0x67, 0x6C, 0x67, 0x42, 0xD5, 0x42, 0x67, 0x6C, 0x67, 0xC9, 0x91, 0x85, 0x9A, 0xE9, 0x6E, 0x01,
+        0x0F, 0x00, 0x62, 0x98, 0x8A, 0xB4, 0x8D, 0xC0, 0x02, 0x31, 0x31, 0x03, 0xE3, 0xB5, 0xB2, 0xB1,
+        0x84, 0x1E, 0x31, 0x3D, 0x36, 0x13, 0x80, 0xB3, 0xBD, 0xB5, 0xFC, 0x0E, 0x33, 0x33, 0x0D, 0xE5,
+        0x8B, 0xB0, 0xB7, 0x85, 0x16, 0x08, 0x34, 0x0F, 0x15, 0x92, 0x8D, 0x8C, 0x85, 0xF4, 0x10, 0x05,
+        0x18, 0x68, 0xDF, 0xE3, 0xED, 0xF9, 0xDF, 0xD7, 0xF6, 0xE3, 0xEC, 0xF3, 0x67, 0x1C, 0x05, 0x1E,
+        0x70, 0x92, 0x82, 0x8F, 0x84, 0x5A, 0x00, 0x34, 0x35, 0x04, 0xE8, 0x8B, 0xB0, 0xB7, 0x9E, 0x1B,
+        0x36, 0x32, 0x34, 0x6A, 0x82, 0xB3, 0xBD, 0x8B, 0xD7, 0x0B, 0x3D, 0x33, 0x02, 0xEB, 0xB4, 0xB2,
+        0xB6, 0x9A, 0x1E, 0x37, 0x30, 0x0B, 0x6B, 0x84, 0xB5, 0xB4, 0x80, 0xC5, 0x04, 0x0F, 0x02, 0x12,
+        0xF0, 0x9E, 0x85, 0x9C, 0xE7, 0x73, 0x6C, 0x63, 0x76, 0x57, 0x5F, 0x7E, 0x6D, 0x63, 0x5E, 0xE8,
+        0x98, 0x85, 0x90, 0x75, 0x05, 0x0C, 0x0D, 0x1D, 0xEA, 0x8F, 0xB4, 0x88, 0x96, 0x1A, 0x37, 0x30,
+        0x0B, 0x64, 0x8D, 0xB3, 0xB3, 0x8E, 0x7D, 0x35, 0x3D, 0x33, 0x00, 0x90, 0xB6, 0xBD, 0xB1, 0x9E,
+        0x04, 0x31, 0x32, 0x35, 0x62, 0x83, 0xB1, 0xB1, 0x82, 0x46, 0x02, 0x34, 0x0A, 0x18, 0xE3, 0x80,
+        0x8F, 0x81, 0xE9, 0x6E, 0x1A, 0x05, 0x11, 0x48, 0xE7, 0xEC, 0xE7, 0xC2, 0xD5, 0xC2, 0xE7, 0xEC,
+        0xE7, 0x49, 0x11, 0x05, 0x1A, 0x69, 0xEE, 0x81, 0x8F, 0x80, 0xE2, 0x18, 0x0A, 0x34, 0x0D, 0x40,
+        0x82, 0xB1, 0xB1, 0x83, 0x63, 0x35, 0x32, 0x31, 0x04, 0x9E, 0xB1, 0xBD, 0xB6, 0x93, 0x00, 0x33,
+        0x3D, 0x35, 0x7C, 0x8E, 0xB3, 0xB3, 0x8D, 0x65, 0x0B, 0x30, 0x37, 0x05, 0x96, 0x88, 0xB4, 0x8F,
+        0x95, 0x12, 0x0D, 0x0C, 0x05, 0x74, 0x90, 0x85, 0x98, 0xE8, 0x5F, 0x63, 0x6D, 0x79, 0x5F, 0x57,
+        0x76, 0x63, 0x6C, 0x73, 0xE7, 0x9C, 0x85, 0x9E, 0xF0, 0x12, 0x02, 0x0F, 0x04, 0xDA, 0x80, 0xB4,
+        0xB5, 0x84, 0x68, 0x0B, 0x30, 0x37, 0x1E, 0x9B, 0xB6, 0xB2, 0xB4, 0xEA, 0x02, 0x33, 0x3D, 0x0B
+    },
+    {   /* 7 */
+        0xD5, 0x8A, 0xB2, 0xB7, 0x93, 0x13, 0x06, 0x1D, 0x48, 0x52, 0x10, 0x0D, 0x0C, 0x17, 0x86, 0xB3,
+        0xB2, 0x8F, 0x6B, 0x34, 0x31, 0x0F, 0x65, 0x96, 0x94, 0xD4, 0x64, 0xE4, 0x80, 0xB4, 0x89, 0xF8,
+        0x09, 0x3D, 0x33, 0x07, 0x9E, 0xB5, 0x8A, 0x9A, 0xD5, 0x65, 0xFD, 0x90, 0xEF, 0x13, 0x35, 0x31,
+        0x0E, 0xFB, 0xB4, 0xBD, 0xB7, 0x96, 0x05, 0x0E, 0x01, 0x6F, 0xD2, 0x66, 0x1A, 0x07, 0x61, 0x81,
+        0xB1, 0xB3, 0x83, 0x12, 0x36, 0x33, 0x09, 0x70, 0x9A, 0x87, 0x95, 0xD5, 0xF2, 0x9A, 0x8F, 0x83,
+        0xD5, 0x08, 0x3D, 0x30, 0x1B, 0x87, 0xB6, 0xB7, 0x87, 0x48, 0x10, 0x6C, 0xF1, 0xF2, 0x16, 0x0E,
+        0x34, 0x03, 0xE8, 0xB7, 0xBC, 0xB7, 0xE8, 0x03, 0x34, 0x0E, 0x16, 0xF2, 0xF1, 0x6C, 0x13, 0x4B,
+        0x87, 0xB7, 0xB6, 0x87, 0x1B, 0x30, 0x3D, 0x08, 0x55, 0x83, 0x8F, 0x9A, 0xF2, 0x55, 0x95, 0x87,
+        0x9A, 0x70, 0x09, 0x33, 0x36, 0x12, 0x83, 0xB3, 0xB1, 0x81, 0x66, 0x07, 0x1A, 0x66, 0xD2, 0x6F,
+        0x01, 0x0E, 0x05, 0x96, 0xB7, 0xBD, 0xB4, 0xE5, 0x0E, 0x31, 0x35, 0x13, 0xEF, 0x90, 0xFD, 0x65,
+        0x55, 0x9A, 0x8A, 0xB5, 0x9E, 0x07, 0x33, 0x3D, 0x09, 0xFE, 0x89, 0xB4, 0x80, 0xE4, 0x64, 0x54,
+        0x94, 0x96, 0x65, 0x0F, 0x31, 0x34, 0x6B, 0x8F, 0xB2, 0xB3, 0x81, 0x14, 0x0C, 0x0D, 0x13, 0x52,
+        0x48, 0x1D, 0x06, 0x13, 0x93, 0xB7, 0xB2, 0xB5, 0xD4, 0x0A, 0x32, 0x37, 0x13, 0x93, 0x86, 0x9D,
+        0xC8, 0xD2, 0x90, 0x8D, 0x8C, 0x97, 0x06, 0x33, 0x32, 0x0F, 0xEB, 0xB4, 0xB1, 0x8F, 0xE5, 0x16,
+        0x14, 0x54, 0xE4, 0x64, 0x00, 0x34, 0x09, 0x79, 0x89, 0xBD, 0xB3, 0x87, 0x1E, 0x35, 0x0A, 0x1A,
+        0x55, 0xE5, 0x7D, 0x10, 0x6F, 0x93, 0xB5, 0xB1, 0x8E, 0x7B, 0x34, 0x3D, 0x37, 0x16, 0x85, 0x8E,
+        0x81, 0xEF, 0x52, 0xE6, 0x9A, 0x87, 0xE1, 0x01, 0x31, 0x33, 0x03, 0x92, 0xB6, 0xB3, 0x89, 0xF0,
+        0x1A, 0x07, 0x15, 0x55, 0x72, 0x1A, 0x0F, 0x03, 0x55, 0x88, 0xBD, 0xB0, 0x9B, 0x07, 0x36, 0x37,
+        0x07, 0xC8, 0x90, 0xEC, 0x71, 0x72, 0x96, 0x8E, 0xB4, 0x83, 0x68, 0x37, 0x3C, 0x37, 0x68, 0x83,
+        0xB4, 0x8E, 0x96, 0x72, 0x71, 0xEC, 0x93, 0xCB, 0x07, 0x37, 0x36, 0x07, 0x9B, 0xB0, 0xBD, 0x88,
+        0xD5, 0x03, 0x0F, 0x1A, 0x72, 0xD5, 0x15, 0x07, 0x1A, 0xF0, 0x89, 0xB3, 0xB6, 0x92, 0x03, 0x33,
+        0x31, 0x01, 0xE6, 0x87, 0x9A, 0xE6, 0x52, 0xEF, 0x81, 0x8E, 0x85, 0x16, 0x37, 0x3D, 0x34, 0x65,
+        0x8E, 0xB1, 0xB5, 0x93, 0x6F, 0x10, 0x7D, 0xE5, 0xD5, 0x1A, 0x0A, 0x35, 0x1E, 0x87, 0xB3, 0xBD,
+        0x89, 0x7E, 0x09, 0x34, 0x00, 0x64, 0xE4, 0xD4, 0x14, 0x16, 0xE5, 0x8F, 0xB1, 0xB4, 0xEB, 0x0F,
+        0x32, 0x33, 0x01, 0x97, 0x8C, 0x8D, 0x93, 0xDD, 0xC8, 0x9D, 0x86, 0x93, 0x13, 0x37, 0x32, 0x35
+    },
+    {   /* 8 */
+        0xD5, 0x8B, 0xB2, 0xB0, 0x81, 0x62, 0x0D, 0x0E, 0x07, 0x61, 0xF6, 0xDF, 0x6C, 0x16, 0x7B, 0x92,
+        0x89, 0xB7, 0x8F, 0xC2, 0x09, 0x32, 0x32, 0x0C, 0xED, 0xB5, 0xB0, 0xB5, 0x9C, 0x6A, 0x07, 0x05,
+        0x68, 0x5D, 0x75, 0x11, 0x07, 0x05, 0x4A, 0x81, 0xB6, 0xB1, 0x8C, 0x67, 0x34, 0x3D, 0x30, 0x07,
+        0x90, 0x8A, 0xB4, 0x82, 0xED, 0x69, 0x16, 0x7A, 0xF4, 0xDA, 0x17, 0x03, 0x09, 0x06, 0xF6, 0x89,
+        0xB3, 0xB0, 0x80, 0x10, 0x36, 0x32, 0x37, 0x12, 0x9F, 0x8E, 0x8C, 0x9E, 0xCC, 0x73, 0xCD, 0x95,
+        0x97, 0x5F, 0x04, 0x35, 0x34, 0x06, 0x94, 0xB7, 0xBD, 0xB1, 0x9B, 0x05, 0x36, 0x31, 0x0E, 0x61,
+        0x9C, 0x86, 0x9E, 0xE4, 0xD5, 0xE4, 0x9E, 0x86, 0x9F, 0x61, 0x0E, 0x31, 0x36, 0x05, 0x9B, 0xB1,
+        0xBD, 0xB7, 0x94, 0x06, 0x34, 0x35, 0x07, 0x5E, 0x97, 0x95, 0xCD, 0x73, 0xCD, 0x9E, 0x8C, 0x8E,
+        0x9E, 0x13, 0x37, 0x32, 0x36, 0x13, 0x80, 0xB0, 0xB3, 0x89, 0xF1, 0x06, 0x09, 0x03, 0x17, 0xDA,
+        0xF4, 0x7A, 0x16, 0x69, 0xE2, 0x82, 0xB4, 0x8A, 0x93, 0x07, 0x30, 0x3D, 0x34, 0x67, 0x8C, 0xB1,
+        0xB6, 0x81, 0x4B, 0x05, 0x07, 0x11, 0x75, 0x5D, 0x68, 0x05, 0x07, 0x15, 0x9C, 0xB5, 0xB0, 0xB5,
+        0xED, 0x0C, 0x32, 0x32, 0x09, 0xC0, 0x8F, 0xB7, 0x89, 0x92, 0x78, 0x16, 0x6C, 0xDF, 0xF6, 0x66,
+        0x07, 0x0E, 0x0D, 0x6D, 0x81, 0xB0, 0xB2, 0x8B, 0xD4, 0x0B, 0x32, 0x30, 0x01, 0xE2, 0x8D, 0x8E,
+        0x87, 0xE1, 0x76, 0x5F, 0xEC, 0x96, 0xFB, 0x12, 0x09, 0x37, 0x0F, 0x42, 0x89, 0xB2, 0xB2, 0x8C,
+        0x6D, 0x35, 0x30, 0x35, 0x1C, 0x95, 0x87, 0x85, 0xE8, 0xDD, 0xF5, 0x91, 0x87, 0x85, 0xCA, 0x01,
+        0x36, 0x31, 0x0C, 0xE7, 0xB4, 0xBD, 0xB0, 0x87, 0x10, 0x0A, 0x34, 0x02, 0x6D, 0xE9, 0x96, 0xFA,
+        0x74, 0x5A, 0x97, 0x83, 0x89, 0x86, 0x76, 0x09, 0x33, 0x30, 0x00, 0x90, 0xB6, 0xB2, 0xB7, 0x92,
+        0x1F, 0x0E, 0x0C, 0x1E, 0x4C, 0xF3, 0x4D, 0x15, 0x17, 0xDF, 0x84, 0xB5, 0xB4, 0x86, 0x14, 0x37,
+        0x3D, 0x31, 0x1B, 0x85, 0xB6, 0xB1, 0x8E, 0xE1, 0x1C, 0x06, 0x1E, 0x64, 0xD5, 0x64, 0x1E, 0x06,
+        0x1F, 0xE1, 0x8E, 0xB1, 0xB6, 0x85, 0x1B, 0x31, 0x3D, 0x37, 0x14, 0x86, 0xB4, 0xB5, 0x87, 0xDE,
+        0x17, 0x15, 0x4D, 0xF3, 0x4D, 0x1E, 0x0C, 0x0E, 0x1E, 0x93, 0xB7, 0xB2, 0xB6, 0x93, 0x00, 0x30,
+        0x33, 0x09, 0x71, 0x86, 0x89, 0x83, 0x97, 0x5A, 0x74, 0xFA, 0x96, 0xE9, 0x62, 0x02, 0x34, 0x0A,
+        0x13, 0x87, 0xB0, 0xBD, 0xB4, 0xE7, 0x0C, 0x31, 0x36, 0x01, 0xCB, 0x85, 0x87, 0x91, 0xF5, 0xDD,
+        0xE8, 0x85, 0x87, 0x95, 0x1C, 0x35, 0x30, 0x35, 0x6D, 0x8C, 0xB2, 0xB2, 0x89, 0x41, 0x0F, 0x37,
+        0x09, 0x12, 0xF8, 0x96, 0xEC, 0x5F, 0x76, 0xE6, 0x87, 0x8E, 0x8D, 0xED, 0x01, 0x31, 0x32, 0x0B
+    },
+    {   /* 9 */
+        0xD5, 0x89, 0xB2, 0xB2, 0x88, 0xF8, 0x00, 0x37, 0x34, 0x02, 0x67, 0x93, 0x87, 0x85, 0x97, 0xC8,
+        0x47, 0xC1, 0xEC, 0x94, 0xE6, 0x62, 0x06, 0x09, 0x0E, 0x1E, 0x95, 0x8B, 0xB0, 0xB1, 0x80, 0x6E,
+        0x34, 0x3D, 0x32, 0x0F, 0xF2, 0x88, 0xB0, 0xB1, 0x82, 0xDF, 0x06, 0x09, 0x0F, 0x18, 0x49, 0xEE,
+        0x94, 0xE7, 0xD5, 0x58, 0xFA, 0x9D, 0x87, 0x84, 0xEF, 0x10, 0x09, 0x37, 0x35, 0x19, 0x9C, 0xB7,
+        0xBD, 0xB0, 0x86, 0x11, 0x37, 0x3D, 0x30, 0x00, 0xE0, 0x8E, 0xB7, 0xB5, 0x84, 0x41, 0x18, 0x06,
+        0x18, 0x6F, 0x56, 0xD8, 0x72, 0x6B, 0x15, 0x4B, 0x91, 0x83, 0x88, 0x82, 0xEE, 0x05, 0x37, 0x33,
+        0x37, 0x1C, 0x85, 0xB1, 0xBC, 0xB1, 0x85, 0x1C, 0x34, 0x33, 0x37, 0x05, 0xEE, 0x82, 0x88, 0x83,
+        0x91, 0x48, 0x15, 0x6B, 0x72, 0xD8, 0x56, 0x6F, 0x18, 0x06, 0x18, 0x40, 0x84, 0xB5, 0xB7, 0x89,
+        0xE3, 0x00, 0x30, 0x3D, 0x37, 0x11, 0x86, 0xB0, 0xBD, 0xB7, 0x9C, 0x1E, 0x35, 0x37, 0x09, 0x10,
+        0xEF, 0x84, 0x87, 0x9D, 0xE5, 0x59, 0x55, 0xE7, 0x94, 0xEE, 0x4E, 0x18, 0x0F, 0x09, 0x06, 0xDD,
+        0x82, 0xB1, 0xB0, 0x88, 0xFC, 0x0C, 0x32, 0x3D, 0x34, 0x6E, 0x80, 0xB1, 0xB0, 0x8B, 0x95, 0x1E,
+        0x0F, 0x09, 0x06, 0x62, 0xE6, 0x94, 0xEC, 0xC1, 0x47, 0xC9, 0x97, 0x85, 0x87, 0x93, 0x67, 0x02,
+        0x34, 0x37, 0x00, 0xFE, 0x88, 0xB2, 0xB2, 0x89, 0xD4, 0x09, 0x32, 0x32, 0x08, 0x78, 0x80, 0xB7,
+        0xB4, 0x82, 0xE7, 0x13, 0x07, 0x05, 0x17, 0x48, 0xC7, 0x41, 0x6C, 0x14, 0x66, 0xE2, 0x86, 0x89,
+        0x8E, 0x9E, 0x15, 0x0B, 0x30, 0x31, 0x00, 0xEE, 0xB4, 0xBD, 0xB2, 0x8F, 0x72, 0x08, 0x30, 0x31,
+        0x02, 0x5F, 0x86, 0x89, 0x8F, 0x98, 0xC9, 0x6E, 0x14, 0x67, 0x55, 0xD8, 0x7A, 0x1D, 0x07, 0x04,
+        0x6F, 0x90, 0x89, 0xB7, 0xB5, 0x99, 0x1C, 0x37, 0x3D, 0x30, 0x06, 0x91, 0xB7, 0xBD, 0xB0, 0x80,
+        0x60, 0x0E, 0x37, 0x35, 0x04, 0xC1, 0x98, 0x86, 0x98, 0xEF, 0xD6, 0x58, 0xF2, 0xEB, 0x95, 0xCB,
+        0x11, 0x03, 0x08, 0x02, 0x6E, 0x85, 0xB7, 0xB3, 0xB7, 0x9C, 0x05, 0x31, 0x3C, 0x31, 0x05, 0x9C,
+        0xB4, 0xB3, 0xB7, 0x85, 0x6E, 0x02, 0x08, 0x03, 0x11, 0xC8, 0x95, 0xEB, 0xF2, 0x58, 0xD6, 0xEF,
+        0x98, 0x86, 0x98, 0xC0, 0x04, 0x35, 0x37, 0x09, 0x63, 0x80, 0xB0, 0xBD, 0xB7, 0x91, 0x06, 0x30,
+        0x3D, 0x37, 0x1C, 0x9E, 0xB5, 0xB7, 0x89, 0x90, 0x6F, 0x04, 0x07, 0x1D, 0x65, 0xD8, 0xD5, 0x67,
+        0x14, 0x6E, 0xCE, 0x98, 0x8F, 0x89, 0x86, 0x5D, 0x02, 0x31, 0x30, 0x08, 0x7C, 0x8C, 0xB2, 0xBD,
+        0xB4, 0xEE, 0x00, 0x31, 0x30, 0x0B, 0x15, 0x9E, 0x8F, 0x89, 0x86, 0xE2, 0x66, 0x14, 0x6C, 0x41,
+        0xC7, 0x49, 0x17, 0x05, 0x07, 0x13, 0xE7, 0x82, 0xB4, 0xB7, 0x80, 0x7E, 0x08, 0x32, 0x32, 0x09
+    },
+    {   /* 0 */
+        0xD5, 0x8F, 0xB3, 0xBD, 0xB6, 0x9B, 0x12, 0x34, 0x33, 0x30, 0x0F, 0x73, 0x81, 0xB7, 0xB6, 0x8B,
+        0x9E, 0x6F, 0x03, 0x0B, 0x09, 0x04, 0x7F, 0x91, 0x87, 0x86, 0x99, 0xEC, 0x4D, 0x6C, 0x68, 0x60,
+        0x74, 0x57, 0x5C, 0x7C, 0x6C, 0x6B, 0x60, 0xD8, 0x97, 0x85, 0x86, 0x85, 0xED, 0x15, 0x00, 0x08,
+        0x09, 0x07, 0x55, 0x86, 0xB4, 0xB6, 0xB5, 0x9F, 0x10, 0x35, 0x33, 0x30, 0x09, 0x7D, 0x82, 0xB0,
+        0xBD, 0xB1, 0x87, 0x17, 0x34, 0x3D, 0x32, 0x0A, 0x6D, 0x81, 0xB6, 0xB2, 0xB6, 0x87, 0x60, 0x0F,
+        0x36, 0x37, 0x0C, 0x6E, 0x9C, 0x8F, 0x8B, 0x8C, 0x9F, 0x4D, 0x1F, 0x06, 0x07, 0x12, 0x79, 0xF9,
+        0xE8, 0xE9, 0xE4, 0xC1, 0xD5, 0xC1, 0xE4, 0xE9, 0xE8, 0xF8, 0x7E, 0x12, 0x07, 0x06, 0x1F, 0x4C,
+        0x9C, 0x8C, 0x8B, 0x8F, 0x9C, 0x6F, 0x0C, 0x37, 0x36, 0x0F, 0x60, 0x87, 0xB6, 0xB2, 0xB6, 0x81,
+        0x6D, 0x0A, 0x32, 0x3D, 0x34, 0x17, 0x87, 0xB1, 0xBD, 0xB0, 0x82, 0x72, 0x09, 0x30, 0x33, 0x35,
+        0x13, 0x9F, 0xB5, 0xB6, 0xB4, 0x86, 0xD5, 0x07, 0x09, 0x08, 0x00, 0x15, 0xE2, 0x85, 0x86, 0x85,
+        0x97, 0xD8, 0x60, 0x6B, 0x6C, 0x7C, 0x5C, 0x57, 0x74, 0x60, 0x68, 0x6C, 0x4C, 0xEC, 0x99, 0x86,
+        0x87, 0x91, 0x7C, 0x04, 0x09, 0x0B, 0x03, 0x6F, 0x9F, 0x8B, 0xB6, 0xB7, 0x81, 0x70, 0x0F, 0x30,
+        0x33, 0x34, 0x1D, 0x9B, 0xB6, 0xBD, 0xB3, 0x8F, 0xD4, 0x0F, 0x33, 0x3D, 0x36, 0x1B, 0x92, 0xB4,
+        0xB3, 0xB0, 0x8F, 0xF3, 0x01, 0x37, 0x36, 0x0B, 0x1E, 0xEF, 0x83, 0x8B, 0x89, 0x84, 0xFF, 0x11,
+        0x07, 0x06, 0x19, 0x6C, 0xCD, 0xEC, 0xE8, 0xE0, 0xF4, 0xD7, 0xDC, 0xFC, 0xEC, 0xEB, 0xE0, 0x59,
+        0x17, 0x05, 0x06, 0x05, 0x6D, 0x95, 0x80, 0x88, 0x89, 0x87, 0xD5, 0x06, 0x34, 0x36, 0x35, 0x1F,
+        0x90, 0xB5, 0xB3, 0xB0, 0x89, 0xFD, 0x02, 0x30, 0x3D, 0x31, 0x07, 0x97, 0xB4, 0xBD, 0xB2, 0x8A,
+        0xED, 0x01, 0x36, 0x32, 0x36, 0x07, 0xE0, 0x8F, 0xB6, 0xB7, 0x8C, 0xEE, 0x1C, 0x0F, 0x0B, 0x0C,
+        0x1F, 0xCD, 0x9F, 0x86, 0x87, 0x92, 0xF9, 0x79, 0x68, 0x69, 0x64, 0x41, 0xD5, 0x41, 0x64, 0x69,
+        0x68, 0x78, 0xFE, 0x92, 0x87, 0x86, 0x9F, 0xCC, 0x1C, 0x0C, 0x0B, 0x0F, 0x1C, 0xEF, 0x8C, 0xB7,
+        0xB6, 0x8F, 0xE0, 0x07, 0x36, 0x32, 0x36, 0x01, 0xED, 0x8A, 0xB2, 0xBD, 0xB4, 0x96, 0x07, 0x31,
+        0x3D, 0x30, 0x02, 0xF2, 0x89, 0xB0, 0xB3, 0xB5, 0x93, 0x1F, 0x35, 0x36, 0x34, 0x06, 0x55, 0x87,
+        0x89, 0x88, 0x80, 0x95, 0x62, 0x05, 0x06, 0x05, 0x17, 0x58, 0xE0, 0xEB, 0xEC, 0xFC, 0xDC, 0xD7,
+        0xF4, 0xE0, 0xE8, 0xEC, 0xCC, 0x6C, 0x19, 0x06, 0x07, 0x11, 0xFC, 0x84, 0x89, 0x8B, 0x83, 0xEF,
+        0x1F, 0x0B, 0x36, 0x37, 0x01, 0xF0, 0x8F, 0xB0, 0xB3, 0xB4, 0x9D, 0x1B, 0x36, 0x3D, 0x33, 0x0F
+    },
+    {   /* B */
+        0xD5, 0x88, 0xB0, 0xB4, 0x99, 0x72, 0x63, 0xFA, 0x9F, 0x94, 0x10, 0x34, 0x32, 0x37, 0x17, 0x80,
+        0xB7, 0x8A, 0x98, 0xD3, 0xD5, 0x93, 0x80, 0x85, 0x61, 0x35, 0x3D, 0x30, 0x04, 0x92, 0x89, 0x8F,
+        0x9D, 0xD8, 0xFF, 0x84, 0x88, 0x8C, 0xF2, 0x0E, 0x32, 0x32, 0x0D, 0xF9, 0x81, 0x87, 0xEE, 0x4D,
+        0xFB, 0x81, 0xB4, 0xB5, 0x92, 0x06, 0x30, 0x33, 0x0E, 0x7C, 0x9D, 0x93, 0xD5, 0x6F, 0xC3, 0x80,
+        0xB6, 0xB1, 0x80, 0x10, 0x37, 0x30, 0x09, 0x68, 0xE3, 0xFE, 0x6A, 0x1E, 0x78, 0x86, 0xB1, 0xB2,
+        0x88, 0x42, 0x09, 0x37, 0x0F, 0x14, 0xC2, 0x72, 0x1B, 0x00, 0x13, 0x99, 0xB1, 0xBD, 0xB7, 0xE8,
+        0x06, 0x08, 0x03, 0x69, 0xD5, 0x69, 0x03, 0x08, 0x06, 0xE9, 0xB7, 0xBD, 0xB1, 0x98, 0x10, 0x00,
+        0x1B, 0x7D, 0xC2, 0x14, 0x0F, 0x37, 0x09, 0x4F, 0x88, 0xB2, 0xB1, 0x86, 0x78, 0x1E, 0x6A, 0xFE,
+        0xE2, 0x68, 0x09, 0x30, 0x37, 0x13, 0x80, 0xB1, 0xB6, 0x80, 0xC2, 0x6F, 0xD5, 0x93, 0x9D, 0x7D,
+        0x0E, 0x33, 0x30, 0x06, 0x92, 0xB5, 0xB4, 0x81, 0xFA, 0x4D, 0xEE, 0x87, 0x81, 0xF8, 0x02, 0x33,
+        0x32, 0x0E, 0xF0, 0x8C, 0x88, 0x84, 0xFF, 0xD8, 0x92, 0x8F, 0x89, 0x92, 0x04, 0x30, 0x3D, 0x35,
+        0x61, 0x85, 0x80, 0x93, 0xD5, 0xD0, 0x99, 0x8A, 0xB7, 0x80, 0x17, 0x37, 0x32, 0x34, 0x13, 0x94,
+        0x9F, 0xFA, 0x63, 0x7D, 0x99, 0xB4, 0xB0, 0x8B, 0xD4, 0x08, 0x30, 0x34, 0x19, 0xF2, 0xE3, 0x7A,
+        0x1F, 0x14, 0x90, 0xB4, 0xB2, 0xB7, 0x97, 0x00, 0x37, 0x0A, 0x18, 0x53, 0xD5, 0x13, 0x00, 0x05,
+        0xE1, 0xB5, 0xBD, 0xB0, 0x84, 0x12, 0x09, 0x0F, 0x12, 0x58, 0x7F, 0x04, 0x08, 0x0C, 0x72, 0x8E,
+        0xB2, 0xB2, 0x8D, 0x79, 0x01, 0x07, 0x6E, 0xCC, 0x7B, 0x01, 0x34, 0x35, 0x12, 0x86, 0xB0, 0xB3,
+        0x8E, 0xFC, 0x1D, 0x13, 0xD5, 0xEF, 0x43, 0x00, 0x36, 0x31, 0x00, 0x90, 0xB7, 0xB0, 0x89, 0xE8,
+        0x63, 0x7F, 0xEA, 0x9E, 0xF8, 0x06, 0x31, 0x32, 0x08, 0xC2, 0x89, 0xB7, 0x8F, 0x94, 0x42, 0xFD,
+        0x9B, 0x80, 0x93, 0x19, 0x31, 0x3D, 0x37, 0x68, 0x86, 0x88, 0x83, 0xE9, 0xD5, 0xE9, 0x83, 0x88,
+        0x86, 0x69, 0x37, 0x3D, 0x31, 0x18, 0x90, 0x80, 0x9B, 0xFD, 0x42, 0x94, 0x8F, 0xB7, 0x89, 0xCF,
+        0x08, 0x32, 0x31, 0x06, 0xF8, 0x9E, 0xEA, 0x7E, 0x63, 0xE8, 0x89, 0xB0, 0xB7, 0x93, 0x00, 0x31,
+        0x36, 0x00, 0x42, 0xEF, 0xD5, 0x13, 0x1D, 0xFD, 0x8E, 0xB3, 0xB0, 0x86, 0x12, 0x35, 0x34, 0x01,
+        0x7A, 0xCD, 0x6E, 0x07, 0x01, 0x78, 0x82, 0xB3, 0xB2, 0x8E, 0x70, 0x0C, 0x08, 0x04, 0x7F, 0x58,
+        0x12, 0x0F, 0x09, 0x12, 0x84, 0xB0, 0xBD, 0xB5, 0xE1, 0x05, 0x00, 0x13, 0xD5, 0x50, 0x19, 0x0A,
+        0x37, 0x00, 0x97, 0xB7, 0xB2, 0xB4, 0x93, 0x14, 0x1F, 0x7A, 0xE3, 0xFD, 0x19, 0x34, 0x30, 0x0B
+    },
+    {   /* C */
+        0xD5, 0x89, 0xB0, 0xB1, 0x82, 0xF7, 0x10, 0x13, 0x7D, 0xE4, 0xF6, 0x10, 0x09, 0x36, 0x35, 0x13,
+        0x87, 0xB1, 0xBD, 0xB7, 0x9C, 0x11, 0x00, 0x07, 0x6A, 0x55, 0x75, 0x1E, 0x0F, 0x0B, 0x07, 0xEC,
+        0xB5, 0xBD, 0xB3, 0x8C, 0x70, 0x0D, 0x0B, 0x03, 0x17, 0x54, 0x49, 0x12, 0x01, 0x06, 0x7E, 0x81,
+        0xB0, 0xBD, 0xB4, 0x94, 0x06, 0x37, 0x37, 0x03, 0x60, 0xE4, 0xF1, 0x6C, 0x1C, 0x6A, 0x94, 0x8B,
+        0xB0, 0xB1, 0x86, 0x11, 0x34, 0x33, 0x37, 0x05, 0xFF, 0x9D, 0x97, 0xD4, 0x61, 0xD8, 0x85, 0xB5,
+        0xB6, 0x8E, 0xCF, 0x0E, 0x32, 0x32, 0x08, 0x64, 0x9B, 0x80, 0x9B, 0xE7, 0x5C, 0xE1, 0x87, 0x88,
+        0x89, 0x93, 0x1A, 0x31, 0x3C, 0x31, 0x1A, 0x93, 0x89, 0x88, 0x87, 0xE1, 0x5C, 0xE7, 0x9B, 0x80,
+        0x9A, 0x65, 0x08, 0x32, 0x32, 0x0E, 0xC2, 0x8E, 0xB6, 0xB5, 0x85, 0xDB, 0x61, 0x54, 0x97, 0x9D,
+        0xFE, 0x05, 0x37, 0x33, 0x34, 0x11, 0x86, 0xB1, 0xB0, 0x8B, 0x94, 0x6A, 0x1C, 0x6C, 0xF1, 0xE4,
+        0x60, 0x03, 0x37, 0x37, 0x06, 0x95, 0xB4, 0xBD, 0xB0, 0x80, 0x7F, 0x06, 0x01, 0x12, 0x49, 0x54,
+        0x17, 0x03, 0x0B, 0x0D, 0x73, 0x8D, 0xB3, 0xBD, 0xB5, 0xEC, 0x07, 0x0B, 0x0F, 0x1E, 0x75, 0xD5,
+        0x6A, 0x07, 0x00, 0x11, 0x9C, 0xB7, 0xBD, 0xB0, 0x87, 0x13, 0x35, 0x36, 0x09, 0x10, 0xF6, 0xE4,
+        0x7D, 0x13, 0x10, 0xF7, 0x82, 0xB1, 0xB0, 0x89, 0xD4, 0x09, 0x30, 0x31, 0x02, 0x77, 0x90, 0x93,
+        0xFD, 0x64, 0x76, 0x90, 0x89, 0xB6, 0xB5, 0x93, 0x07, 0x31, 0x3D, 0x37, 0x1C, 0x91, 0x80, 0x87,
+        0xEA, 0xD5, 0xF5, 0x9E, 0x8F, 0x8B, 0x87, 0x6C, 0x35, 0x3D, 0x33, 0x0C, 0xF0, 0x8D, 0x8B, 0x83,
+        0x97, 0xD4, 0xC9, 0x92, 0x81, 0x86, 0xFE, 0x01, 0x30, 0x3D, 0x34, 0x14, 0x86, 0xB7, 0xB7, 0x83,
+        0xE0, 0x64, 0x71, 0xEC, 0x9C, 0xEA, 0x14, 0x0B, 0x30, 0x31, 0x06, 0x91, 0xB4, 0xB3, 0xB7, 0x85,
+        0x7F, 0x1D, 0x17, 0x54, 0xE1, 0x58, 0x05, 0x35, 0x36, 0x0E, 0x4F, 0x8E, 0xB2, 0xB2, 0x88, 0xE4,
+        0x1B, 0x00, 0x1B, 0x67, 0xDC, 0x61, 0x07, 0x08, 0x09, 0x13, 0x9A, 0xB1, 0xBC, 0xB1, 0x9A, 0x13,
+        0x09, 0x08, 0x07, 0x61, 0xDC, 0x67, 0x1B, 0x00, 0x1B, 0xE5, 0x88, 0xB2, 0xB2, 0x8E, 0x42, 0x0E,
+        0x36, 0x35, 0x05, 0x5B, 0xE1, 0xD4, 0x17, 0x1D, 0x7E, 0x85, 0xB7, 0xB3, 0xB4, 0x91, 0x06, 0x31,
+        0x30, 0x0B, 0x14, 0xEA, 0x9C, 0xEC, 0x71, 0x64, 0xE0, 0x83, 0xB7, 0xB7, 0x86, 0x15, 0x34, 0x3D,
+        0x30, 0x00, 0xFF, 0x86, 0x81, 0x92, 0xC9, 0xD4, 0x97, 0x83, 0x8B, 0x8D, 0xF3, 0x0D, 0x33, 0x3D,
+        0x35, 0x6C, 0x87, 0x8B, 0x8F, 0x9E, 0xF5, 0x55, 0xEA, 0x87, 0x80, 0x91, 0x1C, 0x37, 0x3D, 0x30,
+        0x07, 0x93, 0xB5, 0xB6, 0x89, 0x90, 0x76, 0x64, 0xFD, 0x93, 0x90, 0x77, 0x02, 0x31, 0x30, 0x09
+    },
+    {   /* D */
+        0xD5, 0x8F, 0xB0, 0xB3, 0xB5, 0x92, 0x15, 0x01, 0x01, 0x1E, 0x67, 0x55, 0x7D, 0x12, 0x06, 0x00,
+        0x12, 0xEE, 0x89, 0xB0, 0xB3, 0x8A, 0xEC, 0x00, 0x31, 0x32, 0x37, 0x05, 0xE4, 0x87, 0x80, 0x9A,
+        0xEC, 0xD3, 0xCE, 0x97, 0x87, 0x80, 0x98, 0x74, 0x02, 0x31, 0x32, 0x34, 0x1C, 0x9B, 0xB7, 0xB2,
+        0xB6, 0x80, 0xD5, 0x05, 0x00, 0x04, 0x15, 0x46, 0x59, 0x68, 0x05, 0x00, 0x04, 0x74, 0x86, 0xB6,
+        0xB2, 0xB6, 0x87, 0x17, 0x35, 0x32, 0x30, 0x0F, 0x67, 0x9F, 0x80, 0x86, 0x90, 0xF7, 0xD6, 0xE3,
+        0x98, 0x80, 0x86, 0xEC, 0x19, 0x34, 0x32, 0x30, 0x0D, 0xFD, 0x88, 0xB3, 0xB3, 0x8B, 0x97, 0x11,
+        0x01, 0x01, 0x1C, 0x7B, 0xD5, 0x7B, 0x1C, 0x01, 0x01, 0x11, 0x97, 0x8B, 0xB3, 0xB3, 0x88, 0xFC,
+        0x02, 0x30, 0x32, 0x34, 0x19, 0xEC, 0x86, 0x80, 0x98, 0xE3, 0xD6, 0xF7, 0x90, 0x86, 0x80, 0x9F,
+        0x67, 0x0F, 0x30, 0x32, 0x35, 0x17, 0x87, 0xB6, 0xB2, 0xB6, 0x86, 0x74, 0x04, 0x00, 0x05, 0x68,
+        0x59, 0x46, 0x15, 0x04, 0x00, 0x05, 0x55, 0x80, 0xB6, 0xB2, 0xB7, 0x9A, 0x1D, 0x34, 0x32, 0x31,
+        0x02, 0x77, 0x98, 0x80, 0x87, 0x96, 0xCE, 0xD3, 0xEC, 0x9A, 0x80, 0x87, 0xE4, 0x05, 0x37, 0x32,
+        0x31, 0x00, 0xED, 0x8A, 0xB3, 0xB0, 0x89, 0xE9, 0x12, 0x00, 0x06, 0x12, 0x7D, 0x55, 0x67, 0x1E,
+        0x01, 0x01, 0x15, 0x92, 0xB5, 0xB3, 0xB0, 0x8F, 0xD4, 0x0F, 0x30, 0x33, 0x35, 0x12, 0x95, 0x81,
+        0x81, 0x9E, 0xE7, 0xD5, 0xFD, 0x92, 0x86, 0x80, 0x92, 0x6E, 0x09, 0x30, 0x33, 0x0A, 0x6C, 0x80,
+        0xB1, 0xB2, 0xB7, 0x85, 0x64, 0x07, 0x00, 0x1A, 0x6C, 0x53, 0x4E, 0x17, 0x07, 0x00, 0x18, 0xF4,
+        0x82, 0xB1, 0xB2, 0xB4, 0x9C, 0x1B, 0x37, 0x32, 0x36, 0x00, 0x55, 0x85, 0x80, 0x84, 0x95, 0xC6,
+        0xD9, 0xE8, 0x85, 0x80, 0x84, 0xF7, 0x06, 0x36, 0x32, 0x36, 0x07, 0x97, 0xB5, 0xB2, 0xB0, 0x8F,
+        0xE7, 0x1F, 0x00, 0x06, 0x10, 0x77, 0x56, 0x63, 0x18, 0x00, 0x06, 0x6C, 0x99, 0xB4, 0xB2, 0xB0,
+        0x8D, 0x7D, 0x08, 0x33, 0x33, 0x0B, 0x17, 0x91, 0x81, 0x81, 0x9C, 0xFB, 0xD5, 0xFB, 0x9C, 0x81,
+        0x81, 0x91, 0x17, 0x0B, 0x33, 0x33, 0x08, 0x7C, 0x82, 0xB0, 0xB2, 0xB4, 0x99, 0x6C, 0x06, 0x00,
+        0x18, 0x63, 0x56, 0x77, 0x10, 0x06, 0x00, 0x1F, 0xE7, 0x8F, 0xB0, 0xB2, 0xB5, 0x97, 0x07, 0x36,
+        0x32, 0x36, 0x06, 0xF4, 0x84, 0x80, 0x85, 0xE8, 0xD9, 0xC6, 0x95, 0x84, 0x80, 0x85, 0xD5, 0x00,
+        0x36, 0x32, 0x37, 0x1A, 0x9D, 0xB4, 0xB2, 0xB1, 0x82, 0xF7, 0x18, 0x00, 0x07, 0x16, 0x4E, 0x53,
+        0x6C, 0x1A, 0x00, 0x07, 0x64, 0x85, 0xB7, 0xB2, 0xB1, 0x80, 0x6D, 0x0A, 0x33, 0x30, 0x09, 0x69,
+        0x92, 0x80, 0x86, 0x92, 0xFD, 0xD5, 0xE7, 0x9E, 0x81, 0x81, 0x95, 0x12, 0x35, 0x33, 0x30, 0x0F
+    },
+    {   /* E */
+        0xD5, 0x8D, 0xB0, 0xBD, 0xB1, 0x82, 0xC0, 0x07, 0x0B, 0x35, 0x0F, 0x19, 0x40, 0xE8, 0x91, 0xEA,
+        0xF3, 0x5B, 0x5C, 0xE4, 0x9C, 0x86, 0x83, 0x85, 0xE5, 0x1E, 0x0B, 0x31, 0x31, 0x09, 0x6B, 0x84,
+        0xB6, 0xBD, 0xB2, 0xB5, 0x97, 0x1B, 0x34, 0x30, 0x36, 0x0C, 0x6B, 0x97, 0x86, 0x83, 0x84, 0x96,
+        0xF7, 0x46, 0x55, 0xE7, 0x97, 0x91, 0xE1, 0x60, 0x07, 0x08, 0x35, 0x0E, 0x1C, 0x94, 0x8B, 0xB3,
+        0xB2, 0xB7, 0x84, 0x14, 0x0A, 0x33, 0x32, 0x37, 0x05, 0xE2, 0x82, 0xB5, 0x8A, 0x83, 0x96, 0x74,
+        0x17, 0x16, 0x6C, 0x41, 0xC0, 0x5C, 0x69, 0x1B, 0x00, 0x00, 0x1F, 0xC2, 0x86, 0xB4, 0xB0, 0xB6,
+        0x83, 0x5F, 0x0C, 0x30, 0x3C, 0x30, 0x0C, 0x59, 0x83, 0xB6, 0xB0, 0xB4, 0x86, 0xCC, 0x1F, 0x00,
+        0x00, 0x1B, 0x69, 0x5C, 0xC0, 0x41, 0x6C, 0x16, 0x17, 0x74, 0x96, 0x83, 0x8A, 0xB5, 0x82, 0xE2,
+        0x05, 0x34, 0x32, 0x33, 0x0A, 0x14, 0x85, 0xB7, 0xB2, 0xB3, 0x8B, 0x94, 0x1C, 0x0E, 0x35, 0x08,
+        0x07, 0x60, 0xE1, 0x91, 0x97, 0xE7, 0xD5, 0x46, 0xF7, 0x96, 0x84, 0x83, 0x86, 0x97, 0x68, 0x0C,
+        0x36, 0x30, 0x34, 0x1B, 0x97, 0xB5, 0xB2, 0xBD, 0xB6, 0x84, 0x68, 0x09, 0x31, 0x31, 0x0B, 0x1E,
+        0xFA, 0x85, 0x83, 0x86, 0x9C, 0xE7, 0x5C, 0x5B, 0xF3, 0xEA, 0x91, 0xEB, 0x41, 0x19, 0x0F, 0x35,
+        0x0B, 0x07, 0xC6, 0x82, 0xB1, 0xBD, 0xB0, 0x8D, 0xD4, 0x0D, 0x30, 0x3D, 0x31, 0x02, 0x40, 0x87,
+        0x8B, 0xB5, 0x8F, 0x99, 0xC0, 0x68, 0x11, 0x6A, 0x73, 0xDB, 0xDC, 0x64, 0x1C, 0x06, 0x03, 0x05,
+        0x65, 0x9E, 0x8B, 0xB1, 0xB1, 0x89, 0xEB, 0x04, 0x36, 0x3D, 0x32, 0x35, 0x17, 0x9B, 0xB4, 0xB0,
+        0xB6, 0x8C, 0xEB, 0x17, 0x06, 0x03, 0x04, 0x16, 0x77, 0xC6, 0xD5, 0x67, 0x17, 0x11, 0x61, 0xE0,
+        0x87, 0x88, 0xB5, 0x8E, 0x9C, 0x14, 0x0B, 0x33, 0x32, 0x37, 0x04, 0x94, 0x8A, 0xB3, 0xB2, 0xB7,
+        0x85, 0x62, 0x02, 0x35, 0x0A, 0x03, 0x16, 0xF4, 0x97, 0x96, 0xEC, 0xC1, 0x40, 0xDC, 0xE9, 0x9B,
+        0x80, 0x80, 0x9F, 0x42, 0x06, 0x34, 0x30, 0x36, 0x03, 0xDF, 0x8C, 0xB0, 0xBC, 0xB0, 0x8C, 0xD8,
+        0x03, 0x36, 0x30, 0x34, 0x06, 0x4C, 0x9F, 0x80, 0x80, 0x9B, 0xE9, 0xDC, 0x40, 0xC1, 0xEC, 0x96,
+        0x97, 0xF4, 0x16, 0x03, 0x0A, 0x35, 0x02, 0x62, 0x85, 0xB4, 0xB2, 0xB3, 0x8A, 0x94, 0x05, 0x37,
+        0x32, 0x33, 0x0B, 0x14, 0x9C, 0x8E, 0xB5, 0x88, 0x87, 0xE0, 0x61, 0x11, 0x17, 0x67, 0x55, 0xC6,
+        0x77, 0x16, 0x04, 0x03, 0x06, 0x17, 0xE8, 0x8C, 0xB6, 0xB0, 0xB4, 0x9B, 0x17, 0x35, 0x32, 0x3D,
+        0x36, 0x04, 0xE8, 0x89, 0xB1, 0xB1, 0x8B, 0x9E, 0x7A, 0x05, 0x03, 0x06, 0x1C, 0x67, 0xDC, 0xDB,
+        0x73, 0x6A, 0x11, 0x6B, 0xC1, 0x99, 0x8F, 0xB5, 0x8B, 0x87, 0x46, 0x02, 0x31, 0x3D, 0x30, 0x0D
+    },
+    {   /* F */
+        0xD5, 0x83, 0xB1, 0xBD, 0xB2, 0xB4, 0x9B, 0x68, 0x0E, 0x31, 0x33, 0x36, 0x0C, 0x6C, 0x9D, 0x8F,
+        0xB4, 0xB4, 0x8F, 0x99, 0xD5, 0x1C, 0x01, 0x02, 0x01, 0x1E, 0x60, 0xF7, 0xE8, 0x97, 0xEA, 0xE6,
+        0xC8, 0xD4, 0xD2, 0xF3, 0xE2, 0x94, 0x94, 0xED, 0xD5, 0x15, 0x05, 0x00, 0x02, 0x07, 0x14, 0xE7,
+        0x87, 0x8B, 0xB4, 0xB5, 0x83, 0xEC, 0x1C, 0x0B, 0x31, 0x33, 0x37, 0x00, 0x54, 0x80, 0xB6, 0xBD,
+        0xB2, 0xB4, 0x9A, 0x6A, 0x08, 0x33, 0x3D, 0x30, 0x09, 0x6B, 0x98, 0xB5, 0xB0, 0xB0, 0xB4, 0x86,
+        0xD5, 0x04, 0x0B, 0x34, 0x35, 0x02, 0x16, 0xE4, 0x9A, 0x83, 0x83, 0x87, 0x90, 0xF1, 0x64, 0x15,
+        0x14, 0x6E, 0x7B, 0x45, 0xD5, 0x45, 0x7B, 0x6E, 0x14, 0x15, 0x64, 0xF1, 0x90, 0x87, 0x83, 0x83,
+        0x9A, 0xE7, 0x17, 0x02, 0x35, 0x34, 0x0B, 0x04, 0x55, 0x86, 0xB4, 0xB0, 0xB0, 0xB5, 0x98, 0x68,
+        0x09, 0x30, 0x3D, 0x33, 0x08, 0x6A, 0x9B, 0xB4, 0xB2, 0xBD, 0xB6, 0x83, 0xD4, 0x00, 0x37, 0x33,
+        0x31, 0x0B, 0x1C, 0xEC, 0x83, 0xB5, 0xB4, 0x8B, 0x87, 0xE6, 0x14, 0x07, 0x02, 0x00, 0x05, 0x15,
+        0x55, 0xE2, 0x94, 0x94, 0xE2, 0xF3, 0xD2, 0xD4, 0xC8, 0xE6, 0xEA, 0x97, 0xE8, 0xF7, 0x60, 0x1E,
+        0x01, 0x02, 0x01, 0x1C, 0x55, 0x99, 0x8F, 0xB4, 0xB4, 0x8E, 0x9D, 0x6C, 0x0D, 0x36, 0x33, 0x31,
+        0x0E, 0x68, 0x98, 0xB4, 0xB2, 0xBD, 0xB1, 0x83, 0xD5, 0x03, 0x31, 0x3D, 0x32, 0x34, 0x18, 0xE8,
+        0x8E, 0xB1, 0xB3, 0xB6, 0x8C, 0xEC, 0x1D, 0x0F, 0x34, 0x34, 0x0F, 0x19, 0x55, 0x9C, 0x81, 0x82,
+        0x81, 0x9E, 0xE0, 0x77, 0x68, 0x17, 0x6A, 0x66, 0x48, 0x54, 0x52, 0x73, 0x62, 0x14, 0x14, 0x6D,
+        0x55, 0x95, 0x85, 0x80, 0x82, 0x87, 0x94, 0x67, 0x07, 0x0B, 0x34, 0x35, 0x03, 0x6C, 0x9C, 0x8B,
+        0xB1, 0xB3, 0xB7, 0x80, 0xD4, 0x00, 0x36, 0x3D, 0x32, 0x34, 0x1A, 0xEA, 0x88, 0xB3, 0xBD, 0xB0,
+        0x89, 0xEB, 0x18, 0x35, 0x30, 0x30, 0x34, 0x06, 0x55, 0x84, 0x8B, 0xB4, 0xB5, 0x82, 0x96, 0x64,
+        0x1A, 0x03, 0x03, 0x07, 0x10, 0x71, 0xE4, 0x95, 0x94, 0xEE, 0xFB, 0xC5, 0xD5, 0xC5, 0xFB, 0xEE,
+        0x94, 0x95, 0xE4, 0x71, 0x10, 0x07, 0x03, 0x03, 0x1A, 0x67, 0x97, 0x82, 0xB5, 0xB4, 0x8B, 0x84,
+        0xD5, 0x06, 0x34, 0x30, 0x30, 0x35, 0x18, 0xE8, 0x89, 0xB0, 0xBD, 0xB3, 0x88, 0xEA, 0x1B, 0x34,
+        0x32, 0x3D, 0x36, 0x03, 0x54, 0x80, 0xB7, 0xB3, 0xB1, 0x8B, 0x9C, 0x6C, 0x03, 0x35, 0x34, 0x0B,
+        0x07, 0x66, 0x94, 0x87, 0x82, 0x80, 0x85, 0x95, 0xD5, 0x62, 0x14, 0x14, 0x62, 0x73, 0x52, 0x54,
+        0x48, 0x66, 0x6A, 0x17, 0x68, 0x77, 0xE0, 0x9E, 0x81, 0x82, 0x81, 0x9C, 0xD5, 0x19, 0x0F, 0x34,
+        0x34, 0x0E, 0x1D, 0xEC, 0x8D, 0xB6, 0xB3, 0xB1, 0x8E, 0xE8, 0x18, 0x34, 0x32, 0x3D, 0x31, 0x03
+    }
 };
 
-/* The order of the digits here must match the lists above */
+/* The order of the digits here must match the tables above */
 static const char r2_mf_tone_codes[] = "1234567890BCDEF";
 
 #define R2_MF_THRESHOLD             5.0e8f
 #define R2_MF_TWIST                 5.0f    /* 7dB */
 #define R2_MF_RELATIVE_PEAK         12.6f   /* 11dB */
-#define R2_MF_SAMPLES_PER_BLOCK     133
+#define R2_MF_SAMPLES_PER_BLOCK     OR2_MF_RX_BLOCK_SIZE
+#define R2_MF_SLIDING_HOP           (R2_MF_SAMPLES_PER_BLOCK/OR2_MF_RX_WINDOWS)
+/* Of the last OR2_MF_RX_VOTES windows, how many must see a digit before the
+   sliding mode takes it */
+#define R2_MF_SLIDING_VOTES         2
 
-static openr2_goertzel_descriptor_t mf_fwd_detect_desc[6];
-static openr2_goertzel_descriptor_t mf_back_detect_desc[6];
+/* The same limits for the fixed-point detector, ratios in tenths */
+#define R2_MF_THRESHOLD_FIXED       INT64_C(500000000)
+#define R2_MF_TWIST_X10             50
+#define R2_MF_RELATIVE_PEAK_X10     126
+/* No filter can take more than R2_MF_SAMPLES_PER_BLOCK times the block energy
+   out of a block, so blocks below this energy cannot reach the threshold.
+   There is a 4x margin for rounding in the filters. */
+#define R2_MF_GATE_ENERGY           (R2_MF_THRESHOLD_FIXED/(4*R2_MF_SAMPLES_PER_BLOCK))
+#define R2_MF_ALL_BINS              0x3F
+/* The two halves of a tone pair leave some energy to the rest of the block
+   even when clean, up to about 10% of the weakest tone with a 6dB twist */
+#define R2_MF_TRACK_RESIDUAL        0.25f
+#define R2_MF_TRACK_RESIDUAL_X100   25
 
-static const float r2_mf_fwd_frequencies[] =
+/* Goertzel descriptors for the forward and backward tones, over a
+   R2_MF_SAMPLES_PER_BLOCK block. fac is 2cos(2*pi*f/8000), printed by
+   r2tables */
+static const openr2_goertzel_descriptor_t mf_fwd_detect_desc[6] =
 {
-    1380.0f, 1500.0f, 1620.0f, 1740.0f, 1860.0f, 1980.0f
+    {0.93585968f, 133},    /* 1380Hz */
+    {0.765366852f, 133},    /* 1500Hz */
+    {0.588080585f, 133},    /* 1620Hz */
+    {0.405574679f, 133},    /* 1740Hz */
+    {0.219468623f, 133},    /* 1860Hz */
+    {0.031414561f, 133}     /* 1980Hz */
 };
 
-static const float r2_mf_back_frequencies[] =
+static const openr2_goertzel_descriptor_t mf_back_detect_desc[6] =
 {
-    1140.0f, 1020.0f,  900.0f,  780.0f,  660.0f,  540.0f
+    {1.2504853f, 133},    /* 1140Hz */
+    {1.39182568f, 133},    /* 1020Hz */
+    {1.52081192f, 133},    /*  900Hz */
+    {1.63629949f, 133},    /*  780Hz */
+    {1.73726296f, 133},    /*  660Hz */
+    {1.82280648f, 133}     /*  540Hz */
 };
 
 /* Use codes '1' to 'F' for the R2 signals 1 to 15, except for signal 'A'.
    Use '0' for this, so the codes match the digits 0-9. */
 static const char r2_mf_positions[] = "1247B-358C--69D---0E----F";
 
+/* openr2_alaw_to_linear() for every A-law code, as floats, so detectors
+   can be fed straight from the line without an int16 staging buffer */
+static const float alaw_to_float[256] =
+{
+    -5504.0f, -5248.0f, -6016.0f, -5760.0f, -4480.0f, -4224.0f, -4992.0f, -4736.0f,
+    -7552.0f, -7296.0f, -8064.0f, -7808.0f, -6528.0f, -6272.0f, -7040.0f, -6784.0f,
+    -2752.0f, -2624.0f, -3008.0f, -2880.0f, -2240.0f, -2112.0f, -2496.0f, -2368.0f,
+    -3776.0f, -3648.0f, -4032.0f, -3904.0f, -3264.0f, -3136.0f, -3520.0f, -3392.0f,
+    -22016.0f, -20992.0f, -24064.0f, -23040.0f, -17920.0f, -16896.0f, -19968.0f, -18944.0f,
+    -30208.0f, -29184.0f, -32256.0f, -31232.0f, -26112.0f, -25088.0f, -28160.0f, -27136.0f,
+    -11008.0f, -10496.0f, -12032.0f, -11520.0f, -8960.0f, -8448.0f, -9984.0f, -9472.0f,
+    -15104.0f, -14592.0f, -16128.0f, -15616.0f, -13056.0f, -12544.0f, -14080.0f, -13568.0f,
+    -344.0f, -328.0f, -376.0f, -360.0f, -280.0f, -264.0f, -312.0f, -296.0f,
+    -472.0f, -456.0f, -504.0f, -488.0f, -408.0f, -392.0f, -440.0f, -424.0f,
+    -88.0f, -72.0f, -120.0f, -104.0f, -24.0f, -8.0f, -56.0f, -40.0f,
+    -216.0f, -200.0f, -248.0f, -232.0f, -152.0f, -136.0f, -184.0f, -168.0f,
+    -1376.0f, -1312.0f, -1504.0f, -1440.0f, -1120.0f, -1056.0f, -1248.0f, -1184.0f,
+    -1888.0f, -1824.0f, -2016.0f, -1952.0f, -1632.0f, -1568.0f, -1760.0f, -1696.0f,
+    -688.0f, -656.0f, -752.0f, -720.0f, -560.0f, -528.0f, -624.0f, -592.0f,
+    -944.0f, -912.0f, -1008.0f, -976.0f, -816.0f, -784.0f, -880.0f, -848.0f,
+    5504.0f, 5248.0f, 6016.0f, 5760.0f, 4480.0f, 4224.0f, 4992.0f, 4736.0f,
+    7552.0f, 7296.0f, 8064.0f, 7808.0f, 6528.0f, 6272.0f, 7040.0f, 6784.0f,
+    2752.0f, 2624.0f, 3008.0f, 2880.0f, 2240.0f, 2112.0f, 2496.0f, 2368.0f,
+    3776.0f, 3648.0f, 4032.0f, 3904.0f, 3264.0f, 3136.0f, 3520.0f, 3392.0f,
+    22016.0f, 20992.0f, 24064.0f, 23040.0f, 17920.0f, 16896.0f, 19968.0f, 18944.0f,
+    30208.0f, 29184.0f, 32256.0f, 31232.0f, 26112.0f, 25088.0f, 28160.0f, 27136.0f,
+    11008.0f, 10496.0f, 12032.0f, 11520.0f, 8960.0f, 8448.0f, 9984.0f, 9472.0f,
+    15104.0f, 14592.0f, 16128.0f, 15616.0f, 13056.0f, 12544.0f, 14080.0f, 13568.0f,
+    344.0f, 328.0f, 376.0f, 360.0f, 280.0f, 264.0f, 312.0f, 296.0f,
+    472.0f, 456.0f, 504.0f, 488.0f, 408.0f, 392.0f, 440.0f, 424.0f,
+    88.0f, 72.0f, 120.0f, 104.0f, 24.0f, 8.0f, 56.0f, 40.0f,
+    216.0f, 200.0f, 248.0f, 232.0f, 152.0f, 136.0f, 184.0f, 168.0f,
+    1376.0f, 1312.0f, 1504.0f, 1440.0f, 1120.0f, 1056.0f, 1248.0f, 1184.0f,
+    1888.0f, 1824.0f, 2016.0f, 1952.0f, 1632.0f, 1568.0f, 1760.0f, 1696.0f,
+    688.0f, 656.0f, 752.0f, 720.0f, 560.0f, 528.0f, 624.0f, 592.0f,
+    944.0f, 912.0f, 1008.0f, 976.0f, 816.0f, 784.0f, 880.0f, 848.0f
+};
+
+static void alaw_to_linear_block_generic(int16_t linear[], const uint8_t alaw[], int samples)
+{
+    int i;
+
+    for (i = 0;  i < samples;  i++)
+        linear[i] = openr2_alaw_to_linear(alaw[i]);
+}
+
+static void linear_to_alaw_block_generic(uint8_t alaw[], const int16_t linear[], int samples)
+{
+    int i;
+
+    for (i = 0;  i < samples;  i++)
+        alaw[i] = openr2_linear_to_alaw(linear[i]);
+}
+
+#if defined(OR2_HAVE_X86_DISPATCH)
+/* 16 samples at a time, gathering them from alaw_to_float[] */
+__attribute__((target("avx2")))
+static void alaw_to_linear_block_avx2(int16_t linear[], const uint8_t alaw[], int samples)
+{
+    __m256i lo;
+    __m256i hi;
+    int i;
+
+    for (i = 0;  i + 16 <= samples;  i += 16)
+    {
+        lo = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (alaw + i)));
+        hi = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (alaw + i + 8)));
+        lo = _mm256_cvttps_epi32(_mm256_i32gather_ps(alaw_to_float, lo, 4));
+        hi = _mm256_cvttps_epi32(_mm256_i32gather_ps(alaw_to_float, hi, 4));
+        /* The pack works within each 128 bit lane, put the quads back in order */
+        lo = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256((__m256i *) (linear + i), lo);
+    }
+    alaw_to_linear_block_generic(linear + i, alaw + i, samples - i);
+}
+
+/* 16 samples at a time. The segment is the number of the thresholds
+   0x100, 0x200 ... 0x4000 the magnitude reaches, an int16_t never gets
+   past segment 7 so the out of range case of openr2_linear_to_alaw()
+   can not happen here */
+__attribute__((target("avx2")))
+static __m256i linear_to_alaw_avx2(__m256i linear)
+{
+    __m256i sign;
+    __m256i mag;
+    __m256i seg;
+    __m256i quant;
+    __m256i threshold;
+    int i;
+
+    /* -linear - 1 for negative samples, which is just ~linear */
+    sign = _mm256_srai_epi32(linear, 31);
+    mag = _mm256_xor_si256(linear, sign);
+    seg = _mm256_setzero_si256();
+    threshold = _mm256_set1_epi32(0xFF);
+    for (i = 0;  i < 7;  i++)
+    {
+        seg = _mm256_sub_epi32(seg, _mm256_cmpgt_epi32(mag, threshold));
+        threshold = _mm256_add_epi32(_mm256_add_epi32(threshold, threshold), _mm256_set1_epi32(1));
+    }
+    /* Shift by seg + 3, or by 4 for segment 0 */
+    quant = _mm256_srlv_epi32(mag, _mm256_add_epi32(_mm256_max_epi32(seg, _mm256_set1_epi32(1)), _mm256_set1_epi32(3)));
+    quant = _mm256_and_si256(quant, _mm256_set1_epi32(0x0F));
+    return _mm256_xor_si256(_mm256_or_si256(_mm256_slli_epi32(seg, 4), quant),
+                            _mm256_xor_si256(_mm256_set1_epi32(OR2_ALAW_AMI_MASK | 0x80), _mm256_and_si256(sign, _mm256_set1_epi32(0x80))));
+}
+
+__attribute__((target("avx2")))
+static void linear_to_alaw_block_avx2(uint8_t alaw[], const int16_t linear[], int samples)
+{
+    __m256i lo;
+    __m256i hi;
+    int i;
+
+    for (i = 0;  i + 16 <= samples;  i += 16)
+    {
+        lo = linear_to_alaw_avx2(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) (linear + i))));
+        hi = linear_to_alaw_avx2(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) (linear + i + 8))));
+        lo = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8);
+        _mm_storeu_si128((__m128i *) (alaw + i), _mm_packus_epi16(_mm256_castsi256_si128(lo), _mm256_extracti128_si256(lo, 1)));
+    }
+    linear_to_alaw_block_generic(alaw + i, linear + i, samples - i);
+}
+
+static void alaw_select_kernel(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        alaw_to_linear_block = alaw_to_linear_block_avx2;
+        linear_to_alaw_block = linear_to_alaw_block_avx2;
+    }
+}
+#endif
+
+OR2_DECLARE(void) openr2_alaw_to_linear_block(int16_t linear[], const uint8_t alaw[], int samples)
+{
+    alaw_to_linear_block(linear, alaw, samples);
+}
+
+OR2_DECLARE(void) openr2_linear_to_alaw_block(uint8_t alaw[], const int16_t linear[], int samples)
+{
+    linear_to_alaw_block(alaw, linear, samples);
+}
+
 OR2_DECLARE(int) openr2_mf_tx(openr2_mf_tx_state_t *s, int16_t amp[], int samples)
 {
     int len;
+    int i;
 
     if (s->digit == 0)
     {
-        len = samples;
-        memset(amp, 0, len*sizeof(int16_t));
+        memset(amp, 0, samples*sizeof(int16_t));
+        return samples;
     }
-    else
+    for (len = 0;  len < samples;  len += i)
     {
-        len = tone_gen(&s->tone, amp, samples);
+        i = R2_MF_TX_PERIOD - s->wave_position;
+        if (i > samples - len)
+            i = samples - len;
+        memcpy(amp + len, s->wave + s->wave_position, i*sizeof(int16_t));
+        s->wave_position += i;
+        if (s->wave_position >= R2_MF_TX_PERIOD)
+            s->wave_position = 0;
     }
-    return len;
+    return samples;
+}
+
+OR2_DECLARE(int) openr2_mf_tx_alaw(openr2_mf_tx_state_t *s, uint8_t alaw[], int samples)
+{
+    int len;
+    int i;
+
+    if (s->digit == 0)
+    {
+        /* A-law encoded silence */
+        memset(alaw, OR2_ALAW_AMI_MASK | 0x80, samples);
+        return samples;
+    }
+    for (len = 0;  len < samples;  len += i)
+    {
+        i = R2_MF_TX_PERIOD - s->wave_position;
+        if (i > samples - len)
+            i = samples - len;
+        memcpy(alaw + len, s->alaw_wave + s->wave_position, i);
+        s->wave_position += i;
+        if (s->wave_position >= R2_MF_TX_PERIOD)
+            s->wave_position = 0;
+    }
+    return samples;
 }
 
 OR2_DECLARE(int) openr2_mf_tx_put(openr2_mf_tx_state_t *s, char digit)
@@ -188,9 +2492,16 @@ OR2_DECLARE(int) openr2_mf_tx_put(openr2_mf_tx_state_t *s, char digit)
     if (digit  &&  (cp = strchr(r2_mf_tone_codes, digit)))
     {
         if (s->fwd)
-            tone_gen_init(&s->tone, &r2_mf_fwd_digit_tones[cp - r2_mf_tone_codes]);
+        {
+            s->wave = r2_mf_fwd_digit_waves[cp - r2_mf_tone_codes];
+            s->alaw_wave = r2_mf_fwd_digit_alaw_waves[cp - r2_mf_tone_codes];
+        }
         else
-            tone_gen_init(&s->tone, &r2_mf_back_digit_tones[cp - r2_mf_tone_codes]);
+        {
+            s->wave = r2_mf_back_digit_waves[cp - r2_mf_tone_codes];
+            s->alaw_wave = r2_mf_back_digit_alaw_waves[cp - r2_mf_tone_codes];
+        }
+        s->wave_position = 0;
         s->digit = digit;
     }
     else
@@ -202,9 +2513,6 @@ OR2_DECLARE(int) openr2_mf_tx_put(openr2_mf_tx_state_t *s, char digit)
 
 OR2_DECLARE(openr2_mf_tx_state_t *) openr2_mf_tx_init(openr2_mf_tx_state_t *s, int fwd)
 {
-    int i;
-    const mf_digit_tones_t *tones;
-
     if (s == NULL)
     {
         if ((s = (openr2_mf_tx_state_t *) malloc(sizeof(*s))) == NULL)
@@ -212,225 +2520,1315 @@ OR2_DECLARE(openr2_mf_tx_state_t *) openr2_mf_tx_init(openr2_mf_tx_state_t *s, i
     }
     memset(s, 0, sizeof(*s));
 
-    if (!r2_mf_gen_inited)
+    s->fwd = fwd;
+    return s;
+}
+
+/* Evaluate the filters at the end of an MF detection block and leave
+   them ready for the next block. Returns the digit found, if any, and
+   its two filters in bins[]. The energy of each filter is also left in
+   energies[], unless it is NULL */
+static int mf_rx_decide(openr2_goertzel_state_t out[], int bins[2], float energies[6])
+{
+    float energy[6];
+    int i;
+    int best;
+    int second_best;
+    int hit;
+    int hit_digit;
+
+    /* Find the two highest energies */
+    energy[0] = goertzel_result(&out[0]);
+    energy[1] = goertzel_result(&out[1]);
+    if (energy[0] > energy[1])
     {
-        i = 0;
-        tones = r2_mf_fwd_tones;
-        while (tones->on_time)
+        best = 0;
+        second_best = 1;
+    }
+    else
+    {
+        best = 1;
+        second_best = 0;
+    }
+    
+    for (i = 2;  i < 6;  i++)
+    {
+        energy[i] = goertzel_result(&out[i]);
+        if (energy[i] >= energy[best])
         {
-            make_tone_gen_descriptor(&r2_mf_fwd_digit_tones[i++],
-                                     (int) tones->f1,
-                                     tones->level1,
-                                     (int) tones->f2,
-                                     tones->level2,
-                                     tones->on_time,
-                                     tones->off_time,
-                                     0,
-                                     0,
-                                     (tones->off_time == 0));
-            tones++;
+            second_best = best;
+            best = i;
         }
-        i = 0;
-        tones = r2_mf_back_tones;
-        while (tones->on_time)
+        else if (energy[i] >= energy[second_best])
         {
-            make_tone_gen_descriptor(&r2_mf_back_digit_tones[i++],
-                                     (int) tones->f1,
-                                     tones->level1,
-                                     (int) tones->f2,
-                                     tones->level2,
-                                     tones->on_time,
-                                     tones->off_time,
-                                     0,
-                                     0,
-                                     (tones->off_time == 0));
-            tones++;
+            second_best = i;
         }
-        r2_mf_gen_inited = TRUE;
     }
-    s->fwd = fwd;
-    return s;
+    /* Basic signal level and twist tests */
+    hit = FALSE;
+    if (energy[best] >= R2_MF_THRESHOLD
+        &&
+        energy[second_best] >= R2_MF_THRESHOLD
+        &&
+        energy[best] < energy[second_best]*R2_MF_TWIST
+        &&
+        energy[best]*R2_MF_TWIST > energy[second_best])
+    {
+        /* Relative peak test */
+        hit = TRUE;
+        for (i = 0;  i < 6;  i++)
+        {
+            if (i != best  &&  i != second_best)
+            {
+                if (energy[i]*R2_MF_RELATIVE_PEAK >= energy[second_best])
+                {
+                    /* The best two are not clearly the best */
+                    hit = FALSE;
+                    break;
+                }
+            }
+        }
+    }
+    if (hit)
+    {
+        /* Get the values into ascending order */
+        if (second_best < best)
+        {
+            i = best;
+            best = second_best;
+            second_best = i;
+        }
+        bins[0] = best;
+        bins[1] = second_best;
+        best = best*5 + second_best - 1;
+        hit_digit = r2_mf_positions[best];
+    }
+    else
+    {
+        hit_digit = 0;
+    }
+
+    if (energies)
+        memcpy(energies, energy, sizeof(energy));
+
+    /* Reinitialise the filters for the next block */
+    for (i = 0;  i < 6;  i++)
+        goertzel_reset(&out[i]);
+    return hit_digit;
 }
 
-OR2_DECLARE(int) openr2_mf_rx(openr2_mf_rx_state_t *s, const int16_t amp[], int samples)
+/* Drop a digit that is not allowed to start right now */
+static int mf_rx_allowed(openr2_mf_rx_state_t *s, int digit)
 {
-    float energy[6];
-    float famp;
-    float v1;
+    const char *cp;
+
+    if (digit == 0  ||  digit == s->current_digit)
+        return digit;
+    cp = strchr(r2_mf_tone_codes, digit);
+    return (cp  &&  (s->tone_mask & (1 << (cp - r2_mf_tone_codes))))  ?  digit  :  0;
+}
+
+/* Report the digit found only once it has lasted long enough, and the same
+   for the silence. The time is counted in samples, from the end of the
+   block where the digit (or the silence) was first found to the end of the
+   block at the given sample */
+static int mf_rx_debounce(openr2_mf_rx_state_t *s, unsigned long position)
+{
+    if (s->current_digit != s->debounce_digit)
+    {
+        s->debounce_digit = s->current_digit;
+        s->debounce_change = position;
+    }
+    if (s->debounced_digit != s->debounce_digit
+        &&
+        position - s->debounce_change >= (unsigned long) ((s->debounce_digit)  ?  s->debounce_on  :  s->debounce_off))
+    {
+        s->debounced_digit = s->debounce_digit;
+    }
+    return s->debounced_digit;
+}
+
+/* Evaluate the filters at the end of an MF detection block, update the
+   currently detected digit and leave the detector ready for the next block.
+   The block ends at the given sample */
+static int mf_rx_block_end(openr2_mf_rx_state_t *s, unsigned long position)
+{
+    int bins[2];
+
+    s->current_digit = mf_rx_allowed(s, mf_rx_decide(s->out, bins, NULL));
+    s->current_sample = 0;
+    s->energy[0] = 0;
+    s->gated[0] = TRUE;
+    s->blocks++;
+    return mf_rx_debounce(s, position);
+}
+
+/* Same as mf_rx_decide() for the fixed-point filters */
+static int mf_rx_fixed_decide(openr2_goertzel_fixed_state_t out[], int bins[2], float energies[6])
+{
+    int64_t energy[6];
     int i;
-    int j;
-    int sample;
     int best;
     int second_best;
     int hit;
     int hit_digit;
-    int limit;
 
-    hit = 0;
-    hit_digit = 0;
-    for (sample = 0;  sample < samples;  sample = limit)
+    /* Find the two highest energies */
+    energy[0] = goertzel_fixed_result(&out[0]);
+    energy[1] = goertzel_fixed_result(&out[1]);
+    if (energy[0] > energy[1])
     {
-        if ((samples - sample) >= (R2_MF_SAMPLES_PER_BLOCK - s->current_sample))
-            limit = sample + (R2_MF_SAMPLES_PER_BLOCK - s->current_sample);
-        else
-            limit = samples;
-        for (j = sample;  j < limit;  j++)
-        {
-            famp = amp[j];
-            /* With GCC 2.95, the following unrolled code seems to take about 35%
-               (rough estimate) as long as a neat little 0-5 loop */
-            v1 = s->out[0].v2;
-            s->out[0].v2 = s->out[0].v3;
-            s->out[0].v3 = s->out[0].fac*s->out[0].v2 - v1 + famp;
-    
-            v1 = s->out[1].v2;
-            s->out[1].v2 = s->out[1].v3;
-            s->out[1].v3 = s->out[1].fac*s->out[1].v2 - v1 + famp;
-    
-            v1 = s->out[2].v2;
-            s->out[2].v2 = s->out[2].v3;
-            s->out[2].v3 = s->out[2].fac*s->out[2].v2 - v1 + famp;
-    
-            v1 = s->out[3].v2;
-            s->out[3].v2 = s->out[3].v3;
-            s->out[3].v3 = s->out[3].fac*s->out[3].v2 - v1 + famp;
-    
-            v1 = s->out[4].v2;
-            s->out[4].v2 = s->out[4].v3;
-            s->out[4].v3 = s->out[4].fac*s->out[4].v2 - v1 + famp;
+        best = 0;
+        second_best = 1;
+    }
+    else
+    {
+        best = 1;
+        second_best = 0;
+    }
     
-            v1 = s->out[5].v2;
-            s->out[5].v2 = s->out[5].v3;
-            s->out[5].v3 = s->out[5].fac*s->out[5].v2 - v1 + famp;
-        }
-        s->current_sample += (limit - sample);
-        if (s->current_sample < R2_MF_SAMPLES_PER_BLOCK)
-            continue;
-
-        /* We are at the end of an MF detection block */
-        /* Find the two highest energies */
-        energy[0] = goertzel_result(&s->out[0]);
-        energy[1] = goertzel_result(&s->out[1]);
-        if (energy[0] > energy[1])
+    for (i = 2;  i < 6;  i++)
+    {
+        energy[i] = goertzel_fixed_result(&out[i]);
+        if (energy[i] >= energy[best])
         {
-            best = 0;
-            second_best = 1;
+            second_best = best;
+            best = i;
         }
-        else
+        else if (energy[i] >= energy[second_best])
         {
-            best = 1;
-            second_best = 0;
+            second_best = i;
         }
-        
-        for (i = 2;  i < 6;  i++)
+    }
+    /* Basic signal level and twist tests */
+    hit = FALSE;
+    if (energy[best] >= R2_MF_THRESHOLD_FIXED
+        &&
+        energy[second_best] >= R2_MF_THRESHOLD_FIXED
+        &&
+        energy[best]*10 < energy[second_best]*R2_MF_TWIST_X10
+        &&
+        energy[best]*R2_MF_TWIST_X10 > energy[second_best]*10)
+    {
+        /* Relative peak test */
+        hit = TRUE;
+        for (i = 0;  i < 6;  i++)
         {
-            energy[i] = goertzel_result(&s->out[i]);
-            if (energy[i] >= energy[best])
-            {
-                second_best = best;
-                best = i;
-            }
-            else if (energy[i] >= energy[second_best])
+            if (i != best  &&  i != second_best)
             {
-                second_best = i;
+                if (energy[i]*R2_MF_RELATIVE_PEAK_X10 >= energy[second_best]*10)
+                {
+                    /* The best two are not clearly the best */
+                    hit = FALSE;
+                    break;
+                }
             }
         }
-        /* Basic signal level and twist tests */
-        hit = FALSE;
-        if (energy[best] >= R2_MF_THRESHOLD
+    }
+    if (hit)
+    {
+        /* Get the values into ascending order */
+        if (second_best < best)
+        {
+            i = best;
+            best = second_best;
+            second_best = i;
+        }
+        bins[0] = best;
+        bins[1] = second_best;
+        best = best*5 + second_best - 1;
+        hit_digit = r2_mf_positions[best];
+    }
+    else
+    {
+        hit_digit = 0;
+    }
+
+    if (energies)
+    {
+        for (i = 0;  i < 6;  i++)
+            energies[i] = (float) energy[i];
+    }
+
+    /* Reinitialise the filters for the next block */
+    for (i = 0;  i < 6;  i++)
+        goertzel_fixed_reset(&out[i]);
+    return hit_digit;
+}
+
+/* Check, at the end of a block, whether the tracked pair of filters still
+   holds the digit. Instead of looking at the other four filters, the pair
+   must still pass the level and twist tests and take nearly all the block
+   energy, leaving less than R2_MF_TRACK_RESIDUAL of the weakest tone for
+   anything else. The filters are left untouched */
+static int mf_rx_track_holds(openr2_goertzel_state_t out[], const int bins[2], int64_t energy)
+{
+    openr2_goertzel_state_t pair[2];
+    float weakest;
+    float strongest;
+    float residual;
+
+    pair[0] = out[bins[0]];
+    pair[1] = out[bins[1]];
+    weakest = goertzel_result(&pair[0]);
+    strongest = goertzel_result(&pair[1]);
+    if (weakest > strongest)
+    {
+        residual = weakest;
+        weakest = strongest;
+        strongest = residual;
+    }
+    residual = (float) energy*R2_MF_SAMPLES_PER_BLOCK - 2.0f*(weakest + strongest);
+    return (weakest >= R2_MF_THRESHOLD
+            &&
+            strongest < weakest*R2_MF_TWIST
             &&
-            energy[second_best] >= R2_MF_THRESHOLD
+            residual < weakest*R2_MF_TRACK_RESIDUAL);
+}
+
+/* Same as mf_rx_track_holds() for the fixed-point filters */
+static int mf_rx_fixed_track_holds(openr2_goertzel_fixed_state_t out[], const int bins[2], int64_t energy)
+{
+    openr2_goertzel_fixed_state_t pair[2];
+    int64_t weakest;
+    int64_t strongest;
+    int64_t residual;
+
+    pair[0] = out[bins[0]];
+    pair[1] = out[bins[1]];
+    weakest = goertzel_fixed_result(&pair[0]);
+    strongest = goertzel_fixed_result(&pair[1]);
+    if (weakest > strongest)
+    {
+        residual = weakest;
+        weakest = strongest;
+        strongest = residual;
+    }
+    residual = energy*R2_MF_SAMPLES_PER_BLOCK - 2*(weakest + strongest);
+    return (weakest >= R2_MF_THRESHOLD_FIXED
             &&
-            energy[best] < energy[second_best]*R2_MF_TWIST
+            strongest*10 < weakest*R2_MF_TWIST_X10
             &&
-            energy[best]*R2_MF_TWIST > energy[second_best])
+            residual*100 < weakest*R2_MF_TRACK_RESIDUAL_X100);
+}
+
+/* Run a stretch of samples through some of the filters of one set of MF
+   filters. bins has a bit set for each of the filters to run */
+static void mf_rx_filter(openr2_mf_rx_state_t *s,
+                         openr2_goertzel_state_t out[],
+                         openr2_goertzel_fixed_state_t out_fixed[],
+                         int bins,
+                         const float amp[],
+                         int samples)
+{
+    goertzel_bank_t bank;
+    openr2_goertzel_fixed_state_t selected_fixed[6];
+    int32_t fixed_block[R2_MF_SAMPLES_PER_BLOCK];
+    int filters;
+    int i;
+    int j;
+
+    if (s->fixed_point)
+    {
+        /* The samples are whole numbers, they convert back exactly */
+        for (j = 0;  j < samples;  j++)
+            fixed_block[j] = (int32_t) amp[j];
+        filters = 0;
+        for (i = 0;  i < 6;  i++)
         {
-            /* Relative peak test */
-            hit = TRUE;
-            for (i = 0;  i < 6;  i++)
-            {
-                if (i != best  &&  i != second_best)
-                {
-                    if (energy[i]*R2_MF_RELATIVE_PEAK >= energy[second_best])
-                    {
-                        /* The best two are not clearly the best */
-                        hit = FALSE;
-                        break;
-                    }
-                }
-            }
+            if (bins & (1 << i))
+                selected_fixed[filters++] = out_fixed[i];
+        }
+        goertzel_fixed_update(selected_fixed, filters, fixed_block, samples);
+        filters = 0;
+        for (i = 0;  i < 6;  i++)
+        {
+            if (bins & (1 << i))
+                out_fixed[i] = selected_fixed[filters++];
+        }
+    }
+    else
+    {
+        filters = 0;
+        for (i = 0;  i < 6;  i++)
+        {
+            if (bins & (1 << i))
+                goertzel_bank_load(&bank, &out[i], filters++, 1);
+        }
+        goertzel_bank_update(&bank, amp, samples);
+        filters = 0;
+        for (i = 0;  i < 6;  i++)
+        {
+            if (bins & (1 << i))
+                goertzel_bank_store(&bank, &out[i], filters++, 1);
+        }
+    }
+}
+
+/* Feed some filters of a set of MF filters with samples from the history,
+   the given amount of them, up to skip samples before the newest one */
+static void mf_rx_catch_up(openr2_mf_rx_state_t *s,
+                           openr2_goertzel_state_t out[],
+                           openr2_goertzel_fixed_state_t out_fixed[],
+                           int bins,
+                           int samples,
+                           int skip)
+{
+    int start;
+    int end;
+
+    end = s->history_position - skip;
+    if (end < 0)
+        end += R2_MF_SAMPLES_PER_BLOCK;
+    start = end - samples;
+    if (start < 0)
+    {
+        start += R2_MF_SAMPLES_PER_BLOCK;
+        mf_rx_filter(s, out, out_fixed, bins, s->history + start, R2_MF_SAMPLES_PER_BLOCK - start);
+        mf_rx_filter(s, out, out_fixed, bins, s->history, end);
+    }
+    else
+    {
+        mf_rx_filter(s, out, out_fixed, bins, s->history + start, samples);
+    }
+}
+
+/* Keep the last block of samples around */
+static void mf_rx_remember(openr2_mf_rx_state_t *s, const float amp[], int samples)
+{
+    int len;
+
+    len = R2_MF_SAMPLES_PER_BLOCK - s->history_position;
+    if (len > samples)
+        len = samples;
+    memcpy(s->history + s->history_position, amp, len*sizeof(float));
+    memcpy(s->history, amp + len, (samples - len)*sizeof(float));
+    s->history_position += samples;
+    if (s->history_position >= R2_MF_SAMPLES_PER_BLOCK)
+        s->history_position -= R2_MF_SAMPLES_PER_BLOCK;
+}
+
+/* The filters a window is currently running */
+static int mf_rx_window_bins(openr2_mf_rx_state_t *s, int k)
+{
+    if (s->tracked[k])
+        return (1 << s->track_bins[k][0]) | (1 << s->track_bins[k][1]);
+    return R2_MF_ALL_BINS;
+}
+
+/* Take the figures of a block that held the digit being received, keeping
+   the weakest ones seen over the digit */
+static void mf_rx_stats_block(openr2_mf_rx_state_t *s, const float energy[6], const int bins[2])
+{
+    openr2_mf_digit_stats_t *d = &s->stats_digit;
+    float peak;
+    float second_peak;
+    float other;
+    int first;
+    int i;
+
+    first = (d->peak_energy == 0.0f);
+    peak = energy[bins[0]];
+    second_peak = energy[bins[1]];
+    if (second_peak > peak)
+    {
+        peak = energy[bins[1]];
+        second_peak = energy[bins[0]];
+    }
+    other = 1.0f;
+    for (i = 0;  i < 6;  i++)
+    {
+        if (i != bins[0]  &&  i != bins[1]  &&  energy[i] > other)
+            other = energy[i];
+    }
+    if (first  ||  peak < d->peak_energy)
+        d->peak_energy = peak;
+    if (first  ||  second_peak < d->second_peak_energy)
+    {
+        d->second_peak_energy = second_peak;
+        d->level_margin = 10.0f*log10f(second_peak/R2_MF_THRESHOLD);
+    }
+    if (first  ||  10.0f*log10f(second_peak*R2_MF_TWIST/peak) < d->twist_margin)
+        d->twist_margin = 10.0f*log10f(second_peak*R2_MF_TWIST/peak);
+    if (first  ||  10.0f*log10f(second_peak/(other*R2_MF_RELATIVE_PEAK)) < d->relative_peak_margin)
+        d->relative_peak_margin = 10.0f*log10f(second_peak/(other*R2_MF_RELATIVE_PEAK));
+}
+
+/* Add the figures of a digit that just ended to the totals */
+static void mf_rx_stats_close(openr2_mf_rx_state_t *s)
+{
+    openr2_mf_digit_stats_t *d = &s->stats_digit;
+    openr2_mf_digit_stats_t *w = &s->stats.worst;
+    float margin;
+
+    margin = d->level_margin;
+    if (d->twist_margin < margin)
+        margin = d->twist_margin;
+    if (d->relative_peak_margin < margin)
+        margin = d->relative_peak_margin;
+    s->stats.last = *d;
+    if (s->stats.digits++ == 0)
+    {
+        *w = *d;
+        s->stats_worst_margin = margin;
+        return;
+    }
+    if (margin < s->stats_worst_margin)
+    {
+        w->digit = d->digit;
+        s->stats_worst_margin = margin;
+    }
+    if (d->peak_energy < w->peak_energy)
+        w->peak_energy = d->peak_energy;
+    if (d->second_peak_energy < w->second_peak_energy)
+        w->second_peak_energy = d->second_peak_energy;
+    if (d->level_margin < w->level_margin)
+        w->level_margin = d->level_margin;
+    if (d->twist_margin < w->twist_margin)
+        w->twist_margin = d->twist_margin;
+    if (d->relative_peak_margin < w->relative_peak_margin)
+        w->relative_peak_margin = d->relative_peak_margin;
+    if (d->on_samples < w->on_samples)
+        w->on_samples = d->on_samples;
+    if (d->off_samples < w->off_samples)
+        w->off_samples = d->off_samples;
+}
+
+/* Follow the digit changes of the detector at the given sample. energy[] holds
+   the filter results of the block, or is NULL if the block took no full decision */
+static void mf_rx_stats_update(openr2_mf_rx_state_t *s, int previous, const float energy[6], const int bins[2], unsigned long position)
+{
+    int off_samples;
+
+    if (s->current_digit != previous)
+    {
+        off_samples = 0;
+        if (previous)
+        {
+            s->stats_digit.on_samples = position - s->stats_change;
+            mf_rx_stats_close(s);
+        }
+        else
+        {
+            off_samples = position - s->stats_change;
+        }
+        s->stats_change = position;
+        memset(&s->stats_digit, 0, sizeof(s->stats_digit));
+        s->stats_digit.digit = s->current_digit;
+        s->stats_digit.off_samples = off_samples;
+    }
+    if (s->current_digit  &&  energy)
+        mf_rx_stats_block(s, energy, bins);
+}
+
+/* Windows that only partly overlap a tone edge, or a short fade, disagree
+   with the others. So the sliding mode takes a digit once most of the last
+   windows see it, and keeps it until none of them does */
+static void mf_rx_vote(openr2_mf_rx_state_t *s, int digit)
+{
+    int votes;
+    int held;
+    int i;
+
+    s->window_digits[s->window_vote] = digit;
+    s->window_vote = (s->window_vote + 1) % OR2_MF_RX_VOTES;
+    votes = 0;
+    held = FALSE;
+    for (i = 0;  i < OR2_MF_RX_VOTES;  i++)
+    {
+        if (s->window_digits[i] == digit)
+            votes++;
+        if (s->window_digits[i] == s->current_digit)
+            held = TRUE;
+    }
+    if (!held)
+        s->current_digit = 0;
+    if (s->current_digit == 0  &&  digit  &&  votes >= R2_MF_SLIDING_VOTES)
+        s->current_digit = digit;
+}
+
+/* Run linear samples (amp) or A-law samples (alaw) through the MF detector */
+static int mf_rx(openr2_mf_rx_state_t *s, const int16_t amp[], const uint8_t alaw[], int samples)
+{
+    openr2_goertzel_state_t *out[OR2_MF_RX_WINDOWS];
+    openr2_goertzel_fixed_state_t *out_fixed[OR2_MF_RX_WINDOWS];
+    int *current_sample[OR2_MF_RX_WINDOWS];
+    float block[R2_MF_SAMPLES_PER_BLOCK];
+    float block_energy[6];
+    int64_t energy;
+    int32_t v;
+    int windows;
+    int left;
+    int len;
+    int j;
+    int k;
+    int sample;
+    int hit_digit;
+    int limit;
+    int holds;
+    int digit;
+    int previous;
+
+    /* Window 0 is the regular block detector, the sliding mode adds the rest */
+    out[0] = s->out;
+    out_fixed[0] = s->out_fixed;
+    current_sample[0] = &s->current_sample;
+    windows = (s->sliding)  ?  OR2_MF_RX_WINDOWS  :  1;
+    for (k = 1;  k < windows;  k++)
+    {
+        out[k] = s->window_out[k - 1];
+        out_fixed[k] = s->window_out_fixed[k - 1];
+        current_sample[k] = &s->window_sample[k - 1];
+    }
+
+    hit_digit = 0;
+    for (sample = 0;  sample < samples;  sample = limit)
+    {
+        /* Stop at the nearest window start or end of block */
+        limit = samples;
+        for (k = 0;  k < windows;  k++)
+        {
+            left = (*current_sample[k] < 0)  ?  -*current_sample[k]  :  (R2_MF_SAMPLES_PER_BLOCK - *current_sample[k]);
+            if (sample + left < limit)
+                limit = sample + left;
+        }
+        len = limit - sample;
+        /* Fill the filter block straight from the line, the gate energy
+           is taken from the same samples */
+        energy = 0;
+        if (alaw)
+        {
+            for (j = 0;  j < len;  j++)
+            {
+                block[j] = alaw_to_float[alaw[sample + j]];
+                v = (int32_t) block[j];
+                energy += v*v;
+            }
+        }
+        else
+        {
+            for (j = 0;  j < len;  j++)
+            {
+                block[j] = amp[sample + j];
+                energy += amp[sample + j]*amp[sample + j];
+            }
+        }
+        mf_rx_remember(s, block, len);
+        for (k = 0;  k < windows;  k++)
+        {
+            if (*current_sample[k] >= 0)
+            {
+                s->energy[k] += energy;
+                /* Silence between tones does not need the filters, until the
+                   block gets loud enough to possibly hold a tone */
+                if (s->gated[k]  &&  s->energy[k] >= R2_MF_GATE_ENERGY)
+                {
+                    mf_rx_catch_up(s, out[k], out_fixed[k], mf_rx_window_bins(s, k), *current_sample[k], len);
+                    s->gated[k] = FALSE;
+                }
+                if (!s->gated[k])
+                    mf_rx_filter(s, out[k], out_fixed[k], mf_rx_window_bins(s, k), block, len);
+            }
+            *current_sample[k] += len;
+            if (*current_sample[k] < R2_MF_SAMPLES_PER_BLOCK)
+                continue;
+
+            /* We are at the end of an MF detection block */
+            s->blocks++;
+            previous = s->current_digit;
+            if (s->gated[k])
+            {
+                /* The filters are still clean, and no tone could be there */
+                digit = 0;
+                s->tracked[k] = FALSE;
+                s->skipped_blocks++;
+                holds = FALSE;
+            }
+            else
+            {
+                if (s->tracked[k])
+                {
+                    holds = (s->fixed_point)
+                          ?  mf_rx_fixed_track_holds(out_fixed[k], s->track_bins[k], s->energy[k])
+                          :  mf_rx_track_holds(out[k], s->track_bins[k], s->energy[k]);
+                    /* If the pair is not clearly there, bring the other filters
+                       up to date and take the full decision on this block */
+                    if (!holds)
+                        mf_rx_catch_up(s, out[k], out_fixed[k], R2_MF_ALL_BINS & ~mf_rx_window_bins(s, k), R2_MF_SAMPLES_PER_BLOCK, 0);
+                }
+                else
+                {
+                    holds = FALSE;
+                }
+                if (holds)
+                {
+                    digit = r2_mf_positions[s->track_bins[k][0]*5 + s->track_bins[k][1] - 1];
+                    for (j = 0;  j < 2;  j++)
+                    {
+                        goertzel_reset(&out[k][s->track_bins[k][j]]);
+                        goertzel_fixed_reset(&out_fixed[k][s->track_bins[k][j]]);
+                    }
+                }
+                else if (s->fixed_point)
+                {
+                    digit = mf_rx_fixed_decide(out_fixed[k], s->track_bins[k], (s->stats_enabled)  ?  block_energy  :  NULL);
+                }
+                else
+                {
+                    digit = mf_rx_decide(out[k], s->track_bins[k], (s->stats_enabled)  ?  block_energy  :  NULL);
+                }
+                digit = mf_rx_allowed(s, digit);
+                s->tracked[k] = (s->tracking  &&  digit);
+            }
+            if (windows == 1)
+                s->current_digit = digit;
+            else
+                mf_rx_vote(s, digit);
+            if (s->stats_enabled)
+            {
+                /* A tracked block only ran the filters of the digit, it adds no figures */
+                mf_rx_stats_update(s,
+                                   previous,
+                                   (s->gated[k]  ||  holds)  ?  NULL  :  block_energy,
+                                   s->track_bins[k],
+                                   s->samples + limit);
+            }
+            *current_sample[k] = 0;
+            s->energy[k] = 0;
+            s->gated[k] = TRUE;
+            hit_digit = mf_rx_debounce(s, s->samples + limit);
+        }
+    }
+    s->samples += samples;
+    return hit_digit;
+}
+
+/* Start over the current block(s) after a mode change */
+static void mf_rx_restart(openr2_mf_rx_state_t *s)
+{
+    int i;
+    int k;
+
+    for (i = 0;  i < 6;  i++)
+    {
+        goertzel_reset(&s->out[i]);
+        goertzel_fixed_reset(&s->out_fixed[i]);
+        for (k = 0;  k < OR2_MF_RX_WINDOWS - 1;  k++)
+        {
+            goertzel_reset(&s->window_out[k][i]);
+            goertzel_fixed_reset(&s->window_out_fixed[k][i]);
+        }
+    }
+    s->current_sample = 0;
+    /* The extra windows start one after the other, R2_MF_SLIDING_HOP samples apart */
+    for (k = 0;  k < OR2_MF_RX_WINDOWS - 1;  k++)
+        s->window_sample[k] = -(k + 1)*R2_MF_SLIDING_HOP;
+    for (k = 0;  k < OR2_MF_RX_WINDOWS;  k++)
+    {
+        s->energy[k] = 0;
+        s->gated[k] = TRUE;
+        s->tracked[k] = FALSE;
+    }
+    for (k = 0;  k < OR2_MF_RX_VOTES;  k++)
+        s->window_digits[k] = s->current_digit;
+}
+
+OR2_DECLARE(int) openr2_mf_rx(openr2_mf_rx_state_t *s, const int16_t amp[], int samples)
+{
+    return mf_rx(s, amp, NULL, samples);
+}
+
+OR2_DECLARE(int) openr2_mf_rx_alaw(openr2_mf_rx_state_t *s, const uint8_t alaw[], int samples)
+{
+    return mf_rx(s, NULL, alaw, samples);
+}
+
+OR2_DECLARE(void) openr2_mf_rx_set_fixed_point(openr2_mf_rx_state_t *s, int enable)
+{
+    /* Restart the current block with the selected filters */
+    s->fixed_point = (enable)  ?  TRUE  :  FALSE;
+    mf_rx_restart(s);
+}
+
+OR2_DECLARE(void) openr2_mf_rx_set_sliding(openr2_mf_rx_state_t *s, int enable)
+{
+    s->sliding = (enable)  ?  TRUE  :  FALSE;
+    mf_rx_restart(s);
+}
+
+OR2_DECLARE(void) openr2_mf_rx_set_tracking(openr2_mf_rx_state_t *s, int enable)
+{
+    s->tracking = (enable)  ?  TRUE  :  FALSE;
+    mf_rx_restart(s);
+}
+
+OR2_DECLARE(void) openr2_mf_rx_set_tone_mask(openr2_mf_rx_state_t *s, const char *tones)
+{
+    const char *cp;
+
+    /* No list means every tone is allowed */
+    if (tones == NULL)
+    {
+        s->tone_mask = (1 << (sizeof(r2_mf_tone_codes) - 1)) - 1;
+        return;
+    }
+    s->tone_mask = 0;
+    for (  ;  *tones;  tones++)
+    {
+        if ((cp = strchr(r2_mf_tone_codes, *tones)))
+            s->tone_mask |= (1 << (cp - r2_mf_tone_codes));
+    }
+}
+
+OR2_DECLARE(void) openr2_mf_rx_get_block_counts(openr2_mf_rx_state_t *s, unsigned long *blocks, unsigned long *skipped_blocks)
+{
+    *blocks = s->blocks;
+    *skipped_blocks = s->skipped_blocks;
+}
+
+OR2_DECLARE(void) openr2_mf_rx_set_debounce(openr2_mf_rx_state_t *s, int on_samples, int off_samples)
+{
+    s->debounce_on = (on_samples > 0)  ?  on_samples  :  0;
+    s->debounce_off = (off_samples > 0)  ?  off_samples  :  0;
+}
+
+OR2_DECLARE(void) openr2_mf_rx_set_stats(openr2_mf_rx_state_t *s, int enable)
+{
+    s->stats_enabled = (enable)  ?  TRUE  :  FALSE;
+    openr2_mf_rx_reset_stats(s);
+}
+
+OR2_DECLARE(int) openr2_mf_rx_get_stats(openr2_mf_rx_state_t *s, openr2_mf_rx_stats_t *stats)
+{
+    if (!s->stats_enabled)
+        return -1;
+    *stats = s->stats;
+    return 0;
+}
+
+OR2_DECLARE(void) openr2_mf_rx_reset_stats(openr2_mf_rx_state_t *s)
+{
+    /* A digit already on goes on being measured, and is counted once it ends */
+    memset(&s->stats, 0, sizeof(s->stats));
+    s->stats_worst_margin = 0.0f;
+}
+
+#if defined(__GNUC__)
+/* One lane per channel. Each vector holds the same filter for up to
+   OR2_MF_RX_LANES different channels (struct-of-arrays), so a single
+   vector multiply/subtract/add advances that filter for all of them.
+   GCC lowers this to SSE or AVX depending on the target. */
+#define OR2_MF_RX_LANES 8
+typedef float mf_lanes_t __attribute__((vector_size(OR2_MF_RX_LANES*sizeof(float))));
+
+typedef struct
+{
+    mf_lanes_t v2[6];
+    mf_lanes_t v3[6];
+    mf_lanes_t fac[6];
+} mf_rx_lanes_state_t;
+
+static void mf_rx_lanes_load(mf_rx_lanes_state_t *l, openr2_mf_rx_state_t *s, int lane)
+{
+    int i;
+
+    for (i = 0;  i < 6;  i++)
+    {
+        l->v2[i][lane] = s->out[i].v2;
+        l->v3[i][lane] = s->out[i].v3;
+        l->fac[i][lane] = s->out[i].fac;
+    }
+}
+
+static void mf_rx_lanes_store(mf_rx_lanes_state_t *l, openr2_mf_rx_state_t *s, int lane)
+{
+    int i;
+
+    for (i = 0;  i < 6;  i++)
+    {
+        s->out[i].v2 = l->v2[i][lane];
+        s->out[i].v3 = l->v3[i][lane];
+    }
+}
+
+/* Run up to OR2_MF_RX_LANES channels through the detector at once */
+static void mf_rx_lanes(openr2_mf_rx_state_t *s[], const int16_t *amp[], int samples, int digits[], int channels)
+{
+    mf_rx_lanes_state_t l;
+    const int16_t *a[OR2_MF_RX_LANES];
+    int left[OR2_MF_RX_LANES];
+    mf_lanes_t famp;
+    mf_lanes_t v1;
+    int i;
+    int j;
+    int lane;
+    int sample;
+    int limit;
+
+    memset(&l, 0, sizeof(l));
+    for (lane = 0;  lane < OR2_MF_RX_LANES;  lane++)
+    {
+        if (lane < channels)
+        {
+            a[lane] = amp[lane];
+            left[lane] = R2_MF_SAMPLES_PER_BLOCK - s[lane]->current_sample;
+            /* The lanes always run the filters, so catch up any gated block first */
+            if (s[lane]->gated[0])
+            {
+                mf_rx_catch_up(s[lane], s[lane]->out, s[lane]->out_fixed, R2_MF_ALL_BINS, s[lane]->current_sample, 0);
+                s[lane]->gated[0] = FALSE;
+            }
+            mf_rx_lanes_load(&l, s[lane], lane);
+            digits[lane] = 0;
+        }
+        else
+        {
+            /* Unused lanes just shadow the first channel, their results are dropped */
+            a[lane] = amp[0];
+            left[lane] = R2_MF_SAMPLES_PER_BLOCK;
+        }
+    }
+    for (sample = 0;  sample < samples;  sample = limit)
+    {
+        /* Advance every lane up to the nearest end of block among the channels */
+        limit = samples;
+        for (lane = 0;  lane < channels;  lane++)
+        {
+            if (sample + left[lane] < limit)
+                limit = sample + left[lane];
+        }
+        for (j = sample;  j < limit;  j++)
+        {
+            famp = (mf_lanes_t) {a[0][j], a[1][j], a[2][j], a[3][j], a[4][j], a[5][j], a[6][j], a[7][j]};
+            for (i = 0;  i < 6;  i++)
+            {
+                v1 = l.v2[i];
+                l.v2[i] = l.v3[i];
+                l.v3[i] = l.fac[i]*l.v2[i] - v1 + famp;
+            }
+        }
+        for (lane = 0;  lane < channels;  lane++)
+        {
+            left[lane] -= (limit - sample);
+            if (left[lane])
+                continue;
+            /* This channel reached the end of its detection block */
+            mf_rx_lanes_store(&l, s[lane], lane);
+            s[lane]->current_sample = R2_MF_SAMPLES_PER_BLOCK;
+            digits[lane] = mf_rx_block_end(s[lane], s[lane]->samples + limit);
+            mf_rx_lanes_load(&l, s[lane], lane);
+            left[lane] = R2_MF_SAMPLES_PER_BLOCK;
+        }
+    }
+    for (lane = 0;  lane < channels;  lane++)
+    {
+        mf_rx_lanes_store(&l, s[lane], lane);
+        s[lane]->samples += samples;
+        s[lane]->current_sample = R2_MF_SAMPLES_PER_BLOCK - left[lane];
+        /* The lanes keep no history, the filters of a block they started are already fed */
+        s[lane]->gated[0] = (s[lane]->current_sample == 0);
+    }
+}
+
+OR2_DECLARE(int) openr2_mf_rx_multi(openr2_mf_rx_state_t *s[], const int16_t *amp[], int samples, int digits[], int channels)
+{
+    openr2_mf_rx_state_t *lane_s[OR2_MF_RX_LANES];
+    const int16_t *lane_amp[OR2_MF_RX_LANES];
+    int lane_digits[OR2_MF_RX_LANES];
+    int lane_channel[OR2_MF_RX_LANES];
+    int i;
+    int n;
+
+    n = 0;
+    for (i = 0;  i < channels;  i++)
+    {
+        /* Fixed-point, sliding, tracking and measuring detectors have no lanes, run them on their own */
+        if (s[i]->fixed_point  ||  s[i]->sliding  ||  s[i]->tracking  ||  s[i]->stats_enabled)
+        {
+            digits[i] = openr2_mf_rx(s[i], amp[i], samples);
+            continue;
+        }
+        lane_s[n] = s[i];
+        lane_amp[n] = amp[i];
+        lane_channel[n] = i;
+        if (++n < OR2_MF_RX_LANES  &&  i < channels - 1)
+            continue;
+        mf_rx_lanes(lane_s, lane_amp, samples, lane_digits, n);
+        while (n--)
+            digits[lane_channel[n]] = lane_digits[n];
+        n = 0;
+    }
+    if (n)
+    {
+        mf_rx_lanes(lane_s, lane_amp, samples, lane_digits, n);
+        while (n--)
+            digits[lane_channel[n]] = lane_digits[n];
+    }
+    return channels;
+}
+#else
+OR2_DECLARE(int) openr2_mf_rx_multi(openr2_mf_rx_state_t *s[], const int16_t *amp[], int samples, int digits[], int channels)
+{
+    int i;
+
+    /* No vector extensions available, one channel at a time */
+    for (i = 0;  i < channels;  i++)
+        digits[i] = openr2_mf_rx(s[i], amp[i], samples);
+    return channels;
+}
+#endif
+
+OR2_DECLARE(openr2_mf_rx_state_t *) openr2_mf_rx_init(openr2_mf_rx_state_t *s, int fwd)
+{
+    const openr2_goertzel_descriptor_t *desc;
+    int i;
+    int k;
+
+    if (s == NULL)
+    {
+        if ((s = (openr2_mf_rx_state_t *) malloc(sizeof(*s))) == NULL)
+            return NULL;
+    }
+    memset(s, 0, sizeof(*s));
+
+    s->fwd = fwd;
+
+    desc = (fwd)  ?  mf_fwd_detect_desc  :  mf_back_detect_desc;
+    for (i = 0;  i < 6;  i++)
+    {
+        goertzel_init(&s->out[i], &desc[i]);
+        goertzel_fixed_init(&s->out_fixed[i], &desc[i]);
+        for (k = 0;  k < OR2_MF_RX_WINDOWS - 1;  k++)
+        {
+            goertzel_init(&s->window_out[k][i], &desc[i]);
+            goertzel_fixed_init(&s->window_out_fixed[k][i], &desc[i]);
+        }
+    }
+    s->current_digit = 0;
+    s->current_sample = 0;
+    for (k = 0;  k < OR2_MF_RX_WINDOWS;  k++)
+        s->gated[k] = TRUE;
+    openr2_mf_rx_set_tone_mask(s, NULL);
+    return s;
+}
+
+/* Run linear samples (amp) or A-law samples (alaw) through the 12 filters
+   of the analyzer. Filters 0 to 5 are the forward tones, 6 to 11 the
+   backward ones, so the bank takes the first 8 and a second one the rest */
+static void mf_analyzer(openr2_mf_analyzer_state_t *s, const int16_t amp[], const uint8_t alaw[], int samples)
+{
+    goertzel_bank_t bank;
+    float block[R2_MF_SAMPLES_PER_BLOCK];
+    int bins[2];
+    int sample;
+    int limit;
+    int j;
+
+    for (sample = 0;  sample < samples;  sample = limit)
+    {
+        limit = sample + R2_MF_SAMPLES_PER_BLOCK - s->current_sample;
+        if (limit > samples)
+            limit = samples;
+        if (alaw)
+        {
+            for (j = sample;  j < limit;  j++)
+                block[j - sample] = alaw_to_float[alaw[j]];
+        }
+        else
+        {
+            for (j = sample;  j < limit;  j++)
+                block[j - sample] = amp[j];
+        }
+        goertzel_bank_load(&bank, s->out, 0, GOERTZEL_BANK_SIZE);
+        goertzel_bank_update(&bank, block, limit - sample);
+        goertzel_bank_store(&bank, s->out, 0, GOERTZEL_BANK_SIZE);
+        goertzel_bank_load(&bank, s->out + GOERTZEL_BANK_SIZE, 0, 12 - GOERTZEL_BANK_SIZE);
+        goertzel_bank_update(&bank, block, limit - sample);
+        goertzel_bank_store(&bank, s->out + GOERTZEL_BANK_SIZE, 0, 12 - GOERTZEL_BANK_SIZE);
+        s->current_sample += (limit - sample);
+        if (s->current_sample < R2_MF_SAMPLES_PER_BLOCK)
+            continue;
+
+        /* We are at the end of an MF detection block, for both directions */
+        s->fwd_digit = mf_rx_decide(s->out, bins, NULL);
+        s->back_digit = mf_rx_decide(s->out + 6, bins, NULL);
+        s->current_sample = 0;
+    }
+}
+
+OR2_DECLARE(void) openr2_mf_analyzer_rx(openr2_mf_analyzer_state_t *s, const int16_t amp[], int samples, int *fwd_digit, int *back_digit)
+{
+    mf_analyzer(s, amp, NULL, samples);
+    *fwd_digit = s->fwd_digit;
+    *back_digit = s->back_digit;
+}
+
+OR2_DECLARE(void) openr2_mf_analyzer_rx_alaw(openr2_mf_analyzer_state_t *s, const uint8_t alaw[], int samples, int *fwd_digit, int *back_digit)
+{
+    mf_analyzer(s, NULL, alaw, samples);
+    *fwd_digit = s->fwd_digit;
+    *back_digit = s->back_digit;
+}
+
+OR2_DECLARE(openr2_mf_analyzer_state_t *) openr2_mf_analyzer_init(openr2_mf_analyzer_state_t *s)
+{
+    int i;
+
+    if (s == NULL)
+    {
+        if ((s = (openr2_mf_analyzer_state_t *) malloc(sizeof(*s))) == NULL)
+            return NULL;
+    }
+    memset(s, 0, sizeof(*s));
+
+    for (i = 0;  i < 6;  i++)
+    {
+        goertzel_init(&s->out[i], &mf_fwd_detect_desc[i]);
+        goertzel_init(&s->out[i + 6], &mf_back_detect_desc[i]);
+    }
+    return s;
+}
+
+/* Call progress tones are decided every 20ms. A tone must reach about -35dBm0
+   and carry at least half of the energy of the block, a pure tone gives a
+   Goertzel result of half the block length times the block energy */
+#define CPT_SAMPLES_PER_BLOCK       160
+#define CPT_THRESHOLD               1.0e9f
+#define CPT_TO_TOTAL_ENERGY         40.0f
+/* Complete cycles in a row a cadence must match before its tone is reported */
+#define CPT_CYCLES                  2
+/* Each SIT tone lasts 330ms +-70ms (ITU-T E.180), give or take a block, with
+   no more than a short silence between them */
+#define CPT_SIT_MIN_BLOCKS          12
+#define CPT_SIT_MAX_BLOCKS          21
+#define CPT_SIT_MAX_GAP_BLOCKS      2
+
+static const int cpt_sit_freqs[3] = {950, 1400, 1800};
+
+static int cpt_rx_add_filter(openr2_cpt_rx_state_t *s, int freq, int shared)
+{
+    openr2_goertzel_descriptor_t desc;
+    int i;
+
+    if (shared)
+    {
+        for (i = 0;  i < s->filters;  i++)
+        {
+            if (s->freqs[i] == freq)
+                return i;
+        }
+    }
+    desc.fac = 2.0f*cosf(2.0f*M_PI*freq/8000.0f);
+    desc.samples = CPT_SAMPLES_PER_BLOCK;
+    goertzel_init(&s->out[s->filters], &desc);
+    s->freqs[s->filters] = freq;
+    return s->filters++;
+}
+
+/* A cadence matches if the time is within 20% of it, or a couple of blocks
+   for the short ones */
+static int cpt_rx_matches(int blocks, int expected)
+{
+    int tolerance;
+
+    tolerance = expected/5;
+    if (tolerance < 2)
+        tolerance = 2;
+    return abs(blocks - expected) <= tolerance;
+}
+
+static void cpt_rx_report(openr2_cpt_rx_state_t *s, int tone)
+{
+    if ((s->reported & (1 << tone)))
+        return;
+    s->reported |= (1 << tone);
+    s->detected = tone;
+}
+
+/* A segment of s->run blocks of s->tone just ended, and next is on now */
+static void cpt_rx_segment_end(openr2_cpt_rx_state_t *s, int next)
+{
+    int sit;
+    int i;
+
+    if (s->tone < 0)
+    {
+        /* The end of a silence, which closes a cycle if the tone before it is back */
+        if (s->run > CPT_SIT_MAX_GAP_BLOCKS)
+            s->sit_stage = 0;
+        for (i = 0;  i < OR2_CPT_CADENCES;  i++)
+        {
+            if (s->cadence_filter[i] < 0  ||  s->off_blocks[i] == 0)
+                continue;
+            if (s->cadence_filter[i] == s->last_tone
+                &&
+                s->cadence_filter[i] == next
+                &&
+                cpt_rx_matches(s->last_run, s->on_blocks[i])
+                &&
+                cpt_rx_matches(s->run, s->off_blocks[i]))
+            {
+                if (++s->cycles[i] >= CPT_CYCLES)
+                    cpt_rx_report(s, OR2_CPT_BUSY + i);
+            }
+            else
+            {
+                s->cycles[i] = 0;
+            }
+        }
+        s->last_tone = -1;
+        return;
+    }
+    s->last_tone = s->tone;
+    s->last_run = s->run;
+    if (s->sit_filter < 0)
+        return;
+    /* SIT tones must come in order, and each one for about the same time */
+    sit = s->tone - s->sit_filter;
+    if (sit < 0  ||  s->run < CPT_SIT_MIN_BLOCKS  ||  s->run > CPT_SIT_MAX_BLOCKS)
+        s->sit_stage = 0;
+    else if (sit == s->sit_stage)
+        s->sit_stage++;
+    else
+        s->sit_stage = (sit == 0)  ?  1  :  0;
+    if (s->sit_stage == 3)
+    {
+        cpt_rx_report(s, OR2_CPT_SIT);
+        s->sit_stage = 0;
+    }
+}
+
+static void cpt_rx_block(openr2_cpt_rx_state_t *s)
+{
+    float energy;
+    float best_energy;
+    int tone;
+    int i;
+
+    tone = -1;
+    best_energy = CPT_THRESHOLD;
+    for (i = 0;  i < s->filters;  i++)
+    {
+        energy = goertzel_result(&s->out[i]);
+        if (energy >= best_energy)
+        {
+            best_energy = energy;
+            tone = i;
+        }
+        goertzel_reset(&s->out[i]);
+    }
+    if (tone >= 0  &&  best_energy < CPT_TO_TOTAL_ENERGY*s->energy)
+        tone = -1;
+    s->energy = 0.0f;
+
+    if (tone == s->tone)
+    {
+        s->run++;
+        /* A continuous tone is known once it lasted long enough */
+        for (i = 0;  i < OR2_CPT_CADENCES;  i++)
+        {
+            if (tone >= 0  &&  s->cadence_filter[i] == tone  &&  s->off_blocks[i] == 0  &&  s->run == s->on_blocks[i])
+                cpt_rx_report(s, OR2_CPT_BUSY + i);
         }
-        if (hit)
+        return;
+    }
+    cpt_rx_segment_end(s, tone);
+    /* A tone that follows another straight away ends a zero length silence */
+    if (s->tone >= 0  &&  tone >= 0)
+    {
+        s->tone = -1;
+        s->run = 0;
+        cpt_rx_segment_end(s, tone);
+    }
+    s->tone = tone;
+    s->run = 1;
+}
+
+static int cpt_rx(openr2_cpt_rx_state_t *s, const int16_t amp[], const uint8_t alaw[], int samples)
+{
+    goertzel_bank_t bank;
+    float block[CPT_SAMPLES_PER_BLOCK];
+    int sample;
+    int limit;
+    int j;
+
+    s->detected = OR2_CPT_NONE;
+    for (sample = 0;  sample < samples;  sample = limit)
+    {
+        limit = sample + CPT_SAMPLES_PER_BLOCK - s->current_sample;
+        if (limit > samples)
+            limit = samples;
+        if (alaw)
         {
-            /* Get the values into ascending order */
-            if (second_best < best)
-            {
-                i = best;
-                best = second_best;
-                second_best = i;
-            }
-            best = best*5 + second_best - 1;
-            hit_digit = r2_mf_positions[best];
+            for (j = sample;  j < limit;  j++)
+                block[j - sample] = alaw_to_float[alaw[j]];
         }
         else
         {
-            hit_digit = 0;
+            for (j = sample;  j < limit;  j++)
+                block[j - sample] = amp[j];
         }
-        s->current_digit = hit_digit;
-
-        /* Reinitialise the detector for the next block */
-        for (i = 0;  i < 6;  i++)
-            goertzel_reset(&s->out[i]);
+        for (j = 0;  j < limit - sample;  j++)
+            s->energy += block[j]*block[j];
+        goertzel_bank_load(&bank, s->out, 0, s->filters);
+        goertzel_bank_update(&bank, block, limit - sample);
+        goertzel_bank_store(&bank, s->out, 0, s->filters);
+        s->current_sample += (limit - sample);
+        if (s->current_sample < CPT_SAMPLES_PER_BLOCK)
+            continue;
+        cpt_rx_block(s);
         s->current_sample = 0;
     }
-    return hit_digit;
+    return s->detected;
 }
 
-OR2_DECLARE(openr2_mf_rx_state_t *) openr2_mf_rx_init(openr2_mf_rx_state_t *s, int fwd)
+OR2_DECLARE(int) openr2_cpt_rx(openr2_cpt_rx_state_t *s, const int16_t amp[], int samples)
 {
+    return cpt_rx(s, amp, NULL, samples);
+}
+
+OR2_DECLARE(int) openr2_cpt_rx_alaw(openr2_cpt_rx_state_t *s, const uint8_t alaw[], int samples)
+{
+    return cpt_rx(s, NULL, alaw, samples);
+}
+
+OR2_DECLARE(openr2_cpt_rx_state_t *) openr2_cpt_rx_init(openr2_cpt_rx_state_t *s, const openr2_cpt_config_t *config)
+{
+    const openr2_cpt_cadence_t *cadences[OR2_CPT_CADENCES];
     int i;
-    static int initialised = FALSE;
 
     if (s == NULL)
     {
-        if ((s = (openr2_mf_rx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (openr2_cpt_rx_state_t *) malloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
 
-    s->fwd = fwd;
-
-    if (!initialised)
-    {
-        for (i = 0;  i < 6;  i++)
-        {
-            make_goertzel_descriptor(&mf_fwd_detect_desc[i], r2_mf_fwd_frequencies[i], R2_MF_SAMPLES_PER_BLOCK);
-            make_goertzel_descriptor(&mf_back_detect_desc[i], r2_mf_back_frequencies[i], R2_MF_SAMPLES_PER_BLOCK);
-        }
-        initialised = TRUE;
-    }
-    if (fwd)
+    cadences[0] = &config->busy;
+    cadences[1] = &config->congestion;
+    cadences[2] = &config->ringback;
+    for (i = 0;  i < OR2_CPT_CADENCES;  i++)
     {
-        for (i = 0;  i < 6;  i++)
-            goertzel_init(&s->out[i], &mf_fwd_detect_desc[i]);
+        s->cadence_filter[i] = -1;
+        if (cadences[i]->freq <= 0  ||  cadences[i]->freq >= 4000  ||  cadences[i]->on_ms <= 0)
+            continue;
+        s->cadence_filter[i] = cpt_rx_add_filter(s, cadences[i]->freq, TRUE);
+        s->on_blocks[i] = cadences[i]->on_ms/20;
+        s->off_blocks[i] = (cadences[i]->off_ms > 0)  ?  cadences[i]->off_ms/20  :  0;
     }
-    else
+    s->sit_filter = -1;
+    if (config->sit)
     {
-        for (i = 0;  i < 6;  i++)
-            goertzel_init(&s->out[i], &mf_back_detect_desc[i]);
+        s->sit_filter = s->filters;
+        for (i = 0;  i < 3;  i++)
+            cpt_rx_add_filter(s, cpt_sit_freqs[i], FALSE);
     }
-    s->current_digit = 0;
-    s->current_sample = 0;
+    s->tone = -1;
+    s->last_tone = -1;
     return s;
 }
 
-static void make_goertzel_descriptor(openr2_goertzel_descriptor_t *t, float freq, int samples)
-{
-    t->fac = 2.0f*cosf(2.0f*M_PI*(freq/(float) SAMPLE_RATE));
-    t->samples = samples;
-}
-
-static openr2_goertzel_state_t *goertzel_init(openr2_goertzel_state_t *s, openr2_goertzel_descriptor_t *t)
+static openr2_goertzel_state_t *goertzel_init(openr2_goertzel_state_t *s, const openr2_goertzel_descriptor_t *t)
 {
     if (s == NULL)
     {
@@ -465,40 +3863,193 @@ static float goertzel_result(openr2_goertzel_state_t *s)
     return s->v3*s->v3 + s->v2*s->v2 - s->v2*s->v3*s->fac;
 }
 
-static void make_tone_gen_descriptor(openr2_tone_gen_descriptor_t *s,
-                              int f1,
-                              int l1,
-                              int f2,
-                              int l2,
-                              int d1,
-                              int d2,
-                              int d3,
-                              int d4,
-                              int repeat)
+static openr2_goertzel_fixed_state_t *goertzel_fixed_init(openr2_goertzel_fixed_state_t *s, const openr2_goertzel_descriptor_t *t)
 {
-    memset(s, 0, sizeof(*s));
-    if (f1)
+    s->v2 =
+    s->v3 = 0;
+    s->fac = (int32_t) ((double) t->fac*1073741824.0);
+    return s;
+}
+
+static void goertzel_fixed_reset(openr2_goertzel_fixed_state_t *s)
+{
+    s->v2 =
+    s->v3 = 0;
+}
+
+static int64_t goertzel_fixed_result(openr2_goertzel_fixed_state_t *s)
+{
+    int32_t v1;
+
+    /* Push a zero through the process to finish things off. */
+    v1 = s->v2;
+    s->v2 = s->v3;
+    s->v3 = q30_mul(s->fac, s->v2) - v1;
+    /* Now calculate the non-recursive side of the filter, in the same
+       (unscaled) units as goertzel_result(). */
+    return ((int64_t) s->v3*s->v3 + (int64_t) s->v2*s->v2 - (int64_t) s->v3*q30_mul(s->fac, s->v2))
+           /(GOERTZEL_FIXED_SCALE*GOERTZEL_FIXED_SCALE);
+}
+
+/* Each filter runs over the whole stretch with its state in registers, two
+   filters at a time so that one recursion hides the multiply latency of the
+   other. Going sample by sample over all the filters instead keeps the state
+   in memory, and every step of the recursion then waits for the store of the
+   step before it. The results are the same either way */
+static void goertzel_fixed_update(openr2_goertzel_fixed_state_t s[], int filters, const int32_t amp[], int samples)
+{
+    int32_t v1;
+    int32_t v2[2];
+    int32_t v3[2];
+    int32_t fac[2];
+    int i;
+    int j;
+
+    for (i = 0;  i + 1 < filters;  i += 2)
+    {
+        v2[0] = s[i].v2;
+        v3[0] = s[i].v3;
+        fac[0] = s[i].fac;
+        v2[1] = s[i + 1].v2;
+        v3[1] = s[i + 1].v3;
+        fac[1] = s[i + 1].fac;
+        for (j = 0;  j < samples;  j++)
+        {
+            v1 = v2[0];
+            v2[0] = v3[0];
+            v3[0] = q30_mul(fac[0], v2[0]) - v1 + amp[j]*GOERTZEL_FIXED_SCALE;
+            v1 = v2[1];
+            v2[1] = v3[1];
+            v3[1] = q30_mul(fac[1], v2[1]) - v1 + amp[j]*GOERTZEL_FIXED_SCALE;
+        }
+        s[i].v2 = v2[0];
+        s[i].v3 = v3[0];
+        s[i + 1].v2 = v2[1];
+        s[i + 1].v3 = v3[1];
+    }
+    if (i < filters)
+    {
+        v2[0] = s[i].v2;
+        v3[0] = s[i].v3;
+        for (j = 0;  j < samples;  j++)
+        {
+            v1 = v2[0];
+            v2[0] = v3[0];
+            v3[0] = q30_mul(s[i].fac, v2[0]) - v1 + amp[j]*GOERTZEL_FIXED_SCALE;
+        }
+        s[i].v2 = v2[0];
+        s[i].v3 = v3[0];
+    }
+}
+
+static void goertzel_bank_load(goertzel_bank_t *b, openr2_goertzel_state_t *s, int lane, int filters)
+{
+    int i;
+
+    if (lane == 0)
+        memset(b, 0, sizeof(*b));
+    for (i = 0;  i < filters;  i++)
+    {
+        b->v2[lane + i] = s[i].v2;
+        b->v3[lane + i] = s[i].v3;
+        b->fac[lane + i] = s[i].fac;
+    }
+}
+
+static void goertzel_bank_store(goertzel_bank_t *b, openr2_goertzel_state_t *s, int lane, int filters)
+{
+    int i;
+
+    for (i = 0;  i < filters;  i++)
+    {
+        s[i].v2 = b->v2[lane + i];
+        s[i].v3 = b->v3[lane + i];
+    }
+}
+
+static void goertzel_bank_update_generic(goertzel_bank_t *b, const float amp[], int samples)
+{
+    float v1;
+    int i;
+    int j;
+
+    for (j = 0;  j < samples;  j++)
     {
-        s->tone[0].phase_rate = dds_phase_ratef((float) f1);
-        if (f2 < 0)
-            s->tone[0].phase_rate = -s->tone[0].phase_rate;
-        s->tone[0].gain = dds_scaling_dbm0f((float) l1);
+        for (i = 0;  i < GOERTZEL_BANK_SIZE;  i++)
+        {
+            v1 = b->v2[i];
+            b->v2[i] = b->v3[i];
+            b->v3[i] = b->fac[i]*b->v2[i] - v1 + amp[j];
+        }
     }
-    if (f2)
+}
+
+#if defined(OR2_HAVE_X86_DISPATCH)
+/* Explicit multiply, subtract and add (no fused multiply-add), so the
+   vector kernels give exactly the same results as the generic one */
+__attribute__((target("sse2")))
+static void goertzel_bank_update_sse2(goertzel_bank_t *b, const float amp[], int samples)
+{
+    __m128 v1;
+    __m128 famp;
+    __m128 v2lo = _mm_loadu_ps(&b->v2[0]);
+    __m128 v2hi = _mm_loadu_ps(&b->v2[4]);
+    __m128 v3lo = _mm_loadu_ps(&b->v3[0]);
+    __m128 v3hi = _mm_loadu_ps(&b->v3[4]);
+    __m128 faclo = _mm_loadu_ps(&b->fac[0]);
+    __m128 fachi = _mm_loadu_ps(&b->fac[4]);
+    int j;
+
+    for (j = 0;  j < samples;  j++)
     {
-        s->tone[1].phase_rate = dds_phase_ratef((float) abs(f2));
-        s->tone[1].gain = (f2 < 0)  ?  (float) l2/100.0f  :  dds_scaling_dbm0f((float) l2);
+        famp = _mm_set1_ps(amp[j]);
+        v1 = v2lo;
+        v2lo = v3lo;
+        v3lo = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(faclo, v2lo), v1), famp);
+        v1 = v2hi;
+        v2hi = v3hi;
+        v3hi = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(fachi, v2hi), v1), famp);
     }
+    _mm_storeu_ps(&b->v2[0], v2lo);
+    _mm_storeu_ps(&b->v2[4], v2hi);
+    _mm_storeu_ps(&b->v3[0], v3lo);
+    _mm_storeu_ps(&b->v3[4], v3hi);
+}
 
-    s->duration[0] = d1*SAMPLE_RATE/1000;
-    s->duration[1] = d2*SAMPLE_RATE/1000;
-    s->duration[2] = d3*SAMPLE_RATE/1000;
-    s->duration[3] = d4*SAMPLE_RATE/1000;
+__attribute__((target("avx2")))
+static void goertzel_bank_update_avx2(goertzel_bank_t *b, const float amp[], int samples)
+{
+    __m256 v1;
+    __m256 v2 = _mm256_loadu_ps(b->v2);
+    __m256 v3 = _mm256_loadu_ps(b->v3);
+    __m256 fac = _mm256_loadu_ps(b->fac);
+    int j;
+
+    for (j = 0;  j < samples;  j++)
+    {
+        v1 = v2;
+        v2 = v3;
+        v3 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(fac, v2), v1), _mm256_set1_ps(amp[j]));
+    }
+    _mm256_storeu_ps(b->v2, v2);
+    _mm256_storeu_ps(b->v3, v3);
+}
+#endif
 
-    s->repeat = repeat;
+#if defined(OR2_HAVE_X86_DISPATCH)
+static void goertzel_select_kernel(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        goertzel_bank_update = goertzel_bank_update_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        goertzel_bank_update = goertzel_bank_update_sse2;
+    else
+        goertzel_bank_update = goertzel_bank_update_generic;
 }
+#endif
 
-static openr2_tone_gen_state_t *tone_gen_init(openr2_tone_gen_state_t *s, openr2_tone_gen_descriptor_t *t)
+static openr2_tone_gen_state_t *tone_gen_init(openr2_tone_gen_state_t *s, const openr2_tone_gen_descriptor_t *t)
 {
     int i;
 
@@ -2648,11 +6199,6 @@ static const float sine_table[SINELEN] =
     -0.00306796f
 };
 
-static int32_t dds_phase_ratef(float frequency)
-{
-	return (int32_t) (frequency*65536.0f*65536.0f/SAMPLE_RATE);
-}
-
 static float dds_scaling_dbm0f(float level)
 {
 	return powf(10.0f, (level - DBM0_MAX_SINE_POWER)/20.0f)*32767.0f;
@@ -2683,55 +6229,146 @@ static float dds_modf(uint32_t *phase_acc, int32_t phase_rate, float scale, int3
 #define DTMF_TO_TOTAL_ENERGY        42.0f
 #define DTMF_POWER_OFFSET           90.30f
 
+/* The same limits for the fixed-point detector, ratios in tenths */
+#define DTMF_THRESHOLD_FIXED        INT64_C(80000000)
+#define DTMF_NORMAL_TWIST_X10       63
+#define DTMF_REVERSE_TWIST_X10      25
+#define DTMF_RELATIVE_PEAK_ROW_X10  63
+#define DTMF_RELATIVE_PEAK_COL_X10  63
+#define DTMF_TO_TOTAL_ENERGY_FIXED  42
+
 /* This is based on A-law, but u-law is only 0.03dB different */
 #define DBM0_MAX_POWER          (3.14f + 3.02f)
 
-static const float dtmf_row[] =
+static const char dtmf_positions[] = "123A" "456B" "789C" "*0#D";
+
+/* Goertzel descriptors for the DTMF rows and columns, over a 102 sample
+   block. fac is 2cos(2*pi*f/8000), printed by r2tables */
+static const openr2_goertzel_descriptor_t dtmf_detect_row[4] =
 {
-     697.0f,  770.0f,  852.0f,  941.0f
+    {1.7077378f, 102},    /*  697Hz */
+    {1.64528108f, 102},    /*  770Hz */
+    {1.56868696f, 102},    /*  852Hz */
+    {1.47820449f, 102}     /*  941Hz */
 };
-static const float dtmf_col[] =
+
+static const openr2_goertzel_descriptor_t dtmf_detect_col[4] =
 {
-    1209.0f, 1336.0f, 1477.0f, 1633.0f
+    {1.16410398f, 102},    /* 1209Hz */
+    {0.996370196f, 102},    /* 1336Hz */
+    {0.798618376f, 102},    /* 1477Hz */
+    {0.568532646f, 102}     /* 1633Hz */
 };
 
-static const char dtmf_positions[] = "123A" "456B" "789C" "*0#D";
-static openr2_goertzel_descriptor_t dtmf_detect_row[4];
-static openr2_goertzel_descriptor_t dtmf_detect_col[4];
-
-static int dtmf_tx_inited = FALSE;
-static openr2_tone_gen_descriptor_t dtmf_digit_tones[16];
-
-static void dtmf_tx_initialise(void)
+/* Tone generator descriptors for each digit, in dtmf_positions order, at
+   DEFAULT_DTMF_TX_LEVEL with the default timing, printed by r2tables.
+   openr2_dtmf_tx() replaces the levels and the timing with the ones of the
+   transmitter */
+static const openr2_tone_gen_descriptor_t dtmf_digit_tones[16] =
 {
-    int row;
-    int col;
-
-    if (dtmf_tx_inited)
-        return;
-    for (row = 0;  row < 4;  row++)
-    {
-        for (col = 0;  col < 4;  col++)
-        {
-            make_tone_gen_descriptor(&dtmf_digit_tones[row*4 + col],
-                                     (int) dtmf_row[row],
-                                     DEFAULT_DTMF_TX_LEVEL,
-                                     (int) dtmf_col[col],
-                                     DEFAULT_DTMF_TX_LEVEL,
-                                     DEFAULT_DTMF_TX_ON_TIME,
-                                     DEFAULT_DTMF_TX_OFF_TIME,
-                                     0,
-                                     0,
-                                     FALSE);
-        }
+    {   /* 1 */
+        {{374199040, 7218.3291f}, {649076928, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 2 */
+        {{374199040, 7218.3291f}, {717259520, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 3 */
+        {{374199040, 7218.3291f}, {792958336, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* A */
+        {{374199040, 7218.3291f}, {876710208, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 4 */
+        {{413390592, 7218.3291f}, {649076928, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 5 */
+        {{413390592, 7218.3291f}, {717259520, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 6 */
+        {{413390592, 7218.3291f}, {792958336, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* B */
+        {{413390592, 7218.3291f}, {876710208, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 7 */
+        {{457414016, 7218.3291f}, {649076928, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 8 */
+        {{457414016, 7218.3291f}, {717259520, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 9 */
+        {{457414016, 7218.3291f}, {792958336, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* C */
+        {{457414016, 7218.3291f}, {876710208, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* * */
+        {{505195520, 7218.3291f}, {649076928, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* 0 */
+        {{505195520, 7218.3291f}, {717259520, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* # */
+        {{505195520, 7218.3291f}, {792958336, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
+    },
+    {   /* D */
+        {{505195520, 7218.3291f}, {876710208, 7218.3291f}, {0, 0.0f}, {0, 0.0f}},
+        {400, 440, 0, 0},
+        0
     }
-    dtmf_tx_inited = TRUE;
+};
+/* Render the tone of a digit in A-law, at the levels and on time of the
+   transmitter, the same way openr2_dtmf_tx() generates it */
+static void dtmf_tx_render(openr2_dtmf_tx_state_t *s, int digit)
+{
+    openr2_tone_gen_state_t tones;
+    int16_t amp[OR2_DTMF_TX_MAX_RENDERED];
+
+    tone_gen_init(&tones, &dtmf_digit_tones[digit]);
+    tones.tone[0].gain = s->low_level;
+    tones.tone[1].gain = s->high_level;
+    tones.duration[0] = s->on_time;
+    tones.duration[1] = 0;
+    tone_gen(&tones, amp, s->on_time);
+    linear_to_alaw_block(s->alaw_tones[digit], amp, s->on_time);
+    s->alaw_rendered |= (1 << digit);
 }
 
 OR2_DECLARE(void) openr2_dtmf_tx_set_level(openr2_dtmf_tx_state_t *s, int level, int twist)
 {
     s->low_level = dds_scaling_dbm0f((float) level);
     s->high_level = dds_scaling_dbm0f((float) (level + twist));
+    s->alaw_rendered = 0;
 }
 
 OR2_DECLARE(openr2_dtmf_tx_state_t *) openr2_dtmf_tx_init(openr2_dtmf_tx_state_t *s)
@@ -2741,13 +6378,12 @@ OR2_DECLARE(openr2_dtmf_tx_state_t *) openr2_dtmf_tx_init(openr2_dtmf_tx_state_t
         if ((s = (openr2_dtmf_tx_state_t *) malloc(sizeof (*s))) == NULL)
             return  NULL;
     }
-    if (!dtmf_tx_inited)
-        dtmf_tx_initialise();
     tone_gen_init(&(s->tones), &dtmf_digit_tones[0]);
     openr2_dtmf_tx_set_level(s, DEFAULT_DTMF_TX_LEVEL, 0);
     openr2_dtmf_tx_set_timing(s, -1, -1);
     queue_init(&s->queue.queue, OR2_MAX_DTMF_DIGITS, QUEUE_READ_ATOMIC | QUEUE_WRITE_ATOMIC);
     s->tones.current_section = -1;
+    s->alaw_digit = -1;
     return s;
 }
 
@@ -2755,11 +6391,13 @@ OR2_DECLARE(void) openr2_dtmf_tx_set_timing(openr2_dtmf_tx_state_t *s, int on_ti
 {
     s->on_time = ((on_time >= 0)  ?  on_time  :  DEFAULT_DTMF_TX_ON_TIME)*SAMPLE_RATE/1000;
     s->off_time = ((off_time >= 0)  ?  off_time  :  DEFAULT_DTMF_TX_OFF_TIME)*SAMPLE_RATE/1000;
+    s->alaw_rendered = 0;
 }
 
 OR2_DECLARE(size_t) openr2_dtmf_tx_put(openr2_dtmf_tx_state_t *s, const char *digits, int len)
 {
     size_t space;
+    const char *cp;
 
     /* This returns the number of characters that would not fit in the buffer.
        The buffer will only be loaded if the whole string of digits will fit,
@@ -2771,9 +6409,18 @@ OR2_DECLARE(size_t) openr2_dtmf_tx_put(openr2_dtmf_tx_state_t *s, const char *di
     }
     if ((space = queue_free_space(&s->queue.queue)) < (size_t) len)
         return len - space;
-    if (queue_write(&s->queue.queue, (const uint8_t *) digits, len) >= 0)
-        return 0;
-    return -1;
+    if (queue_write(&s->queue.queue, (const uint8_t *) digits, len) < 0)
+        return -1;
+    /* Render the tones now, so openr2_dtmf_tx_alaw() just has to copy them */
+    if (s->on_time <= OR2_DTMF_TX_MAX_RENDERED)
+    {
+        for (  ;  len > 0;  len--, digits++)
+        {
+            if (*digits  &&  (cp = strchr(dtmf_positions, *digits))  &&  !(s->alaw_rendered & (1 << (cp - dtmf_positions))))
+                dtmf_tx_render(s, cp - dtmf_positions);
+        }
+    }
+    return 0;
 }
 
 OR2_DECLARE(int) openr2_dtmf_tx(openr2_dtmf_tx_state_t *s, int16_t amp[], int max_samples)
@@ -2805,12 +6452,71 @@ OR2_DECLARE(int) openr2_dtmf_tx(openr2_dtmf_tx_state_t *s, int16_t amp[], int ma
     return len;
 }
 
+OR2_DECLARE(int) openr2_dtmf_tx_alaw(openr2_dtmf_tx_state_t *s, uint8_t alaw[], int max_samples)
+{
+    int16_t amp[160];
+    const char *cp;
+    int digit;
+    int len;
+    int i;
+
+    if (s->on_time > OR2_DTMF_TX_MAX_RENDERED)
+    {
+        /* Too long to keep rendered, generate it and encode it as it goes */
+        for (len = 0;  len < max_samples;  len += i)
+        {
+            i = max_samples - len;
+            if (i > (int) (sizeof(amp)/sizeof(amp[0])))
+                i = sizeof(amp)/sizeof(amp[0]);
+            if ((i = openr2_dtmf_tx(s, amp, i)) <= 0)
+                break;
+            linear_to_alaw_block(alaw + len, amp, i);
+        }
+        return len;
+    }
+    len = 0;
+    while (len < max_samples)
+    {
+        if (s->alaw_digit < 0)
+        {
+            /* Step to the next digit */
+            if ((digit = queue_read_byte(&s->queue.queue)) < 0)
+                break;
+            if (digit == 0  ||  (cp = strchr(dtmf_positions, digit)) == NULL)
+                continue;
+            s->alaw_digit = cp - dtmf_positions;
+            s->alaw_position = 0;
+            if (!(s->alaw_rendered & (1 << s->alaw_digit)))
+                dtmf_tx_render(s, s->alaw_digit);
+        }
+        if (s->alaw_position < s->on_time)
+        {
+            i = s->on_time - s->alaw_position;
+            if (i > max_samples - len)
+                i = max_samples - len;
+            memcpy(alaw + len, s->alaw_tones[s->alaw_digit] + s->alaw_position, i);
+        }
+        else
+        {
+            i = s->on_time + s->off_time - s->alaw_position;
+            if (i > max_samples - len)
+                i = max_samples - len;
+            /* A-law encoded silence */
+            memset(alaw + len, OR2_ALAW_AMI_MASK | 0x80, i);
+        }
+        len += i;
+        s->alaw_position += i;
+        if (s->alaw_position >= s->on_time + s->off_time)
+            s->alaw_digit = -1;
+    }
+    return len;
+}
+
 OR2_DECLARE(openr2_dtmf_rx_state_t *) openr2_dtmf_rx_init(openr2_dtmf_rx_state_t *s,
                               openr2_digits_rx_callback_t callback,
                               void *user_data)
 {
     int i;
-    static int initialised = FALSE;
 
     if (s == NULL)
     {
@@ -2828,20 +6534,19 @@ OR2_DECLARE(openr2_dtmf_rx_state_t *) openr2_dtmf_rx_init(openr2_dtmf_rx_state_t
     s->in_digit = 0;
     s->last_hit = 0;
 
-    if (!initialised)
-    {
-        for (i = 0;  i < 4;  i++)
-        {
-            make_goertzel_descriptor(&dtmf_detect_row[i], dtmf_row[i], 102);
-            make_goertzel_descriptor(&dtmf_detect_col[i], dtmf_col[i], 102);
-        }
-        initialised = TRUE;
-    }
     for (i = 0;  i < 4;  i++)
     {
         goertzel_init(&s->row_out[i], &dtmf_detect_row[i]);
         goertzel_init(&s->col_out[i], &dtmf_detect_col[i]);
+        goertzel_fixed_init(&s->row_out_fixed[i], &dtmf_detect_row[i]);
+        goertzel_fixed_init(&s->col_out_fixed[i], &dtmf_detect_col[i]);
     }
+    s->fixed_point = FALSE;
+    s->z350[0] = s->z350[1] = 0.0f;
+    s->z440[0] = s->z440[1] = 0.0f;
+    s->z350_fixed[0] = s->z350_fixed[1] = 0;
+    s->z440_fixed[0] = s->z440_fixed[1] = 0;
+    s->energy_fixed = 0;
     s->energy = 0.0f;
     s->current_sample = 0;
     s->lost_digits = 0;
@@ -2850,17 +6555,135 @@ OR2_DECLARE(openr2_dtmf_rx_state_t *) openr2_dtmf_rx_init(openr2_dtmf_rx_state_t
     return s;
 }
 
-OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[], int samples)
+/* Find the peak row and column at the end of a DTMF detection block, and
+   check them against the DTMF specs. Returns the digit found, if any */
+static uint8_t dtmf_rx_block_hit(openr2_dtmf_rx_state_t *s)
 {
     float row_energy[4];
     float col_energy[4];
+    int i;
+    int best_row;
+    int best_col;
+    uint8_t hit;
+
+    /* Find the peak row and the peak column */
+    row_energy[0] = goertzel_result(&s->row_out[0]);
+    best_row = 0;
+    col_energy[0] = goertzel_result(&s->col_out[0]);
+    best_col = 0;
+
+    for (i = 1;  i < 4;  i++)
+    {
+        row_energy[i] = goertzel_result(&s->row_out[i]);
+        if (row_energy[i] > row_energy[best_row])
+            best_row = i;
+        col_energy[i] = goertzel_result(&s->col_out[i]);
+        if (col_energy[i] > col_energy[best_col])
+            best_col = i;
+    }
+    hit = 0;
+    /* Basic signal level test and the twist test */
+    if (row_energy[best_row] >= DTMF_THRESHOLD
+        &&
+        col_energy[best_col] >= DTMF_THRESHOLD
+        &&
+        col_energy[best_col] < row_energy[best_row]*s->reverse_twist
+        &&
+        col_energy[best_col]*s->normal_twist > row_energy[best_row])
+    {
+        /* Relative peak test ... */
+        for (i = 0;  i < 4;  i++)
+        {
+            if ((i != best_col  &&  col_energy[i]*DTMF_RELATIVE_PEAK_COL > col_energy[best_col])
+                ||
+                (i != best_row  &&  row_energy[i]*DTMF_RELATIVE_PEAK_ROW > row_energy[best_row]))
+            {
+                break;
+            }
+        }
+        /* ... and fraction of total energy test */
+        if (i >= 4
+            &&
+            (row_energy[best_row] + col_energy[best_col]) > DTMF_TO_TOTAL_ENERGY*s->energy)
+        {
+            /* Got a hit */
+            hit = dtmf_positions[(best_row << 2) + best_col];
+        }
+    }
+    return hit;
+}
+
+/* Same as dtmf_rx_block_hit() for the fixed-point filters. The twist
+   limits are the DTMF_*_TWIST defaults the floating point detector starts with */
+static uint8_t dtmf_rx_fixed_block_hit(openr2_dtmf_rx_state_t *s)
+{
+    int64_t row_energy[4];
+    int64_t col_energy[4];
+    int i;
+    int best_row;
+    int best_col;
+    uint8_t hit;
+
+    /* Find the peak row and the peak column */
+    row_energy[0] = goertzel_fixed_result(&s->row_out_fixed[0]);
+    best_row = 0;
+    col_energy[0] = goertzel_fixed_result(&s->col_out_fixed[0]);
+    best_col = 0;
+
+    for (i = 1;  i < 4;  i++)
+    {
+        row_energy[i] = goertzel_fixed_result(&s->row_out_fixed[i]);
+        if (row_energy[i] > row_energy[best_row])
+            best_row = i;
+        col_energy[i] = goertzel_fixed_result(&s->col_out_fixed[i]);
+        if (col_energy[i] > col_energy[best_col])
+            best_col = i;
+    }
+    hit = 0;
+    /* Basic signal level test and the twist test */
+    if (row_energy[best_row] >= DTMF_THRESHOLD_FIXED
+        &&
+        col_energy[best_col] >= DTMF_THRESHOLD_FIXED
+        &&
+        col_energy[best_col]*10 < row_energy[best_row]*DTMF_REVERSE_TWIST_X10
+        &&
+        col_energy[best_col]*DTMF_NORMAL_TWIST_X10 > row_energy[best_row]*10)
+    {
+        /* Relative peak test ... */
+        for (i = 0;  i < 4;  i++)
+        {
+            if ((i != best_col  &&  col_energy[i]*DTMF_RELATIVE_PEAK_COL_X10 > col_energy[best_col]*10)
+                ||
+                (i != best_row  &&  row_energy[i]*DTMF_RELATIVE_PEAK_ROW_X10 > row_energy[best_row]*10))
+            {
+                break;
+            }
+        }
+        /* ... and fraction of total energy test */
+        if (i >= 4
+            &&
+            (row_energy[best_row] + col_energy[best_col]) > DTMF_TO_TOTAL_ENERGY_FIXED*s->energy_fixed)
+        {
+            /* Got a hit */
+            hit = dtmf_positions[(best_row << 2) + best_col];
+        }
+    }
+    return hit;
+}
+
+/* Run linear samples (amp) or A-law samples (alaw) through the DTMF detector */
+static int dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[], const uint8_t alaw[], int samples)
+{
+    goertzel_bank_t bank;
+    float block[102];
     float famp;
     float v1;
+    int32_t fixed_block[102];
+    int32_t fixed_amp;
+    int32_t fixed_v1;
     int i;
     int j;
     int sample;
-    int best_row;
-    int best_col;
     int limit;
     uint8_t hit;
 
@@ -2872,110 +6695,66 @@ OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[],
             limit = sample + (102 - s->current_sample);
         else
             limit = samples;
-        /* The following unrolled loop takes only 35% (rough estimate) of the 
-           time of a rolled loop on the machine on which it was developed */
-        for (j = sample;  j < limit;  j++)
+        if (s->fixed_point)
         {
-            famp = amp[j];
-            if (s->filter_dialtone)
+            for (j = sample;  j < limit;  j++)
             {
-                /* Sharp notches applied at 350Hz and 440Hz - the two common dialtone frequencies.
-                   These are rather high Q, to achieve the required narrowness, without using lots of
-                   sections. */
-                v1 = 0.98356f*famp + 1.8954426f*s->z350[0] - 0.9691396f*s->z350[1];
-                famp = v1 - 1.9251480f*s->z350[0] + s->z350[1];
-                s->z350[1] = s->z350[0];
-                s->z350[0] = v1;
-
-                v1 = 0.98456f*famp + 1.8529543f*s->z440[0] - 0.9691396f*s->z440[1];
-                famp = v1 - 1.8819938f*s->z440[0] + s->z440[1];
-                s->z440[1] = s->z440[0];
-                s->z440[0] = v1;
-            }
-            s->energy += famp*famp;
-            /* With GCC 2.95, the following unrolled code seems to take about 35%
-               (rough estimate) as long as a neat little 0-3 loop */
-            v1 = s->row_out[0].v2;
-            s->row_out[0].v2 = s->row_out[0].v3;
-            s->row_out[0].v3 = s->row_out[0].fac*s->row_out[0].v2 - v1 + famp;
-
-            v1 = s->col_out[0].v2;
-            s->col_out[0].v2 = s->col_out[0].v3;
-            s->col_out[0].v3 = s->col_out[0].fac*s->col_out[0].v2 - v1 + famp;
-
-            v1 = s->row_out[1].v2;
-            s->row_out[1].v2 = s->row_out[1].v3;
-            s->row_out[1].v3 = s->row_out[1].fac*s->row_out[1].v2 - v1 + famp;
-
-            v1 = s->col_out[1].v2;
-            s->col_out[1].v2 = s->col_out[1].v3;
-            s->col_out[1].v3 = s->col_out[1].fac*s->col_out[1].v2 - v1 + famp;
-
-            v1 = s->row_out[2].v2;
-            s->row_out[2].v2 = s->row_out[2].v3;
-            s->row_out[2].v3 = s->row_out[2].fac*s->row_out[2].v2 - v1 + famp;
-
-            v1 = s->col_out[2].v2;
-            s->col_out[2].v2 = s->col_out[2].v3;
-            s->col_out[2].v3 = s->col_out[2].fac*s->col_out[2].v2 - v1 + famp;
-
-            v1 = s->row_out[3].v2;
-            s->row_out[3].v2 = s->row_out[3].v3;
-            s->row_out[3].v3 = s->row_out[3].fac*s->row_out[3].v2 - v1 + famp;
-
-            v1 = s->col_out[3].v2;
-            s->col_out[3].v2 = s->col_out[3].v3;
-            s->col_out[3].v3 = s->col_out[3].fac*s->col_out[3].v2 - v1 + famp;
-        }
-        s->current_sample += (limit - sample);
-        if (s->current_sample < 102)
-            continue;
-
-        /* We are at the end of a DTMF detection block */
-        /* Find the peak row and the peak column */
-        row_energy[0] = goertzel_result(&s->row_out[0]);
-        best_row = 0;
-        col_energy[0] = goertzel_result(&s->col_out[0]);
-        best_col = 0;
+                fixed_amp = (alaw)  ?  openr2_alaw_to_linear(alaw[j])  :  amp[j];
+                if (s->filter_dialtone)
+                {
+                    /* The same notches as below, with Q14 coefficients */
+                    fixed_v1 = q14_mul(Q14(0.98356f), fixed_amp) + q14_mul(Q14(1.8954426f), s->z350_fixed[0]) - q14_mul(Q14(0.9691396f), s->z350_fixed[1]);
+                    fixed_amp = fixed_v1 - q14_mul(Q14(1.9251480f), s->z350_fixed[0]) + s->z350_fixed[1];
+                    s->z350_fixed[1] = s->z350_fixed[0];
+                    s->z350_fixed[0] = fixed_v1;
 
-        for (i = 1;  i < 4;  i++)
-        {
-            row_energy[i] = goertzel_result(&s->row_out[i]);
-            if (row_energy[i] > row_energy[best_row])
-                best_row = i;
-            col_energy[i] = goertzel_result(&s->col_out[i]);
-            if (col_energy[i] > col_energy[best_col])
-                best_col = i;
+                    fixed_v1 = q14_mul(Q14(0.98456f), fixed_amp) + q14_mul(Q14(1.8529543f), s->z440_fixed[0]) - q14_mul(Q14(0.9691396f), s->z440_fixed[1]);
+                    fixed_amp = fixed_v1 - q14_mul(Q14(1.8819938f), s->z440_fixed[0]) + s->z440_fixed[1];
+                    s->z440_fixed[1] = s->z440_fixed[0];
+                    s->z440_fixed[0] = fixed_v1;
+                }
+                s->energy_fixed += (int64_t) fixed_amp*fixed_amp;
+                fixed_block[j - sample] = fixed_amp;
+            }
+            goertzel_fixed_update(s->row_out_fixed, 4, fixed_block, limit - sample);
+            goertzel_fixed_update(s->col_out_fixed, 4, fixed_block, limit - sample);
         }
-        hit = 0;
-        /* Basic signal level test and the twist test */
-        if (row_energy[best_row] >= DTMF_THRESHOLD
-            &&
-            col_energy[best_col] >= DTMF_THRESHOLD
-            &&
-            col_energy[best_col] < row_energy[best_row]*s->reverse_twist
-            &&
-            col_energy[best_col]*s->normal_twist > row_energy[best_row])
+        else
         {
-            /* Relative peak test ... */
-            for (i = 0;  i < 4;  i++)
+            for (j = sample;  j < limit;  j++)
             {
-                if ((i != best_col  &&  col_energy[i]*DTMF_RELATIVE_PEAK_COL > col_energy[best_col])
-                    ||
-                    (i != best_row  &&  row_energy[i]*DTMF_RELATIVE_PEAK_ROW > row_energy[best_row]))
+                famp = (alaw)  ?  alaw_to_float[alaw[j]]  :  amp[j];
+                if (s->filter_dialtone)
                 {
-                    break;
+                    /* Sharp notches applied at 350Hz and 440Hz - the two common dialtone frequencies.
+                       These are rather high Q, to achieve the required narrowness, without using lots of
+                       sections. */
+                    v1 = 0.98356f*famp + 1.8954426f*s->z350[0] - 0.9691396f*s->z350[1];
+                    famp = v1 - 1.9251480f*s->z350[0] + s->z350[1];
+                    s->z350[1] = s->z350[0];
+                    s->z350[0] = v1;
+
+                    v1 = 0.98456f*famp + 1.8529543f*s->z440[0] - 0.9691396f*s->z440[1];
+                    famp = v1 - 1.8819938f*s->z440[0] + s->z440[1];
+                    s->z440[1] = s->z440[0];
+                    s->z440[0] = v1;
                 }
+                s->energy += famp*famp;
+                block[j - sample] = famp;
             }
-            /* ... and fraction of total energy test */
-            if (i >= 4
-                &&
-                (row_energy[best_row] + col_energy[best_col]) > DTMF_TO_TOTAL_ENERGY*s->energy)
-            {
-                /* Got a hit */
-                hit = dtmf_positions[(best_row << 2) + best_col];
-            }
+            /* Rows in lanes 0-3, columns in lanes 4-7 */
+            goertzel_bank_load(&bank, s->row_out, 0, 4);
+            goertzel_bank_load(&bank, s->col_out, 4, 4);
+            goertzel_bank_update(&bank, block, limit - sample);
+            goertzel_bank_store(&bank, s->row_out, 0, 4);
+            goertzel_bank_store(&bank, s->col_out, 4, 4);
         }
+        s->current_sample += (limit - sample);
+        if (s->current_sample < 102)
+            continue;
+
+        /* We are at the end of a DTMF detection block */
+        hit = (s->fixed_point)  ?  dtmf_rx_fixed_block_hit(s)  :  dtmf_rx_block_hit(s);
         /* The logic in the next test should ensure the following for different successive hit patterns:
                 -----ABB = start of digit B.
                 ----B-BB = start of digit B
@@ -3013,7 +6792,7 @@ OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[],
                     /* Avoid reporting multiple no digit conditions on flaky hits */
                     if (s->in_digit  ||  hit)
                     {
-                        i = (s->in_digit  &&  !hit)  ?  -99  :  lfastrintf(log10f(s->energy)*10.0f - 20.08f - DTMF_POWER_OFFSET + DBM0_MAX_POWER);
+                        i = (s->in_digit  &&  !hit)  ?  -99  :  lfastrintf(log10f((s->fixed_point)  ?  (float) s->energy_fixed  :  s->energy)*10.0f - 20.08f - DTMF_POWER_OFFSET + DBM0_MAX_POWER);
                         s->realtime_callback(s->realtime_callback_data, hit, i, 0);
                     }
                 }
@@ -3046,8 +6825,11 @@ OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[],
         {
             goertzel_reset(&s->row_out[i]);
             goertzel_reset(&s->col_out[i]);
+            goertzel_fixed_reset(&s->row_out_fixed[i]);
+            goertzel_fixed_reset(&s->col_out_fixed[i]);
         }
         s->energy = 0.0f;
+        s->energy_fixed = 0;
         s->current_sample = 0;
     }
     if (s->current_digits  &&  s->digits_callback)
@@ -3059,6 +6841,34 @@ OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[],
     return 0;
 }
 
+OR2_DECLARE(int) openr2_dtmf_rx(openr2_dtmf_rx_state_t *s, const int16_t amp[], int samples)
+{
+    return dtmf_rx(s, amp, NULL, samples);
+}
+
+OR2_DECLARE(int) openr2_dtmf_rx_alaw(openr2_dtmf_rx_state_t *s, const uint8_t alaw[], int samples)
+{
+    return dtmf_rx(s, NULL, alaw, samples);
+}
+
+OR2_DECLARE(void) openr2_dtmf_rx_set_fixed_point(openr2_dtmf_rx_state_t *s, int enable)
+{
+    int i;
+
+    /* Restart the current block with the selected filters */
+    s->fixed_point = (enable)  ?  TRUE  :  FALSE;
+    for (i = 0;  i < 4;  i++)
+    {
+        goertzel_reset(&s->row_out[i]);
+        goertzel_reset(&s->col_out[i]);
+        goertzel_fixed_reset(&s->row_out_fixed[i]);
+        goertzel_fixed_reset(&s->col_out_fixed[i]);
+    }
+    s->energy = 0.0f;
+    s->energy_fixed = 0;
+    s->current_sample = 0;
+}
+
 OR2_DECLARE(int) openr2_dtmf_rx_status(openr2_dtmf_rx_state_t *s)
 {
     if (s->in_digit)
@@ -43,6 +43,12 @@
 #ifdef HAVE_STRING_H
 #include <string.h>
 #endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifndef WIN32
+#include <poll.h>
+#endif
 #include "openr2/r2zapcompat.h"
 #include "openr2/r2log-pvt.h"
 #include "openr2/r2chan-pvt.h"
@@ -153,6 +159,20 @@ static int zt_flush_write_buffers(openr2_chan_t *r2chan)
 	return 0;
 }
 
+static int zt_flush_read_buffers(openr2_chan_t *r2chan)
+{
+	int myerrno = 0;
+	int flush_read = ZT_FLUSH_READ;
+	int fd = (long)r2chan->fd;
+	if (ioctl(fd, ZT_FLUSH, &flush_read)) {
+		myerrno = errno;
+		EMI(r2chan)->on_os_error(r2chan, myerrno);
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Flush read buffer failed: %s\n", strerror(myerrno));
+		return -1;
+	}
+	return 0;
+}
+
 static int zt_get_cas(openr2_chan_t *r2chan, int *cas)
 {
 	int myerrno = 0;
@@ -272,6 +292,14 @@ static int zt_setup(openr2_chan_t *r2chan)
 		return -1;
 	}
 
+	zapval = r2context->linear_io;
+	res = ioctl(chanfd, ZT_SETLINEAR, &zapval);
+	if (res) {
+		r2context->last_error = OR2_LIBERR_SYSCALL_FAILED;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to set linear mode %d on channel %d (%s)\n", zapval, channo, strerror(errno));
+		return -1;
+	}
+
 	zapval = 0;
 	res = ioctl(chanfd, ZT_ECHOCANCEL, &zapval);
 	if (res) {
@@ -350,6 +378,11 @@ static int zt_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
 	return 0;
 }
 
+static openr2_io_format_t zt_get_format(openr2_chan_t *r2chan)
+{
+	return r2chan->r2context->linear_io ? OR2_IO_FORMAT_SLINEAR : OR2_IO_FORMAT_ALAW;
+}
+
 static openr2_io_interface_t zt_io_interface = 
 {
 	.open = zt_open,
@@ -362,7 +395,12 @@ static openr2_io_interface_t zt_io_interface =
 	.setup = zt_setup,
 	.wait = zt_wait,
 	.get_oob_event = zt_get_oob_event,
-	.get_alarm_state = zt_get_alarm_state
+	.get_alarm_state = zt_get_alarm_state,
+	.get_format = zt_get_format,
+	.span = NULL,
+	.peek = NULL,
+	.consume = NULL,
+	.flush_read_buffers = zt_flush_read_buffers
 };
 
 openr2_io_interface_t *openr2_io_get_zt_interface()
@@ -404,6 +442,11 @@ int openr2_io_close(openr2_chan_t *r2chan)
 
 int openr2_io_set_cas(openr2_chan_t *r2chan, int cas)
 {
+	/* the span write will carry it */
+	if (r2chan->span_cas_write != -1) {
+		r2chan->span_cas_write = cas;
+		return 0;
+	}
 	IO(r2chan)->set_cas(r2chan, cas);
 	return rc;
 }
@@ -414,7 +457,18 @@ int openr2_io_set_cas(openr2_chan_t *r2chan, int cas)
 		     ((cas) & (1 << 0)) ? 1 : 0
 int openr2_io_get_cas(openr2_chan_t *r2chan, int *cas)
 {
-	IO(r2chan)->get_cas(r2chan, cas);
+	int rc = 0;
+	if (r2chan->span_cas_read != -1) {
+		/* already read along with the rest of the span */
+		*cas = r2chan->span_cas_read;
+		r2chan->span_cas_read = -1;
+	} else if (!r2chan->r2context->io) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR,
+				"%s: Cannot perform I/O operation because no valid I/O interface is available.\n", __FUNCTION__);
+		return -1;
+	} else {
+		rc = r2chan->r2context->io->get_cas(r2chan, cas);
+	}
 	if (!rc) {
 		if (*cas != r2chan->cas_raw_read) {
 			openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "CAS bits changed from %d%d%d%d to %d%d%d%d\n", 
@@ -470,3 +524,73 @@ int openr2_io_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
 	return rc;
 }
 
+openr2_io_span_interface_t *openr2_io_get_span_interface(openr2_context_t *r2context)
+{
+	return r2context->io ? r2context->io->span : NULL;
+}
+
+int openr2_io_span_wait(openr2_chan_t *r2chans[], int numchans, int timeout)
+{
+	openr2_io_span_interface_t *span = openr2_io_get_span_interface(r2chans[0]->r2context);
+#ifndef WIN32
+	struct pollfd *pfds;
+	int i, res;
+#endif
+	if (span && span->wait) {
+		return span->wait(r2chans, numchans, timeout);
+	}
+#ifndef WIN32
+	/* the descriptors of the channels tell, as they do with DAHDI */
+	pfds = calloc(numchans, sizeof(*pfds));
+	if (!pfds) {
+		r2chans[0]->r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+		return -1;
+	}
+	for (i = 0; i < numchans; i++) {
+		pfds[i].fd = (int)(long)r2chans[i]->fd;
+		pfds[i].events = POLLIN | POLLPRI;
+	}
+	res = poll(pfds, numchans, timeout);
+	free(pfds);
+	if (res == -1 && errno == EINTR) {
+		return 0;
+	}
+	return res;
+#else
+	openr2_log2(r2chans[0]->r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Waiting on a span needs I/O that can do it\n");
+	return -1;
+#endif
+}
+
+openr2_io_format_t openr2_io_get_format(openr2_chan_t *r2chan)
+{
+	if (!r2chan->r2context->io || !r2chan->r2context->io->get_format) {
+		return OR2_IO_FORMAT_ALAW;
+	}
+	return r2chan->r2context->io->get_format(r2chan);
+}
+
+int openr2_io_peek(openr2_chan_t *r2chan, const void **buf, int size)
+{
+	/* without read in place every frame is copied by read */
+	if (!r2chan->r2context->io || !r2chan->r2context->io->peek || !r2chan->r2context->io->consume) {
+		return 0;
+	}
+	return r2chan->r2context->io->peek(r2chan, buf, size);
+}
+
+int openr2_io_consume(openr2_chan_t *r2chan, int size)
+{
+	IO(r2chan)->consume(r2chan, size);
+	return rc;
+}
+
+int openr2_io_flush_read_buffers(openr2_chan_t *r2chan)
+{
+	/* nothing to drop if the I/O does not keep media around */
+	if (!r2chan->r2context->io || !r2chan->r2context->io->flush_read_buffers) {
+		return 0;
+	}
+	return r2chan->r2context->io->flush_read_buffers(r2chan);
+}
+
@@ -0,0 +1,873 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2ioloop.c - in-process virtual E1 trunks, to run calls between two
+ *              contexts of the same process without any telephony hardware
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Each channel number is a virtual trunk with two ends: the first channel
+ * opened with a given number gets one end and the second channel opened with
+ * the same number, usually from another context, gets the other one. The CAS
+ * bits written on one end are read on the other end along with a CAS change
+ * event, and the media written on one end is read on the other end.
+ *
+ * The line runs on a 20ms frame clock like a real E1: each end can read a
+ * frame of OR2_CHAN_READ_SIZE samples every 20ms, which is silence when the
+ * far end did not write anything. In free running mode the two ends of a
+ * trunk that are both reading take turns instead: an end reads its next frame
+ * once the far end read its own one and came back to wait for more, by then
+ * it wrote whatever it had to write, so calls go as fast as the CPU allows
+ * and the tones are never cut by frames the far end did not get to write.
+ *
+ * The descriptor of each channel is the read end of a pipe that is readable
+ * whenever there is an event to get, or a frame to read while the channel
+ * reads media, so applications can keep polling it as they would poll a DAHDI
+ * channel.
+ *
+ * The trunks can also be opened as a span with openr2_chan_new_span(), the
+ * CAS bits and the alarm state of the whole span are then read and written
+ * at once and openr2_chan_wait_span() waits on all of its channels.
+ */
+
+#if !defined(_XOPEN_SOURCE) && !defined(__FreeBSD__)
+#define _XOPEN_SOURCE 600
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef WIN32
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#endif
+#include "openr2/r2log-pvt.h"
+#include "openr2/r2chan-pvt.h"
+#include "openr2/r2context-pvt.h"
+#include "openr2/r2ioabs.h"
+
+#ifndef WIN32
+
+/* duration of a frame of the line */
+#define LOOP_FRAME_MS 20
+#define LOOP_FRAME_SIZE OR2_CHAN_READ_SIZE
+
+/* frames written and not read yet by the far end, beyond that the writer
+   is told it cannot write */
+#define LOOP_RX_FRAMES 2
+#define LOOP_RX_SIZE (LOOP_RX_FRAMES * LOOP_FRAME_SIZE)
+
+/* frame periods that can go by without reading before the frames and the
+   media not read are lost */
+#define LOOP_MAX_TICKS 4
+
+/* an end that did not read for this many frames is not waited for by the
+   free running mode of the far end */
+#define LOOP_IDLE_TICKS 2
+
+/* A-law silence */
+#define LOOP_SILENCE 0xD5
+
+/* CAS bits seen on an end while the far end is not open */
+#define LOOP_NO_PEER_CAS 0xF
+
+struct loop_trunk_s;
+
+typedef struct loop_end_s {
+	struct loop_trunk_s *trunk;
+	struct loop_end_s *peer;
+	int open;
+	/* pipe readable while there is something pending on this end */
+	int wakefd[2];
+	int signaled;
+	/* go as fast as the far end reads instead of every 20ms */
+	int free_running;
+	/* the channel asked for media the last time it waited */
+	int reading;
+	/* CAS bits written on this end */
+	int cas;
+	/* the far end changed its CAS bits, or came or went */
+	int cas_changed;
+	int alarm_changed;
+	/* frame periods elapsed and not read yet */
+	int ticks;
+	/* frame periods since this end read for the last time */
+	int idle_ticks;
+	/* frames read on this end, and frames done with, whose media was
+	   written already */
+	unsigned long frames_read;
+	unsigned long frames_done;
+	/* media written by the far end and not read yet */
+	uint8_t rx[LOOP_RX_SIZE];
+	int rx_head;
+	int rx_len;
+	/* frame periods the oldest media has been waiting to be read */
+	int rx_ticks;
+} loop_end_t;
+
+typedef struct loop_trunk_s {
+	pthread_mutex_t lock;
+	loop_end_t ends[2];
+} loop_trunk_t;
+
+static struct {
+	/* write locked to open and close channels, read locked to find them */
+	pthread_rwlock_t lock;
+	/* indexed by channel number */
+	loop_trunk_t **trunks;
+	int numtrunks;
+	/* indexed by channel descriptor */
+	loop_end_t **ends;
+	int numends;
+	int open_ends;
+	int clock_running;
+} loop = { PTHREAD_RWLOCK_INITIALIZER, NULL, 0, NULL, 0, 0, 0 };
+
+/* end of a channel, loop.lock must be locked */
+static loop_end_t *loop_lookup_end(openr2_chan_t *r2chan)
+{
+	loop_end_t *end = NULL;
+	int fd = (int)(long)r2chan->fd;
+	if (fd >= 0 && fd < loop.numends) {
+		end = loop.ends[fd];
+	}
+	if (!end) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Channel is not a loopback channel\n");
+		errno = EBADF;
+	}
+	return end;
+}
+
+static loop_end_t *loop_find_end(openr2_chan_t *r2chan)
+{
+	loop_end_t *end;
+	pthread_rwlock_rdlock(&loop.lock);
+	end = loop_lookup_end(r2chan);
+	pthread_rwlock_unlock(&loop.lock);
+	return end;
+}
+
+/* both ends of the trunk keep reading, so the free running mode can go on */
+static int loop_lockstep(loop_end_t *end)
+{
+	return end->free_running && end->peer->open &&
+		end->idle_ticks < LOOP_IDLE_TICKS && end->peer->idle_ticks < LOOP_IDLE_TICKS;
+}
+
+/* I/O readiness of an end, the trunk must be locked */
+static int loop_ready(loop_end_t *end)
+{
+	int flags = 0;
+	long turn;
+	if (end->cas_changed || end->alarm_changed) {
+		flags |= OR2_IO_OOB_EVENT;
+	}
+	if (loop_lockstep(end)) {
+		/* on a tie the first end goes first */
+		turn = (long)(end->peer->frames_done - end->frames_read);
+		if (turn > 0 || (!turn && end == &end->trunk->ends[0])) {
+			flags |= OR2_IO_READ;
+		}
+	} else if (end->ticks) {
+		flags |= OR2_IO_READ;
+	}
+	if (end->peer->open && (LOOP_RX_SIZE - end->peer->rx_len) >= LOOP_FRAME_SIZE) {
+		flags |= OR2_IO_WRITE;
+	}
+	return flags;
+}
+
+/* make the descriptor of an end readable if there is something to read or
+   an event to get, and not readable otherwise. The trunk must be locked */
+static void loop_signal(loop_end_t *end)
+{
+	char byte = 0;
+	int pending;
+	if (!end->open) {
+		return;
+	}
+	/* frames nobody is going to read would keep the descriptor readable */
+	pending = loop_ready(end) & (end->reading ? (OR2_IO_READ | OR2_IO_OOB_EVENT) : OR2_IO_OOB_EVENT);
+	if (pending && !end->signaled) {
+		if (write(end->wakefd[1], &byte, 1) == 1) {
+			end->signaled = 1;
+		}
+	} else if (!pending && end->signaled) {
+		if (read(end->wakefd[0], &byte, 1) == 1) {
+			end->signaled = 0;
+		}
+	}
+}
+
+static void *loop_clock(void *data)
+{
+	struct timespec next;
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+	int i, e;
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (;;) {
+		next.tv_nsec += LOOP_FRAME_MS * 1000000L;
+		if (next.tv_nsec >= 1000000000L) {
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR);
+
+		pthread_rwlock_rdlock(&loop.lock);
+		if (!loop.open_ends) {
+			/* the channels are opened and closed with the lock held for
+			   writing, so nobody else looks at this meanwhile */
+			loop.clock_running = 0;
+			pthread_rwlock_unlock(&loop.lock);
+			break;
+		}
+		for (i = 0; i < loop.numtrunks; i++) {
+			if (!(trunk = loop.trunks[i])) {
+				continue;
+			}
+			pthread_mutex_lock(&trunk->lock);
+			for (e = 0; e < 2; e++) {
+				end = &trunk->ends[e];
+				if (!end->open) {
+					continue;
+				}
+				if (end->ticks < LOOP_MAX_TICKS) {
+					end->ticks++;
+				}
+				if (end->idle_ticks < LOOP_IDLE_TICKS) {
+					end->idle_ticks++;
+				}
+				if (end->rx_len && ++end->rx_ticks >= LOOP_MAX_TICKS) {
+					/* nobody is listening, the media went by unheard
+					   instead of being read late by the next call */
+					end->rx_len = 0;
+				}
+			}
+			loop_signal(&trunk->ends[0]);
+			loop_signal(&trunk->ends[1]);
+			pthread_mutex_unlock(&trunk->lock);
+		}
+		pthread_rwlock_unlock(&loop.lock);
+	}
+	return NULL;
+}
+
+static openr2_io_fd_t loop_open(openr2_context_t *r2context, int channo)
+{
+	pthread_attr_t attr;
+	pthread_t clock_thread;
+	loop_trunk_t **trunks, *trunk;
+	loop_end_t **ends, *end;
+	int wakefd[2], flags, res, i;
+
+	if (channo < 0) {
+		r2context->last_error = OR2_LIBERR_INVALID_CHAN_NUMBER;
+		return NULL;
+	}
+	if (pipe(wakefd)) {
+		r2context->last_error = OR2_LIBERR_SYSCALL_FAILED;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to create loopback channel %d (%s)\n", channo, strerror(errno));
+		return NULL;
+	}
+	for (i = 0; i < 2; i++) {
+		flags = fcntl(wakefd[i], F_GETFL);
+		fcntl(wakefd[i], F_SETFL, flags | O_NONBLOCK);
+		fcntl(wakefd[i], F_SETFD, FD_CLOEXEC);
+	}
+
+	pthread_rwlock_wrlock(&loop.lock);
+	if (!loop.clock_running) {
+		pthread_attr_init(&attr);
+		pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+		res = pthread_create(&clock_thread, &attr, loop_clock, NULL);
+		pthread_attr_destroy(&attr);
+		if (res) {
+			pthread_rwlock_unlock(&loop.lock);
+			r2context->last_error = OR2_LIBERR_SYSCALL_FAILED;
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to start the loopback clock (%s)\n", strerror(res));
+			close(wakefd[0]);
+			close(wakefd[1]);
+			return NULL;
+		}
+		loop.clock_running = 1;
+	}
+	if (channo >= loop.numtrunks) {
+		if (!(trunks = realloc(loop.trunks, (channo + 1) * sizeof(*trunks)))) {
+			goto nomem;
+		}
+		memset(&trunks[loop.numtrunks], 0, (channo + 1 - loop.numtrunks) * sizeof(*trunks));
+		loop.trunks = trunks;
+		loop.numtrunks = channo + 1;
+	}
+	if (wakefd[0] >= loop.numends) {
+		if (!(ends = realloc(loop.ends, (wakefd[0] + 1) * sizeof(*ends)))) {
+			goto nomem;
+		}
+		memset(&ends[loop.numends], 0, (wakefd[0] + 1 - loop.numends) * sizeof(*ends));
+		loop.ends = ends;
+		loop.numends = wakefd[0] + 1;
+	}
+	if (!(trunk = loop.trunks[channo])) {
+		if (!(trunk = calloc(1, sizeof(*trunk)))) {
+			goto nomem;
+		}
+		pthread_mutex_init(&trunk->lock, NULL);
+		trunk->ends[0].trunk = trunk;
+		trunk->ends[0].peer = &trunk->ends[1];
+		trunk->ends[1].trunk = trunk;
+		trunk->ends[1].peer = &trunk->ends[0];
+		loop.trunks[channo] = trunk;
+	}
+
+	pthread_mutex_lock(&trunk->lock);
+	end = trunk->ends[0].open ? &trunk->ends[1] : &trunk->ends[0];
+	if (end->open) {
+		pthread_mutex_unlock(&trunk->lock);
+		pthread_rwlock_unlock(&loop.lock);
+		r2context->last_error = OR2_LIBERR_SYSCALL_FAILED;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Both ends of loopback channel %d are already open\n", channo);
+		close(wakefd[0]);
+		close(wakefd[1]);
+		return NULL;
+	}
+	end->open = 1;
+	end->wakefd[0] = wakefd[0];
+	end->wakefd[1] = wakefd[1];
+	end->signaled = 0;
+	end->free_running = r2context->loopback_free_running;
+	end->reading = 1;
+	end->cas = LOOP_NO_PEER_CAS;
+	/* the bits of a far end already there are news for this end */
+	end->cas_changed = end->peer->open;
+	end->alarm_changed = 0;
+	end->ticks = 0;
+	end->idle_ticks = LOOP_IDLE_TICKS;
+	end->frames_read = end->peer->frames_read;
+	end->frames_done = end->frames_read;
+	end->rx_head = 0;
+	end->rx_len = 0;
+	end->rx_ticks = 0;
+	if (end->peer->open) {
+		/* the line comes up on the far end */
+		end->peer->alarm_changed = 1;
+		loop_signal(end->peer);
+	}
+	loop_signal(end);
+	pthread_mutex_unlock(&trunk->lock);
+
+	loop.ends[wakefd[0]] = end;
+	loop.open_ends++;
+	pthread_rwlock_unlock(&loop.lock);
+	return (openr2_io_fd_t)(long)wakefd[0];
+
+nomem:
+	pthread_rwlock_unlock(&loop.lock);
+	r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+	openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to create loopback channel %d (out of memory)\n", channo);
+	close(wakefd[0]);
+	close(wakefd[1]);
+	return NULL;
+}
+
+/* close an end, loop.lock must be write locked */
+static void loop_close_end(loop_end_t *end)
+{
+	loop_trunk_t *trunk = end->trunk;
+	int i;
+
+	pthread_mutex_lock(&trunk->lock);
+	loop.ends[end->wakefd[0]] = NULL;
+	loop.open_ends--;
+	end->open = 0;
+	close(end->wakefd[0]);
+	close(end->wakefd[1]);
+	if (end->peer->open) {
+		/* the line goes down on the far end */
+		end->peer->alarm_changed = 1;
+		loop_signal(end->peer);
+		pthread_mutex_unlock(&trunk->lock);
+	} else {
+		pthread_mutex_unlock(&trunk->lock);
+		for (i = 0; i < loop.numtrunks; i++) {
+			if (loop.trunks[i] == trunk) {
+				loop.trunks[i] = NULL;
+				break;
+			}
+		}
+		pthread_mutex_destroy(&trunk->lock);
+		free(trunk);
+	}
+}
+
+static int loop_close(openr2_chan_t *r2chan)
+{
+	loop_end_t *end;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	pthread_rwlock_wrlock(&loop.lock);
+	loop_close_end(end);
+	pthread_rwlock_unlock(&loop.lock);
+	return 0;
+}
+
+static int loop_set_cas(openr2_chan_t *r2chan, int cas)
+{
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	if (end->cas != cas) {
+		end->cas = cas;
+		if (end->peer->open) {
+			end->peer->cas_changed = 1;
+			loop_signal(end->peer);
+		}
+	}
+	pthread_mutex_unlock(&trunk->lock);
+	return 0;
+}
+
+static int loop_get_cas(openr2_chan_t *r2chan, int *cas)
+{
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	*cas = end->peer->open ? end->peer->cas : LOOP_NO_PEER_CAS;
+	pthread_mutex_unlock(&trunk->lock);
+	return 0;
+}
+
+static int loop_flush_write_buffers(openr2_chan_t *r2chan)
+{
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	end->peer->rx_len = 0;
+	pthread_mutex_unlock(&trunk->lock);
+	return 0;
+}
+
+static int loop_flush_read_buffers(openr2_chan_t *r2chan)
+{
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	end->rx_len = 0;
+	/* the frame periods that went by unread are gone as well */
+	if (end->ticks > 1) {
+		end->ticks = 1;
+	}
+	loop_signal(end);
+	pthread_mutex_unlock(&trunk->lock);
+	return 0;
+}
+
+static int loop_write(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	const uint8_t *samples = buf;
+	loop_trunk_t *trunk;
+	loop_end_t *end, *peer;
+	int written, tail, chunk;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	peer = end->peer;
+	pthread_mutex_lock(&trunk->lock);
+	if (!peer->open) {
+		/* nobody on the far end, the media goes nowhere */
+		pthread_mutex_unlock(&trunk->lock);
+		return size;
+	}
+	if (!peer->rx_len) {
+		peer->rx_ticks = 0;
+		/* the far end is late reading frames of silence older than this
+		   media, skip them or it would read the media first and then the
+		   silence right in the middle of a tone */
+		if (peer->ticks > 1) {
+			peer->ticks = 1;
+		}
+	}
+	for (written = 0; written < size && peer->rx_len < LOOP_RX_SIZE; written += chunk) {
+		tail = (peer->rx_head + peer->rx_len) % LOOP_RX_SIZE;
+		chunk = LOOP_RX_SIZE - tail;
+		if (chunk > LOOP_RX_SIZE - peer->rx_len) {
+			chunk = LOOP_RX_SIZE - peer->rx_len;
+		}
+		if (chunk > size - written) {
+			chunk = size - written;
+		}
+		memcpy(&peer->rx[tail], &samples[written], chunk);
+		peer->rx_len += chunk;
+	}
+	pthread_mutex_unlock(&trunk->lock);
+	return written;
+}
+
+static int loop_read(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	uint8_t *samples = (uint8_t *)buf;
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+	int chunk, done;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	if (size > LOOP_FRAME_SIZE) {
+		size = LOOP_FRAME_SIZE;
+	}
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	for (done = 0; done < size && end->rx_len; done += chunk) {
+		chunk = LOOP_RX_SIZE - end->rx_head;
+		if (chunk > end->rx_len) {
+			chunk = end->rx_len;
+		}
+		if (chunk > size - done) {
+			chunk = size - done;
+		}
+		memcpy(&samples[done], &end->rx[end->rx_head], chunk);
+		end->rx_head = (end->rx_head + chunk) % LOOP_RX_SIZE;
+		end->rx_len -= chunk;
+	}
+	end->rx_ticks = 0;
+	/* the far end did not write this part of the frame */
+	memset(&samples[done], LOOP_SILENCE, size - done);
+
+	if (loop_lockstep(end)) {
+		end->ticks = 0;
+	} else {
+		/* keep in step with the far end for when it reads again */
+		if (end->peer->open) {
+			end->frames_read = end->peer->frames_read;
+		}
+		if (end->ticks) {
+			end->ticks--;
+		}
+	}
+	end->frames_read++;
+	end->idle_ticks = 0;
+	loop_signal(end);
+	loop_signal(end->peer);
+	pthread_mutex_unlock(&trunk->lock);
+	return size;
+}
+
+static int loop_setup(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+static int loop_wait(openr2_chan_t *r2chan, int *flags, int wait)
+{
+	struct pollfd pfd;
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+	int ready;
+
+	if (!flags || !*flags) {
+		return -1;
+	}
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	pfd.fd = end->wakefd[0];
+	pfd.events = POLLIN;
+	for (;;) {
+		pthread_mutex_lock(&trunk->lock);
+		if (end->reading != !!(*flags & OR2_IO_READ)) {
+			end->reading = !end->reading;
+			loop_signal(end);
+		}
+		if (end->frames_done != end->frames_read) {
+			/* back for more, so done with the last frame read */
+			end->frames_done = end->frames_read;
+			loop_signal(end->peer);
+		}
+		ready = loop_ready(end) & *flags;
+		pthread_mutex_unlock(&trunk->lock);
+		if (ready || !wait) {
+			break;
+		}
+		/* the descriptor does not tell about write readiness, so do not
+		   sleep more than a frame while waiting for it */
+		poll(&pfd, 1, LOOP_FRAME_MS);
+	}
+	*flags = ready;
+	return 0;
+}
+
+static int loop_get_oob_event(openr2_chan_t *r2chan, openr2_oob_event_t *event)
+{
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+
+	if (!event) {
+		return -1;
+	}
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	*event = OR2_OOB_EVENT_NONE;
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	if (end->alarm_changed) {
+		end->alarm_changed = 0;
+		/* the CAS bits of a far end that just came up are news too */
+		end->cas_changed = end->peer->open;
+		*event = end->peer->open ? OR2_OOB_EVENT_ALARM_OFF : OR2_OOB_EVENT_ALARM_ON;
+	} else if (end->cas_changed) {
+		end->cas_changed = 0;
+		*event = OR2_OOB_EVENT_CAS_CHANGE;
+	}
+	loop_signal(end);
+	pthread_mutex_unlock(&trunk->lock);
+	return 0;
+}
+
+static int loop_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
+{
+	loop_trunk_t *trunk;
+	loop_end_t *end;
+
+	if (!(end = loop_find_end(r2chan))) {
+		return -1;
+	}
+	trunk = end->trunk;
+	pthread_mutex_lock(&trunk->lock);
+	/* the line is down until the far end is open */
+	*alarm = end->peer->open ? 0 : 1;
+	pthread_mutex_unlock(&trunk->lock);
+	return 0;
+}
+
+/* The span routines look up every end of the span at once and keep the
+   channels from being closed meanwhile. The CAS changes and the alarms they
+   report are not reported again as events of the channels */
+static int loop_span_open(openr2_context_t *r2context, int span_id, const int channos[], openr2_io_fd_t fds[], int numchans)
+{
+	int i;
+
+	for (i = 0; i < numchans; i++) {
+		if (!(fds[i] = loop_open(r2context, channos[i]))) {
+			break;
+		}
+	}
+	if (i == numchans) {
+		return 0;
+	}
+	pthread_rwlock_wrlock(&loop.lock);
+	while (i--) {
+		loop_close_end(loop.ends[(int)(long)fds[i]]);
+	}
+	pthread_rwlock_unlock(&loop.lock);
+	return -1;
+}
+
+static int loop_span_set_cas(openr2_chan_t *r2chans[], const int cas[], int numchans)
+{
+	loop_end_t *end;
+	int i;
+
+	pthread_rwlock_rdlock(&loop.lock);
+	for (i = 0; i < numchans; i++) {
+		if (!(end = loop_lookup_end(r2chans[i]))) {
+			pthread_rwlock_unlock(&loop.lock);
+			return -1;
+		}
+		pthread_mutex_lock(&end->trunk->lock);
+		if (end->cas != cas[i]) {
+			end->cas = cas[i];
+			if (end->peer->open) {
+				end->peer->cas_changed = 1;
+				loop_signal(end->peer);
+			}
+		}
+		pthread_mutex_unlock(&end->trunk->lock);
+	}
+	pthread_rwlock_unlock(&loop.lock);
+	return 0;
+}
+
+static int loop_span_get_cas(openr2_chan_t *r2chans[], int cas[], int numchans)
+{
+	loop_end_t *end;
+	int i;
+
+	pthread_rwlock_rdlock(&loop.lock);
+	for (i = 0; i < numchans; i++) {
+		if (!(end = loop_lookup_end(r2chans[i]))) {
+			pthread_rwlock_unlock(&loop.lock);
+			return -1;
+		}
+		pthread_mutex_lock(&end->trunk->lock);
+		cas[i] = end->peer->open ? end->peer->cas : LOOP_NO_PEER_CAS;
+		end->cas_changed = 0;
+		loop_signal(end);
+		pthread_mutex_unlock(&end->trunk->lock);
+	}
+	pthread_rwlock_unlock(&loop.lock);
+	return 0;
+}
+
+/* an E1 is up or down as a whole, so the span is down while the far end of
+   any of its trunks is not open */
+static int loop_span_get_alarm_state(openr2_chan_t *r2chans[], int numchans, int *alarm)
+{
+	loop_end_t *end;
+	int i;
+
+	*alarm = 0;
+	pthread_rwlock_rdlock(&loop.lock);
+	for (i = 0; i < numchans; i++) {
+		if (!(end = loop_lookup_end(r2chans[i]))) {
+			pthread_rwlock_unlock(&loop.lock);
+			return -1;
+		}
+		pthread_mutex_lock(&end->trunk->lock);
+		if (!end->peer->open) {
+			*alarm = 1;
+		}
+		if (end->alarm_changed) {
+			end->alarm_changed = 0;
+			/* the CAS bits of a far end that just came up are news too */
+			end->cas_changed = end->peer->open;
+			loop_signal(end);
+		}
+		pthread_mutex_unlock(&end->trunk->lock);
+	}
+	pthread_rwlock_unlock(&loop.lock);
+	return 0;
+}
+
+static int loop_span_wait(openr2_chan_t *r2chans[], int numchans, int timeout)
+{
+	struct pollfd *pfds;
+	loop_end_t *end;
+	int i, res;
+
+	if (!(pfds = calloc(numchans, sizeof(*pfds)))) {
+		r2chans[0]->r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+		return -1;
+	}
+	pthread_rwlock_rdlock(&loop.lock);
+	for (i = 0; i < numchans; i++) {
+		if (!(end = loop_lookup_end(r2chans[i]))) {
+			pthread_rwlock_unlock(&loop.lock);
+			free(pfds);
+			return -1;
+		}
+		pthread_mutex_lock(&end->trunk->lock);
+		/* frames only wake up the channels that take the media */
+		if (end->reading != r2chans[i]->reading_media) {
+			end->reading = r2chans[i]->reading_media;
+			loop_signal(end);
+		}
+		if (end->frames_done != end->frames_read) {
+			/* back for more, so done with the last frame read */
+			end->frames_done = end->frames_read;
+			loop_signal(end->peer);
+		}
+		pthread_mutex_unlock(&end->trunk->lock);
+		pfds[i].fd = end->wakefd[0];
+		pfds[i].events = POLLIN;
+	}
+	pthread_rwlock_unlock(&loop.lock);
+	res = poll(pfds, numchans, timeout);
+	free(pfds);
+	if (res == -1 && errno == EINTR) {
+		return 0;
+	}
+	return res;
+}
+
+static openr2_io_span_interface_t loop_span_interface =
+{
+	.open = loop_span_open,
+	.set_cas = loop_span_set_cas,
+	.get_cas = loop_span_get_cas,
+	.get_alarm_state = loop_span_get_alarm_state,
+	.wait = loop_span_wait
+};
+
+static openr2_io_interface_t loop_io_interface =
+{
+	.open = loop_open,
+	.close = loop_close,
+	.set_cas = loop_set_cas,
+	.get_cas = loop_get_cas,
+	.flush_write_buffers = loop_flush_write_buffers,
+	.write = loop_write,
+	.read = loop_read,
+	.setup = loop_setup,
+	.wait = loop_wait,
+	.get_oob_event = loop_get_oob_event,
+	.get_alarm_state = loop_get_alarm_state,
+	.get_format = NULL,
+	.span = &loop_span_interface,
+	.peek = NULL,
+	.consume = NULL,
+	.flush_read_buffers = loop_flush_read_buffers
+};
+
+openr2_io_interface_t *openr2_io_get_loopback_interface()
+{
+	return &loop_io_interface;
+}
+
+#else
+
+openr2_io_interface_t *openr2_io_get_loopback_interface()
+{
+	return NULL;
+}
+
+#endif
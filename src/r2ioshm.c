@@ -0,0 +1,589 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2ioshm.c - I/O on the shared memory rings of a user space TDM driver,
+ *             see openr2/r2ioshm.h for the layout and how they are handed over
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * The media is never copied on its way to the detectors: the channel peeks
+ * at the frame right in the rx ring and only moves the tail once it is done
+ * with it. A frame that wraps around the end of the ring is copied by read
+ * as usual. The descriptor of each channel is the eventfd the driver writes
+ * to, so applications can keep polling it as they would poll a DAHDI
+ * channel.
+ */
+
+#if !defined(_XOPEN_SOURCE) && !defined(__FreeBSD__)
+#define _XOPEN_SOURCE 600
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef __linux__
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+#include "openr2/r2log-pvt.h"
+#include "openr2/r2chan-pvt.h"
+#include "openr2/r2context-pvt.h"
+#include "openr2/r2ioabs.h"
+#include "openr2/r2ioshm.h"
+
+#ifdef __linux__
+
+/* the other side of each member is another process */
+#define shm_load(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define shm_store(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+
+#define SHM_RING_OFFSET(count) ((count) & (OR2_SHM_RING_SIZE - 1))
+
+typedef struct {
+	openr2_shm_chan_t *shm;
+	/* connection to the driver, open while the channel is */
+	int sock;
+	/* eventfd written by the driver, the descriptor of the channel */
+	int rxfd;
+	/* eventfd written by us */
+	int txfd;
+	/* bytes per sample and per frame */
+	int sample_size;
+	int frame_size;
+	/* the connection went down, the driver is gone */
+	int hangup;
+	/* last CAS register and alarm state reported */
+	uint32_t rx_cas;
+	int alarm;
+} shm_chan_t;
+
+static struct {
+	/* write locked to open and close channels, read locked to find them */
+	pthread_rwlock_t lock;
+	/* indexed by channel descriptor */
+	shm_chan_t **chans;
+	int numchans;
+} shm = { PTHREAD_RWLOCK_INITIALIZER, NULL, 0 };
+
+/* the line is down when the driver says so or when the driver is gone */
+static int shm_alarm(shm_chan_t *chan)
+{
+	return (chan->hangup || shm_load(&chan->shm->alarm)) ? 1 : 0;
+}
+
+static shm_chan_t *shm_find_chan(openr2_chan_t *r2chan)
+{
+	shm_chan_t *chan = NULL;
+	int fd = (int)(long)r2chan->fd;
+	pthread_rwlock_rdlock(&shm.lock);
+	if (fd >= 0 && fd < shm.numchans) {
+		chan = shm.chans[fd];
+	}
+	pthread_rwlock_unlock(&shm.lock);
+	if (!chan) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Channel is not a shared memory channel\n");
+		errno = EBADF;
+	}
+	return chan;
+}
+
+/* tell the driver there is something new on the channel */
+static void shm_kick(shm_chan_t *chan)
+{
+	uint64_t one = 1;
+	if (write(chan->txfd, &one, sizeof(one)) != sizeof(one) && errno != EAGAIN) {
+		/* nothing we can do, the driver will see it on its next frame */
+	}
+}
+
+/* ask the driver for the descriptors of a channel, returns 0 or an errno value */
+static int shm_request(int sock, int channo, int fds[3])
+{
+	openr2_shm_request_t request;
+	openr2_shm_reply_t reply;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char control[CMSG_SPACE(3 * sizeof(int))];
+	ssize_t len;
+
+	memset(&request, 0, sizeof(request));
+	request.magic = OR2_SHM_MAGIC;
+	request.version = OR2_SHM_VERSION;
+	request.channo = channo;
+	if (write(sock, &request, sizeof(request)) != sizeof(request)) {
+		return errno ? errno : EIO;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	memset(control, 0, sizeof(control));
+	iov.iov_base = &reply;
+	iov.iov_len = sizeof(reply);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	while ((len = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC)) == -1 && errno == EINTR);
+	if (len != sizeof(reply) || reply.magic != OR2_SHM_MAGIC) {
+		return len == -1 ? errno : EPROTO;
+	}
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (reply.status) {
+		return reply.status;
+	}
+	if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS
+	    || cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int))) {
+		return EPROTO;
+	}
+	memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+	return 0;
+}
+
+static openr2_io_fd_t shm_open_chan(openr2_context_t *r2context, int channo)
+{
+	struct sockaddr_un addr;
+	struct stat st;
+	shm_chan_t **chans, *chan;
+	void *mem;
+	size_t pathlen;
+	int fds[3] = { -1, -1, -1 };
+	int sock = -1;
+	int res, flags;
+
+	if (channo < 0) {
+		r2context->last_error = OR2_LIBERR_INVALID_CHAN_NUMBER;
+		return NULL;
+	}
+	if (!(chan = calloc(1, sizeof(*chan)))) {
+		r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to open shared memory channel %d (out of memory)\n", channo);
+		return NULL;
+	}
+	/* a longer path would connect to a different, truncated one */
+	if ((pathlen = strlen(r2context->shm_socket)) >= sizeof(addr.sun_path)) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "The driver socket path %s is too long for channel %d\n",
+				r2context->shm_socket, channo);
+		res = ENAMETOOLONG;
+		goto failed;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	memcpy(addr.sun_path, r2context->shm_socket, pathlen);
+	if ((sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) == -1
+	    || connect(sock, (struct sockaddr *)&addr, sizeof(addr))) {
+		res = errno;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to connect to the driver at %s for channel %d (%s)\n",
+				r2context->shm_socket, channo, strerror(res));
+		goto failed;
+	}
+	if ((res = shm_request(sock, channo, fds))) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "The driver at %s did not open channel %d (%s)\n",
+				r2context->shm_socket, channo, strerror(res));
+		goto failed;
+	}
+	/* touching pages past the end of a short memfd would raise SIGBUS */
+	if (fstat(fds[0], &st)) {
+		res = errno;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to check shared memory channel %d (%s)\n", channo, strerror(res));
+		goto failed;
+	}
+	if (st.st_size < (off_t)sizeof(*chan->shm)) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Shared memory channel %d has %ld bytes, expected at least %lu\n",
+				channo, (long)st.st_size, (unsigned long)sizeof(*chan->shm));
+		res = EPROTO;
+		goto failed;
+	}
+	mem = mmap(NULL, sizeof(*chan->shm), PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+	close(fds[0]);
+	fds[0] = -1;
+	if (mem == MAP_FAILED) {
+		res = errno;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to map shared memory channel %d (%s)\n", channo, strerror(res));
+		goto failed;
+	}
+	chan->shm = mem;
+	if (chan->shm->magic != OR2_SHM_MAGIC || chan->shm->version != OR2_SHM_VERSION) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Shared memory channel %d has version %u, expected %u\n",
+				channo, chan->shm->version, OR2_SHM_VERSION);
+		res = EPROTO;
+		goto failed;
+	}
+	chan->sock = sock;
+	chan->rxfd = fds[1];
+	chan->txfd = fds[2];
+	flags = fcntl(chan->rxfd, F_GETFL);
+	fcntl(chan->rxfd, F_SETFL, flags | O_NONBLOCK);
+	chan->sample_size = (chan->shm->format == OR2_IO_FORMAT_SLINEAR) ? sizeof(int16_t) : 1;
+	chan->frame_size = OR2_CHAN_READ_SIZE * chan->sample_size;
+	chan->rx_cas = shm_load(&chan->shm->rx_cas);
+	chan->alarm = shm_alarm(chan);
+
+	pthread_rwlock_wrlock(&shm.lock);
+	if (chan->rxfd >= shm.numchans) {
+		if (!(chans = realloc(shm.chans, (chan->rxfd + 1) * sizeof(*chans)))) {
+			pthread_rwlock_unlock(&shm.lock);
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to open shared memory channel %d (out of memory)\n", channo);
+			res = ENOMEM;
+			goto failed;
+		}
+		memset(&chans[shm.numchans], 0, (chan->rxfd + 1 - shm.numchans) * sizeof(*chans));
+		shm.chans = chans;
+		shm.numchans = chan->rxfd + 1;
+	}
+	shm.chans[chan->rxfd] = chan;
+	pthread_rwlock_unlock(&shm.lock);
+	return (openr2_io_fd_t)(long)chan->rxfd;
+
+failed:
+	r2context->last_error = (res == ENOMEM) ? OR2_LIBERR_OUT_OF_MEMORY : OR2_LIBERR_SYSCALL_FAILED;
+	if (chan->shm) {
+		munmap(chan->shm, sizeof(*chan->shm));
+	}
+	if (fds[0] != -1) {
+		close(fds[0]);
+	}
+	if (fds[1] != -1) {
+		close(fds[1]);
+		close(fds[2]);
+	}
+	if (sock != -1) {
+		close(sock);
+	}
+	free(chan);
+	return NULL;
+}
+
+static int shm_close(openr2_chan_t *r2chan)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	pthread_rwlock_wrlock(&shm.lock);
+	shm.chans[chan->rxfd] = NULL;
+	pthread_rwlock_unlock(&shm.lock);
+	munmap(chan->shm, sizeof(*chan->shm));
+	/* the driver takes the channel back when the connection goes down */
+	close(chan->sock);
+	close(chan->rxfd);
+	close(chan->txfd);
+	free(chan);
+	return 0;
+}
+
+static int shm_set_cas(openr2_chan_t *r2chan, int cas)
+{
+	shm_chan_t *chan;
+	uint32_t reg;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	reg = chan->shm->tx_cas;
+	if (OR2_SHM_CAS_BITS(reg) != (cas & 0xF)) {
+		shm_store(&chan->shm->tx_cas, OR2_SHM_CAS(OR2_SHM_CAS_SEQ(reg) + 1, cas));
+		shm_kick(chan);
+	}
+	return 0;
+}
+
+static int shm_get_cas(openr2_chan_t *r2chan, int *cas)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	*cas = OR2_SHM_CAS_BITS(shm_load(&chan->shm->rx_cas));
+	return 0;
+}
+
+static int shm_flush_write_buffers(openr2_chan_t *r2chan)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	/* only the driver moves the tail of the tx ring, it drops the media
+	   up to where the head is now */
+	shm_store(&chan->shm->tx_flush, chan->shm->tx.head);
+	shm_kick(chan);
+	return 0;
+}
+
+static int shm_write(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	openr2_shm_ring_t *ring;
+	shm_chan_t *chan;
+	uint32_t head, offset;
+	int space, chunk;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	ring = &chan->shm->tx;
+	head = ring->head;
+	space = OR2_SHM_RING_SIZE - (int)(head - shm_load(&ring->tail));
+	if (size > space) {
+		size = space - (space % chan->sample_size);
+	}
+	if (size <= 0) {
+		return 0;
+	}
+	offset = SHM_RING_OFFSET(head);
+	chunk = (size < OR2_SHM_RING_SIZE - offset) ? size : OR2_SHM_RING_SIZE - offset;
+	memcpy(&ring->data[offset], buf, chunk);
+	memcpy(&ring->data[0], (const uint8_t *)buf + chunk, size - chunk);
+	shm_store(&ring->head, head + size);
+	shm_kick(chan);
+	return size;
+}
+
+static int shm_read(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	openr2_shm_ring_t *ring;
+	shm_chan_t *chan;
+	uint32_t tail, offset;
+	int avail, chunk;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	ring = &chan->shm->rx;
+	tail = ring->tail;
+	avail = (int)(shm_load(&ring->head) - tail);
+	if (size > avail) {
+		size = avail - (avail % chan->sample_size);
+	}
+	if (size <= 0) {
+		return 0;
+	}
+	offset = SHM_RING_OFFSET(tail);
+	chunk = (size < OR2_SHM_RING_SIZE - offset) ? size : OR2_SHM_RING_SIZE - offset;
+	memcpy((uint8_t *)buf, &ring->data[offset], chunk);
+	memcpy((uint8_t *)buf + chunk, &ring->data[0], size - chunk);
+	shm_store(&ring->tail, tail + size);
+	return size;
+}
+
+static int shm_peek(openr2_chan_t *r2chan, const void **buf, int size)
+{
+	openr2_shm_ring_t *ring;
+	shm_chan_t *chan;
+	uint32_t tail, offset;
+	int avail;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	ring = &chan->shm->rx;
+	tail = ring->tail;
+	avail = (int)(shm_load(&ring->head) - tail);
+	if (size > avail) {
+		size = avail - (avail % chan->sample_size);
+	}
+	offset = SHM_RING_OFFSET(tail);
+	if (size <= 0 || offset + size > OR2_SHM_RING_SIZE) {
+		/* nothing there, or it wraps around, let read copy it */
+		return 0;
+	}
+	*buf = &ring->data[offset];
+	return size;
+}
+
+static int shm_consume(openr2_chan_t *r2chan, int size)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	shm_store(&chan->shm->rx.tail, chan->shm->rx.tail + size);
+	return 0;
+}
+
+static int shm_flush_read_buffers(openr2_chan_t *r2chan)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	/* the driver only writes whole samples, so the head is a sample boundary */
+	shm_store(&chan->shm->rx.tail, shm_load(&chan->shm->rx.head));
+	return 0;
+}
+
+static int shm_setup(openr2_chan_t *r2chan)
+{
+	return 0;
+}
+
+static int shm_ready(shm_chan_t *chan)
+{
+	int flags = 0;
+	if (shm_load(&chan->shm->rx_cas) != chan->rx_cas || shm_alarm(chan) != chan->alarm) {
+		flags |= OR2_IO_OOB_EVENT;
+	}
+	if ((int)(shm_load(&chan->shm->rx.head) - chan->shm->rx.tail) >= chan->frame_size) {
+		flags |= OR2_IO_READ;
+	}
+	if (OR2_SHM_RING_SIZE - (int)(chan->shm->tx.head - shm_load(&chan->shm->tx.tail)) >= chan->frame_size) {
+		flags |= OR2_IO_WRITE;
+	}
+	return flags;
+}
+
+static int shm_wait(openr2_chan_t *r2chan, int *flags, int wait)
+{
+	struct pollfd pfds[2];
+	shm_chan_t *chan;
+	uint64_t count;
+	int ready, res;
+
+	if (!flags || !*flags) {
+		return -1;
+	}
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	pfds[0].fd = chan->rxfd;
+	pfds[0].events = POLLIN;
+	pfds[1].events = POLLIN;
+	for (;;) {
+		if ((ready = shm_ready(chan) & *flags)) {
+			break;
+		}
+		/* nothing to do, look at the descriptor and clear it if the driver
+		   wrote to it meanwhile, then look again. The driver does not write
+		   to the connection, anything on it means it went down */
+		pfds[1].fd = chan->hangup ? -1 : chan->sock;
+		res = poll(pfds, 2, wait ? -1 : 0);
+		if (res == -1 && errno != EINTR) {
+			return -1;
+		}
+		if (res <= 0) {
+			if (!wait) {
+				break;
+			}
+			continue;
+		}
+		if (pfds[1].revents) {
+			openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Lost the connection to the driver\n");
+			chan->hangup = 1;
+		}
+		if (pfds[0].revents & POLLIN) {
+			if (read(chan->rxfd, &count, sizeof(count)) != sizeof(count)) {
+				/* somebody else cleared it already */
+			}
+		}
+	}
+	*flags = ready;
+	return 0;
+}
+
+static int shm_get_oob_event(openr2_chan_t *r2chan, openr2_oob_event_t *event)
+{
+	shm_chan_t *chan;
+	uint32_t reg;
+	int alarm;
+
+	if (!event) {
+		return -1;
+	}
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	*event = OR2_OOB_EVENT_NONE;
+	if ((alarm = shm_alarm(chan)) != chan->alarm) {
+		chan->alarm = alarm;
+		*event = alarm ? OR2_OOB_EVENT_ALARM_ON : OR2_OOB_EVENT_ALARM_OFF;
+	} else if ((reg = shm_load(&chan->shm->rx_cas)) != chan->rx_cas) {
+		chan->rx_cas = reg;
+		*event = OR2_OOB_EVENT_CAS_CHANGE;
+	}
+	return 0;
+}
+
+static int shm_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return -1;
+	}
+	*alarm = shm_alarm(chan);
+	return 0;
+}
+
+static openr2_io_format_t shm_get_format(openr2_chan_t *r2chan)
+{
+	shm_chan_t *chan;
+
+	if (!(chan = shm_find_chan(r2chan))) {
+		return OR2_IO_FORMAT_ALAW;
+	}
+	return (chan->sample_size == 1) ? OR2_IO_FORMAT_ALAW : OR2_IO_FORMAT_SLINEAR;
+}
+
+static openr2_io_interface_t shm_io_interface =
+{
+	.open = shm_open_chan,
+	.close = shm_close,
+	.set_cas = shm_set_cas,
+	.get_cas = shm_get_cas,
+	.flush_write_buffers = shm_flush_write_buffers,
+	.write = shm_write,
+	.read = shm_read,
+	.setup = shm_setup,
+	.wait = shm_wait,
+	.get_oob_event = shm_get_oob_event,
+	.get_alarm_state = shm_get_alarm_state,
+	.get_format = shm_get_format,
+	.span = NULL,
+	.peek = shm_peek,
+	.consume = shm_consume,
+	.flush_read_buffers = shm_flush_read_buffers
+};
+
+openr2_io_interface_t *openr2_io_get_shm_interface()
+{
+	return &shm_io_interface;
+}
+
+#else
+
+openr2_io_interface_t *openr2_io_get_shm_interface()
+{
+	return NULL;
+}
+
+#endif
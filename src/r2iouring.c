@@ -0,0 +1,1132 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2iouring.c - Zaptel or DAHDI I/O with the media of all the channels of a
+ *               context read and written through a single io_uring
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Only the media goes through the ring. Opening the channels, the CAS bits,
+ * the events and the alarms are left to a base interface, the Zaptel or DAHDI
+ * one unless the application gives another, so any descriptor the kernel can
+ * read, write and poll will do, a pipe or a socket as well.
+ *
+ * Each channel has one read and one write in flight at most. A read is only
+ * queued once openr2 asks for OR2_IO_READ, and the frame it brings is handed
+ * to the channel in place. The frames written are queued on the channel and
+ * written one after the other as each write completes, so they never overtake
+ * each other. The descriptors are non blocking, so no read or write ever
+ * holds a kernel worker: reads are linked behind a poll for POLLIN, and a
+ * read or write the descriptor turns down with EAGAIN goes behind a new
+ * poll. Events are noticed with a POLLPRI poll on the descriptor, or when
+ * DAHDI fails a read or a write with ELAST. The buffers of the channels are
+ * registered with the ring when the kernel lets us.
+ *
+ * The channels queue their operations and, when they find nothing else to do,
+ * hand them to the kernel in one system call. Once the application waits on
+ * them with openr2_chan_wait_span() they leave that to it instead, and a single
+ * io_uring_enter() submits the I/O of all the channels of the context.
+ * Polling the descriptors themselves still works, but a frame the ring already
+ * took from the kernel does not show up there, so applications using this
+ * interface should rather wait with openr2_chan_wait_span().
+ *
+ * Channels created with openr2_chan_new_from_fd() never go through the ring,
+ * the base interface does all their I/O.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#if defined(__linux__) && defined(HAVE_LINUX_IO_URING_H)
+#include <linux/io_uring.h>
+#endif
+
+/* IORING_OP_READ and the poll driven retry of reads came along with it */
+#if defined(__linux__) && defined(HAVE_LINUX_IO_URING_H) && defined(IORING_FEAT_FAST_POLL)
+#define OR2_URING_AVAILABLE
+#endif
+
+#ifdef OR2_URING_AVAILABLE
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+#include "openr2/r2zapcompat.h"
+#include "openr2/r2log-pvt.h"
+#include "openr2/r2chan-pvt.h"
+#include "openr2/r2context-pvt.h"
+#include "openr2/r2utils-pvt.h"
+#include "openr2/r2ioabs.h"
+
+#ifdef OR2_URING_AVAILABLE
+
+/* the ring only orders our operations, the kernel keeps the completions that
+   do not fit in the completion queue until we reap them */
+#define URING_ENTRIES 256
+#define URING_CQ_ENTRIES 4096
+
+/* registered buffer slots of a ring, one per channel */
+#define URING_MAX_SLOTS 1024
+
+/* frames written ahead, as many as the DAHDI buffers of the channel */
+#define URING_TX_FRAMES 4
+
+/* room for a frame of either format */
+#define URING_FRAME_SIZE (OR2_CHAN_READ_SIZE * sizeof(int16_t))
+
+/* the blocking wait looks again after a frame at most, somebody else may
+   have reaped the completion it waits for */
+#define URING_FRAME_MS 20
+
+/* what completed, in the low bits of the user data, the rest points to the channel */
+#define URING_OP_READ 0
+#define URING_OP_WRITE 1
+#define URING_OP_POLL 2
+/* polls a read or a write is linked behind */
+#define URING_OP_READ_POLL 3
+#define URING_OP_WRITE_POLL 4
+#define URING_OP_MASK 7
+
+#define uring_load(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define uring_store(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+
+typedef struct openr2_uring_s {
+	/* taken by every operation on the ring or the channels using it */
+	pthread_mutex_t lock;
+	int fd;
+	/* submission queue */
+	void *sq_ring;
+	size_t sq_ring_size;
+	unsigned *sq_head;
+	unsigned *sq_tail;
+	unsigned sq_mask;
+	unsigned sq_entries;
+	struct io_uring_sqe *sqes;
+	/* completion queue */
+	void *cq_ring;
+	size_t cq_ring_size;
+	unsigned *cq_head;
+	unsigned *cq_tail;
+	unsigned cq_mask;
+	struct io_uring_cqe *cqes;
+	/* entries filled and not handed to the kernel yet */
+	unsigned queued;
+	/* openr2_chan_wait_span() submits for the channels */
+	int batched;
+	/* the buffer table is registered */
+	int fixed;
+	/* channels using the ring */
+	int users;
+	/* registered buffer slots taken */
+	unsigned char slots[URING_MAX_SLOTS];
+} uring_ring_t;
+
+typedef struct {
+	uring_ring_t *ring;
+	int fd;
+	/* registered buffer slot, -1 when the buffer is not registered */
+	int slot;
+	/* the received frame first, then the frames to write */
+	uint8_t *mem;
+	/* bytes of a frame */
+	int frame_size;
+	/* what openr2 waited for the last time */
+	int wanted;
+	/* operations in flight */
+	int reading;
+	int writing;
+	int polling;
+	/* the last write was turned down, the next one waits for POLLOUT */
+	int tx_blocked;
+	/* received frame, rx_off bytes of it already taken */
+	int rx_len;
+	int rx_off;
+	/* the read in flight brings media flushed already */
+	int rx_drop;
+	/* frames to write, from tx_head on, tx_off bytes of the first one
+	   already written */
+	int tx_head;
+	int tx_count;
+	int tx_len[URING_TX_FRAMES];
+	int tx_off;
+	/* an event is waiting */
+	int oob;
+	/* DAHDI refuses the media until the event is taken */
+	int elast;
+	/* errno of the last failed read or write, reported by the next one */
+	int rx_error;
+	int tx_error;
+} uring_chan_t;
+
+static struct {
+	/* write locked to open and close channels, read locked to find them */
+	pthread_rwlock_t lock;
+	/* indexed by channel descriptor */
+	uring_chan_t **chans;
+	int numchans;
+} uring = { PTHREAD_RWLOCK_INITIALIZER, NULL, 0 };
+
+static int uring_setup(unsigned entries, struct io_uring_params *params)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static int uring_register(int fd, unsigned opcode, void *arg, unsigned nr_args)
+{
+	return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/* ring channel of a channel, with uring.lock locked */
+static uring_chan_t *uring_lookup_chan(openr2_chan_t *r2chan)
+{
+	int fd = (int)(long)r2chan->fd;
+	return (fd >= 0 && fd < uring.numchans) ? uring.chans[fd] : NULL;
+}
+
+/* channels not opened by us are left to the base interface */
+static uring_chan_t *uring_find_chan(openr2_chan_t *r2chan)
+{
+	uring_chan_t *chan;
+	pthread_rwlock_rdlock(&uring.lock);
+	chan = uring_lookup_chan(r2chan);
+	pthread_rwlock_unlock(&uring.lock);
+	return chan;
+}
+
+static void uring_ring_delete(uring_ring_t *ring)
+{
+	if (ring->sqes) {
+		munmap(ring->sqes, ring->sq_entries * sizeof(*ring->sqes));
+	}
+	if (ring->cq_ring) {
+		munmap(ring->cq_ring, ring->cq_ring_size);
+	}
+	if (ring->sq_ring) {
+		munmap(ring->sq_ring, ring->sq_ring_size);
+	}
+	if (ring->fd != -1) {
+		close(ring->fd);
+	}
+	pthread_mutex_destroy(&ring->lock);
+	free(ring);
+}
+
+static uring_ring_t *uring_ring_new(openr2_context_t *r2context)
+{
+	struct io_uring_params params;
+	uring_ring_t *ring;
+	unsigned *sq_array;
+	unsigned i;
+	void *mem;
+
+	if (!(ring = calloc(1, sizeof(*ring)))) {
+		r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+		return NULL;
+	}
+	pthread_mutex_init(&ring->lock, NULL);
+	memset(&params, 0, sizeof(params));
+	params.flags = IORING_SETUP_CQSIZE;
+	params.cq_entries = URING_CQ_ENTRIES;
+	if ((ring->fd = uring_setup(URING_ENTRIES, &params)) == -1) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to create the io_uring of the context (%s)\n", strerror(errno));
+		goto failed;
+	}
+	if (!(params.features & IORING_FEAT_NODROP)) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "The kernel may drop io_uring completions, not using it\n");
+		goto failed;
+	}
+	ring->sq_entries = params.sq_entries;
+	ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	mem = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+	if (mem == MAP_FAILED) {
+		goto map_failed;
+	}
+	ring->sq_ring = mem;
+	mem = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+	if (mem == MAP_FAILED) {
+		goto map_failed;
+	}
+	ring->cq_ring = mem;
+	mem = mmap(NULL, params.sq_entries * sizeof(*ring->sqes), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+	if (mem == MAP_FAILED) {
+		goto map_failed;
+	}
+	ring->sqes = mem;
+	ring->sq_head = (unsigned *)((char *)ring->sq_ring + params.sq_off.head);
+	ring->sq_tail = (unsigned *)((char *)ring->sq_ring + params.sq_off.tail);
+	ring->sq_mask = *(unsigned *)((char *)ring->sq_ring + params.sq_off.ring_mask);
+	ring->cq_head = (unsigned *)((char *)ring->cq_ring + params.cq_off.head);
+	ring->cq_tail = (unsigned *)((char *)ring->cq_ring + params.cq_off.tail);
+	ring->cq_mask = *(unsigned *)((char *)ring->cq_ring + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)((char *)ring->cq_ring + params.cq_off.cqes);
+	/* each entry always goes in the slot of the same index */
+	sq_array = (unsigned *)((char *)ring->sq_ring + params.sq_off.array);
+	for (i = 0; i < ring->sq_entries; i++) {
+		sq_array[i] = i;
+	}
+#ifdef IORING_RSRC_REGISTER_SPARSE
+	{
+		/* room for the buffers of the channels, filled as they come */
+		struct io_uring_rsrc_register reg;
+		memset(&reg, 0, sizeof(reg));
+		reg.nr = URING_MAX_SLOTS;
+		reg.flags = IORING_RSRC_REGISTER_SPARSE;
+		ring->fixed = !uring_register(ring->fd, IORING_REGISTER_BUFFERS2, &reg, sizeof(reg));
+	}
+#endif
+	if (!ring->fixed) {
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_NOTICE, "Not registering the media buffers with the io_uring\n");
+	}
+	return ring;
+
+map_failed:
+	openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to map the io_uring of the context (%s)\n", strerror(errno));
+failed:
+	r2context->last_error = OR2_LIBERR_SYSCALL_FAILED;
+	uring_ring_delete(ring);
+	return NULL;
+}
+
+/* hand the queued entries to the kernel, with the ring locked */
+static int uring_submit(uring_ring_t *ring)
+{
+	int res;
+	while (ring->queued) {
+		res = uring_enter(ring->fd, ring->queued, 0, 0);
+		if (res == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			/* EAGAIN and EBUSY go away once the kernel catches up */
+			return (errno == EAGAIN || errno == EBUSY) ? 0 : -1;
+		}
+		ring->queued -= res;
+	}
+	return 0;
+}
+
+/* make room for count submission entries, with the ring locked */
+static int uring_sq_room(uring_ring_t *ring, unsigned count)
+{
+	if (*ring->sq_tail - uring_load(ring->sq_head) + count > ring->sq_entries) {
+		uring_submit(ring);
+	}
+	return *ring->sq_tail - uring_load(ring->sq_head) + count <= ring->sq_entries;
+}
+
+/* next free submission entry, with the ring locked */
+static struct io_uring_sqe *uring_get_sqe(uring_ring_t *ring, int fd, int opcode, uint64_t user_data)
+{
+	struct io_uring_sqe *sqe;
+	if (!uring_sq_room(ring, 1)) {
+		return NULL;
+	}
+	sqe = &ring->sqes[*ring->sq_tail & ring->sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = opcode;
+	sqe->fd = fd;
+	sqe->user_data = user_data;
+	return sqe;
+}
+
+static void uring_put_sqe(uring_ring_t *ring)
+{
+	uring_store(ring->sq_tail, *ring->sq_tail + 1);
+	ring->queued++;
+}
+
+/* poll events in the byte order the kernel reads them */
+static uint32_t uring_poll_events(uint32_t events)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	events = (events << 16) | (events >> 16);
+#endif
+	return events;
+}
+
+/* queue a read or write of the media, behind a poll for the descriptor to
+   be ready when asked to, with the ring locked */
+static int uring_queue_rw(uring_chan_t *chan, int op, uint8_t *buf, int len, int poll_first)
+{
+	struct io_uring_sqe *sqe;
+	int opcode;
+	if (poll_first) {
+		/* both go to the kernel at once, or the link would be cut */
+		if (!uring_sq_room(chan->ring, 2)) {
+			return -1;
+		}
+		sqe = uring_get_sqe(chan->ring, chan->fd, IORING_OP_POLL_ADD,
+				(uint64_t)(uintptr_t)chan | ((op == URING_OP_READ) ? URING_OP_READ_POLL : URING_OP_WRITE_POLL));
+		sqe->poll32_events = uring_poll_events((op == URING_OP_READ) ? POLLIN : POLLOUT);
+		sqe->flags |= IOSQE_IO_LINK;
+		uring_put_sqe(chan->ring);
+	}
+	if (chan->slot != -1) {
+		opcode = (op == URING_OP_READ) ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+	} else {
+		opcode = (op == URING_OP_READ) ? IORING_OP_READ : IORING_OP_WRITE;
+	}
+	if (!(sqe = uring_get_sqe(chan->ring, chan->fd, opcode, (uint64_t)(uintptr_t)chan | op))) {
+		return -1;
+	}
+	sqe->addr = (uint64_t)(uintptr_t)buf;
+	sqe->len = len;
+	/* the current position, for the descriptors that have one */
+	sqe->off = (uint64_t)-1;
+	if (chan->slot != -1) {
+		sqe->buf_index = chan->slot;
+	}
+	uring_put_sqe(chan->ring);
+	if (op == URING_OP_READ) {
+		chan->reading = 1;
+	} else {
+		chan->writing = 1;
+	}
+	return 0;
+}
+
+/* media comes every 20ms, so a read always waits for it first */
+static void uring_queue_read(uring_chan_t *chan)
+{
+	uring_queue_rw(chan, URING_OP_READ, chan->mem, chan->frame_size, 1);
+}
+
+/* there is room to write most of the time, a write only waits for it once
+   the last one was turned down */
+static void uring_queue_write(uring_chan_t *chan)
+{
+	uint8_t *frame = chan->mem + (1 + chan->tx_head) * URING_FRAME_SIZE;
+	uring_queue_rw(chan, URING_OP_WRITE, frame + chan->tx_off, chan->tx_len[chan->tx_head] - chan->tx_off, chan->tx_blocked);
+}
+
+static void uring_queue_poll(uring_chan_t *chan)
+{
+	struct io_uring_sqe *sqe;
+	if (!(sqe = uring_get_sqe(chan->ring, chan->fd, IORING_OP_POLL_ADD, (uint64_t)(uintptr_t)chan | URING_OP_POLL))) {
+		return;
+	}
+	/* sockets wake their urgent data waiters with POLLRDBAND but not POLLPRI */
+	sqe->poll32_events = uring_poll_events(POLLPRI | POLLRDBAND);
+	uring_put_sqe(chan->ring);
+	chan->polling = 1;
+}
+
+static void uring_complete(uring_chan_t *chan, int op, int res)
+{
+	switch (op) {
+	case URING_OP_READ:
+		chan->reading = 0;
+		if (chan->rx_drop) {
+			chan->rx_drop = 0;
+		} else if (res > 0) {
+			chan->rx_len = res;
+			chan->rx_off = 0;
+#ifdef ELAST
+		} else if (res == -ELAST) {
+			chan->oob = chan->elast = 1;
+#endif
+		} else if (!res) {
+			/* the far end of a pipe or socket went away */
+			chan->rx_error = EPIPE;
+		} else if (res == -EAGAIN || res == -EINTR) {
+			/* woken up for nothing, wait for the media again */
+			if ((chan->wanted & OR2_IO_READ) && !chan->elast && chan->fd != -1) {
+				uring_queue_read(chan);
+			}
+		} else if (res != -ECANCELED) {
+			chan->rx_error = -res;
+		}
+		break;
+	case URING_OP_WRITE:
+		chan->writing = 0;
+		chan->tx_blocked = 0;
+		if (res > 0) {
+			chan->tx_off += res;
+			if (chan->tx_off < chan->tx_len[chan->tx_head]) {
+				break;
+			}
+		} else if (res == -EAGAIN) {
+			chan->tx_blocked = 1;
+			break;
+		} else if (res == -EINTR || res == -ECANCELED) {
+			break;
+#ifdef ELAST
+		} else if (res == -ELAST) {
+			/* written again once the event is taken */
+			chan->oob = chan->elast = 1;
+			break;
+#endif
+		} else {
+			/* the frame is lost, say so on the next write */
+			chan->tx_error = res ? -res : EIO;
+		}
+		chan->tx_off = 0;
+		chan->tx_head = (chan->tx_head + 1) % URING_TX_FRAMES;
+		chan->tx_count--;
+		break;
+	case URING_OP_POLL:
+		chan->polling = 0;
+		if (res > 0 && (res & (POLLPRI | POLLRDBAND))) {
+			chan->oob = 1;
+		}
+		break;
+	}
+	/* writes follow each other right away, a frame at a time */
+	if (chan->tx_count && !chan->writing && !chan->elast && chan->fd != -1) {
+		uring_queue_write(chan);
+	}
+}
+
+/* handle the completions, with the ring locked */
+static void uring_reap(uring_ring_t *ring)
+{
+	struct io_uring_cqe *cqe;
+	uint64_t user_data;
+	int op;
+	unsigned head = *ring->cq_head;
+	unsigned tail = uring_load(ring->cq_tail);
+	while (head != tail) {
+		cqe = &ring->cqes[head & ring->cq_mask];
+		user_data = cqe->user_data;
+		/* the completions of the cancellations carry no channel, and those
+		   of the polls a read or write is linked behind tell nothing the
+		   read or write does not tell, the channel may be gone by then */
+		op = user_data & URING_OP_MASK;
+		if (user_data && op != URING_OP_READ_POLL && op != URING_OP_WRITE_POLL) {
+			uring_complete((uring_chan_t *)(uintptr_t)(user_data & ~(uint64_t)URING_OP_MASK), op, cqe->res);
+		}
+		head++;
+		if (head == tail) {
+			uring_store(ring->cq_head, head);
+			tail = uring_load(ring->cq_tail);
+		}
+	}
+}
+
+/* queue what the channel needs to find out about the events requested,
+   with the ring locked */
+static void uring_arm(uring_chan_t *chan, int flags)
+{
+	chan->wanted = flags;
+	if ((flags & OR2_IO_OOB_EVENT) && !chan->polling && !chan->oob) {
+		uring_queue_poll(chan);
+	}
+	if (chan->elast) {
+		return;
+	}
+	if ((flags & OR2_IO_READ) && !chan->reading && !chan->rx_len && !chan->rx_error) {
+		uring_queue_read(chan);
+	}
+	if (chan->tx_count && !chan->writing) {
+		uring_queue_write(chan);
+	}
+}
+
+static int uring_ready(uring_chan_t *chan)
+{
+	int flags = 0;
+	if (chan->oob) {
+		flags |= OR2_IO_OOB_EVENT;
+	}
+	if (chan->rx_len || chan->rx_error) {
+		flags |= OR2_IO_READ;
+	}
+	if (chan->tx_count < URING_TX_FRAMES) {
+		flags |= OR2_IO_WRITE;
+	}
+	return flags;
+}
+
+/* put the descriptor on the ring of the context */
+static int uring_attach(openr2_context_t *r2context, int fd)
+{
+	uring_chan_t **chans, *chan;
+	openr2_io_format_t format = OR2_IO_FORMAT_ALAW;
+	openr2_chan_t r2chan;
+	struct iovec iov;
+	int flags, i;
+
+	if (!(chan = calloc(1, sizeof(*chan)))
+	    || posix_memalign((void **)&chan->mem, sysconf(_SC_PAGESIZE), (1 + URING_TX_FRAMES) * URING_FRAME_SIZE)) {
+		free(chan);
+		r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+		openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to put descriptor %d on the io_uring (out of memory)\n", fd);
+		return -1;
+	}
+	chan->fd = fd;
+	chan->slot = -1;
+	chan->wanted = OR2_IO_READ | OR2_IO_OOB_EVENT;
+	/* the base only needs the context and the descriptor to tell the format */
+	if (r2context->uring_base->get_format) {
+		memset(&r2chan, 0, sizeof(r2chan));
+		r2chan.r2context = r2context;
+		r2chan.fd = (openr2_io_fd_t)(long)fd;
+		format = r2context->uring_base->get_format(&r2chan);
+	}
+	chan->frame_size = OR2_CHAN_READ_SIZE * ((format == OR2_IO_FORMAT_SLINEAR) ? sizeof(int16_t) : 1);
+	/* the ring polls the descriptor before reading or writing, a blocking
+	   one would hold a kernel worker for every read in flight */
+	flags = fcntl(fd, F_GETFL);
+	fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+	pthread_rwlock_wrlock(&uring.lock);
+	if (fd >= uring.numchans) {
+		if (!(chans = realloc(uring.chans, (fd + 1) * sizeof(*chans)))) {
+			pthread_rwlock_unlock(&uring.lock);
+			r2context->last_error = OR2_LIBERR_OUT_OF_MEMORY;
+			openr2_log2(r2context, OR2_CONTEXT_LOG, OR2_LOG_ERROR, "Failed to put descriptor %d on the io_uring (out of memory)\n", fd);
+			goto failed;
+		}
+		memset(&chans[uring.numchans], 0, (fd + 1 - uring.numchans) * sizeof(*chans));
+		uring.chans = chans;
+		uring.numchans = fd + 1;
+	}
+	if (!r2context->uring && !(r2context->uring = uring_ring_new(r2context))) {
+		pthread_rwlock_unlock(&uring.lock);
+		goto failed;
+	}
+	chan->ring = r2context->uring;
+	pthread_mutex_lock(&chan->ring->lock);
+	chan->ring->users++;
+	for (i = 0; chan->ring->fixed && i < URING_MAX_SLOTS; i++) {
+		struct io_uring_rsrc_update2 update;
+		if (chan->ring->slots[i]) {
+			continue;
+		}
+		iov.iov_base = chan->mem;
+		iov.iov_len = (1 + URING_TX_FRAMES) * URING_FRAME_SIZE;
+		memset(&update, 0, sizeof(update));
+		update.offset = i;
+		update.data = (uint64_t)(uintptr_t)&iov;
+		update.nr = 1;
+		/* past RLIMIT_MEMLOCK the rest go unregistered */
+		if (uring_register(chan->ring->fd, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update)) == 1) {
+			chan->ring->slots[i] = 1;
+			chan->slot = i;
+		}
+		break;
+	}
+	pthread_mutex_unlock(&chan->ring->lock);
+	uring.chans[fd] = chan;
+	pthread_rwlock_unlock(&uring.lock);
+	return 0;
+
+failed:
+	fcntl(fd, F_SETFL, flags);
+	free(chan->mem);
+	free(chan);
+	return -1;
+}
+
+/* take the channel off the ring once nothing is in flight any more */
+static void uring_detach(openr2_context_t *r2context, uring_chan_t *chan)
+{
+	uring_ring_t *ring = chan->ring;
+	struct io_uring_rsrc_update2 update;
+	struct io_uring_sqe *sqe;
+	struct iovec iov;
+	struct pollfd pfd;
+	int op;
+
+	pthread_rwlock_wrlock(&uring.lock);
+	uring.chans[chan->fd] = NULL;
+	pthread_rwlock_unlock(&uring.lock);
+
+	pthread_mutex_lock(&ring->lock);
+	/* the polls first, cancelling one cancels what is linked behind it */
+	for (op = URING_OP_WRITE_POLL; op >= URING_OP_READ; op--) {
+		if (((op == URING_OP_READ || op == URING_OP_READ_POLL) && !chan->reading)
+		    || ((op == URING_OP_WRITE || op == URING_OP_WRITE_POLL) && !chan->writing)
+		    || (op == URING_OP_POLL && !chan->polling)) {
+			continue;
+		}
+		if ((sqe = uring_get_sqe(ring, -1, IORING_OP_ASYNC_CANCEL, 0))) {
+			sqe->addr = (uint64_t)(uintptr_t)chan | op;
+			uring_put_sqe(ring);
+		}
+	}
+	/* nothing new gets queued for it from here on */
+	chan->tx_count = 0;
+	chan->fd = -1;
+	uring_submit(ring);
+	uring_reap(ring);
+	while (chan->reading || chan->writing || chan->polling) {
+		pthread_mutex_unlock(&ring->lock);
+		pfd.fd = ring->fd;
+		pfd.events = POLLIN;
+		poll(&pfd, 1, URING_FRAME_MS);
+		pthread_mutex_lock(&ring->lock);
+		uring_reap(ring);
+	}
+	if (chan->slot != -1) {
+		iov.iov_base = NULL;
+		iov.iov_len = 0;
+		memset(&update, 0, sizeof(update));
+		update.offset = chan->slot;
+		update.data = (uint64_t)(uintptr_t)&iov;
+		update.nr = 1;
+		uring_register(ring->fd, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update));
+		ring->slots[chan->slot] = 0;
+	}
+	ring->users--;
+	pthread_mutex_unlock(&ring->lock);
+
+	/* the last channel takes the ring along */
+	pthread_rwlock_wrlock(&uring.lock);
+	if (!ring->users && r2context->uring == ring) {
+		r2context->uring = NULL;
+		uring_ring_delete(ring);
+	}
+	pthread_rwlock_unlock(&uring.lock);
+	free(chan->mem);
+	free(chan);
+}
+
+static openr2_io_fd_t uring_open(openr2_context_t *r2context, int channo)
+{
+	openr2_chan_t r2chan;
+	openr2_io_fd_t fd;
+
+	if (!(fd = r2context->uring_base->open(r2context, channo))) {
+		return NULL;
+	}
+	if (uring_attach(r2context, (int)(long)fd)) {
+		memset(&r2chan, 0, sizeof(r2chan));
+		r2chan.r2context = r2context;
+		r2chan.number = channo;
+		r2chan.fd = fd;
+		r2context->uring_base->close(&r2chan);
+		return NULL;
+	}
+	return fd;
+}
+
+static int uring_close(openr2_chan_t *r2chan)
+{
+	uring_chan_t *chan;
+
+	if ((chan = uring_find_chan(r2chan))) {
+		uring_detach(r2chan->r2context, chan);
+	}
+	return r2chan->r2context->uring_base->close(r2chan);
+}
+
+static int uring_set_cas(openr2_chan_t *r2chan, int cas)
+{
+	return r2chan->r2context->uring_base->set_cas(r2chan, cas);
+}
+
+static int uring_get_cas(openr2_chan_t *r2chan, int *cas)
+{
+	return r2chan->r2context->uring_base->get_cas(r2chan, cas);
+}
+
+static int uring_flush_write_buffers(openr2_chan_t *r2chan)
+{
+	uring_chan_t *chan;
+
+	if ((chan = uring_find_chan(r2chan))) {
+		/* the frame in flight is gone already */
+		pthread_mutex_lock(&chan->ring->lock);
+		chan->tx_count = chan->writing ? 1 : 0;
+		pthread_mutex_unlock(&chan->ring->lock);
+	}
+	return r2chan->r2context->uring_base->flush_write_buffers(r2chan);
+}
+
+static int uring_write(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	uring_chan_t *chan;
+	int myerrno, frame;
+
+	if (!(chan = uring_find_chan(r2chan))) {
+		return r2chan->r2context->uring_base->write(r2chan, buf, size);
+	}
+	pthread_mutex_lock(&chan->ring->lock);
+	if ((myerrno = chan->tx_error)) {
+		chan->tx_error = 0;
+		pthread_mutex_unlock(&chan->ring->lock);
+		EMI(r2chan)->on_os_error(r2chan, myerrno);
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Failed to write to channel %d: %s\n", r2chan->number, strerror(myerrno));
+		errno = myerrno;
+		return -1;
+	}
+	if (chan->tx_count == URING_TX_FRAMES) {
+		pthread_mutex_unlock(&chan->ring->lock);
+		return 0;
+	}
+	if (size > URING_FRAME_SIZE) {
+		size = URING_FRAME_SIZE;
+	}
+	frame = (chan->tx_head + chan->tx_count) % URING_TX_FRAMES;
+	memcpy(chan->mem + (1 + frame) * URING_FRAME_SIZE, buf, size);
+	chan->tx_len[frame] = size;
+	chan->tx_count++;
+	if (!chan->writing && !chan->elast) {
+		uring_queue_write(chan);
+	}
+	pthread_mutex_unlock(&chan->ring->lock);
+	return size;
+}
+
+/* take up to size bytes of the received frame, with the ring locked */
+static int uring_take(openr2_chan_t *r2chan, uring_chan_t *chan, const void **buf, int size)
+{
+	int myerrno;
+	if ((myerrno = chan->rx_error)) {
+		chan->rx_error = 0;
+		EMI(r2chan)->on_os_error(r2chan, myerrno);
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Failed to read from channel %d: %s\n", r2chan->number, strerror(myerrno));
+		errno = myerrno;
+		return -1;
+	}
+	if (size > chan->rx_len - chan->rx_off) {
+		size = chan->rx_len - chan->rx_off;
+	}
+	*buf = chan->mem + chan->rx_off;
+	return size;
+}
+
+/* done with size bytes of the received frame, with the ring locked */
+static void uring_drop(uring_chan_t *chan, int size)
+{
+	chan->rx_off += size;
+	if (chan->rx_off >= chan->rx_len) {
+		chan->rx_len = chan->rx_off = 0;
+	}
+}
+
+static int uring_read(openr2_chan_t *r2chan, const void *buf, int size)
+{
+	uring_chan_t *chan;
+	const void *frame;
+
+	if (!(chan = uring_find_chan(r2chan))) {
+		return r2chan->r2context->uring_base->read(r2chan, buf, size);
+	}
+	pthread_mutex_lock(&chan->ring->lock);
+	if ((size = uring_take(r2chan, chan, &frame, size)) > 0) {
+		memcpy((void *)buf, frame, size);
+		uring_drop(chan, size);
+	}
+	pthread_mutex_unlock(&chan->ring->lock);
+	return size;
+}
+
+static int uring_peek(openr2_chan_t *r2chan, const void **buf, int size)
+{
+	uring_chan_t *chan;
+
+	if (!(chan = uring_find_chan(r2chan))) {
+		return 0;
+	}
+	pthread_mutex_lock(&chan->ring->lock);
+	/* read reports the errors */
+	size = chan->rx_error ? 0 : uring_take(r2chan, chan, buf, size);
+	pthread_mutex_unlock(&chan->ring->lock);
+	return size;
+}
+
+static int uring_consume(openr2_chan_t *r2chan, int size)
+{
+	uring_chan_t *chan;
+
+	if (!(chan = uring_find_chan(r2chan))) {
+		return -1;
+	}
+	/* the frame stays put until the next read is queued */
+	pthread_mutex_lock(&chan->ring->lock);
+	uring_drop(chan, size);
+	pthread_mutex_unlock(&chan->ring->lock);
+	return 0;
+}
+
+static int uring_setup_chan(openr2_chan_t *r2chan)
+{
+	uring_chan_t *chan;
+
+	if (r2chan->r2context->uring_base->setup(r2chan)) {
+		/* the channel is not closed when its setup fails */
+		if ((chan = uring_find_chan(r2chan))) {
+			uring_detach(r2chan->r2context, chan);
+		}
+		return -1;
+	}
+	return 0;
+}
+
+static int uring_wait(openr2_chan_t *r2chan, int *flags, int block)
+{
+	uring_chan_t *chan;
+	uring_ring_t *ring;
+	struct pollfd pfd;
+	int ready, myerrno;
+
+	if (!flags || !*flags) {
+		return -1;
+	}
+	if (!(chan = uring_find_chan(r2chan))) {
+		return r2chan->r2context->uring_base->wait(r2chan, flags, block);
+	}
+	ring = chan->ring;
+	pthread_mutex_lock(&ring->lock);
+	uring_reap(ring);
+	uring_arm(chan, *flags);
+	ready = uring_ready(chan) & *flags;
+	/* nothing to do, get the I/O going unless the application does it for
+	   all the channels at once */
+	if (!ready && ring->queued && (block || !ring->batched)) {
+		if (uring_submit(ring)) {
+			myerrno = errno;
+			pthread_mutex_unlock(&ring->lock);
+			openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Failed to submit I/O to the io_uring: %s\n", strerror(myerrno));
+			EMI(r2chan)->on_os_error(r2chan, myerrno);
+			return -1;
+		}
+		uring_reap(ring);
+		uring_arm(chan, *flags);
+		ready = uring_ready(chan) & *flags;
+	}
+	while (!ready && block) {
+		pthread_mutex_unlock(&ring->lock);
+		pfd.fd = ring->fd;
+		pfd.events = POLLIN;
+		poll(&pfd, 1, URING_FRAME_MS);
+		pthread_mutex_lock(&ring->lock);
+		uring_reap(ring);
+		uring_arm(chan, *flags);
+		/* what the completions and the channel queued goes before sleeping */
+		uring_submit(ring);
+		ready = uring_ready(chan) & *flags;
+	}
+	pthread_mutex_unlock(&ring->lock);
+	*flags = ready;
+	return 0;
+}
+
+static int uring_get_oob_event(openr2_chan_t *r2chan, openr2_oob_event_t *event)
+{
+	uring_chan_t *chan;
+
+	if ((chan = uring_find_chan(r2chan))) {
+		/* the next wait polls again, for the events still waiting */
+		pthread_mutex_lock(&chan->ring->lock);
+		chan->oob = chan->elast = 0;
+		pthread_mutex_unlock(&chan->ring->lock);
+	}
+	return r2chan->r2context->uring_base->get_oob_event(r2chan, event);
+}
+
+static int uring_get_alarm_state(openr2_chan_t *r2chan, int *alarm)
+{
+	openr2_io_interface_t *base = r2chan->r2context->uring_base;
+	if (!base->get_alarm_state) {
+		*alarm = 0;
+		return 0;
+	}
+	return base->get_alarm_state(r2chan, alarm);
+}
+
+static openr2_io_format_t uring_get_format(openr2_chan_t *r2chan)
+{
+	openr2_io_interface_t *base = r2chan->r2context->uring_base;
+	return base->get_format ? base->get_format(r2chan) : OR2_IO_FORMAT_ALAW;
+}
+
+static int uring_span_set_cas(openr2_chan_t *r2chans[], const int cas[], int numchans)
+{
+	openr2_io_interface_t *base = r2chans[0]->r2context->uring_base;
+	int i;
+	if (base->span && base->span->set_cas) {
+		return base->span->set_cas(r2chans, cas, numchans);
+	}
+	for (i = 0; i < numchans; i++) {
+		if (base->set_cas(r2chans[i], cas[i])) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int uring_span_get_cas(openr2_chan_t *r2chans[], int cas[], int numchans)
+{
+	openr2_io_interface_t *base = r2chans[0]->r2context->uring_base;
+	int i;
+	if (base->span && base->span->get_cas) {
+		return base->span->get_cas(r2chans, cas, numchans);
+	}
+	for (i = 0; i < numchans; i++) {
+		if (base->get_cas(r2chans[i], &cas[i])) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* channels of the span with media to read or an event, with uring.lock and
+   the ring locked */
+static int uring_span_ready(openr2_chan_t *r2chans[], int numchans)
+{
+	uring_chan_t *chan;
+	int i, ready = 0;
+	for (i = 0; i < numchans; i++) {
+		/* a frame left over once reading stopped must not wake us up */
+		chan = uring_lookup_chan(r2chans[i]);
+		if (chan && (uring_ready(chan) & chan->wanted & (OR2_IO_READ | OR2_IO_OOB_EVENT))) {
+			ready++;
+		}
+	}
+	return ready;
+}
+
+static int uring_span_wait(openr2_chan_t *r2chans[], int numchans, int timeout)
+{
+	openr2_context_t *r2context = r2chans[0]->r2context;
+	uring_ring_t *ring;
+	struct timespec now, deadline;
+	struct pollfd pfd;
+	int ready, ms;
+
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout / 1000;
+	deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+	if (deadline.tv_nsec >= 1000000000) {
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000;
+	}
+	pfd.events = POLLIN;
+	for (;;) {
+		/* the channels, and the ring along with the last of them, may be
+		   closed while we sleep, so they are looked up every time */
+		pthread_rwlock_rdlock(&uring.lock);
+		if (!(ring = r2context->uring)) {
+			pthread_rwlock_unlock(&uring.lock);
+			errno = EBADF;
+			return -1;
+		}
+		pthread_mutex_lock(&ring->lock);
+		/* the channels leave the submission to us from now on */
+		ring->batched = 1;
+		ready = uring_submit(ring);
+		if (!ready) {
+			uring_reap(ring);
+			ready = uring_span_ready(r2chans, numchans);
+			/* reads the completions queued again */
+			uring_submit(ring);
+		}
+		pfd.fd = ring->fd;
+		pthread_mutex_unlock(&ring->lock);
+		pthread_rwlock_unlock(&uring.lock);
+		if (ready || !timeout) {
+			break;
+		}
+		ms = -1;
+		if (timeout > 0) {
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			ms = (int)((deadline.tv_sec - now.tv_sec) * 1000 + (deadline.tv_nsec - now.tv_nsec) / 1000000);
+			if (ms <= 0) {
+				break;
+			}
+		}
+		if (poll(&pfd, 1, ms) == -1 && errno != EINTR) {
+			return -1;
+		}
+	}
+	return ready;
+}
+
+/* the channels of a span are opened and their alarms read one by one, the
+   base opens them and sets them up */
+static openr2_io_span_interface_t uring_span_interface =
+{
+	.open = NULL,
+	.set_cas = uring_span_set_cas,
+	.get_cas = uring_span_get_cas,
+	.get_alarm_state = NULL,
+	.wait = uring_span_wait
+};
+
+static int uring_flush_read_buffers(openr2_chan_t *r2chan)
+{
+	uring_chan_t *chan;
+
+	if ((chan = uring_find_chan(r2chan))) {
+		pthread_mutex_lock(&chan->ring->lock);
+		chan->rx_len = 0;
+		chan->rx_off = 0;
+		chan->rx_drop = chan->reading;
+		pthread_mutex_unlock(&chan->ring->lock);
+	}
+	if (!r2chan->r2context->uring_base->flush_read_buffers) {
+		return 0;
+	}
+	return r2chan->r2context->uring_base->flush_read_buffers(r2chan);
+}
+
+static openr2_io_interface_t uring_io_interface =
+{
+	.open = uring_open,
+	.close = uring_close,
+	.set_cas = uring_set_cas,
+	.get_cas = uring_get_cas,
+	.flush_write_buffers = uring_flush_write_buffers,
+	.write = uring_write,
+	.read = uring_read,
+	.setup = uring_setup_chan,
+	.wait = uring_wait,
+	.get_oob_event = uring_get_oob_event,
+	.get_alarm_state = uring_get_alarm_state,
+	.get_format = uring_get_format,
+	.span = &uring_span_interface,
+	.peek = uring_peek,
+	.consume = uring_consume,
+	.flush_read_buffers = uring_flush_read_buffers
+};
+
+openr2_io_interface_t *openr2_io_get_uring_interface()
+{
+	return &uring_io_interface;
+}
+
+#else
+
+openr2_io_interface_t *openr2_io_get_uring_interface()
+{
+	return NULL;
+}
+
+#endif
@@ -25,8 +25,10 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <getopt.h>
 #include "openr2/openr2.h"
 #include "openr2/r2engine-pvt.h"
+#include "r2batch.h"
 
 #define FORMAT_INVALID 0 
 #define FORMAT_ALAW 1
@@ -34,10 +36,59 @@
 
 #define CHUNK_SAMPLES 160
 
-#define USAGE "USAGE: %s [alaw|slinear] [alaw or slinear file path]\n"
+#define USAGE "USAGE: %s [-e] [-t threads] [alaw|slinear] [alaw or slinear file or directory path]...\n" \
+	"  with a single file and no options the tones are printed as they come and go,\n" \
+	"  otherwise the files are scanned in parallel and each digit is printed as an\n" \
+	"  event line (-e forces that for a single file, -t sets the number of threads)\n"
 
 #define samples_to_ms(samples) (int)((((float)samples/(float)8000)) * (float)1000)
 
+typedef struct {
+	const char *direction;
+	char digit;
+	unsigned long on_sample;
+} digit_track_t;
+
+static void track_digit(r2batch_output_t *output, digit_track_t *track, int digit, unsigned long position)
+{
+	if (digit == track->digit) {
+		return;
+	}
+	if (track->digit) {
+		r2batch_digit(output, track->direction, track->digit, track->on_sample, position);
+	}
+	track->digit = digit;
+	track->on_sample = position;
+}
+
+static void scan_mf(int format, const void *samples, size_t count, r2batch_output_t *output)
+{
+	openr2_mf_analyzer_state_t analyzer;
+	digit_track_t fwd = { "fwd", 0, 0 };
+	digit_track_t bwd = { "back", 0, 0 };
+	int fwd_digit = 0;
+	int bwd_digit = 0;
+	size_t position = 0;
+	int chunk;
+
+	openr2_mf_analyzer_init(&analyzer);
+	while (position < count) {
+		chunk = (count - position < CHUNK_SAMPLES) ? count - position : CHUNK_SAMPLES;
+		if (format == R2BATCH_FORMAT_ALAW) {
+			openr2_mf_analyzer_rx_alaw(&analyzer, (const uint8_t *)samples + position, chunk, &fwd_digit, &bwd_digit);
+		} else {
+			openr2_mf_analyzer_rx(&analyzer, (const int16_t *)samples + position, chunk, &fwd_digit, &bwd_digit);
+		}
+		position += chunk;
+		/* same as the single file output, edges are reported at the end of the chunk */
+		track_digit(output, &fwd, fwd_digit, position);
+		track_digit(output, &bwd, bwd_digit, position);
+	}
+	/* close the tones still on at the end of the file */
+	track_digit(output, &fwd, 0, position);
+	track_digit(output, &bwd, 0, position);
+}
+
 int main(int argc, char *argv[])
 {
 	struct stat statbuf;
@@ -47,21 +98,51 @@ int main(int argc, char *argv[])
 	char *chunk_buffer;
 	size_t chunksize = 0;
 	int format = FORMAT_INVALID;
-	int i = 0;
-	char digit = 0;
+	int fwd_digit = 0;
+	int bwd_digit = 0;
 	char bwd_currdigit = 0;
 	char fwd_currdigit = 0;
 	int processed_samples = 0;
-	openr2_mf_rx_state_t  fwd_rxstate;
-	openr2_mf_rx_state_t  bwd_rxstate;
+	openr2_mf_analyzer_state_t analyzer;
+	int events = 0;
+	int threads = 0;
+	int c;
+
+	while ((c = getopt(argc, argv, "et:")) != -1) {
+		switch (c) {
+		case 'e':
+			events = 1;
+			break;
+		case 't':
+			threads = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, USAGE, argv[0]);
+			exit(1);
+		}
+	}
 
-	printf("Running MF Detection Test - alaw or slinear 8000hz only\n");
+	if (argc - optind < 2) {
+		fprintf(stderr, USAGE, argv[0]);
+		exit(1);
+	}
 
-	if (argc < 3) {
+	if (!openr2_strncasecmp(argv[optind], "alaw", sizeof("alaw")-1)) {
+		format = FORMAT_ALAW;
+	} else if (!openr2_strncasecmp(argv[optind], "slinear", sizeof("slinear")-1)) {
+		format = FORMAT_SLINEAR;
+	} else {
 		fprintf(stderr, USAGE, argv[0]);
 		exit(1);
 	}
 
+	if (optind > 1 || events || argc - optind > 2 || (!stat(argv[optind + 1], &statbuf) && S_ISDIR(statbuf.st_mode))) {
+		return r2batch_run(format == FORMAT_ALAW ? R2BATCH_FORMAT_ALAW : R2BATCH_FORMAT_SLINEAR,
+				&argv[optind + 1], argc - optind - 1, threads, scan_mf) ? 1 : 0;
+	}
+
+	printf("Running MF Detection Test - alaw or slinear 8000hz only\n");
+
 	if (!openr2_strncasecmp(argv[1], "alaw", sizeof("alaw")-1)) {
 		format = FORMAT_ALAW;
 		chunksize = sizeof(alaw_buffer);
@@ -87,40 +168,34 @@ int main(int argc, char *argv[])
 		exit(1);
 	}
 
-	if (!openr2_mf_rx_init(&bwd_rxstate, 0)) {
-		fprintf(stderr, "could not create backward rx state\n");
-		exit(1);
-	}
-
-	if (!openr2_mf_rx_init(&fwd_rxstate, 1)) {
-		fprintf(stderr, "could not create forward rx state\n");
+	/* a single analyzer watches both directions */
+	if (!openr2_mf_analyzer_init(&analyzer)) {
+		fprintf(stderr, "could not create MF analyzer state\n");
 		exit(1);
 	}
 
 	while (fread(chunk_buffer, chunksize, 1, audiofp) == 1) {
 		if (format == FORMAT_ALAW) {
 			/* chunksize == bytes == samples */
-			for (i = 0; i < chunksize; i++) {
-				slinear_buffer[i] = openr2_alaw_to_linear(chunk_buffer[i]);
-			}
-		} 
+			openr2_mf_analyzer_rx_alaw(&analyzer, (uint8_t *)alaw_buffer, CHUNK_SAMPLES, &fwd_digit, &bwd_digit);
+		} else {
+			openr2_mf_analyzer_rx(&analyzer, slinear_buffer, CHUNK_SAMPLES, &fwd_digit, &bwd_digit);
+		}
 
 		processed_samples += CHUNK_SAMPLES;
 
-		digit = openr2_mf_rx(&bwd_rxstate, slinear_buffer, CHUNK_SAMPLES);
-		if (digit && digit != bwd_currdigit) {
-			bwd_currdigit = digit;
+		if (bwd_digit && bwd_digit != bwd_currdigit) {
+			bwd_currdigit = bwd_digit;
 			printf("Backward %c ON (samples = %d, ms = %d)\n", bwd_currdigit, processed_samples, samples_to_ms(processed_samples));
-		} else if (!digit && bwd_currdigit) {
+		} else if (!bwd_digit && bwd_currdigit) {
 			printf("Backward %c OFF (samples = %d, ms %d)\n", bwd_currdigit, processed_samples, samples_to_ms(processed_samples));
 			bwd_currdigit = 0;
 		}
 
-		digit = openr2_mf_rx(&fwd_rxstate, slinear_buffer, CHUNK_SAMPLES);
-		if (digit && digit != fwd_currdigit) {
-			fwd_currdigit = digit;
+		if (fwd_digit && fwd_digit != fwd_currdigit) {
+			fwd_currdigit = fwd_digit;
 			printf("Forward %c ON (samples = %d, ms = %d)\n", fwd_currdigit, processed_samples, samples_to_ms(processed_samples));
-		} else if (!digit && fwd_currdigit) {
+		} else if (!fwd_digit && fwd_currdigit) {
 			printf("Forward %c OFF (samples = %d, ms = %d)\n", fwd_currdigit, processed_samples, samples_to_ms(processed_samples));
 			fwd_currdigit = 0;
 		}
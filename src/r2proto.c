@@ -109,6 +109,11 @@ static void r2config_brazil(openr2_context_t *r2context)
 	r2context->mf_gb_tones.special_info_tone = OR2_MF_TONE_6; /* holding? */
 	r2context->mf_gb_tones.number_changed = OR2_MF_TONE_3;
 	r2context->mf_gb_tones.unallocated_number = OR2_MF_TONE_7; 
+
+	r2context->cpt.busy.on_ms = 250;
+	r2context->cpt.busy.off_ms = 250;
+	r2context->cpt.congestion.on_ms = 750;
+	r2context->cpt.congestion.off_ms = 250;
 }
 
 static void r2config_china(openr2_context_t *r2context)
@@ -118,6 +123,15 @@ static void r2config_china(openr2_context_t *r2context)
 	   used, so their value never changes during a call */
 	r2context->cas_nonr2_bits = 0x3;    /* 0011 */
 
+	/* call progress tones are 450Hz */
+	r2context->cpt.busy.freq = 450;
+	r2context->cpt.busy.on_ms = 350;
+	r2context->cpt.busy.off_ms = 350;
+	r2context->cpt.congestion.freq = 450;
+	r2context->cpt.congestion.on_ms = 700;
+	r2context->cpt.congestion.off_ms = 700;
+	r2context->cpt.ringback.freq = 450;
+
 	r2context->mf_ga_tones.request_next_ani_digit = OR2_MF_TONE_1;
 	r2context->mf_ga_tones.request_category = OR2_MF_TONE_6;
 	r2context->mf_ga_tones.address_complete_charge_setup = OR2_MF_TONE_INVALID;
@@ -423,6 +437,18 @@ int openr2_proto_configure_context(openr2_context_t *r2context, openr2_variant_t
 	/* DTMF start dialing timer */
 	r2context->timers.dtmf_start_dial = 500;
 
+	/* Call progress tones, as recommended by ITU-T E.180 */
+	r2context->cpt.busy.freq = 425;
+	r2context->cpt.busy.on_ms = 500;
+	r2context->cpt.busy.off_ms = 500;
+	r2context->cpt.congestion.freq = 425;
+	r2context->cpt.congestion.on_ms = 250;
+	r2context->cpt.congestion.off_ms = 250;
+	r2context->cpt.ringback.freq = 425;
+	r2context->cpt.ringback.on_ms = 1000;
+	r2context->cpt.ringback.off_ms = 4000;
+	r2context->cpt.sit = 1;
+
 	/* Max ANI and DNIS */
 	r2context->max_dnis = (max_dnis >= OR2_MAX_DNIS) ? OR2_MAX_DNIS - 1 : max_dnis;
 	r2context->max_ani = (max_ani >= OR2_MAX_ANI) ? OR2_MAX_ANI - 1 : max_ani;
@@ -744,6 +770,8 @@ static void openr2_proto_init(openr2_chan_t *r2chan)
 	r2chan->call_state = OR2_CALL_IDLE;
 	r2chan->direction = OR2_DIR_STOPPED;
 	r2chan->answered = 0;
+	r2chan->detecting_call_dtmf = 0;
+	r2chan->detecting_cpt = 0;
 	r2chan->category_sent = 0;
 	r2chan->mf_write_tone = 0;
 	r2chan->mf_read_tone = 0;
@@ -775,6 +803,22 @@ int openr2_proto_set_blocked(openr2_chan_t *r2chan)
 	return 0;
 }
 
+/* hand the user the MF signal quality of the call, once per call, if the
+   built-in MF detector measured any digit */
+static void report_mf_stats(openr2_chan_t *r2chan)
+{
+	openr2_mf_rx_stats_t stats;
+	if (MFI(r2chan)->mf_read_init != (openr2_mf_read_init_func)openr2_mf_rx_init
+	    || !r2chan->r2context->mf_stats
+	    || !r2chan->mf_read_handle
+	    || openr2_mf_rx_get_stats(r2chan->mf_read_handle, &stats)
+	    || !stats.digits) {
+		return;
+	}
+	openr2_mf_rx_reset_stats(r2chan->mf_read_handle);
+	EMI(r2chan)->on_call_mf_stats(r2chan, &stats);
+}
+
 static void handle_protocol_error(openr2_chan_t *r2chan, openr2_protocol_error_t reason)
 {
 	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, 
@@ -790,6 +834,7 @@ static void handle_protocol_error(openr2_chan_t *r2chan, openr2_protocol_error_t
 			r2chan->mf_read_tone ? r2chan->mf_read_tone : 0x20);
 	/* mute anything we may have */
 	MFI(r2chan)->mf_select_tone(r2chan->mf_write_handle, 0);
+	report_mf_stats(r2chan);
 	openr2_proto_set_idle(r2chan);
 	EMI(r2chan)->on_protocol_error(r2chan, reason);
 }
@@ -922,6 +967,97 @@ static void on_dtmf_received(void *user_data, const char *digits, int len)
 	}
 }
 
+/* apply the context DSP settings, only the built-in detectors know about them */
+static void configure_mf_detector(openr2_chan_t *r2chan, void *mf_read_handle)
+{
+	if (MFI(r2chan)->mf_read_init != (openr2_mf_read_init_func)openr2_mf_rx_init) {
+		return;
+	}
+	openr2_mf_rx_set_fixed_point(mf_read_handle, r2chan->r2context->dsp_engine == OR2_DSP_FIXED_POINT);
+	openr2_mf_rx_set_sliding(mf_read_handle, r2chan->r2context->mf_sliding_detection);
+	openr2_mf_rx_set_tracking(mf_read_handle, r2chan->r2context->mf_tracking_detection);
+	openr2_mf_rx_set_tone_mask(mf_read_handle, NULL);
+	openr2_mf_rx_set_stats(mf_read_handle, r2chan->r2context->mf_stats);
+	/* the tones are debounced counting samples, 8 per ms */
+	openr2_mf_rx_set_debounce(mf_read_handle, r2chan->r2context->mf_threshold * 8, r2chan->r2context->mf_threshold * 8);
+}
+
+static int add_mf_tones(char *tones, int len, const openr2_mf_tone_t *group, int group_size)
+{
+	int i;
+	for (i = 0; i < group_size; i++) {
+		if (group[i] != OR2_MF_TONE_INVALID) {
+			tones[len++] = group[i];
+		}
+	}
+	return len;
+}
+
+/* with MF tracking detection on, let the built-in detector know which backward
+   tones are valid for the group we are in, anything else is not a tone to us */
+static void update_mf_tone_mask(openr2_chan_t *r2chan)
+{
+	char tones[sizeof(openr2_mf_ga_tones_t)/sizeof(openr2_mf_tone_t) + 1];
+	int len = 0;
+	if (MFI(r2chan)->mf_read_init != (openr2_mf_read_init_func)openr2_mf_rx_init
+	    || !r2chan->r2context->mf_tracking_detection
+	    || !r2chan->mf_read_handle) {
+		return;
+	}
+	switch (r2chan->mf_group) {
+	case OR2_MF_GI:
+		len = add_mf_tones(tones, len, (const openr2_mf_tone_t *)&GA_TONE(r2chan), sizeof(GA_TONE(r2chan))/sizeof(openr2_mf_tone_t));
+		break;
+	case OR2_MF_GII:
+		len = add_mf_tones(tones, len, (const openr2_mf_tone_t *)&GB_TONE(r2chan), sizeof(GB_TONE(r2chan))/sizeof(openr2_mf_tone_t));
+		break;
+	case OR2_MF_GIII:
+		len = add_mf_tones(tones, len, (const openr2_mf_tone_t *)&GC_TONE(r2chan), sizeof(GC_TONE(r2chan))/sizeof(openr2_mf_tone_t));
+		break;
+	default:
+		/* forward tones, every one of them may be valid */
+		openr2_mf_rx_set_tone_mask(r2chan->mf_read_handle, NULL);
+		return;
+	}
+	tones[len] = '\0';
+	openr2_mf_rx_set_tone_mask(r2chan->mf_read_handle, tones);
+}
+
+static void configure_dtmf_detector(openr2_chan_t *r2chan, void *dtmf_read_handle)
+{
+	if (DTMF(r2chan)->dtmf_rx_init != (openr2_dtmf_rx_init_func)openr2_dtmf_rx_init) {
+		return;
+	}
+	openr2_dtmf_rx_set_fixed_point(dtmf_read_handle, r2chan->r2context->dsp_engine == OR2_DSP_FIXED_POINT);
+}
+
+static void on_call_dtmf_received(void *user_data, const char *digits, int len)
+{
+	openr2_chan_t *r2chan = user_data;
+	if (!digits) {
+		return;
+	}
+	while (len-- && *digits) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Got in-call DTMF digit %c\n", *digits);
+		EMI(r2chan)->on_call_dtmf(r2chan, *digits++);
+	}
+}
+
+/* start the DTMF detector on the audio of the answered call, the DTMF R2
+   detector is done with the DNIS by now so its handle is free to use */
+int openr2_proto_start_call_dtmf(openr2_chan_t *r2chan)
+{
+	if (!DTMF(r2chan)->dtmf_rx_init(r2chan->dtmf_read_handle, on_call_dtmf_received, r2chan)) {
+		openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "Failed to initialize in-call DTMF detector\n");
+		r2chan->detecting_call_dtmf = -1;
+		return -1;
+	}
+	configure_dtmf_detector(r2chan, r2chan->dtmf_read_handle);
+	r2chan->detecting_call_dtmf = 1;
+	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Initialized in-call DTMF detector\n");
+	return 0;
+}
+
 static void handle_incoming_call(openr2_chan_t *r2chan)
 {
 	void *mf_read_handle = NULL;
@@ -943,6 +1079,7 @@ static void handle_incoming_call(openr2_chan_t *r2chan)
 			handle_protocol_error(r2chan, OR2_INTERNAL_ERROR);
 			return;
 		}
+		configure_mf_detector(r2chan, mf_read_handle);
 		r2chan->mf_write_handle = mf_write_handle;
 		r2chan->mf_read_handle = mf_read_handle;
 		r2chan->mf_state = OR2_MF_SEIZE_ACK_TXD;
@@ -955,6 +1092,7 @@ static void handle_incoming_call(openr2_chan_t *r2chan)
 			handle_protocol_error(r2chan, OR2_INTERNAL_ERROR);
 			return;
 		}
+		configure_dtmf_detector(r2chan, r2chan->dtmf_read_handle);
 		r2chan->mf_group = OR2_MF_DTMF_BACK_INIT;
 		r2chan->mf_state = OR2_MF_DETECTING_DTMF;
 		r2chan->detecting_dtmf = 1;
@@ -1074,6 +1212,7 @@ static void report_call_disconnection(openr2_chan_t *r2chan, openr2_call_disconn
 static void report_call_end(openr2_chan_t *r2chan)
 {
 	openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_DEBUG, "Call ended\n");
+	report_mf_stats(r2chan);
 	openr2_proto_set_idle(r2chan);
 	EMI(r2chan)->on_call_end(r2chan);
 }
@@ -1281,6 +1420,8 @@ handlecas:
 				r2chan->mf_group = OR2_MF_GI;
 				MFI(r2chan)->mf_write_init(r2chan->mf_write_handle, 1);
 				MFI(r2chan)->mf_read_init(r2chan->mf_read_handle, 0);
+				configure_mf_detector(r2chan, r2chan->mf_read_handle);
+				update_mf_tone_mask(r2chan);
 				mf_send_dnis(r2chan, 0);
 			} else {
 				/* handle seize ack for DTMF R2 */
@@ -2355,12 +2496,15 @@ static int timediff(struct timeval *t1, struct timeval *t2)
 	return msdiff;
 }
 
+/* the built-in MF detector debounces the tones itself, this is only
+   needed for other MF detectors */
 static int check_threshold(openr2_chan_t *r2chan, int tone)
 {
 	int res = 0;
 	int tone_threshold = 0;
 	struct timeval currtime = {0, 0};
-	if (r2chan->r2context->mf_threshold) {
+	if (r2chan->r2context->mf_threshold
+	    && MFI(r2chan)->mf_read_init != (openr2_mf_read_init_func)openr2_mf_rx_init) {
 		if (r2chan->mf_threshold_tone != tone) {
 			res = gettimeofday(&r2chan->mf_threshold_time, NULL);
 			if (-1 == res) {
@@ -2424,6 +2568,7 @@ void openr2_proto_handle_mf_tone(openr2_chan_t *r2chan, int tone)
 			openr2_log(r2chan, OR2_CHANNEL_LOG, OR2_LOG_ERROR, "BUG: invalid direction of R2 channel\n");
 			handle_protocol_error(r2chan, OR2_LIBRARY_BUG);
 		}
+		update_mf_tone_mask(r2chan);
 
 	} else {
 
@@ -2447,6 +2592,7 @@ void openr2_proto_handle_mf_tone(openr2_chan_t *r2chan, int tone)
 			handle_protocol_error(r2chan, OR2_LIBRARY_BUG);
 		}
 		r2chan->mf_read_tone = 0;
+		update_mf_tone_mask(r2chan);
 
 	}
 }
@@ -2907,6 +3053,22 @@ OR2_DECLARE(const openr2_variant_entry_t *) openr2_proto_get_variant_list(int *n
 	return r2variants;
 }
 
+OR2_DECLARE(const char *) openr2_proto_get_cpt_tone_string(openr2_cpt_tone_t tone)
+{
+	switch (tone) {
+	case OR2_CPT_BUSY:
+		return "Busy";
+	case OR2_CPT_CONGESTION:
+		return "Congestion";
+	case OR2_CPT_RINGBACK:
+		return "Ringback";
+	case OR2_CPT_SIT:
+		return "Special Information";
+	default:
+		return "*Unknown*";
+	}
+}
+
 /* Send seize ack to an incoming call */
 int openr2_proto_ack_call(openr2_chan_t *r2chan)
 {
@@ -0,0 +1,160 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2queue_check.c - write and read the digit queue across the end of its
+ *                   buffer, in byte and in message mode
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "openr2/queue.h"
+
+#define QUEUE_LEN 16
+
+static int failures = 0;
+
+#define check(cond, ...) \
+	do { \
+		if (!(cond)) { \
+			printf(__VA_ARGS__); \
+			failures++; \
+		} \
+	} while (0)
+
+/* read one transfer, either at once or byte by byte */
+static int read_transfer(queue_state_t *q, uint8_t *out, int bytewise)
+{
+	int i, c;
+
+	if (!bytewise) {
+		return queue_read(q, out, QUEUE_LEN);
+	}
+	for (i = 0; i < QUEUE_LEN; i++) {
+		if ((c = queue_read_byte(q)) < 0) {
+			break;
+		}
+		out[i] = (uint8_t)c;
+	}
+	return i;
+}
+
+/* write one transfer, either at once or byte by byte */
+static int write_transfer(queue_state_t *q, const uint8_t *in, int size, int bytewise)
+{
+	int i;
+
+	if (!bytewise) {
+		return queue_write(q, in, size);
+	}
+	for (i = 0; i < size; i++) {
+		if (queue_write_byte(q, in[i]) != 1) {
+			break;
+		}
+	}
+	return i;
+}
+
+/* every transfer size, from every starting offset, so that transfers end
+   exactly on the end of the buffer too. The bulk functions are mixed with
+   the byte functions, which wrap the pointers on their own */
+static void check_bytes(void)
+{
+	queue_state_t *q;
+	uint8_t in[QUEUE_LEN];
+	uint8_t out[QUEUE_LEN];
+	int start, size, round, i, res;
+
+	for (start = 0; start <= QUEUE_LEN; start++) {
+		for (size = 1; size <= QUEUE_LEN; size++) {
+			q = queue_init(NULL, QUEUE_LEN, 0);
+			if (!q) {
+				printf("failed to allocate the queue\n");
+				exit(1);
+			}
+			/* move both pointers to the starting offset */
+			for (i = 0; i < start; i++) {
+				queue_write_byte(q, 0);
+				queue_read_byte(q);
+			}
+			for (round = 0; round < 6; round++) {
+				for (i = 0; i < size; i++) {
+					in[i] = (uint8_t)(start*31 + size*7 + round*3 + i);
+				}
+				res = write_transfer(q, in, size, round % 3 == 1);
+				check(res == size, "start %d size %d round %d: wrote %d\n", start, size, round, res);
+				check(queue_contents(q) == size, "start %d size %d round %d: %d bytes queued\n",
+						start, size, round, queue_contents(q));
+				res = read_transfer(q, out, round % 3 == 2);
+				check(res == size && !memcmp(in, out, size), "start %d size %d round %d: read %d\n",
+						start, size, round, res);
+				check(queue_empty(q), "start %d size %d round %d: not empty after the read\n",
+						start, size, round);
+			}
+			queue_free(q);
+		}
+	}
+}
+
+static void check_messages(void)
+{
+	queue_state_t *q;
+	uint8_t in[QUEUE_LEN];
+	uint8_t out[QUEUE_LEN];
+	int start, size, round, i, res;
+
+	for (start = 0; start <= QUEUE_LEN; start++) {
+		for (size = 1; size + (int)sizeof(uint16_t) <= QUEUE_LEN; size++) {
+			q = queue_init(NULL, QUEUE_LEN, QUEUE_READ_ATOMIC | QUEUE_WRITE_ATOMIC);
+			if (!q) {
+				printf("failed to allocate the queue\n");
+				exit(1);
+			}
+			for (i = 0; i < start; i++) {
+				queue_write_byte(q, 0);
+				queue_read_byte(q);
+			}
+			for (round = 0; round < 3; round++) {
+				for (i = 0; i < size; i++) {
+					in[i] = (uint8_t)(start*17 + size*5 + round + i);
+				}
+				res = queue_write_msg(q, in, size);
+				check(res == size, "msg start %d size %d round %d: wrote %d\n", start, size, round, res);
+				res = queue_read_msg(q, out, sizeof(out));
+				check(res == size && !memcmp(in, out, size), "msg start %d size %d round %d: read %d\n",
+						start, size, round, res);
+				check(queue_empty(q), "msg start %d size %d round %d: not empty after the read\n",
+						start, size, round);
+			}
+			queue_free(q);
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	check_bytes();
+	check_messages();
+	if (failures) {
+		printf("%d queue checks failed\n", failures);
+		return 1;
+	}
+	printf("queue checks passed\n");
+	return 0;
+}
@@ -0,0 +1,438 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2shmdrv.c - test driver for the shared memory I/O (OR2_IO_SHM), stands in
+ *              for a user space TDM driver: the two channels opened with the
+ *              same number are the two ends of a virtual E1 trunk
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "openr2/openr2.h"
+#include "openr2/r2ioshm.h"
+
+#ifdef __linux__
+#include <time.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+
+#define USAGE "USAGE: %s [-s socket] [-l] [-v]\n" \
+	"  -s path of the socket openr2 connects to, " OR2_SHM_DEFAULT_SOCKET " by default\n" \
+	"  -l carry signed linear media instead of A-law\n" \
+	"  -v print the channels opened and closed and the CAS bits\n"
+
+#define FRAME_MS 20
+#define FRAME_SAMPLES 160
+#define NO_PEER_CAS 0xF
+
+#define shm_load(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define shm_store(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+
+typedef struct {
+	int open;
+	int conn;
+	openr2_shm_chan_t *shm;
+	/* eventfd we write to, and eventfd openr2 writes to */
+	int rxfd;
+	int txfd;
+	/* last CAS register of openr2 seen */
+	uint32_t tx_cas;
+} drv_end_t;
+
+typedef struct {
+	drv_end_t ends[2];
+} drv_trunk_t;
+
+static drv_trunk_t *trunks = NULL;
+static int numtrunks = 0;
+static int sample_size = 1;
+static int verbose = 0;
+
+static void kick(drv_end_t *end)
+{
+	uint64_t one = 1;
+	if (write(end->rxfd, &one, sizeof(one)) != sizeof(one)) {
+		/* the counter is full, it is readable anyway */
+	}
+}
+
+static void set_rx_cas(drv_end_t *end, int bits)
+{
+	uint32_t reg = end->shm->rx_cas;
+	if (OR2_SHM_CAS_BITS(reg) != bits) {
+		shm_store(&end->shm->rx_cas, OR2_SHM_CAS(OR2_SHM_CAS_SEQ(reg) + 1, bits));
+		kick(end);
+	}
+}
+
+static void set_alarm(drv_end_t *end, int alarm)
+{
+	shm_store(&end->shm->alarm, alarm);
+	kick(end);
+}
+
+/* take the CAS bits and flush requests from openr2 */
+static void handle_tx(int channo, drv_end_t *end, drv_end_t *peer)
+{
+	openr2_shm_ring_t *ring = &end->shm->tx;
+	uint32_t reg, flush;
+
+	reg = shm_load(&end->shm->tx_cas);
+	if (reg != end->tx_cas) {
+		end->tx_cas = reg;
+		if (verbose) {
+			printf("channel %d end %d CAS bits 0x%X\n", channo, (int)(end - trunks[channo].ends), OR2_SHM_CAS_BITS(reg));
+		}
+		if (peer->open) {
+			set_rx_cas(peer, OR2_SHM_CAS_BITS(reg));
+		}
+	}
+	flush = shm_load(&end->shm->tx_flush);
+	if ((int32_t)(flush - ring->tail) > 0 && (int32_t)(ring->head - flush) >= 0) {
+		shm_store(&ring->tail, flush);
+	}
+}
+
+/* one frame of the line, from the tx ring of an end to the rx ring of the
+   far end, silence when openr2 did not write enough */
+static void move_frame(drv_end_t *end, drv_end_t *peer)
+{
+	openr2_shm_ring_t *tx = &end->shm->tx;
+	openr2_shm_ring_t *rx;
+	uint8_t frame[FRAME_SAMPLES * sizeof(int16_t)];
+	int size = FRAME_SAMPLES * sample_size;
+	uint32_t tail, head;
+	int avail, i;
+
+	tail = tx->tail;
+	avail = (int)(shm_load(&tx->head) - tail);
+	if (avail > size) {
+		avail = size;
+	}
+	for (i = 0; i < avail; i++) {
+		frame[i] = tx->data[(tail + i) & (OR2_SHM_RING_SIZE - 1)];
+	}
+	memset(&frame[avail], sample_size == 1 ? 0xD5 : 0, size - avail);
+	shm_store(&tx->tail, tail + avail);
+	if (!peer->open) {
+		return;
+	}
+	rx = &peer->shm->rx;
+	head = rx->head;
+	if (OR2_SHM_RING_SIZE - (int)(head - shm_load(&rx->tail)) < size) {
+		/* openr2 is not reading, the frame is lost */
+		return;
+	}
+	for (i = 0; i < size; i++) {
+		rx->data[(head + i) & (OR2_SHM_RING_SIZE - 1)] = frame[i];
+	}
+	shm_store(&rx->head, head + size);
+	kick(peer);
+}
+
+static void close_end(int channo, drv_end_t *end)
+{
+	drv_end_t *peer = &trunks[channo].ends[end == &trunks[channo].ends[0] ? 1 : 0];
+	if (verbose) {
+		printf("channel %d end %d closed\n", channo, (int)(end - trunks[channo].ends));
+	}
+	munmap(end->shm, sizeof(*end->shm));
+	close(end->conn);
+	close(end->rxfd);
+	close(end->txfd);
+	end->open = 0;
+	if (peer->open) {
+		set_rx_cas(peer, NO_PEER_CAS);
+		set_alarm(peer, 1);
+	}
+}
+
+static int send_reply(int conn, int status, int fds[3])
+{
+	openr2_shm_reply_t reply;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char control[CMSG_SPACE(3 * sizeof(int))];
+
+	memset(&reply, 0, sizeof(reply));
+	reply.magic = OR2_SHM_MAGIC;
+	reply.status = status;
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = &reply;
+	iov.iov_len = sizeof(reply);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	if (!status) {
+		memset(control, 0, sizeof(control));
+		msg.msg_control = control;
+		msg.msg_controllen = sizeof(control);
+		cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_RIGHTS;
+		cmsg->cmsg_len = CMSG_LEN(3 * sizeof(int));
+		memcpy(CMSG_DATA(cmsg), fds, 3 * sizeof(int));
+	}
+	return sendmsg(conn, &msg, MSG_NOSIGNAL) == sizeof(reply) ? 0 : -1;
+}
+
+static void open_end(int conn)
+{
+	openr2_shm_request_t request;
+	drv_trunk_t *grown;
+	drv_end_t *end, *peer;
+	int fds[3] = { -1, -1, -1 };
+	int status = 0;
+
+	if (read(conn, &request, sizeof(request)) != sizeof(request)
+	    || request.magic != OR2_SHM_MAGIC || request.version != OR2_SHM_VERSION || request.channo < 0) {
+		fprintf(stderr, "bad request from openr2\n");
+		send_reply(conn, EPROTO, NULL);
+		close(conn);
+		return;
+	}
+	if (request.channo >= numtrunks) {
+		if (!(grown = realloc(trunks, (request.channo + 1) * sizeof(*trunks)))) {
+			send_reply(conn, ENOMEM, NULL);
+			close(conn);
+			return;
+		}
+		memset(&grown[numtrunks], 0, (request.channo + 1 - numtrunks) * sizeof(*trunks));
+		trunks = grown;
+		numtrunks = request.channo + 1;
+	}
+	end = &trunks[request.channo].ends[0];
+	peer = &trunks[request.channo].ends[1];
+	if (end->open) {
+		end = &trunks[request.channo].ends[1];
+		peer = &trunks[request.channo].ends[0];
+	}
+	if (end->open) {
+		send_reply(conn, EBUSY, NULL);
+		close(conn);
+		return;
+	}
+
+	memset(end, 0, sizeof(*end));
+	if ((fds[0] = memfd_create("openr2-shm", MFD_CLOEXEC)) == -1
+	    || ftruncate(fds[0], sizeof(*end->shm))
+	    || (end->shm = mmap(NULL, sizeof(*end->shm), PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0)) == MAP_FAILED
+	    || (fds[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) == -1
+	    || (fds[2] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) == -1) {
+		status = errno;
+		fprintf(stderr, "could not create channel %d: %s\n", request.channo, strerror(status));
+		if (end->shm && end->shm != MAP_FAILED) {
+			munmap(end->shm, sizeof(*end->shm));
+		}
+		goto done;
+	}
+	end->shm->magic = OR2_SHM_MAGIC;
+	end->shm->version = OR2_SHM_VERSION;
+	end->shm->format = (sample_size == 1) ? OR2_IO_FORMAT_ALAW : OR2_IO_FORMAT_SLINEAR;
+	end->shm->alarm = peer->open ? 0 : 1;
+	end->shm->rx_cas = OR2_SHM_CAS(0, peer->open ? OR2_SHM_CAS_BITS(peer->tx_cas) : NO_PEER_CAS);
+	end->shm->tx_cas = end->tx_cas = OR2_SHM_CAS(0, NO_PEER_CAS);
+	if (send_reply(conn, 0, fds)) {
+		status = errno;
+		fprintf(stderr, "could not hand channel %d over: %s\n", request.channo, strerror(status));
+		munmap(end->shm, sizeof(*end->shm));
+		goto done;
+	}
+	end->open = 1;
+	end->conn = conn;
+	end->rxfd = fds[1];
+	end->txfd = fds[2];
+	close(fds[0]);
+	if (verbose) {
+		printf("channel %d end %d opened\n", request.channo, (int)(end - trunks[request.channo].ends));
+	}
+	if (peer->open) {
+		/* the line comes up on the far end */
+		set_rx_cas(peer, OR2_SHM_CAS_BITS(end->tx_cas));
+		set_alarm(peer, 0);
+	}
+	return;
+
+done:
+	send_reply(conn, status, NULL);
+	close(conn);
+	if (fds[0] != -1) {
+		close(fds[0]);
+	}
+	if (fds[1] != -1) {
+		close(fds[1]);
+	}
+	if (fds[2] != -1) {
+		close(fds[2]);
+	}
+}
+
+static int elapsed_ms(const struct timespec *from, const struct timespec *to)
+{
+	return (to->tv_sec - from->tv_sec) * 1000 + (to->tv_nsec - from->tv_nsec) / 1000000;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *path = OR2_SHM_DEFAULT_SOCKET;
+	struct sockaddr_un addr;
+	struct timespec next, now;
+	struct pollfd *pfds = NULL;
+	drv_end_t **pends = NULL;
+	int *pchans = NULL;
+	int numpfds, maxpfds = 0;
+	uint64_t count;
+	int listener, conn, timeout, c, i, e;
+
+	while ((c = getopt(argc, argv, "s:lv")) != -1) {
+		switch (c) {
+		case 's':
+			path = optarg;
+			break;
+		case 'l':
+			sample_size = sizeof(int16_t);
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		default:
+			fprintf(stderr, USAGE, argv[0]);
+			exit(1);
+		}
+	}
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "socket path too long: %s\n", path);
+		exit(1);
+	}
+	strcpy(addr.sun_path, path);
+	unlink(path);
+	if ((listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) == -1
+	    || bind(listener, (struct sockaddr *)&addr, sizeof(addr))
+	    || listen(listener, 64)) {
+		fprintf(stderr, "could not listen on %s: %s\n", path, strerror(errno));
+		exit(1);
+	}
+	printf("Waiting for openr2 on %s\n", path);
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (;;) {
+		/* the listener, and the connection and eventfd of every end */
+		if (maxpfds < 1 + 4 * numtrunks) {
+			maxpfds = 1 + 4 * numtrunks;
+			pfds = realloc(pfds, maxpfds * sizeof(*pfds));
+			pends = realloc(pends, maxpfds * sizeof(*pends));
+			pchans = realloc(pchans, maxpfds * sizeof(*pchans));
+			if (!pfds || !pends || !pchans) {
+				fprintf(stderr, "out of memory\n");
+				exit(1);
+			}
+		}
+		pfds[0].fd = listener;
+		pfds[0].events = POLLIN;
+		numpfds = 1;
+		for (i = 0; i < numtrunks; i++) {
+			for (e = 0; e < 2; e++) {
+				if (!trunks[i].ends[e].open) {
+					continue;
+				}
+				pfds[numpfds].fd = trunks[i].ends[e].conn;
+				pfds[numpfds].events = POLLIN;
+				pends[numpfds] = &trunks[i].ends[e];
+				pchans[numpfds++] = i;
+				pfds[numpfds].fd = trunks[i].ends[e].txfd;
+				pfds[numpfds].events = POLLIN;
+				pends[numpfds] = &trunks[i].ends[e];
+				pchans[numpfds++] = i;
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		timeout = elapsed_ms(&now, &next);
+		if (timeout < 0) {
+			timeout = 0;
+		}
+		if (poll(pfds, numpfds, timeout) == -1 && errno != EINTR) {
+			fprintf(stderr, "poll failed: %s\n", strerror(errno));
+			exit(1);
+		}
+
+		for (i = 1; i < numpfds; i++) {
+			if (!pfds[i].revents || !pends[i]->open) {
+				continue;
+			}
+			e = (pends[i] == &trunks[pchans[i]].ends[0]) ? 1 : 0;
+			if (pfds[i].fd == pends[i]->conn) {
+				/* openr2 does not write after the request, it closed the channel */
+				close_end(pchans[i], pends[i]);
+			} else {
+				if (read(pends[i]->txfd, &count, sizeof(count)) != sizeof(count)) {
+					/* cleared already */
+				}
+				handle_tx(pchans[i], pends[i], &trunks[pchans[i]].ends[e]);
+			}
+		}
+		if (pfds[0].revents & POLLIN) {
+			if ((conn = accept4(listener, NULL, NULL, SOCK_CLOEXEC)) != -1) {
+				open_end(conn);
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if (elapsed_ms(&now, &next) > 0) {
+			continue;
+		}
+		next.tv_nsec += FRAME_MS * 1000000L;
+		if (next.tv_nsec >= 1000000000L) {
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		for (i = 0; i < numtrunks; i++) {
+			for (e = 0; e < 2; e++) {
+				if (trunks[i].ends[e].open) {
+					handle_tx(i, &trunks[i].ends[e], &trunks[i].ends[!e]);
+					move_frame(&trunks[i].ends[e], &trunks[i].ends[!e]);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+#else
+
+int main(int argc, char *argv[])
+{
+	fprintf(stderr, "%s: the shared memory I/O needs Linux\n", argv[0]);
+	return 1;
+}
+
+#endif
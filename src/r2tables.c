@@ -0,0 +1,329 @@
+/*
+ * OpenR2
+ * MFC/R2 call setup library
+ *
+ * r2tables.c - generator of the tone and Goertzel descriptor tables that
+ *              r2engine.c keeps as const data, and check of those tables
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include "openr2/fast_convert.h"
+#include "openr2/r2engine-pvt.h"
+
+#define USAGE "USAGE: %s [-c r2engine.c]\n" \
+              "Prints the MF and DTMF tables of r2engine.c, rendered the way the tone\n" \
+              "generator and the detectors of the library would set them up. With -c,\n" \
+              "checks that the given r2engine.c holds every table exactly as printed\n"
+
+/* C99 systems may not define M_PI */
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327
+#endif
+
+#define SAMPLE_RATE 8000
+/* the same as in r2engine.c */
+#define DBM0_MAX_SINE_POWER (3.14f)
+#define SLENK 11
+#define SINELEN (1 << SLENK)
+#define R2_MF_TX_PERIOD 400
+#define R2_MF_TX_LEVEL -11
+#define DTMF_TX_LEVEL -10
+#define DTMF_TX_ON_TIME 50
+#define DTMF_TX_OFF_TIME 55
+#define DTMF_BLOCK_SIZE 102
+
+static const int r2_mf_fwd_frequencies[6] = {1380, 1500, 1620, 1740, 1860, 1980};
+static const int r2_mf_back_frequencies[6] = {1140, 1020, 900, 780, 660, 540};
+static const int dtmf_row[4] = {697, 770, 852, 941};
+static const int dtmf_col[4] = {1209, 1336, 1477, 1633};
+
+/* the tone pair of each R2 signal, as positions in the frequency lists, in
+   the order of the r2_mf_tone_codes of r2engine.c */
+static const int r2_mf_pairs[15][2] = {
+	{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}, {0, 4}, {1, 4},
+	{2, 4}, {3, 4}, {0, 5}, {1, 5}, {2, 5}, {3, 5}, {4, 5}
+};
+static const char r2_mf_tone_codes[] = "1234567890BCDEF";
+static const char dtmf_positions[] = "123A" "456B" "789C" "*0#D";
+
+/* the sine_table of r2engine.c, which gives its values to 8 decimals */
+static float sine_table[SINELEN];
+
+/* the table being printed */
+static struct {
+	char *buf;
+	size_t len;
+	size_t size;
+} out;
+
+static void put(const char *fmt, ...)
+{
+	va_list ap;
+	char *buf;
+	int len;
+
+	for (;;) {
+		va_start(ap, fmt);
+		len = vsnprintf(out.buf + out.len, out.size - out.len, fmt, ap);
+		va_end(ap);
+		if (len >= 0 && (size_t)len < out.size - out.len) {
+			out.len += len;
+			return;
+		}
+		if (!(buf = realloc(out.buf, out.size ? out.size * 2 : 4096))) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		out.buf = buf;
+		out.size = out.size ? out.size * 2 : 4096;
+	}
+}
+
+/* a float the way it is written in the tables, always with a point */
+static void put_float(float value)
+{
+	char text[32];
+
+	snprintf(text, sizeof(text), "%.9g", value);
+	put("%s%sf", text, strpbrk(text, ".e") ? "" : ".0");
+}
+
+static void make_sine_table(void)
+{
+	char text[32];
+	int i;
+
+	for (i = 0; i < SINELEN; i++) {
+		snprintf(text, sizeof(text), "%.8f", sin(2.0 * M_PI * i / SINELEN));
+		sine_table[i] = strtof(text, NULL);
+	}
+}
+
+static int32_t dds_phase_ratef(float frequency)
+{
+	return (int32_t)(frequency * 65536.0f * 65536.0f / SAMPLE_RATE);
+}
+
+static float dds_scaling_dbm0f(float level)
+{
+	return powf(10.0f, (level - DBM0_MAX_SINE_POWER) / 20.0f) * 32767.0f;
+}
+
+static float dds_modf(uint32_t *phase_acc, int32_t phase_rate, float scale)
+{
+	float amp;
+
+	amp = sine_table[*phase_acc >> (32 - SLENK)] * scale;
+	*phase_acc += phase_rate;
+	return amp;
+}
+
+/* One period of an MF signal, the way the tone generator of r2engine.c
+   renders a pair of tones at the same level that never stops */
+static void render_mf_digit(int16_t wave[], int f1, int f2)
+{
+	uint32_t phase[2] = {0, 0};
+	int32_t rate[2];
+	float gain, xamp;
+	int i;
+
+	rate[0] = dds_phase_ratef((float)f1);
+	rate[1] = dds_phase_ratef((float)f2);
+	gain = dds_scaling_dbm0f((float)R2_MF_TX_LEVEL);
+	for (i = 0; i < R2_MF_TX_PERIOD; i++) {
+		xamp = 0.0f;
+		xamp += dds_modf(&phase[0], rate[0], gain);
+		xamp += dds_modf(&phase[1], rate[1], gain);
+		wave[i] = (int16_t)lfastrintf(xamp);
+	}
+}
+
+static void put_mf_waves(const char *name, const int freqs[6])
+{
+	int16_t wave[R2_MF_TX_PERIOD];
+	int f1, f2, d, i;
+
+	put("static const int16_t %s[15][R2_MF_TX_PERIOD] =\n{\n", name);
+	for (d = 0; d < 15; d++) {
+		f1 = freqs[r2_mf_pairs[d][0]];
+		f2 = freqs[r2_mf_pairs[d][1]];
+		render_mf_digit(wave, f1, f2);
+		put("    {   /* %c: %dHz + %dHz */\n", r2_mf_tone_codes[d], f1, f2);
+		for (i = 0; i < R2_MF_TX_PERIOD; i++) {
+			put("%s%6d%s", (i % 10) ? " " : "        ", wave[i],
+					(i == R2_MF_TX_PERIOD - 1) ? "\n" : ((i % 10 == 9) ? ",\n" : ","));
+		}
+		put("    }%s\n", (d == 14) ? "" : ",");
+	}
+	put("};\n");
+}
+
+static void put_mf_alaw_waves(const char *name, const int freqs[6])
+{
+	int16_t wave[R2_MF_TX_PERIOD];
+	int d, i;
+
+	put("static const uint8_t %s[15][R2_MF_TX_PERIOD] =\n{\n", name);
+	for (d = 0; d < 15; d++) {
+		render_mf_digit(wave, freqs[r2_mf_pairs[d][0]], freqs[r2_mf_pairs[d][1]]);
+		put("    {   /* %c */\n", r2_mf_tone_codes[d]);
+		for (i = 0; i < R2_MF_TX_PERIOD; i++) {
+			put("%s0x%02X%s", (i % 16) ? " " : "        ", openr2_linear_to_alaw(wave[i]),
+					(i == R2_MF_TX_PERIOD - 1) ? "\n" : ((i % 16 == 15) ? ",\n" : ","));
+		}
+		put("    }%s\n", (d == 14) ? "" : ",");
+	}
+	put("};\n");
+}
+
+/* fac is 2cos(2*pi*f/8000), as the detectors used to work it out */
+static void put_goertzel_descriptors(const char *name, const int freqs[], int count, int samples)
+{
+	int i;
+
+	put("static const openr2_goertzel_descriptor_t %s[%d] =\n{\n", name, count);
+	for (i = 0; i < count; i++) {
+		put("    {");
+		put_float(2.0f * cosf(2.0f * M_PI * ((float)freqs[i] / (float)SAMPLE_RATE)));
+		put(", %d}%s    /* %4dHz */\n", samples, (i == count - 1) ? " " : ",", freqs[i]);
+	}
+	put("};\n");
+}
+
+static void put_dtmf_digit_tones(void)
+{
+	int row, col, i;
+
+	put("static const openr2_tone_gen_descriptor_t dtmf_digit_tones[16] =\n{\n");
+	for (i = 0; i < 16; i++) {
+		row = i / 4;
+		col = i % 4;
+		put("    {   /* %c */\n        {{%d, ", dtmf_positions[i], (int)dds_phase_ratef((float)dtmf_row[row]));
+		put_float(dds_scaling_dbm0f((float)DTMF_TX_LEVEL));
+		put("}, {%d, ", (int)dds_phase_ratef((float)dtmf_col[col]));
+		put_float(dds_scaling_dbm0f((float)DTMF_TX_LEVEL));
+		put("}, {0, 0.0f}, {0, 0.0f}},\n");
+		put("        {%d, %d, 0, 0},\n        0\n    }%s\n",
+				DTMF_TX_ON_TIME * SAMPLE_RATE / 1000, DTMF_TX_OFF_TIME * SAMPLE_RATE / 1000, (i == 15) ? "" : ",");
+	}
+	put("};\n");
+}
+
+/* Put each table in out, and print it or look for it in the source */
+static int tables(const char *source)
+{
+	int failed = 0;
+	int t;
+
+	for (t = 0; t < 9; t++) {
+		out.len = 0;
+		switch (t) {
+		case 0:
+			put_mf_waves("r2_mf_fwd_digit_waves", r2_mf_fwd_frequencies);
+			break;
+		case 1:
+			put_mf_waves("r2_mf_back_digit_waves", r2_mf_back_frequencies);
+			break;
+		case 2:
+			put_mf_alaw_waves("r2_mf_fwd_digit_alaw_waves", r2_mf_fwd_frequencies);
+			break;
+		case 3:
+			put_mf_alaw_waves("r2_mf_back_digit_alaw_waves", r2_mf_back_frequencies);
+			break;
+		case 4:
+			put_goertzel_descriptors("mf_fwd_detect_desc", r2_mf_fwd_frequencies, 6, OR2_MF_RX_BLOCK_SIZE);
+			break;
+		case 5:
+			put_goertzel_descriptors("mf_back_detect_desc", r2_mf_back_frequencies, 6, OR2_MF_RX_BLOCK_SIZE);
+			break;
+		case 6:
+			put_goertzel_descriptors("dtmf_detect_row", dtmf_row, 4, DTMF_BLOCK_SIZE);
+			break;
+		case 7:
+			put_goertzel_descriptors("dtmf_detect_col", dtmf_col, 4, DTMF_BLOCK_SIZE);
+			break;
+		case 8:
+			put_dtmf_digit_tones();
+			break;
+		}
+		if (!source) {
+			printf("%s%s", t ? "\n" : "", out.buf);
+		} else if (!strstr(source, out.buf)) {
+			/* the name is on the first line */
+			printf("table %.*s differs\n", (int)(strchr(out.buf, '\n') - out.buf), out.buf);
+			failed = 1;
+		}
+	}
+	return failed;
+}
+
+static char *read_source(const char *path)
+{
+	FILE *file;
+	char *source;
+	long size;
+
+	if (!(file = fopen(path, "r"))) {
+		fprintf(stderr, "could not open %s\n", path);
+		return NULL;
+	}
+	if (fseek(file, 0, SEEK_END) || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET)) {
+		fprintf(stderr, "could not read %s\n", path);
+		fclose(file);
+		return NULL;
+	}
+	if (!(source = malloc(size + 1))) {
+		fprintf(stderr, "out of memory\n");
+		fclose(file);
+		return NULL;
+	}
+	size = fread(source, 1, size, file);
+	source[size] = '\0';
+	fclose(file);
+	return source;
+}
+
+int main(int argc, char *argv[])
+{
+	char *source = NULL;
+	int failed;
+
+	if (argc == 3 && !strcmp(argv[1], "-c")) {
+		if (!(source = read_source(argv[2]))) {
+			return 1;
+		}
+	} else if (argc != 1) {
+		fprintf(stderr, USAGE, argv[0]);
+		return 1;
+	}
+
+	make_sine_table();
+	failed = tables(source);
+	if (source) {
+		printf("tables %s\n", failed ? "differ, run r2tables to print them again" : "match");
+	}
+	free(source);
+	free(out.buf);
+	return failed;
+}